@@ -101,11 +101,17 @@ ChildFrameQueue RenderThreadManager::PassFramesOnRT() {
 ChildFrameQueue RenderThreadManager::PassUncommittedFrameOnUI() {
   DCHECK(ui_loop_->BelongsToCurrentThread());
   CheckUiCallsAllowed();
-  base::AutoLock lock(lock_);
-  for (auto& frame_ptr : child_frames_)
-    frame_ptr->WaitOnFutureIfNeeded();
   ChildFrameQueue returned_frames;
-  returned_frames.swap(child_frames_);
+  {
+    base::AutoLock lock(lock_);
+    returned_frames.swap(child_frames_);
+  }
+  // The frames are owned by this thread once they leave `child_frames_`, so
+  // wait on their futures without holding `lock_`. Otherwise the render thread
+  // would stall on the lock (e.g. in GetScrollOffsetOnRT) for the duration of
+  // the wait.
+  for (auto& frame_ptr : returned_frames)
+    frame_ptr->WaitOnFutureIfNeeded();
   return returned_frames;
 }
 
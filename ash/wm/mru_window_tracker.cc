@@ -21,6 +21,7 @@
 #include "ash/wm/window_util.h"
 #include "base/containers/adapters.h"
 #include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
 #include "base/memory/raw_ptr.h"
 #include "base/ranges/algorithm.h"
 #include "components/app_restore/window_properties.h"
@@ -189,6 +190,15 @@ MruWindowTracker::WindowList BuildWindowListInternal(
   // TODO(afakhry): Check with UX, if kAllDesks is desired, should we put
   // the active desk's windows at the front?
 
+  // Look up |mru_windows| in a set below, since checking each container child
+  // against the list is quadratic with many windows open, e.g. when entering
+  // overview across several desks.
+  base::flat_set<aura::Window*> mru_window_set;
+  if (mru_windows) {
+    mru_window_set =
+        base::flat_set<aura::Window*>(mru_windows->begin(), mru_windows->end());
+  }
+
   for (aura::Window* root : base::Reversed(roots)) {
     // |wm::kSwitchableWindowContainerIds[]| contains a list of the container
     // IDs sorted such that the ID of the top-most container comes last. Hence,
@@ -203,7 +213,7 @@ MruWindowTracker::WindowList BuildWindowListInternal(
 
         // Only add windows that have not been added previously from
         // |mru_windows| (if available).
-        if (mru_windows && base::Contains(*mru_windows, child))
+        if (base::Contains(mru_window_set, child))
           continue;
 
         windows.emplace_back(child);
@@ -60,13 +60,13 @@
 
 #include "base/allocator/dispatcher/dispatcher.h"
 #include "base/allocator/dispatcher/notification_data.h"
+#include "base/containers/flat_hash_map.h"
 #include "base/containers/flat_map.h"
 #include "base/logging.h"
 #include "base/strings/safe_sprintf.h"
 #include "base/unguessable_token.h"
 #include "base/values.h"
 #include "third_party/abseil-cpp/absl/container/btree_map.h"
-#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
 #include "third_party/abseil-cpp/absl/container/node_hash_map.h"
 
 namespace {
@@ -166,8 +166,8 @@ void Measure(const Inserter& inserter) {
   MeasureOneContainer<std::unordered_map<K, V, Hasher>>(inserter);
   RAW_LOG(INFO, "===== absl::btree_map =====");
   MeasureOneContainer<absl::btree_map<K, V>>(inserter);
-  RAW_LOG(INFO, "===== absl::flat_hash_map =====");
-  MeasureOneContainer<absl::flat_hash_map<K, V, Hasher>>(inserter);
+  RAW_LOG(INFO, "===== base::FlatHashMap (absl::flat_hash_map) =====");
+  MeasureOneContainer<base::FlatHashMap<K, V, Hasher>>(inserter);
   RAW_LOG(INFO, "===== absl::node_hash_map =====");
   MeasureOneContainer<absl::node_hash_map<K, V, Hasher>>(inserter);
 }
@@ -182,6 +182,17 @@ int main() {
     ScopedLogAllocAndFree scoped_logging;
     container.insert({i, 0});
   });
+  // Models maps of IDs that are mutated every frame: once the map holds 1000
+  // elements, each insert also erases the oldest one, so this measures how
+  // much memory erased elements keep around.
+  RAW_LOG(INFO, "int -> int (sliding window of 1000)");
+  Measure<int, int>([](auto& container, size_t i) {
+    ScopedLogAllocAndFree scoped_logging;
+    container.insert({i, 0});
+    if (i > 1000) {
+      container.erase(static_cast<int>(i - 1000));
+    }
+  });
   RAW_LOG(INFO, "int -> void*");
   Measure<int, void*>([](auto& container, size_t i) {
     ScopedLogAllocAndFree scoped_logging;
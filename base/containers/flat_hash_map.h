@@ -0,0 +1,44 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_CONTAINERS_FLAT_HASH_MAP_H_
+#define BASE_CONTAINERS_FLAT_HASH_MAP_H_
+
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_set.h"
+
+namespace base {
+
+// `FlatHashMap` and `FlatHashSet` provide abseil's open-addressing ("Swiss
+// table") hash containers in Chromium. They store their elements inline in a
+// single array with one byte of metadata per slot, which makes them
+// considerably faster and smaller than `std::unordered_map` for large maps
+// that are mutated often, e.g. maps keyed by integer IDs that are updated
+// every frame. Unlike `base::flat_map`, inserts and erases are O(1).
+//
+// See base/containers/README.md for when to prefer other containers. In
+// particular:
+//
+//   * Neither iterators nor references to elements are stable: any insert may
+//     rehash and move all elements. Never keep pointers (raw or `raw_ptr<T>`)
+//     to elements across mutations; store the key instead.
+//   * Iteration order is unspecified, and differs between runs.
+//   * Values themselves follow the usual rules, so pointer-typed values and
+//     keys should be `raw_ptr<T>`. `raw_ptr<T>` keys are hashed through their
+//     `std::hash` specialization.
+//
+// abseil's containers are otherwise disallowed by DEPS, so these aliases are
+// the supported way to use them.
+//
+// The optional trailing template parameters are the hash, key equality and
+// allocator types, as for `absl::flat_hash_map`.
+template <class Key, class Value, class... Args>
+using FlatHashMap = absl::flat_hash_map<Key, Value, Args...>;
+
+template <class Key, class... Args>
+using FlatHashSet = absl::flat_hash_set<Key, Args...>;
+
+}  // namespace base
+
+#endif  // BASE_CONTAINERS_FLAT_HASH_MAP_H_
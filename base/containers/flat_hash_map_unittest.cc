@@ -0,0 +1,49 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/containers/flat_hash_map.h"
+
+#include <string>
+
+#include "base/memory/raw_ptr.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+namespace {
+
+TEST(FlatHashMapTest, IntegerKeysChurn) {
+  // Models a map of IDs where a window of elements is replaced every frame.
+  FlatHashMap<int, std::string> map;
+  constexpr int kWindow = 1000;
+  for (int frame = 0; frame < 20; ++frame) {
+    for (int i = 0; i < kWindow; ++i) {
+      const int id = frame * kWindow + i;
+      map[id] = "node";
+      map.erase(id - kWindow);
+    }
+    EXPECT_EQ(static_cast<size_t>(kWindow), map.size());
+  }
+  EXPECT_FALSE(map.contains(0));
+  EXPECT_TRUE(map.contains(20 * kWindow - 1));
+}
+
+TEST(FlatHashMapTest, RawPtrKeysAndValues) {
+  int a = 1;
+  int b = 2;
+  FlatHashMap<raw_ptr<int>, raw_ptr<int>> map;
+  map[&a] = &b;
+  map[&b] = &a;
+  ASSERT_TRUE(map.contains(&a));
+  EXPECT_EQ(&b, map[&a]);
+  EXPECT_EQ(2u, map.size());
+
+  FlatHashSet<raw_ptr<int>> set;
+  EXPECT_TRUE(set.insert(&a).second);
+  EXPECT_FALSE(set.insert(&a).second);
+  EXPECT_TRUE(set.contains(&a));
+  EXPECT_FALSE(set.contains(&b));
+}
+
+}  // namespace
+}  // namespace base
@@ -0,0 +1,289 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file contains a variant of `base::LRUCache` whose values live in a
+// memory-mapped file instead of on the heap, together with a persisted index
+// of the keys and their recency. Reopening the file restores the cache,
+// including its least-recently-used order, by reading only the index: values
+// stay on disk until they are first accessed. This gives caches such as
+// thumbnail or icon caches warm contents right after a restart.
+//
+// Keys and values are copied into the file as raw bytes, so both must be
+// trivially copyable and must not contain pointers. Keys must also be ordered
+// by `std::less`. The file format is only guaranteed to be compatible with the
+// same build; files that don't match the expected layout are discarded.
+//
+// Opening and accessing the cache may block on disk I/O, so it must be used
+// from a sequence that allows blocking.
+
+#ifndef BASE_CONTAINERS_MMAP_LRU_CACHE_H_
+#define BASE_CONTAINERS_MMAP_LRU_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base/bits.h"
+#include "base/check_op.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/memory/ptr_util.h"
+#include "base/memory/raw_ptr_exclusion.h"
+#include "base/numerics/checked_math.h"
+
+namespace base {
+
+template <class KeyType, class ValueType>
+class MmapLRUCache {
+  static_assert(std::is_trivially_copyable_v<KeyType>,
+                "Keys are persisted as raw bytes");
+  static_assert(std::is_trivially_copyable_v<ValueType>,
+                "Values are persisted as raw bytes");
+
+ public:
+  using key_type = KeyType;
+  using mapped_type = ValueType;
+  using size_type = size_t;
+
+  enum class Mode {
+    // Creates the file if needed, and persists all modifications into it.
+    kReadWrite,
+    // Only reads an existing file. Put() and Erase() are not allowed, and the
+    // recency updates of Get() are not persisted.
+    kReadOnly,
+  };
+
+  // Opens the cache stored at `path`, which holds at most `max_size` values.
+  // In kReadWrite mode, a missing file, or one that was written with a
+  // different `max_size` or layout, is replaced by an empty cache. Returns
+  // null if the file can't be opened or mapped, or in kReadOnly mode if it
+  // doesn't hold a compatible cache.
+  static std::unique_ptr<MmapLRUCache> Open(const FilePath& path,
+                                            size_type max_size,
+                                            Mode mode) {
+    CHECK_GT(max_size, 0u);
+    size_t index_end = 0;
+    if (!(CheckedNumeric<size_t>(max_size) * sizeof(IndexEntry) + kIndexOffset)
+             .AssignIfValid(&index_end)) {
+      return nullptr;
+    }
+    const size_t values_offset = bits::AlignUp(index_end, alignof(ValueType));
+    size_t length = 0;
+    if (!(CheckedNumeric<size_t>(max_size) * sizeof(ValueType) + values_offset)
+             .AssignIfValid(&length)) {
+      return nullptr;
+    }
+
+    const bool read_only = mode == Mode::kReadOnly;
+    File file(path, read_only ? File::FLAG_OPEN | File::FLAG_READ
+                              : File::FLAG_OPEN_ALWAYS | File::FLAG_READ |
+                                    File::FLAG_WRITE);
+    if (!file.IsValid()) {
+      return nullptr;
+    }
+    if (file.GetLength() != static_cast<int64_t>(length)) {
+      // Truncating first makes sure that the whole file is zeroed, which marks
+      // all index entries as free.
+      if (read_only || !file.SetLength(0) ||
+          !file.SetLength(static_cast<int64_t>(length))) {
+        return nullptr;
+      }
+    }
+
+    auto mapped_file = std::make_unique<MemoryMappedFile>();
+    if (!mapped_file->Initialize(std::move(file),
+                                read_only ? MemoryMappedFile::READ_ONLY
+                                          : MemoryMappedFile::READ_WRITE)) {
+      return nullptr;
+    }
+
+    // The mapping is page-aligned, so all the offsets above are aligned too.
+    Header* header = reinterpret_cast<Header*>(mapped_file->data());
+    const Header expected_header = {kMagic, kVersion,
+                                    static_cast<uint32_t>(sizeof(KeyType)),
+                                    static_cast<uint32_t>(sizeof(ValueType)),
+                                    max_size};
+    if (memcmp(header, &expected_header, sizeof(Header)) != 0) {
+      if (read_only) {
+        return nullptr;
+      }
+      memset(mapped_file->data(), 0, mapped_file->length());
+      memcpy(header, &expected_header, sizeof(Header));
+    }
+
+    return WrapUnique(new MmapLRUCache(std::move(mapped_file), values_offset,
+                                       max_size, read_only));
+  }
+
+  MmapLRUCache(const MmapLRUCache&) = delete;
+  MmapLRUCache& operator=(const MmapLRUCache&) = delete;
+  ~MmapLRUCache() = default;
+
+  size_type size() const { return index_.size(); }
+  size_type max_size() const { return max_size_; }
+  bool empty() const { return index_.empty(); }
+
+  // Returns the value of `key` and marks it as the most recently used, or
+  // null if there is none. The value is read-only and stays valid until it
+  // is overwritten, evicted or erased, or the cache is destroyed.
+  const ValueType* Get(const KeyType& key) {
+    auto it = index_.Get(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    if (!read_only_) {
+      index_entries_[it->second].sequence = next_sequence_++;
+    }
+    return &values_[it->second];
+  }
+
+  // As Get(), but doesn't change the recency of `key`.
+  const ValueType* Peek(const KeyType& key) const {
+    auto it = index_.Peek(key);
+    return it == index_.end() ? nullptr : &values_[it->second];
+  }
+
+  // Stores `value` for `key` and marks it as the most recently used. If the
+  // cache is full, the least recently used value is evicted.
+  void Put(const KeyType& key, const ValueType& value) {
+    CHECK(!read_only_);
+    size_t slot;
+    auto it = index_.Peek(key);
+    if (it != index_.end()) {
+      slot = it->second;
+    } else if (!free_slots_.empty()) {
+      slot = free_slots_.back();
+      free_slots_.pop_back();
+    } else {
+      auto oldest = index_.rbegin();
+      slot = oldest->second;
+      index_.Erase(oldest);
+    }
+
+    // The value is written before the index entry, so that a crash in
+    // between leaves the previous key pointing to a new value rather than
+    // the new key pointing to a stale one. Callers that can't tolerate that
+    // should validate values on Get().
+    memcpy(&values_[slot], &value, sizeof(ValueType));
+    IndexEntry& entry = index_entries_[slot];
+    entry.key = key;
+    entry.sequence = next_sequence_++;
+    index_.Put(key, slot);
+  }
+
+  // Removes `key` from the cache. Returns whether it was present.
+  bool Erase(const KeyType& key) {
+    CHECK(!read_only_);
+    auto it = index_.Peek(key);
+    if (it == index_.end()) {
+      return false;
+    }
+    FreeSlot(it->second);
+    index_.Erase(it);
+    return true;
+  }
+
+ private:
+  static constexpr uint32_t kMagic = 0x4D4C5255;  // "MLRU"
+  static constexpr uint32_t kVersion = 1;
+
+  // Describes the layout of the file, so that files written with a different
+  // layout are discarded.
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t key_size;
+    uint32_t value_size;
+    uint64_t max_size;
+  };
+
+  // One per value slot. A `sequence` of 0 marks a free slot; otherwise it
+  // orders the slots from least to most recently used.
+  struct IndexEntry {
+    KeyType key;
+    uint64_t sequence;
+  };
+
+  static constexpr size_t kIndexOffset =
+      bits::AlignUp(sizeof(Header), alignof(IndexEntry));
+
+  MmapLRUCache(std::unique_ptr<MemoryMappedFile> mapped_file,
+               size_t values_offset,
+               size_type max_size,
+               bool read_only)
+      : mapped_file_(std::move(mapped_file)),
+        index_entries_(
+            reinterpret_cast<IndexEntry*>(mapped_file_->data() + kIndexOffset)),
+        values_(reinterpret_cast<ValueType*>(mapped_file_->data() +
+                                             values_offset)),
+        max_size_(max_size),
+        read_only_(read_only),
+        index_(decltype(index_)::NO_AUTO_EVICT) {
+    LoadIndex();
+  }
+
+  // Rebuilds the in-memory index from the persisted one, oldest first, so
+  // that the least-recently-used order is restored.
+  void LoadIndex() {
+    std::vector<std::pair<uint64_t, size_t>> used_slots;
+    for (size_t slot = 0; slot < max_size_; ++slot) {
+      if (index_entries_[slot].sequence == 0) {
+        free_slots_.push_back(slot);
+      } else {
+        used_slots.emplace_back(index_entries_[slot].sequence, slot);
+      }
+    }
+    std::sort(used_slots.begin(), used_slots.end());
+
+    for (const auto& [sequence, slot] : used_slots) {
+      const KeyType& key = index_entries_[slot].key;
+      // A key can only be present twice if the file was corrupted; keep the
+      // most recent value.
+      auto it = index_.Peek(key);
+      if (it != index_.end()) {
+        if (!read_only_) {
+          FreeSlot(it->second);
+        }
+        index_.Erase(it);
+      }
+      index_.Put(key, slot);
+      next_sequence_ = sequence + 1;
+    }
+  }
+
+  void FreeSlot(size_t slot) {
+    index_entries_[slot].sequence = 0;
+    free_slots_.push_back(slot);
+  }
+
+  const std::unique_ptr<MemoryMappedFile> mapped_file_;
+
+  // RAW_PTR_EXCLUSION: Point into `mapped_file_`, which is never allocated by
+  // PartitionAlloc.
+  RAW_PTR_EXCLUSION IndexEntry* const index_entries_;
+  RAW_PTR_EXCLUSION ValueType* const values_;
+
+  const size_type max_size_;
+  const bool read_only_;
+
+  // Maps each key to its slot, in the order of recency.
+  LRUCache<KeyType, size_t> index_;
+
+  // The slots which hold no value.
+  std::vector<size_t> free_slots_;
+
+  uint64_t next_sequence_ = 1;
+};
+
+}  // namespace base
+
+#endif  // BASE_CONTAINERS_MMAP_LRU_CACHE_H_
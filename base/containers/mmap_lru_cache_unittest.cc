@@ -0,0 +1,186 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/containers/mmap_lru_cache.h"
+
+#include <stdint.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+struct Thumbnail {
+  int32_t width;
+  int32_t height;
+  std::array<uint8_t, 64> pixels;
+};
+
+Thumbnail MakeThumbnail(int32_t width) {
+  Thumbnail thumbnail = {};
+  thumbnail.width = width;
+  thumbnail.height = width * 2;
+  thumbnail.pixels.fill(static_cast<uint8_t>(width));
+  return thumbnail;
+}
+
+using Cache = MmapLRUCache<uint64_t, Thumbnail>;
+
+class MmapLRUCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().AppendASCII("cache");
+  }
+
+  std::unique_ptr<Cache> Open(size_t max_size,
+                              Cache::Mode mode = Cache::Mode::kReadWrite) {
+    return Cache::Open(path_, max_size, mode);
+  }
+
+  const FilePath& path() const { return path_; }
+
+ private:
+  ScopedTempDir temp_dir_;
+  FilePath path_;
+};
+
+}  // namespace
+
+TEST_F(MmapLRUCacheTest, PutAndGet) {
+  std::unique_ptr<Cache> cache = Open(3);
+  ASSERT_TRUE(cache);
+  EXPECT_TRUE(cache->empty());
+  EXPECT_EQ(3u, cache->max_size());
+  EXPECT_FALSE(cache->Get(1));
+
+  cache->Put(1, MakeThumbnail(10));
+  cache->Put(2, MakeThumbnail(20));
+  EXPECT_EQ(2u, cache->size());
+  ASSERT_TRUE(cache->Get(1));
+  EXPECT_EQ(10, cache->Get(1)->width);
+  EXPECT_EQ(40, cache->Peek(2)->height);
+
+  // Overwriting a key keeps its slot.
+  cache->Put(1, MakeThumbnail(11));
+  EXPECT_EQ(2u, cache->size());
+  EXPECT_EQ(11, cache->Get(1)->pixels[5]);
+
+  EXPECT_TRUE(cache->Erase(1));
+  EXPECT_FALSE(cache->Erase(1));
+  EXPECT_FALSE(cache->Get(1));
+  EXPECT_EQ(1u, cache->size());
+}
+
+TEST_F(MmapLRUCacheTest, EvictsLeastRecentlyUsed) {
+  std::unique_ptr<Cache> cache = Open(3);
+  ASSERT_TRUE(cache);
+  cache->Put(1, MakeThumbnail(1));
+  cache->Put(2, MakeThumbnail(2));
+  cache->Put(3, MakeThumbnail(3));
+
+  // Get() makes 1 the most recent, but Peek() doesn't affect 2.
+  EXPECT_TRUE(cache->Get(1));
+  EXPECT_TRUE(cache->Peek(2));
+  cache->Put(4, MakeThumbnail(4));
+  EXPECT_EQ(3u, cache->size());
+  EXPECT_FALSE(cache->Peek(2));
+  EXPECT_EQ(4, cache->Peek(4)->width);
+
+  cache->Put(5, MakeThumbnail(5));
+  EXPECT_FALSE(cache->Peek(3));
+  EXPECT_TRUE(cache->Peek(1));
+}
+
+TEST_F(MmapLRUCacheTest, ReopenRestoresContentsAndOrder) {
+  {
+    std::unique_ptr<Cache> cache = Open(3);
+    ASSERT_TRUE(cache);
+    cache->Put(1, MakeThumbnail(1));
+    cache->Put(2, MakeThumbnail(2));
+    cache->Put(3, MakeThumbnail(3));
+    cache->Erase(3);
+    cache->Put(4, MakeThumbnail(4));
+    EXPECT_TRUE(cache->Get(1));
+  }
+
+  std::unique_ptr<Cache> cache = Open(3);
+  ASSERT_TRUE(cache);
+  EXPECT_EQ(3u, cache->size());
+  EXPECT_FALSE(cache->Peek(3));
+  EXPECT_EQ(4, cache->Peek(4)->width);
+
+  // 2 is the least recently used, then 4.
+  cache->Put(5, MakeThumbnail(5));
+  EXPECT_FALSE(cache->Peek(2));
+  cache->Put(6, MakeThumbnail(6));
+  EXPECT_FALSE(cache->Peek(4));
+  EXPECT_EQ(1, cache->Peek(1)->pixels[0]);
+}
+
+TEST_F(MmapLRUCacheTest, ReadOnly) {
+  // There is nothing to read yet.
+  EXPECT_FALSE(Open(2, Cache::Mode::kReadOnly));
+  EXPECT_FALSE(PathExists(path()));
+
+  {
+    std::unique_ptr<Cache> cache = Open(2);
+    ASSERT_TRUE(cache);
+    cache->Put(1, MakeThumbnail(1));
+    cache->Put(2, MakeThumbnail(2));
+  }
+
+  // A different size doesn't match the file.
+  EXPECT_FALSE(Open(3, Cache::Mode::kReadOnly));
+
+  {
+    std::unique_ptr<Cache> cache = Open(2, Cache::Mode::kReadOnly);
+    ASSERT_TRUE(cache);
+    EXPECT_EQ(2u, cache->size());
+    EXPECT_EQ(2, cache->Get(2)->width);
+    EXPECT_EQ(1, cache->Get(1)->width);
+  }
+
+  // The recency updates of the read-only cache weren't persisted, so 1 is
+  // still the least recently used.
+  std::unique_ptr<Cache> cache = Open(2);
+  ASSERT_TRUE(cache);
+  cache->Put(3, MakeThumbnail(3));
+  EXPECT_FALSE(cache->Peek(1));
+  EXPECT_TRUE(cache->Peek(2));
+}
+
+TEST_F(MmapLRUCacheTest, IncompatibleFileIsDiscarded) {
+  {
+    std::unique_ptr<Cache> cache = Open(2);
+    ASSERT_TRUE(cache);
+    cache->Put(1, MakeThumbnail(1));
+  }
+
+  // A different size discards the contents.
+  {
+    std::unique_ptr<Cache> cache = Open(4);
+    ASSERT_TRUE(cache);
+    EXPECT_TRUE(cache->empty());
+    cache->Put(1, MakeThumbnail(1));
+  }
+
+  // So does a file that doesn't hold a cache at all, even with the right size.
+  int64_t length = 0;
+  ASSERT_TRUE(GetFileSize(path(), &length));
+  ASSERT_TRUE(WriteFile(path(), std::string(static_cast<size_t>(length), 'x')));
+  std::unique_ptr<Cache> cache = Open(4);
+  ASSERT_TRUE(cache);
+  EXPECT_TRUE(cache->empty());
+}
+
+}  // namespace base
@@ -215,6 +215,17 @@ FilePath FileEnumerator::Next() {
         continue;
       }
 
+      // When the file system reports the entry as a plain file or directory,
+      // that is what both stat() and lstat() would say too. Skip the stat call
+      // for entries which would neither be returned nor traversed.
+      if (dent->d_type == DT_REG || dent->d_type == DT_DIR) {
+        const bool is_dir = dent->d_type == DT_DIR;
+        if (!(recursive_ && is_dir) &&
+            !(is_pattern_matched && IsTypeMatched(is_dir))) {
+          continue;
+        }
+      }
+
       const FilePath full_path = root_path_.Append(info.filename_);
       GetStat(full_path, ShouldShowSymLinks(file_type_), &info.stat_);
 
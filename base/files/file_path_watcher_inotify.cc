@@ -705,7 +705,8 @@ bool FilePathWatcherImpl::UpdateRecursiveWatches(
 
   // Check to see if this is a forced update or if some component of |target_|
   // has changed. For these cases, redo the watches for |target_| and below.
-  if (!Contains(recursive_paths_by_watch_, fired_watch) &&
+  auto fired_it = recursive_paths_by_watch_.find(fired_watch);
+  if (fired_it == recursive_paths_by_watch_.end() &&
       fired_watch != watches_.back().watch) {
     return UpdateRecursiveWatchesForPath(target_);
   }
@@ -714,9 +715,8 @@ bool FilePathWatcherImpl::UpdateRecursiveWatches(
   if (!is_dir)
     return true;
 
-  const FilePath& changed_dir = Contains(recursive_paths_by_watch_, fired_watch)
-                                    ? recursive_paths_by_watch_[fired_watch]
-                                    : target_;
+  const FilePath& changed_dir =
+      fired_it != recursive_paths_by_watch_.end() ? fired_it->second : target_;
 
   auto start_it = recursive_watches_by_path_.upper_bound(changed_dir);
   auto end_it = start_it;
@@ -771,7 +771,8 @@ bool FilePathWatcherImpl::UpdateRecursiveWatchesForPath(const FilePath& path) {
 
     // Check `recursive_watches_by_path_` as a heuristic to determine if this
     // needs to be an add or update operation.
-    if (!Contains(recursive_watches_by_path_, current)) {
+    auto existing_it = recursive_watches_by_path_.find(current);
+    if (existing_it == recursive_watches_by_path_.end()) {
       // Try to add new watches.
       InotifyReader::Watch watch =
           g_inotify_reader.Get().AddWatch(current, this);
@@ -788,7 +789,7 @@ bool FilePathWatcherImpl::UpdateRecursiveWatchesForPath(const FilePath& path) {
       TrackWatchForRecursion(watch, current);
     } else {
       // Update existing watches.
-      InotifyReader::Watch old_watch = recursive_watches_by_path_[current];
+      InotifyReader::Watch old_watch = existing_it->second;
       DUMP_WILL_BE_CHECK_NE(InotifyReader::kInvalidWatch, old_watch);
       InotifyReader::Watch watch =
           g_inotify_reader.Get().AddWatch(current, this);
@@ -797,7 +798,7 @@ bool FilePathWatcherImpl::UpdateRecursiveWatchesForPath(const FilePath& path) {
       if (watch != old_watch) {
         g_inotify_reader.Get().RemoveWatch(old_watch, this);
         recursive_paths_by_watch_.erase(old_watch);
-        recursive_watches_by_path_.erase(current);
+        recursive_watches_by_path_.erase(existing_it);
         TrackWatchForRecursion(watch, current);
       }
     }
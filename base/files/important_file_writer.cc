@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "base/check.h"
+#include "base/containers/span.h"
 #include "base/critical_closure.h"
 #include "base/debug/alias.h"
 #include "base/files/file.h"
@@ -119,7 +120,9 @@ void ImportantFileWriter::ProduceAndWriteStringToFileAtomically(
     BackgroundDataProducerCallback data_producer_for_background_sequence,
     OnceClosure before_write_callback,
     OnceCallback<void(bool success)> after_write_callback,
-    const std::string& histogram_suffix) {
+    const std::string& histogram_suffix,
+    scoped_refptr<RefCountedData<std::optional<SHA1Digest>>>
+        last_written_digest) {
   // Produce the actual data string on the background sequence.
   std::optional<std::string> data =
       std::move(data_producer_for_background_sequence).Run();
@@ -131,11 +134,25 @@ void ImportantFileWriter::ProduceAndWriteStringToFileAtomically(
   if (!before_write_callback.is_null())
     std::move(before_write_callback).Run();
 
-  // Calling the impl by way of the private
-  // ProduceAndWriteStringToFileAtomically, which originated from an
-  // ImportantFileWriter instance, so |from_instance| is true.
-  const bool result = WriteFileAtomicallyImpl(path, *data, histogram_suffix,
-                                              /*from_instance=*/true);
+  std::optional<SHA1Digest> digest;
+  if (last_written_digest) {
+    digest = SHA1HashSpan(as_bytes(make_span(*data)));
+  }
+
+  bool result;
+  if (digest && digest == last_written_digest->data) {
+    result = true;
+  } else {
+    // Calling the impl by way of the private
+    // ProduceAndWriteStringToFileAtomically, which originated from an
+    // ImportantFileWriter instance, so |from_instance| is true.
+    result = WriteFileAtomicallyImpl(path, *data, histogram_suffix,
+                                     /*from_instance=*/true);
+    if (last_written_digest) {
+      // After a failed write, the file's contents are unknown.
+      last_written_digest->data = result ? digest : std::nullopt;
+    }
+  }
 
   if (!after_write_callback.is_null())
     std::move(after_write_callback).Run(result);
@@ -322,7 +339,8 @@ void ImportantFileWriter::WriteNowWithBackgroundDataProducer(
       BindOnce(&ProduceAndWriteStringToFileAtomically, path_,
                std::move(background_data_producer),
                std::move(before_next_write_callback_),
-               std::move(after_next_write_callback_), histogram_suffix_));
+               std::move(after_next_write_callback_), histogram_suffix_,
+               last_written_digest_));
 
   if (!task_runner_->PostTask(
           FROM_HERE, MakeCriticalClosure("ImportantFileWriter::WriteNow",
@@ -417,6 +435,15 @@ void ImportantFileWriter::ClearPendingWrite() {
   serializer_.emplace<absl::monostate>();
 }
 
+void ImportantFileWriter::set_skip_unchanged_writes(
+    bool skip_unchanged_writes) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  last_written_digest_ =
+      skip_unchanged_writes
+          ? MakeRefCounted<RefCountedData<std::optional<SHA1Digest>>>()
+          : nullptr;
+}
+
 void ImportantFileWriter::SetTimerForTesting(OneShotTimer* timer_override) {
   timer_override_ = timer_override;
 }
@@ -12,6 +12,8 @@
 #include "base/base_export.h"
 #include "base/files/file_path.h"
 #include "base/functional/callback.h"
+#include "base/hash/sha1.h"
+#include "base/memory/ref_counted.h"
 #include "base/memory/raw_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/strings/string_piece.h"
@@ -143,6 +145,12 @@ class BASE_EXPORT ImportantFileWriter {
     return commit_interval_;
   }
 
+  // If set, a write whose data has the same digest as this writer's previous
+  // successful write is skipped, together with its flush, and reported as
+  // successful. Only use this if nothing else writes to |path|, e.g. for files
+  // that get reserialized unchanged often.
+  void set_skip_unchanged_writes(bool skip_unchanged_writes);
+
   // Overrides the timer to use for scheduling writes with |timer_override|.
   void SetTimerForTesting(OneShotTimer* timer_override);
 
@@ -166,12 +174,16 @@ class BASE_EXPORT ImportantFileWriter {
 
   // Helper function to call WriteFileAtomically() with a promise-like callback
   // producing a std::string.
+  // If |last_written_digest| isn't null, it's used to skip writing the same
+  // data again, and is updated after each write.
   static void ProduceAndWriteStringToFileAtomically(
       const FilePath& path,
       BackgroundDataProducerCallback data_producer_for_background_sequence,
       OnceClosure before_write_callback,
       OnceCallback<void(bool success)> after_write_callback,
-      const std::string& histogram_suffix);
+      const std::string& histogram_suffix,
+      scoped_refptr<RefCountedData<std::optional<SHA1Digest>>>
+          last_written_digest);
 
   // Writes |data| to |path|, recording histograms with an optional
   // |histogram_suffix|. |from_instance| indicates whether the call originates
@@ -216,6 +228,10 @@ class BASE_EXPORT ImportantFileWriter {
   // scheduled writes.
   size_t previous_data_size_ = 0;
 
+  // Digest of the last data written, if set_skip_unchanged_writes() was set.
+  // Only used on |task_runner_|.
+  scoped_refptr<RefCountedData<std::optional<SHA1Digest>>> last_written_digest_;
+
   SEQUENCE_CHECKER(sequence_checker_);
 
   WeakPtrFactory<ImportantFileWriter> weak_factory_{this};
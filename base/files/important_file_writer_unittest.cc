@@ -209,6 +209,30 @@ TEST_F(ImportantFileWriterTest, WriteWithObserver) {
   EXPECT_EQ("baz", GetFileContent(writer.path()));
 }
 
+TEST_F(ImportantFileWriterTest, SkipUnchangedWrites) {
+  ImportantFileWriter writer(file_,
+                             SingleThreadTaskRunner::GetCurrentDefault());
+  writer.set_skip_unchanged_writes(true);
+  writer.WriteNow("foo");
+  RunLoop().RunUntilIdle();
+  EXPECT_EQ("foo", GetFileContent(writer.path()));
+
+  // Change the file behind the writer's back, to tell whether it gets
+  // rewritten. Writing the same data again is skipped, but still reported as
+  // a successful write.
+  ASSERT_TRUE(WriteFile(writer.path(), "bar"));
+  write_callback_observer_.ObserveNextWriteCallbacks(&writer);
+  writer.WriteNow("foo");
+  RunLoop().RunUntilIdle();
+  EXPECT_EQ(CALLED_WITH_SUCCESS,
+            write_callback_observer_.GetAndResetObservationState());
+  EXPECT_EQ("bar", GetFileContent(writer.path()));
+
+  writer.WriteNow("baz");
+  RunLoop().RunUntilIdle();
+  EXPECT_EQ("baz", GetFileContent(writer.path()));
+}
+
 TEST_F(ImportantFileWriterTest, FailedWriteWithObserver) {
   // Use an invalid file path (relative paths are invalid) to get a
   // FILE_ERROR_ACCESS_DENIED error when trying to write the file.
@@ -29,6 +29,10 @@ void FastHash(base::span<const uint8_t> data) {
   base::FastHash(data);
 }
 
+void PersistentHash(base::span<const uint8_t> data) {
+  base::PersistentHash(data);
+}
+
 void RunTest(const char* hash_name,
              void (*hash)(base::span<const uint8_t>),
              const size_t len) {
@@ -95,4 +99,19 @@ TEST(HashPerfTest, Speed) {
   }
 }
 
+// Most FastHash() and PersistentHash() callers hash short keys, so also cover
+// sizes that fit in a few cache lines.
+TEST(HashPerfTest, SmallBufferSpeed) {
+  for (size_t len : {16U, 64U, 256U, 1024U}) {
+    RunTest("FastHash.", FastHash, len);
+    RunTest("PersistentHash.", PersistentHash, len);
+  }
+}
+
+TEST(PersistentHashPerfTest, Speed) {
+  for (int shift : {1, 5, 6, 7}) {
+    RunTest("PersistentHash.", PersistentHash, 1024 * 1024U >> shift);
+  }
+}
+
 }  // namespace base
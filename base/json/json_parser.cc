@@ -4,6 +4,9 @@
 
 #include "base/json/json_parser.h"
 
+#include <stdint.h>
+#include <string.h>
+
 #include <cmath>
 #include <iterator>
 #include <string_view>
@@ -78,6 +81,39 @@ bool UnprefixedHexStringToInt(std::string_view input, int* output) {
   return HexStringToInt(input, output);
 }
 
+// Returns the number of leading characters of |input| that a string can hold
+// as they are: printable ASCII other than '"' and '\\'. Everything else needs
+// the checks in ConsumeStringRaw(). The input is scanned a word at a time,
+// using the usual bit tricks to find a byte that is zero or below a bound.
+size_t CountPlainStringChars(std::string_view input) {
+  constexpr uint64_t kOnes = 0x0101010101010101u;
+  constexpr uint64_t kHighBits = 0x8080808080808080u;
+  size_t count = 0;
+  while (input.length() - count >= sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, input.data() + count, sizeof(word));
+    const uint64_t quotes = word ^ (kOnes * '"');
+    const uint64_t backslashes = word ^ (kOnes * '\\');
+    // The high bit of a byte of |special| is set for a control character, a
+    // '"', a '\\' or a non-ASCII byte. Bytes can only be flagged spuriously
+    // after one that really is special, so the word is plain if none is set.
+    const uint64_t special = ((word - kOnes * 0x20) & ~word) |
+                             ((quotes - kOnes) & ~quotes) |
+                             ((backslashes - kOnes) & ~backslashes) | word;
+    if (special & kHighBits) {
+      break;
+    }
+    count += sizeof(uint64_t);
+  }
+  for (; count < input.length(); ++count) {
+    const unsigned char c = static_cast<unsigned char>(input[count]);
+    if (c < 0x20 || c >= kExtendedASCIIStart || c == '"' || c == '\\') {
+      break;
+    }
+  }
+  return count;
+}
+
 // These values are persisted to logs. Entries should not be renumbered and
 // numeric values should never be reused.
 enum class ChromiumJsonExtension {
@@ -148,6 +184,10 @@ std::optional<Value> JSONParser::Parse(std::string_view input) {
   error_line_ = 0;
   error_column_ = 0;
 
+  // A previous parse that failed may have left entries behind.
+  dict_entries_.clear();
+  list_items_.clear();
+
   // When the input JSON string starts with a UTF-8 Byte-Order-Mark,
   // advance the start position to avoid the ParseNextToken function mis-
   // treating a Unicode BOM as an invalid character and returning NULL.
@@ -216,6 +256,15 @@ void JSONParser::StringBuilder::Append(base_icu::UChar32 point) {
   }
 }
 
+void JSONParser::StringBuilder::AppendASCIIRun(std::string_view run) {
+  if (!string_) {
+    DCHECK_EQ(run.data(), pos_ + length_);
+    length_ += run.length();
+  } else {
+    string_->append(run);
+  }
+}
+
 void JSONParser::StringBuilder::Convert() {
   if (string_)
     return;
@@ -420,7 +469,7 @@ std::optional<Value> JSONParser::ConsumeDictionary() {
     return std::nullopt;
   }
 
-  std::vector<std::pair<std::string, Value>> values;
+  const size_t first_entry = dict_entries_.size();
 
   Token token = GetNextToken();
   while (token != T_OBJECT_END) {
@@ -450,7 +499,7 @@ std::optional<Value> JSONParser::ConsumeDictionary() {
       return std::nullopt;
     }
 
-    values.emplace_back(key.DestructiveAsString(), std::move(*value));
+    dict_entries_.emplace_back(key.DestructiveAsString(), std::move(*value));
 
     token = GetNextToken();
     if (token == T_LIST_SEPARATOR) {
@@ -467,11 +516,14 @@ std::optional<Value> JSONParser::ConsumeDictionary() {
   }
 
   ConsumeChar();  // Closing '}'.
-  // Reverse |dict_storage| to keep the last of elements with the same key in
-  // the input.
-  ranges::reverse(values);
-  return Value(Value::Dict(std::make_move_iterator(values.begin()),
-                           std::make_move_iterator(values.end())));
+  auto entries_begin = dict_entries_.begin() + first_entry;
+  // Reverse the entries to keep the last of elements with the same key in the
+  // input.
+  ranges::reverse(entries_begin, dict_entries_.end());
+  Value::Dict dict(std::make_move_iterator(entries_begin),
+                   std::make_move_iterator(dict_entries_.end()));
+  dict_entries_.erase(entries_begin, dict_entries_.end());
+  return Value(std::move(dict));
 }
 
 std::optional<Value> JSONParser::ConsumeList() {
@@ -486,7 +538,7 @@ std::optional<Value> JSONParser::ConsumeList() {
     return std::nullopt;
   }
 
-  Value::List list;
+  const size_t first_item = list_items_.size();
 
   Token token = GetNextToken();
   while (token != T_ARRAY_END) {
@@ -496,7 +548,7 @@ std::optional<Value> JSONParser::ConsumeList() {
       return std::nullopt;
     }
 
-    list.Append(std::move(*item));
+    list_items_.push_back(std::move(*item));
 
     token = GetNextToken();
     if (token == T_LIST_SEPARATOR) {
@@ -514,6 +566,13 @@ std::optional<Value> JSONParser::ConsumeList() {
 
   ConsumeChar();  // Closing ']'.
 
+  Value::List list;
+  list.reserve(list_items_.size() - first_item);
+  auto items_begin = list_items_.begin() + first_item;
+  for (auto it = items_begin; it != list_items_.end(); ++it) {
+    list.Append(std::move(*it));
+  }
+  list_items_.erase(items_begin, list_items_.end());
   return Value(std::move(list));
 }
 
@@ -536,6 +595,17 @@ bool JSONParser::ConsumeStringRaw(StringBuilder* out) {
   StringBuilder string(pos());
 
   while (std::optional<char> c = PeekChar()) {
+    // Most of a string is usually made of characters that are copied as they
+    // are, so runs of them are consumed in bulk without going through the
+    // checks below.
+    const std::string_view rest(input_.data() + index_,
+                                input_.length() - index_);
+    if (size_t run_length = CountPlainStringChars(rest)) {
+      string.AppendASCIIRun(rest.substr(0, run_length));
+      index_ += run_length;
+      continue;
+    }
+
     base_icu::UChar32 next_char = 0;
     if (static_cast<unsigned char>(*c) < kExtendedASCIIStart) {
       // Fast path for ASCII.
@@ -12,6 +12,8 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "base/base_export.h"
 #include "base/compiler_specific.h"
@@ -136,6 +138,10 @@ class BASE_EXPORT JSONParser {
     // converted, or by appending the UTF8 bytes for the code point.
     void Append(base_icu::UChar32 point);
 
+    // Appends |run|, which must be printable ASCII and, if the string has not
+    // been converted, must directly follow the bytes built so far.
+    void AppendASCIIRun(std::string_view run);
+
     // Converts the builder from its default std::string_view to a full
     // std::string, performing a copy. Once a builder is converted, it cannot be
     // made a std::string_view again.
@@ -257,6 +263,15 @@ class BASE_EXPORT JSONParser {
   // The number of times the parser has recursed (current stack depth).
   size_t stack_depth_;
 
+  // Scratch stacks that the entries of the dictionaries and lists being parsed
+  // are collected on, the innermost container's at the top. Once a container
+  // is complete its entries are moved into a right-sized Value::Dict or
+  // Value::List and popped, so each container allocates once instead of
+  // growing as it is parsed, and the scratch memory is reused for the whole
+  // document.
+  std::vector<std::pair<std::string, Value>> dict_entries_;
+  std::vector<Value> list_items_;
+
   // The line number that the parser is at currently.
   int line_number_;
 
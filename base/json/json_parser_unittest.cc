@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 
 #include "base/json/json_reader.h"
 #include "base/memory/ptr_util.h"
@@ -339,5 +340,88 @@ TEST_F(JSONParserTest, ErrorMessages) {
   }
 }
 
+// Containers are built from shared scratch stacks, so nesting must not mix up
+// their entries.
+TEST_F(JSONParserTest, NestedContainers) {
+  JSONParser parser(JSON_PARSE_RFC);
+  std::optional<Value> value = parser.Parse(
+      R"({"a": [1, {"b": [2, 3], "b": [4]}, [], 5], "c": {}, "a": [6, 7]})");
+  ASSERT_TRUE(value);
+  EXPECT_EQ(*value, JSONReader::Read(R"({"a": [6, 7], "c": {}})"));
+
+  value = parser.Parse(R"([1, {"a": [2, {"b": 3}], "c": 4}, [5, [6]], 7])");
+  ASSERT_TRUE(value);
+  const Value::List& list = value->GetList();
+  ASSERT_EQ(list.size(), 4u);
+  EXPECT_EQ(list[0], Value(1));
+  EXPECT_EQ(*list[1].GetDict().Find("c"), Value(4));
+  EXPECT_EQ(list[1].GetDict().FindList("a")->size(), 2u);
+  EXPECT_EQ(list[2].GetList().size(), 2u);
+  EXPECT_EQ(list[3], Value(7));
+
+  // A failed parse leaves no entries behind for the next one.
+  EXPECT_FALSE(parser.Parse(R"({"a": [1, 2, {"b": 3)"));
+  value = parser.Parse(R"({"d": [8]})");
+  ASSERT_TRUE(value);
+  EXPECT_EQ(*value, JSONReader::Read(R"({"d": [8]})"));
+}
+
+// Strings are consumed in runs of plain characters, a word at a time. Put
+// characters that need special handling at every offset within a word, and
+// make sure they are still handled.
+TEST_F(JSONParserTest, SpecialCharactersAtEveryOffset) {
+  for (size_t offset = 0; offset < 20; ++offset) {
+    const std::string prefix(offset, 'a');
+    const std::string suffix(11, 'b');
+    SCOPED_TRACE(offset);
+
+    {
+      JSONParser parser(JSON_PARSE_RFC);
+      std::optional<Value> value =
+          parser.Parse("\"" + prefix + "\\n\\u00e9\xC3\xA9" + suffix + "\"");
+      ASSERT_TRUE(value);
+      EXPECT_EQ(prefix + "\n\xC3\xA9\xC3\xA9" + suffix, value->GetString());
+    }
+    {
+      JSONParser parser(JSON_PARSE_RFC);
+      std::optional<Value> value =
+          parser.Parse("\"" + prefix + "\"" + suffix + "\"");
+      EXPECT_FALSE(value);
+      EXPECT_EQ(JSONParser::JSON_UNEXPECTED_DATA_AFTER_ROOT,
+                parser.error_code());
+    }
+    {
+      JSONParser parser(JSON_PARSE_RFC);
+      std::optional<Value> value =
+          parser.Parse("\"" + prefix + "\t" + suffix + "\"");
+      EXPECT_FALSE(value);
+      EXPECT_EQ(
+          JSONParser::FormatErrorMessage(1, static_cast<int>(offset) + 1,
+                                         JSONParser::kUnsupportedEncoding),
+          parser.GetErrorMessage());
+    }
+    {
+      JSONParser parser(JSON_ALLOW_CONTROL_CHARS);
+      std::optional<Value> value =
+          parser.Parse("\"" + prefix + "\t\n" + suffix + "\"");
+      ASSERT_TRUE(value);
+      EXPECT_EQ(prefix + "\t\n" + suffix, value->GetString());
+    }
+    {
+      JSONParser parser(JSON_REPLACE_INVALID_CHARACTERS);
+      std::optional<Value> value =
+          parser.Parse("\"" + prefix + "\xFF" + suffix + "\"");
+      ASSERT_TRUE(value);
+      EXPECT_EQ(prefix + "\xEF\xBF\xBD" + suffix, value->GetString());
+    }
+    {
+      // Unterminated.
+      JSONParser parser(JSON_PARSE_RFC);
+      EXPECT_FALSE(parser.Parse("\"" + prefix + suffix));
+      EXPECT_EQ(JSONParser::JSON_SYNTAX_ERROR, parser.error_code());
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace base
@@ -2,6 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
 #include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/memory/ptr_util.h"
@@ -19,6 +25,8 @@ namespace {
 constexpr char kMetricPrefixJSON[] = "JSON.";
 constexpr char kMetricReadTime[] = "read_time";
 constexpr char kMetricWriteTime[] = "write_time";
+constexpr char kMetricReadThroughput[] = "read_throughput";
+constexpr char kMetricPeakBufferSize[] = "peak_buffer_size";
 
 perf_test::PerfResultReporter SetUpReporter(const std::string& story_name) {
   perf_test::PerfResultReporter reporter(kMetricPrefixJSON, story_name);
@@ -61,6 +69,31 @@ Value::Dict GenerateLayeredDict(int breadth, int depth) {
   return root;
 }
 
+// Generates about |size| bytes of JSON made of long strings, in the style of
+// large preference files and extension manifests. With |pretty_print| the
+// output is indented, which adds whitespace between the tokens.
+std::string GenerateStringHeavyJSON(size_t size, bool pretty_print) {
+  Value::List list;
+  std::string json;
+  for (int i = 0; json.size() < size; ++i) {
+    Value::Dict entry;
+    entry.Set("id", "entry_" + base::NumberToString(i));
+    entry.Set("url", "https://www.example.com/some/fairly/long/path/to/" +
+                         base::NumberToString(i) + "/index.html?query=value");
+    entry.Set("description",
+              std::string("A description long enough to span many words, with "
+                          "an \"escaped quote\", a tab\t and \u00e9 in it."));
+    list.Append(std::move(entry));
+    if (i % 1000 == 999) {
+      // Check the size every so often, writing is not free either.
+      json.clear();
+      JSONWriter::WriteWithOptions(
+          list, pretty_print ? JSONWriter::OPTIONS_PRETTY_PRINT : 0, &json);
+    }
+  }
+  return json;
+}
+
 }  // namespace
 
 class JSONPerfTest : public testing::Test {
@@ -83,6 +116,22 @@ class JSONPerfTest : public testing::Test {
     TimeTicks end_read = TimeTicks::Now();
     reporter.AddResult(kMetricReadTime, end_read - start_read);
   }
+
+  void TestLargeRead(const std::string& story, bool pretty_print) {
+    constexpr size_t kSize = 8 * 1024 * 1024;
+    std::string json = GenerateStringHeavyJSON(kSize, pretty_print);
+
+    perf_test::PerfResultReporter reporter(kMetricPrefixJSON, story);
+    reporter.RegisterImportantMetric(kMetricReadTime, "ms");
+    reporter.RegisterImportantMetric(kMetricReadThroughput, "MB/s");
+    TimeTicks start_read = TimeTicks::Now();
+    std::optional<Value> value = JSONReader::Read(json);
+    TimeDelta read_time = TimeTicks::Now() - start_read;
+    ASSERT_TRUE(value);
+    reporter.AddResult(kMetricReadTime, read_time);
+    reporter.AddResult(kMetricReadThroughput,
+                       json.size() / read_time.InSecondsF() / (1024 * 1024));
+  }
 };
 
 TEST_F(JSONPerfTest, StressTest) {
@@ -97,4 +146,50 @@ TEST_F(JSONPerfTest, StressTest) {
   }
 }
 
+// Compares writing a large value to a string with streaming it out in chunks,
+// as done when persisting it to a file. The peak buffer size is the memory the
+// serialized output holds at its peak.
+TEST_F(JSONPerfTest, LargeWriteToSink) {
+  std::optional<Value> value = JSONReader::Read(
+      GenerateStringHeavyJSON(8 * 1024 * 1024, /*pretty_print=*/false));
+  ASSERT_TRUE(value);
+
+  {
+    perf_test::PerfResultReporter reporter(kMetricPrefixJSON,
+                                           "large_write_to_string");
+    reporter.RegisterImportantMetric(kMetricWriteTime, "ms");
+    reporter.RegisterImportantMetric(kMetricPeakBufferSize, "bytes");
+    TimeTicks start_write = TimeTicks::Now();
+    std::optional<std::string> json =
+        WriteJsonWithOptions(*value, JSONWriter::OPTIONS_PRETTY_PRINT);
+    reporter.AddResult(kMetricWriteTime, TimeTicks::Now() - start_write);
+    ASSERT_TRUE(json);
+    reporter.AddResult(kMetricPeakBufferSize, json->capacity());
+  }
+  {
+    perf_test::PerfResultReporter reporter(kMetricPrefixJSON,
+                                           "large_write_to_sink");
+    reporter.RegisterImportantMetric(kMetricWriteTime, "ms");
+    reporter.RegisterImportantMetric(kMetricPeakBufferSize, "bytes");
+    size_t peak_buffer_size = 0;
+    TimeTicks start_write = TimeTicks::Now();
+    ASSERT_TRUE(WriteJsonWithOptionsToSink(
+        *value, JSONWriter::OPTIONS_PRETTY_PRINT,
+        [&peak_buffer_size](std::string_view chunk) {
+          peak_buffer_size = std::max(peak_buffer_size, chunk.size());
+          return true;
+        }));
+    reporter.AddResult(kMetricWriteTime, TimeTicks::Now() - start_write);
+    reporter.AddResult(kMetricPeakBufferSize, peak_buffer_size);
+  }
+}
+
+TEST_F(JSONPerfTest, LargeStringHeavyRead) {
+  TestLargeRead("large_string_heavy", /*pretty_print=*/false);
+}
+
+TEST_F(JSONPerfTest, LargePrettyPrintedRead) {
+  TestLargeRead("large_pretty_printed", /*pretty_print=*/true);
+}
+
 }  // namespace base
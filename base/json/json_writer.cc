@@ -65,6 +65,25 @@ JSONWriter::JSONWriter(int options, std::string* json, size_t max_depth)
   CHECK_LE(max_depth, internal::kAbsoluteMaxDepth);
 }
 
+void JSONWriter::SetSink(FunctionRef<bool(std::string_view)> sink,
+                         size_t chunk_size) {
+  DCHECK_GT(chunk_size, 0u);
+  sink_.emplace(sink);
+  chunk_size_ = chunk_size;
+}
+
+bool JSONWriter::MaybeFlush(bool force) {
+  if (!sink_ || sink_failed_) {
+    return !sink_failed_;
+  }
+  if (json_string_->empty() || (!force && json_string_->size() < chunk_size_)) {
+    return true;
+  }
+  sink_failed_ = !(*sink_)(*json_string_);
+  json_string_->clear();
+  return !sink_failed_;
+}
+
 bool JSONWriter::BuildJSONString(absl::monostate node, size_t depth) {
   json_string_->append("null");
   return true;
@@ -157,6 +176,9 @@ bool JSONWriter::BuildJSONString(const Value::Dict& node, size_t depth) {
     result &= value.Visit([this, depth = depth + 1](const auto& member) {
       return BuildJSONString(member, depth);
     });
+    if (!MaybeFlush()) {
+      return false;
+    }
 
     first_value_has_been_output = true;
   }
@@ -201,6 +223,9 @@ bool JSONWriter::BuildJSONString(const Value::List& node, size_t depth) {
     result &= value.Visit([this, depth](const auto& member) {
       return BuildJSONString(member, depth);
     });
+    if (!MaybeFlush()) {
+      return false;
+    }
 
     first_value_has_been_output = true;
   }
@@ -235,4 +260,28 @@ std::optional<std::string> WriteJsonWithOptions(ValueView node,
   return result;
 }
 
+bool WriteJsonWithOptionsToSink(ValueView node,
+                                uint32_t options,
+                                FunctionRef<bool(std::string_view)> sink,
+                                size_t chunk_size,
+                                size_t max_depth) {
+  // Leave room for the value that goes over |chunk_size|.
+  std::string buffer;
+  buffer.reserve(chunk_size + chunk_size / 8);
+
+  JSONWriter writer(static_cast<int>(options), &buffer, max_depth);
+  writer.SetSink(sink, chunk_size);
+  bool result = node.Visit([&writer](const auto& member) {
+    return writer.BuildJSONString(member, 0);
+  });
+  if (!result) {
+    return false;
+  }
+
+  if (options & OPTIONS_PRETTY_PRINT) {
+    buffer.append(kPrettyPrintLineEnding);
+  }
+  return writer.MaybeFlush(/*force=*/true);
+}
+
 }  // namespace base
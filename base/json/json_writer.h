@@ -13,6 +13,7 @@
 #include <string_view>
 
 #include "base/base_export.h"
+#include "base/functional/function_ref.h"
 #include "base/json/json_common.h"
 #include "base/memory/raw_ptr.h"
 #include "base/values.h"
@@ -59,6 +60,25 @@ BASE_EXPORT std::optional<std::string> WriteJsonWithOptions(
     uint32_t options,
     size_t max_depth = internal::kAbsoluteMaxDepth);
 
+// The default `chunk_size` of WriteJsonWithOptionsToSink().
+inline constexpr size_t kJsonSinkChunkSize = 64 * 1024;
+
+// Generates the same output as WriteJsonWithOptions(), but hands it to `sink`
+// as it is generated, in chunks of about `chunk_size` bytes, instead of
+// building all of it in memory. This bounds the memory needed to write out a
+// large value, e.g. to a file. A chunk only goes over `chunk_size` by the size
+// of a single string or number.
+//
+// Returns false if WriteJsonWithOptions() would fail, or if `sink` returns
+// false, which stops serialization. In both cases `sink` may already have been
+// given part of the output.
+BASE_EXPORT bool WriteJsonWithOptionsToSink(
+    ValueView node,
+    uint32_t options,
+    FunctionRef<bool(std::string_view)> sink,
+    size_t chunk_size = kJsonSinkChunkSize,
+    size_t max_depth = internal::kAbsoluteMaxDepth);
+
 class BASE_EXPORT JSONWriter {
  public:
   using Options = JsonOptions;
@@ -96,10 +116,25 @@ class BASE_EXPORT JSONWriter {
                                size_t max_depth = internal::kAbsoluteMaxDepth);
 
  private:
+  friend bool WriteJsonWithOptionsToSink(ValueView node,
+                                         uint32_t options,
+                                         FunctionRef<bool(std::string_view)>,
+                                         size_t chunk_size,
+                                         size_t max_depth);
+
   JSONWriter(int options,
              std::string* json,
              size_t max_depth = internal::kAbsoluteMaxDepth);
 
+  // Makes the writer hand |json_string_| over to |sink| and clear it whenever
+  // it reaches |chunk_size| bytes.
+  void SetSink(FunctionRef<bool(std::string_view)> sink, size_t chunk_size);
+
+  // Hands what |json_string_| holds over to |sink_| if there is one, and
+  // either |json_string_| holds at least |chunk_size_| bytes or |force|.
+  // Returns false if the sink failed, now or earlier.
+  bool MaybeFlush(bool force = false);
+
   // Called recursively to build the JSON string. When completed,
   // |json_string_| will contain the JSON.
   bool BuildJSONString(absl::monostate node, size_t depth);
@@ -121,6 +156,11 @@ class BASE_EXPORT JSONWriter {
   // Where we write JSON data as we generate it.
   raw_ptr<std::string> json_string_;
 
+  // Where chunks of JSON data are handed over to, if set.
+  std::optional<FunctionRef<bool(std::string_view)>> sink_;
+  size_t chunk_size_ = 0;
+  bool sink_failed_ = false;
+
   // Maximum depth to write.
   const size_t max_depth_;
 
@@ -4,10 +4,14 @@
 
 #include "base/json/json_writer.h"
 
+#include <algorithm>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include "base/containers/span.h"
 #include "base/json/json_reader.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "base/test/gmock_expected_support.h"
 #include "base/values.h"
@@ -232,4 +236,76 @@ TEST(JsonWriterTest, JSONWriterWriteWithOptionsFailure) {
       JSONWriter::OPTIONS_PRETTY_PRINT, &output_js, /*max_depth=*/1));
 }
 
+TEST(JsonWriterTest, WriteToSinkMatchesWriteJson) {
+  Value::List list;
+  for (int i = 0; i < 100; ++i) {
+    list.Append(Value::Dict()
+                    .Set("index", i)
+                    .Set("name", "item " + NumberToString(i))
+                    .Set("nested", Value::List().Append(1.5).Append(true)));
+  }
+  Value::Dict root = Value::Dict().Set("items", std::move(list));
+
+  for (uint32_t options :
+       {0u, static_cast<uint32_t>(JSONWriter::OPTIONS_PRETTY_PRINT),
+        static_cast<uint32_t>(
+            JSONWriter::OPTIONS_OMIT_DOUBLE_TYPE_PRESERVATION)}) {
+    SCOPED_TRACE(options);
+    std::optional<std::string> expected = WriteJsonWithOptions(root, options);
+    ASSERT_TRUE(expected);
+
+    std::string output;
+    size_t chunk_count = 0;
+    size_t max_chunk_size = 0;
+    EXPECT_TRUE(WriteJsonWithOptionsToSink(
+        root, options,
+        [&](std::string_view chunk) {
+          output.append(chunk);
+          ++chunk_count;
+          max_chunk_size = std::max(max_chunk_size, chunk.size());
+          return true;
+        },
+        /*chunk_size=*/256));
+    EXPECT_EQ(output, *expected);
+    EXPECT_GT(chunk_count, 1u);
+    // No single value is larger than 128 bytes.
+    EXPECT_LT(max_chunk_size, 256u + 128u);
+  }
+}
+
+TEST(JsonWriterTest, WriteToSinkFailures) {
+  const auto kBinaryData = base::as_bytes(base::make_span("asdf", 4u));
+  auto binary_list = Value::List().Append(5).Append(Value(kBinaryData));
+  auto sink = [](std::string_view chunk) { return true; };
+  EXPECT_FALSE(WriteJsonWithOptionsToSink(binary_list, 0, sink));
+
+  std::string output;
+  EXPECT_TRUE(WriteJsonWithOptionsToSink(
+      binary_list, JSONWriter::OPTIONS_OMIT_BINARY_VALUES,
+      [&](std::string_view chunk) {
+        output.append(chunk);
+        return true;
+      }));
+  EXPECT_EQ(output, "[5]");
+
+  EXPECT_FALSE(WriteJsonWithOptionsToSink(
+      Value::Dict().Set("key", Value::Dict().Set("nested", Value::Dict())), 0,
+      sink, kJsonSinkChunkSize, /*max_depth=*/1));
+
+  // A failing sink stops serialization.
+  Value::List long_list;
+  for (int i = 0; i < 1000; ++i) {
+    long_list.Append(i);
+  }
+  int calls = 0;
+  EXPECT_FALSE(WriteJsonWithOptionsToSink(
+      long_list, 0,
+      [&](std::string_view chunk) {
+        ++calls;
+        return false;
+      },
+      /*chunk_size=*/16));
+  EXPECT_EQ(calls, 1);
+}
+
 }  // namespace base
@@ -669,6 +669,23 @@ std::set<std::string> FieldTrialList::GetActiveTrialsOfParentProcess() {
   return result;
 }
 
+// static
+bool FieldTrialList::IsTrialActiveInParentProcess(const FieldTrial& trial) {
+  if (!global_ || !global_->field_trial_allocator_ ||
+      !global_->field_trial_allocator_->IsReadonly() ||
+      trial.ref_ == FieldTrialAllocator::kReferenceNull) {
+    return false;
+  }
+
+  // The parent process updates the activated state of entries in place (see
+  // ActivateFieldTrialEntryWhileLocked()), so this reflects activations that
+  // happened after this process was launched.
+  const FieldTrial::FieldTrialEntry* entry =
+      global_->field_trial_allocator_->GetAsObject<FieldTrial::FieldTrialEntry>(
+          trial.ref_);
+  return entry && subtle::NoBarrier_Load(&entry->activated);
+}
+
 // static
 bool FieldTrialList::CreateTrialsFromString(const std::string& trials_string,
                                             bool override_trials) {
@@ -586,6 +586,12 @@ class BASE_EXPORT FieldTrialList {
   // Must be called only after a call to CreateTrialsInChildProcess().
   static std::set<std::string> GetActiveTrialsOfParentProcess();
 
+  // Returns whether |trial| is marked as active in the field trial allocator
+  // shared by the parent process, i.e. whether the parent process has already
+  // activated it. Returns false if this is not a child process or if |trial|
+  // was not created from the shared allocator.
+  static bool IsTrialActiveInParentProcess(const FieldTrial& trial);
+
   // Use a state string (re: AllStatesToString()) to augment the current list of
   // field trials to include the supplied trials, and using a 100% probability
   // for each trial, force them to have the same group string. This is commonly
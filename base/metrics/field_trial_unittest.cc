@@ -1174,6 +1174,9 @@ MULTIPROCESS_TEST_MAIN(CreateTrialsInChildProcess) {
 
   // Validate the expected field trial and feaure state
   CHECK_EQ("Group1", FieldTrialList::FindFullName("Trial1"));
+  // "Trial1" was created from shared memory but never activated by the parent.
+  CHECK(!FieldTrialList::IsTrialActiveInParentProcess(
+      *FieldTrialList::Find("Trial1")));
   CHECK(FeatureList::IsEnabled(kTestFeatureA));
   CHECK(!FeatureList::IsEnabled(kTestFeatureB));
   CHECK(!FeatureList::IsEnabled(kTestFeatureC));
@@ -1211,6 +1214,9 @@ TEST_F(FieldTrialListTest, PassFieldTrialSharedMemoryOnCommandLine) {
   // The shared memory handle should be specified.
   EXPECT_TRUE(command_line.HasSwitch(switches::kFieldTrialHandle));
 
+  // This process owns the writable allocator, so it has no parent state.
+  EXPECT_FALSE(FieldTrialList::IsTrialActiveInParentProcess(*trial));
+
   // Explicitly specified enabled/disabled features should be specified.
   EXPECT_EQ(kTestFeatureA.name,
             command_line.GetSwitchValueASCII(switches::kEnableFeatures));
@@ -32,6 +32,7 @@
 #include "base/metrics/persistent_memory_allocator.h"
 #include "base/metrics/sample_vector.h"
 #include "base/metrics/statistics_recorder.h"
+#include "base/metrics/thread_local_sample_buffer.h"
 #include "base/notreached.h"
 #include "base/pickle.h"
 #include "base/ranges/algorithm.h"
@@ -503,7 +504,11 @@ void Histogram::AddCount(int value, int count) {
     NOTREACHED();
     return;
   }
-  unlogged_samples_->Accumulate(value, count);
+  if (HasFlags(kThreadLocalBuffered)) {
+    ThreadLocalSampleBuffer::Accumulate(this, value, count);
+  } else {
+    unlogged_samples_->Accumulate(value, count);
+  }
 
   if (UNLIKELY(StatisticsRecorder::have_active_callbacks()))
     FindAndRunCallbacks(value);
@@ -545,6 +550,7 @@ std::unique_ptr<HistogramSamples> Histogram::SnapshotDelta() {
   // vector: this way, the next snapshot will include any concurrent updates
   // missed by the current snapshot.
 
+  FlushThreadLocalSamples();
   std::unique_ptr<HistogramSamples> snapshot =
       std::make_unique<SampleVector>(unlogged_samples_->id(), bucket_ranges());
   snapshot->Extract(*unlogged_samples_);
@@ -610,7 +616,11 @@ Histogram::Histogram(const char* name,
       unlogged_samples_->id(), ranges, logged_meta, logged_counts);
 }
 
-Histogram::~Histogram() = default;
+Histogram::~Histogram() {
+  // Buffers must not keep pointing at this histogram. This only happens in
+  // tests, since histograms are otherwise never deleted.
+  FlushThreadLocalSamples();
+}
 
 const std::string Histogram::GetAsciiBucketRange(size_t i) const {
   return GetSimpleAsciiBucketRange(ranges(i));
@@ -697,12 +707,19 @@ std::unique_ptr<SampleVector> Histogram::SnapshotAllSamples() const {
 }
 
 std::unique_ptr<SampleVector> Histogram::SnapshotUnloggedSamplesImpl() const {
+  FlushThreadLocalSamples();
   std::unique_ptr<SampleVector> samples(
       new SampleVector(unlogged_samples_->id(), bucket_ranges()));
   samples->Add(*unlogged_samples_);
   return samples;
 }
 
+void Histogram::FlushThreadLocalSamples() const {
+  if (HasFlags(kThreadLocalBuffered)) {
+    ThreadLocalSampleBuffer::FlushHistogram(this);
+  }
+}
+
 Value::Dict Histogram::GetParameters() const {
   Value::Dict params;
   params.Set("type", HistogramTypeToString(GetHistogramType()));
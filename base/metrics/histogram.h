@@ -267,6 +267,7 @@ class BASE_EXPORT Histogram : public HistogramBase {
 
   friend class StatisticsRecorder;  // To allow it to delete duplicates.
   friend class StatisticsRecorderTest;
+  friend class ThreadLocalSampleBuffer;  // To flush buffered samples.
 
   friend BASE_EXPORT HistogramBase* DeserializeHistogramInfo(
       base::PickleIterator* iter);
@@ -303,6 +304,10 @@ class BASE_EXPORT Histogram : public HistogramBase {
   // |params|.
   Value::Dict GetParameters() const override;
 
+  // Accumulates the samples that threads buffered for this histogram if it has
+  // the kThreadLocalBuffered flag. Called before reading |unlogged_samples_|.
+  void FlushThreadLocalSamples() const;
+
   // Samples that have not yet been logged with SnapshotDelta().
   std::unique_ptr<SampleVectorBase> unlogged_samples_;
 
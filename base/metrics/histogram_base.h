@@ -130,6 +130,15 @@ class BASE_EXPORT HistogramBase {
     // MemoryAllocator, and that loaded into the Histogram module before this
     // histogram is created.
     kIsPersistent = 0x40,
+
+    // Indicates that samples are first accumulated in a per-thread buffer,
+    // and only added to the histogram's shared counts in batches, or when the
+    // histogram is snapshotted. This avoids contention on histograms that are
+    // recorded very often from many threads, at the cost of a few hundred
+    // bytes per thread. Only supported by Histogram and its subclasses, and
+    // must be set when the histogram is created and never cleared. See
+    // ThreadLocalSampleBuffer.
+    kThreadLocalBuffered = 0x80,
   };
 
   // Histogram data inconsistency types.
@@ -0,0 +1,145 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/barrier_closure.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/metrics/histogram.h"
+#include "base/metrics/histogram_base.h"
+#include "base/metrics/histogram_samples.h"
+#include "base/metrics/statistics_recorder.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/system/sys_info.h"
+#include "base/threading/simple_thread.h"
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+// This file measures the cost of recording samples into one histogram from
+// many threads at once, with and without HistogramBase::kThreadLocalBuffered.
+
+namespace base {
+
+namespace {
+
+constexpr char kMetricPrefixHistogram[] = "Histogram.";
+constexpr char kMetricAddThroughput[] = "add_throughput";
+constexpr char kMetricSnapshotTime[] = "snapshot_time";
+constexpr int kSamplesPerThread = 1000000;
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story_name) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixHistogram, story_name);
+  reporter.RegisterImportantMetric(kMetricAddThroughput, "operations/ms");
+  reporter.RegisterImportantMetric(kMetricSnapshotTime, "us");
+  return reporter;
+}
+
+class AddThread : public SimpleThread {
+ public:
+  // Upon entering its main function, the thread waits for |start_event| to be
+  // signaled. Then, it adds |kSamplesPerThread| samples to |histogram|, and
+  // invokes |done_closure|. It then waits for |exit_event| before exiting, so
+  // that buffered samples are only flushed by the snapshot.
+  AddThread(HistogramBase* histogram,
+            WaitableEvent* start_event,
+            OnceClosure done_closure,
+            WaitableEvent* exit_event)
+      : SimpleThread("AddThread"),
+        histogram_(histogram),
+        start_event_(start_event),
+        done_closure_(std::move(done_closure)),
+        exit_event_(exit_event) {}
+
+  // SimpleThread:
+  void Run() override {
+    start_event_->Wait();
+    for (int i = 0; i < kSamplesPerThread; ++i) {
+      // A few distinct values, as recorded by typical timing histograms.
+      histogram_->Add(i & 7);
+    }
+    std::move(done_closure_).Run();
+    exit_event_->Wait();
+  }
+
+ private:
+  const raw_ptr<HistogramBase> histogram_;
+  const raw_ptr<WaitableEvent> start_event_;
+  OnceClosure done_closure_;
+  const raw_ptr<WaitableEvent> exit_event_;
+};
+
+void RunContendedAddPerfTest(const std::string& story_name,
+                             int32_t flags,
+                             int num_threads) {
+  std::unique_ptr<StatisticsRecorder> recorder =
+      StatisticsRecorder::CreateTemporaryForTesting();
+  HistogramBase* histogram =
+      Histogram::FactoryGet(story_name, 1, 1000, 50, flags);
+
+  WaitableEvent start_event;
+  WaitableEvent done_event;
+  WaitableEvent exit_event;
+  RepeatingClosure done_closure = BarrierClosure(
+      num_threads, BindOnce(&WaitableEvent::Signal, Unretained(&done_event)));
+
+  std::vector<std::unique_ptr<AddThread>> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.push_back(std::make_unique<AddThread>(histogram, &start_event,
+                                                  done_closure, &exit_event));
+    threads.back()->Start();
+  }
+
+  const TimeTicks start_time = TimeTicks::Now();
+  start_event.Signal();
+  done_event.Wait();
+  const TimeTicks add_end_time = TimeTicks::Now();
+  std::unique_ptr<HistogramSamples> samples = histogram->SnapshotDelta();
+  const TimeTicks snapshot_end_time = TimeTicks::Now();
+
+  exit_event.Signal();
+  for (auto& thread : threads) {
+    thread->Join();
+  }
+  EXPECT_EQ(num_threads * kSamplesPerThread, samples->TotalCount());
+
+  auto reporter = SetUpReporter(story_name);
+  reporter.AddResult(
+      kMetricAddThroughput,
+      num_threads * kSamplesPerThread /
+          (add_end_time - start_time).InMillisecondsF());
+  reporter.AddResult(kMetricSnapshotTime,
+                     (snapshot_end_time - add_end_time).InMicrosecondsF());
+}
+
+int NumberOfCores() {
+  return SysInfo::NumberOfProcessors();
+}
+
+}  // namespace
+
+TEST(HistogramPerfTest, ContendedAdd_1Thread) {
+  RunContendedAddPerfTest("ContendedAdd_1Thread", HistogramBase::kNoFlags, 1);
+}
+
+TEST(HistogramPerfTest, ContendedAdd_AllCores) {
+  RunContendedAddPerfTest("ContendedAdd_AllCores", HistogramBase::kNoFlags,
+                          NumberOfCores());
+}
+
+TEST(HistogramPerfTest, ContendedAddThreadLocalBuffered_1Thread) {
+  RunContendedAddPerfTest("ContendedAddThreadLocalBuffered_1Thread",
+                          HistogramBase::kThreadLocalBuffered, 1);
+}
+
+TEST(HistogramPerfTest, ContendedAddThreadLocalBuffered_AllCores) {
+  RunContendedAddPerfTest("ContendedAddThreadLocalBuffered_AllCores",
+                          HistogramBase::kThreadLocalBuffered, NumberOfCores());
+}
+
+}  // namespace base
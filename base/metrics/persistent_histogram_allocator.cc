@@ -9,6 +9,7 @@
 #include <string_view>
 #include <utility>
 
+#include "base/atomicops.h"
 #include "base/debug/crash_logging.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
@@ -319,7 +320,8 @@ PersistentHistogramAllocator::Iterator::GetNextWithIgnore(Reference ignore) {
 PersistentHistogramAllocator::PersistentHistogramAllocator(
     std::unique_ptr<PersistentMemoryAllocator> memory)
     : memory_allocator_(std::move(memory)),
-      sparse_histogram_data_manager_(memory_allocator_.get()) {}
+      sparse_histogram_data_manager_(memory_allocator_.get()),
+      merge_iterator_(memory_allocator_.get()) {}
 
 PersistentHistogramAllocator::~PersistentHistogramAllocator() = default;
 
@@ -543,6 +545,44 @@ void PersistentHistogramAllocator::MergeHistogramFinalDeltaToStatisticsRecorder(
   MergeSamplesToExistingHistogram(existing, histogram, std::move(samples));
 }
 
+size_t PersistentHistogramAllocator::MergeChangedDeltasToStatisticsRecorder() {
+  AutoLock auto_lock(merge_lock_);
+
+  PersistentMemoryAllocator::Reference ref;
+  while ((ref = merge_iterator_.GetNextOfType<PersistentHistogramData>()) !=
+         0) {
+    merge_entries_.push_back({ref, nullptr});
+  }
+
+  size_t merged_count = 0;
+  for (MergeEntry& entry : merge_entries_) {
+    // Every sample accumulated into a histogram increments the redundant count
+    // of its unlogged samples, and taking a delta snapshot extracts it back to
+    // zero. So a zero count means there is nothing to merge, and the
+    // (comparatively expensive) recreation, snapshot and StatisticsRecorder
+    // lookup can be skipped. A sample that is being accumulated concurrently
+    // will be merged by the next call.
+    const PersistentHistogramData* data =
+        memory_allocator_->GetAsObject<PersistentHistogramData>(entry.ref);
+    if (!data) {
+      continue;
+    }
+    if (subtle::NoBarrier_Load(&data->samples_metadata.redundant_count) == 0) {
+      continue;
+    }
+
+    if (!entry.histogram) {
+      entry.histogram = GetHistogram(entry.ref);
+      if (!entry.histogram) {
+        continue;
+      }
+    }
+    MergeHistogramDeltaToStatisticsRecorder(entry.histogram.get());
+    ++merged_count;
+  }
+  return merged_count;
+}
+
 std::unique_ptr<PersistentSampleMapRecords>
 PersistentHistogramAllocator::CreateSampleMapRecords(uint64_t id) {
   return sparse_histogram_data_manager_.CreateSampleMapRecords(id);
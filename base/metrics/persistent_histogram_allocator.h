@@ -273,6 +273,17 @@ class BASE_EXPORT PersistentHistogramAllocator {
   void MergeHistogramFinalDeltaToStatisticsRecorder(
       const HistogramBase* histogram);
 
+  // Merges the deltas of all histograms in this allocator with the ones held
+  // globally by the StatisticsRecorder, like calling
+  // MergeHistogramDeltaToStatisticsRecorder() on everything returned by an
+  // Iterator. Unlike that, histograms that got no samples since the previous
+  // call are skipped by peeking at their metadata in persistent memory, without
+  // recreating them, and histograms that are recreated are kept for later
+  // calls. This makes repeated merges scale with the number of histograms that
+  // changed rather than with the number of histograms. Returns the number of
+  // histograms that were merged. Don't call this on a "global" allocator.
+  size_t MergeChangedDeltasToStatisticsRecorder();
+
   // Returns an object that manages persistent-sample-map records for a given
   // |id|. The returned object queries |sparse_histogram_data_manager_| for
   // records. Hence, the returned object must not outlive
@@ -351,6 +362,22 @@ class BASE_EXPORT PersistentHistogramAllocator {
   // A reference to the last-created histogram in the allocator, used to avoid
   // trying to import what was just created.
   std::atomic<Reference> last_created_ = 0;
+
+  // A histogram found by MergeChangedDeltasToStatisticsRecorder().
+  // |histogram| is only created the first time it has samples to merge.
+  struct MergeEntry {
+    Reference ref;
+    std::unique_ptr<HistogramBase> histogram;
+  };
+
+  // State of MergeChangedDeltasToStatisticsRecorder(), which can be
+  // called from several threads. |merge_iterator_| picks up histograms as they
+  // become iterable, and |merge_entries_| holds all of those found so far.
+  // Declared last so that the histograms are destroyed before the data they
+  // reference.
+  Lock merge_lock_;
+  PersistentMemoryAllocator::Iterator merge_iterator_ GUARDED_BY(merge_lock_);
+  std::vector<MergeEntry> merge_entries_ GUARDED_BY(merge_lock_);
 };
 
 
@@ -467,6 +467,84 @@ TEST_F(PersistentHistogramAllocatorTest,
             StatisticsRecorder::GetHistogramCount());
 }
 
+// Verify that MergeChangedDeltasToStatisticsRecorder() only merges the
+// histograms that got samples since the previous merge, and picks up
+// histograms that are created in between merges.
+TEST_F(PersistentHistogramAllocatorTest, StatisticsRecorderMergeChangedDeltas) {
+  const size_t global_sr_initial_histogram_count =
+      StatisticsRecorder::GetHistogramCount();
+
+  // Create the histograms in a local StatisticsRecorder and allocator, as in
+  // the tests above.
+  std::unique_ptr<StatisticsRecorder> local_sr =
+      StatisticsRecorder::CreateTemporaryForTesting();
+  GlobalHistogramAllocator* old_allocator =
+      GlobalHistogramAllocator::ReleaseForTesting();
+  GlobalHistogramAllocator::CreateWithLocalMemory(kAllocatorMemorySize, 0, "");
+  ASSERT_TRUE(GlobalHistogramAllocator::Get());
+
+  HistogramBase* histogram1 =
+      LinearHistogram::FactoryGet("SRTLinearHistogram1", 1, 10, 10, 0);
+  HistogramBase* histogram2 =
+      LinearHistogram::FactoryGet("SRTLinearHistogram2", 1, 10, 10, 0);
+  HistogramBase* sparse_histogram =
+      SparseHistogram::FactoryGet("SRTSparseHistogram", 0);
+  histogram1->Add(3);
+  sparse_histogram->Add(5);
+
+  GlobalHistogramAllocator* new_allocator =
+      GlobalHistogramAllocator::ReleaseForTesting();
+  local_sr.reset();
+  GlobalHistogramAllocator::Set(old_allocator);
+
+  PersistentHistogramAllocator recovery(
+      std::make_unique<PersistentMemoryAllocator>(
+          const_cast<void*>(new_allocator->memory_allocator()->data()),
+          new_allocator->memory_allocator()->size(), 0, 0, "",
+          PersistentMemoryAllocator::kReadWrite));
+
+  // Only the histograms with samples are merged, and nothing is merged again
+  // until more samples are added.
+  EXPECT_EQ(2U, recovery.MergeChangedDeltasToStatisticsRecorder());
+  EXPECT_EQ(global_sr_initial_histogram_count + 2,
+            StatisticsRecorder::GetHistogramCount());
+  EXPECT_FALSE(StatisticsRecorder::FindHistogram("SRTLinearHistogram2"));
+  EXPECT_EQ(0U, recovery.MergeChangedDeltasToStatisticsRecorder());
+
+  histogram1->Add(3);
+  histogram2->Add(4);
+  EXPECT_EQ(2U, recovery.MergeChangedDeltasToStatisticsRecorder());
+  EXPECT_EQ(0U, recovery.MergeChangedDeltasToStatisticsRecorder());
+
+  // A histogram made iterable after the first merge is found by later ones.
+  PersistentHistogramAllocator::Reference ref;
+  std::unique_ptr<HistogramBase> histogram3 = new_allocator->AllocateHistogram(
+      LINEAR_HISTOGRAM, "SRTLinearHistogram3", 1, 10,
+      static_cast<Histogram*>(histogram1)->bucket_ranges(), 0, &ref);
+  ASSERT_TRUE(histogram3);
+  new_allocator->FinalizeHistogram(ref, /*registered=*/true);
+  histogram3->Add(7);
+  sparse_histogram->Add(5);
+  EXPECT_EQ(2U, recovery.MergeChangedDeltasToStatisticsRecorder());
+  EXPECT_EQ(global_sr_initial_histogram_count + 4,
+            StatisticsRecorder::GetHistogramCount());
+
+  // Check the merged histograms for accuracy.
+  HistogramBase* found =
+      StatisticsRecorder::FindHistogram("SRTLinearHistogram1");
+  ASSERT_TRUE(found);
+  EXPECT_EQ(2, found->SnapshotSamples()->GetCount(3));
+  found = StatisticsRecorder::FindHistogram("SRTLinearHistogram2");
+  ASSERT_TRUE(found);
+  EXPECT_EQ(1, found->SnapshotSamples()->GetCount(4));
+  found = StatisticsRecorder::FindHistogram("SRTLinearHistogram3");
+  ASSERT_TRUE(found);
+  EXPECT_EQ(1, found->SnapshotSamples()->GetCount(7));
+  found = StatisticsRecorder::FindHistogram("SRTSparseHistogram");
+  ASSERT_TRUE(found);
+  EXPECT_EQ(2, found->SnapshotSamples()->GetCount(5));
+}
+
 TEST_F(PersistentHistogramAllocatorTest, MultipleSameSparseHistograms) {
   const std::string kSparseHistogramName = "SRTSparseHistogram";
 
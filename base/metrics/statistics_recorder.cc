@@ -5,6 +5,7 @@
 #include "base/metrics/statistics_recorder.h"
 
 #include <string_view>
+#include <utility>
 
 #include "base/at_exit.h"
 #include "base/barrier_closure.h"
@@ -18,6 +19,7 @@
 #include "base/metrics/metrics_hashes.h"
 #include "base/metrics/persistent_histogram_allocator.h"
 #include "base/metrics/record_histogram_checker.h"
+#include "base/no_destructor.h"
 #include "base/ranges/algorithm.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
@@ -34,6 +36,27 @@ bool HistogramNameLesser(const base::HistogramBase* a,
 
 }  // namespace
 
+// Aligned to a cache line so that threads working on different shards don't
+// contend on the same line.
+struct alignas(64) StatisticsRecorder::HistogramShard {
+  Lock lock;
+  HistogramMap histograms GUARDED_BY(lock);
+};
+
+// static
+std::array<StatisticsRecorder::HistogramShard,
+           StatisticsRecorder::kHistogramShardCount>&
+StatisticsRecorder::GetHistogramShards() {
+  static NoDestructor<std::array<HistogramShard, kHistogramShardCount>> shards;
+  return *shards;
+}
+
+// static
+StatisticsRecorder::HistogramShard& StatisticsRecorder::GetHistogramShard(
+    uint64_t hash) {
+  return GetHistogramShards()[hash % kHistogramShardCount];
+}
+
 // static
 LazyInstance<Lock>::Leaky StatisticsRecorder::lock_ = LAZY_INSTANCE_INITIALIZER;
 
@@ -81,6 +104,18 @@ StatisticsRecorder::~StatisticsRecorder() {
   const AutoLock auto_lock(GetLock());
   DCHECK_EQ(this, top_);
   top_ = previous_;
+
+  // Hand the shards back to the previous recorder, if any.
+  for (size_t i = 0; i < kHistogramShardCount; ++i) {
+    HistogramShard& shard = GetHistogramShards()[i];
+    const AutoLock shard_lock(shard.lock);
+    if (previous_) {
+      shard.histograms = std::move(previous_->suspended_histograms_[i]);
+      previous_->suspended_histograms_[i].clear();
+    } else {
+      shard.histograms.clear();
+    }
+  }
 }
 
 // static
@@ -116,32 +151,58 @@ HistogramBase* StatisticsRecorder::RegisterOrDeleteDuplicate(
   // this is expensive.
   DCHECK_EQ(hash, HashMetricName(histogram->histogram_name()));
 
-  // Declared before |auto_lock| so that the histogram is deleted after the lock
-  // is released (no point in holding the lock longer than needed).
+  // Declared before the locks so that the histogram is deleted after they are
+  // released (no point in holding the locks longer than needed).
   std::unique_ptr<HistogramBase> histogram_deleter;
+  HistogramShard& shard = GetHistogramShard(hash);
+
+  // Fast path: the histogram, or one with the same name, is already
+  // registered. This only needs the shard lock.
+  {
+    const AutoLock shard_lock(shard.lock);
+    const HistogramMap::const_iterator it = shard.histograms.find(hash);
+    if (it != shard.histograms.end()) {
+      return ResolveDuplicate(histogram, it->second, histogram_deleter);
+    }
+  }
+
+  // Slow path: insert the histogram. This takes |lock_| so that the insertion
+  // is consistent with |observers_| and with the recorder being swapped by
+  // CreateTemporaryForTesting(). |lock_| is always acquired before a shard
+  // lock.
   const AutoLock auto_lock(GetLock());
   EnsureGlobalRecorderWhileLocked();
+  const AutoLock shard_lock(shard.lock);
 
-  HistogramBase*& registered = top_->histograms_[hash];
-
-  if (!registered) {
-    registered = histogram;
-    ANNOTATE_LEAKING_OBJECT_PTR(histogram);  // see crbug.com/79322
-    // If there are callbacks for this histogram, we set the kCallbackExists
-    // flag.
-    if (base::Contains(top_->observers_, hash)) {
-      // Note: SetFlags() does not write to persistent memory, it only writes to
-      // an in-memory version of the flags.
-      histogram->SetFlags(HistogramBase::kCallbackExists);
-    }
+  // Another thread may have registered the same histogram while no lock was
+  // held.
+  HistogramBase*& registered = shard.histograms[hash];
+  if (registered) {
+    return ResolveDuplicate(histogram, registered, histogram_deleter);
+  }
 
-    return histogram;
+  registered = histogram;
+  ANNOTATE_LEAKING_OBJECT_PTR(histogram);  // see crbug.com/79322
+  // If there are callbacks for this histogram, we set the kCallbackExists
+  // flag.
+  if (base::Contains(top_->observers_, hash)) {
+    // Note: SetFlags() does not write to persistent memory, it only writes to
+    // an in-memory version of the flags.
+    histogram->SetFlags(HistogramBase::kCallbackExists);
   }
 
+  return histogram;
+}
+
+// static
+HistogramBase* StatisticsRecorder::ResolveDuplicate(
+    HistogramBase* histogram,
+    HistogramBase* registered,
+    std::unique_ptr<HistogramBase>& histogram_deleter) {
   // Assert that there was no collision. Note that this is intentionally a
   // DCHECK because 1) this is expensive to call repeatedly, and 2) this
   // comparison may cause a read in persistent memory, which can cause I/O (this
-  // is bad because |lock_| is currently being held).
+  // is bad because a lock is currently being held).
   //
   // If you are a developer adding a new histogram and this DCHECK is being hit,
   // you are unluckily a victim of a hash collision. For now, the best solution
@@ -150,7 +211,8 @@ HistogramBase* StatisticsRecorder::RegisterOrDeleteDuplicate(
   DCHECK_EQ(strcmp(histogram->histogram_name(), registered->histogram_name()),
             0)
       << "Histogram name hash collision between " << histogram->histogram_name()
-      << " and " << registered->histogram_name() << " (hash = " << hash << ")";
+      << " and " << registered->histogram_name()
+      << " (hash = " << histogram->name_hash() << ")";
 
   if (histogram == registered) {
     // The histogram was registered before.
@@ -235,15 +297,9 @@ HistogramBase* StatisticsRecorder::FindHistogram(std::string_view name) {
   // will acquire the lock at that time.
   ImportGlobalPersistentHistograms();
 
-  const AutoLock auto_lock(GetLock());
-
-  // Manipulate |top_| through a const variable to ensure it is not mutated.
-  const auto* const_top = top_;
-  if (!const_top) {
-    return nullptr;
-  }
-
-  return const_top->FindHistogramByHashInternal(hash, name);
+  // Only the shard lock is taken, lookups don't contend on |lock_|. If there is
+  // no global recorder, the shards are empty.
+  return FindHistogramByHashInternal(hash, name);
 }
 
 // static
@@ -320,18 +376,20 @@ void StatisticsRecorder::InitLogOnShutdown() {
   InitLogOnShutdownWhileLocked();
 }
 
+// static
 HistogramBase* StatisticsRecorder::FindHistogramByHashInternal(
     uint64_t hash,
-    std::string_view name) const {
-  AssertLockHeld();
-  const HistogramMap::const_iterator it = histograms_.find(hash);
-  if (it == histograms_.end()) {
+    std::string_view name) {
+  HistogramShard& shard = GetHistogramShard(hash);
+  const AutoLock shard_lock(shard.lock);
+  const HistogramMap::const_iterator it = shard.histograms.find(hash);
+  if (it == shard.histograms.end()) {
     return nullptr;
   }
   // Assert that there was no collision. Note that this is intentionally a
   // DCHECK because 1) this is expensive to call repeatedly, and 2) this
   // comparison may cause a read in persistent memory, which can cause I/O (this
-  // is bad because |lock_| is currently being held).
+  // is bad because a lock is currently being held).
   //
   // If you are a developer adding a new histogram and this DCHECK is being hit,
   // you are unluckily a victim of a hash collision. For now, the best solution
@@ -361,7 +419,7 @@ void StatisticsRecorder::AddHistogramSampleObserver(
 
   top_->observers_[hash]->AddObserver(observer);
 
-  HistogramBase* histogram = top_->FindHistogramByHashInternal(hash, name);
+  HistogramBase* histogram = FindHistogramByHashInternal(hash, name);
   if (histogram) {
     // Note: SetFlags() does not write to persistent memory, it only writes to
     // an in-memory version of the flags.
@@ -391,7 +449,7 @@ void StatisticsRecorder::RemoveHistogramSampleObserver(
     top_->observers_.erase(hash);
 
     // We also clear the flag from the histogram (if it exists).
-    HistogramBase* histogram = top_->FindHistogramByHashInternal(hash, name);
+    HistogramBase* histogram = FindHistogramByHashInternal(hash, name);
     if (histogram) {
       // Note: ClearFlags() does not write to persistent memory, it only writes
       // to an in-memory version of the flags.
@@ -448,14 +506,13 @@ void StatisticsRecorder::SetGlobalSampleCallback(
 
 // static
 size_t StatisticsRecorder::GetHistogramCount() {
-  const AutoLock auto_lock(GetLock());
-
-  // Manipulate |top_| through a const variable to ensure it is not mutated.
-  const auto* const_top = top_;
-  if (!const_top) {
-    return 0;
+  size_t count = 0;
+  for (size_t i = 0; i < kHistogramShardCount; ++i) {
+    HistogramShard& shard = GetHistogramShards()[i];
+    const AutoLock shard_lock(shard.lock);
+    count += shard.histograms.size();
   }
-  return const_top->histograms_.size();
+  return count;
 }
 
 // static
@@ -464,7 +521,7 @@ void StatisticsRecorder::ForgetHistogramForTesting(std::string_view name) {
   EnsureGlobalRecorderWhileLocked();
 
   uint64_t hash = HashMetricName(name);
-  HistogramBase* base = top_->FindHistogramByHashInternal(hash, name);
+  HistogramBase* base = FindHistogramByHashInternal(hash, name);
   if (!base) {
     return;
   }
@@ -479,7 +536,9 @@ void StatisticsRecorder::ForgetHistogramForTesting(std::string_view name) {
 
   // This performs another lookup in the map, but this is fine since this is
   // only used in tests.
-  top_->histograms_.erase(hash);
+  HistogramShard& shard = GetHistogramShard(hash);
+  const AutoLock shard_lock(shard.lock);
+  shard.histograms.erase(hash);
 }
 
 // static
@@ -521,23 +580,22 @@ StatisticsRecorder::Histograms StatisticsRecorder::GetHistograms(
 
   Histograms out;
 
-  const AutoLock auto_lock(GetLock());
-
-  // Manipulate |top_| through a const variable to ensure it is not mutated.
-  const auto* const_top = top_;
-  if (!const_top) {
-    return out;
-  }
-
-  out.reserve(const_top->histograms_.size());
-  for (const auto& entry : const_top->histograms_) {
-    // Note: HasFlags() does not read to persistent memory, it only reads an
-    // in-memory version of the flags.
-    bool is_persistent = entry.second->HasFlags(HistogramBase::kIsPersistent);
-    if (!include_persistent && is_persistent) {
-      continue;
+  // The shards are visited one at a time, so histograms registered
+  // concurrently may or may not be included. If there is no global recorder,
+  // the shards are empty.
+  for (size_t i = 0; i < kHistogramShardCount; ++i) {
+    HistogramShard& shard = GetHistogramShards()[i];
+    const AutoLock shard_lock(shard.lock);
+    out.reserve(out.size() + shard.histograms.size());
+    for (const auto& entry : shard.histograms) {
+      // Note: HasFlags() does not read to persistent memory, it only reads an
+      // in-memory version of the flags.
+      bool is_persistent = entry.second->HasFlags(HistogramBase::kIsPersistent);
+      if (!include_persistent && is_persistent) {
+        continue;
+      }
+      out.push_back(entry.second);
     }
-    out.push_back(entry.second);
   }
 
   return out;
@@ -592,6 +650,18 @@ StatisticsRecorder::StatisticsRecorder() {
   AssertLockHeld();
   previous_ = top_;
   top_ = this;
+
+  // Push the histograms of the previous recorder aside, this recorder starts
+  // out empty.
+  for (size_t i = 0; i < kHistogramShardCount; ++i) {
+    HistogramShard& shard = GetHistogramShards()[i];
+    const AutoLock shard_lock(shard.lock);
+    if (previous_) {
+      previous_->suspended_histograms_[i] = std::move(shard.histograms);
+    }
+    shard.histograms.clear();
+  }
+
   InitLogOnShutdownWhileLocked();
 }
 
@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 
+#include <array>
 #include <atomic>  // For std::memory_order_*.
 #include <memory>
 #include <string>
@@ -325,13 +326,34 @@ class BASE_EXPORT StatisticsRecorder {
   static Lock& GetLock() { return lock_.Get(); }
   static void AssertLockHeld() { lock_.Get().AssertAcquired(); }
 
+  // The histograms of the current global recorder are spread over this many
+  // shards by name hash, each with its own lock, so that looking up and
+  // registering histograms from many threads doesn't serialize on |lock_|.
+  static constexpr size_t kHistogramShardCount = 32;
+
+  // A shard of the histogram map. Defined in the .cc file.
+  struct HistogramShard;
+
+  // Returns all the shards, and the shard that holds the histogram with name
+  // hash |hash|.
+  static std::array<HistogramShard, kHistogramShardCount>& GetHistogramShards();
+  static HistogramShard& GetHistogramShard(uint64_t hash);
+
   // Returns the histogram registered with |hash|, if there is one. Returns
-  // nullptr otherwise.
+  // nullptr otherwise. Only takes the lock of the shard for |hash|, so this can
+  // be called with or without |lock_| held.
   // Note: |name| is only used in DCHECK builds to assert that there was no
   // collision (i.e. different histograms with the same hash).
-  HistogramBase* FindHistogramByHashInternal(uint64_t hash,
-                                             std::string_view name) const
-      EXCLUSIVE_LOCKS_REQUIRED(GetLock());
+  static HistogramBase* FindHistogramByHashInternal(uint64_t hash,
+                                                    std::string_view name);
+
+  // Called by RegisterOrDeleteDuplicate() when a histogram with the same name
+  // hash as |histogram| is already |registered|. Returns |registered|, and
+  // hands |histogram| to |histogram_deleter| if it is a different object.
+  static HistogramBase* ResolveDuplicate(
+      HistogramBase* histogram,
+      HistogramBase* registered,
+      std::unique_ptr<HistogramBase>& histogram_deleter);
 
   // Adds an observer to be notified when a new sample is recorded on the
   // histogram referred to by |histogram_name|. Can be called before or after
@@ -393,7 +415,10 @@ class BASE_EXPORT StatisticsRecorder {
   static void InitLogOnShutdownWhileLocked()
       EXCLUSIVE_LOCKS_REQUIRED(GetLock());
 
-  HistogramMap histograms_;
+  // The histograms of this recorder while it is pushed aside by a temporary
+  // recorder. While this recorder is |top_|, its histograms live in the
+  // global shards instead.
+  std::array<HistogramMap, kHistogramShardCount> suspended_histograms_;
   ObserverMap observers_;
   HistogramProviders providers_;
   RangesManager ranges_manager_;
@@ -0,0 +1,195 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/barrier_closure.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/metrics/histogram.h"
+#include "base/metrics/statistics_recorder.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/system/sys_info.h"
+#include "base/threading/simple_thread.h"
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+// This file measures the throughput of registering and looking up histograms
+// in the StatisticsRecorder from many threads at once, which is what happens
+// during startup when histogram macros run on every thread.
+
+namespace base {
+
+namespace {
+
+constexpr char kMetricPrefixStatisticsRecorder[] = "StatisticsRecorder.";
+constexpr char kMetricRegisterThroughput[] = "register_throughput";
+constexpr char kMetricLookupThroughput[] = "lookup_throughput";
+constexpr char kHistogramNamePrefix[] = "SRPerfTest.";
+constexpr size_t kHistogramsPerThread = 2000;
+constexpr size_t kLookupRounds = 20;
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story_name) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixStatisticsRecorder,
+                                         story_name);
+  reporter.RegisterImportantMetric(kMetricRegisterThroughput, "operations/ms");
+  reporter.RegisterImportantMetric(kMetricLookupThroughput, "operations/ms");
+  return reporter;
+}
+
+std::string GetHistogramName(size_t thread_index, size_t histogram_index) {
+  return StrCat({kHistogramNamePrefix, NumberToString(thread_index), ".",
+                 NumberToString(histogram_index)});
+}
+
+class RegisterAndLookupThread : public SimpleThread {
+ public:
+  // Upon entering its main function, the thread waits for |start_event| to be
+  // signaled and registers its own |kHistogramsPerThread| histograms, then
+  // invokes |registered_closure|. It then waits for |lookup_event| and looks up
+  // the histograms of all |num_threads| threads |kLookupRounds| times, then
+  // invokes |done_closure|.
+  RegisterAndLookupThread(size_t thread_index,
+                          size_t num_threads,
+                          WaitableEvent* start_event,
+                          OnceClosure registered_closure,
+                          WaitableEvent* lookup_event,
+                          OnceClosure done_closure)
+      : SimpleThread("RegisterAndLookupThread"),
+        thread_index_(thread_index),
+        start_event_(start_event),
+        registered_closure_(std::move(registered_closure)),
+        lookup_event_(lookup_event),
+        done_closure_(std::move(done_closure)) {
+    for (size_t i = 0; i < kHistogramsPerThread; ++i) {
+      own_names_.push_back(GetHistogramName(thread_index_, i));
+    }
+    // Look up the histograms of the other threads in a different order on
+    // each thread, so that they don't all hit the same shard at once.
+    for (size_t i = 0; i < kHistogramsPerThread; ++i) {
+      for (size_t t = 0; t < num_threads; ++t) {
+        lookup_names_.push_back(
+            GetHistogramName((thread_index_ + t) % num_threads, i));
+      }
+    }
+  }
+
+  // SimpleThread:
+  void Run() override {
+    start_event_->Wait();
+    for (const std::string& name : own_names_) {
+      Histogram::FactoryGet(name, 1, 1000, 50, HistogramBase::kNoFlags);
+    }
+    std::move(registered_closure_).Run();
+
+    lookup_event_->Wait();
+    for (size_t round = 0; round < kLookupRounds; ++round) {
+      for (const std::string& name : lookup_names_) {
+        if (!StatisticsRecorder::FindHistogram(name)) {
+          ++missing_lookups_;
+        }
+      }
+    }
+    std::move(done_closure_).Run();
+  }
+
+  size_t lookup_count() const { return kLookupRounds * lookup_names_.size(); }
+  size_t missing_lookups() const { return missing_lookups_; }
+
+ private:
+  const size_t thread_index_;
+  const raw_ptr<WaitableEvent> start_event_;
+  OnceClosure registered_closure_;
+  const raw_ptr<WaitableEvent> lookup_event_;
+  OnceClosure done_closure_;
+  std::vector<std::string> own_names_;
+  std::vector<std::string> lookup_names_;
+  size_t missing_lookups_ = 0;
+};
+
+void RunRegisterAndLookupPerfTest(const std::string& story_name,
+                                  size_t num_threads) {
+  std::unique_ptr<StatisticsRecorder> recorder =
+      StatisticsRecorder::CreateTemporaryForTesting();
+
+  WaitableEvent start_event;
+  WaitableEvent registered_event;
+  WaitableEvent lookup_event;
+  WaitableEvent done_event;
+  RepeatingClosure registered_closure = BarrierClosure(
+      num_threads,
+      BindOnce(&WaitableEvent::Signal, Unretained(&registered_event)));
+  RepeatingClosure done_closure = BarrierClosure(
+      num_threads, BindOnce(&WaitableEvent::Signal, Unretained(&done_event)));
+
+  std::vector<std::unique_ptr<RegisterAndLookupThread>> threads;
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.push_back(std::make_unique<RegisterAndLookupThread>(
+        i, num_threads, &start_event, registered_closure, &lookup_event,
+        done_closure));
+    threads.back()->Start();
+  }
+
+  const TimeTicks register_start_time = TimeTicks::Now();
+  start_event.Signal();
+  registered_event.Wait();
+  const TimeTicks lookup_start_time = TimeTicks::Now();
+  lookup_event.Signal();
+  done_event.Wait();
+  const TimeTicks end_time = TimeTicks::Now();
+
+  size_t lookup_count = 0;
+  for (auto& thread : threads) {
+    thread->Join();
+    EXPECT_EQ(thread->missing_lookups(), 0u);
+    lookup_count += thread->lookup_count();
+  }
+  EXPECT_EQ(StatisticsRecorder::GetHistogramCount(),
+            num_threads * kHistogramsPerThread);
+
+  auto reporter = SetUpReporter(story_name);
+  reporter.AddResult(kMetricRegisterThroughput,
+                     num_threads * kHistogramsPerThread /
+                         (lookup_start_time - register_start_time)
+                             .InMillisecondsF());
+  reporter.AddResult(kMetricLookupThroughput,
+                     lookup_count / (end_time - lookup_start_time)
+                                        .InMillisecondsF());
+
+  // Histograms are deleted after the temporary recorder, so that it never
+  // holds dangling pointers.
+  StatisticsRecorder::Histograms histograms =
+      StatisticsRecorder::GetHistograms();
+  recorder.reset();
+  for (HistogramBase* histogram : histograms) {
+    if (StartsWith(histogram->histogram_name(), kHistogramNamePrefix)) {
+      delete histogram;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(StatisticsRecorderPerfTest, RegisterAndLookup_1Thread) {
+  RunRegisterAndLookupPerfTest("RegisterAndLookup_1Thread", 1);
+}
+
+TEST(StatisticsRecorderPerfTest, RegisterAndLookup_4Threads) {
+  RunRegisterAndLookupPerfTest("RegisterAndLookup_4Threads", 4);
+}
+
+TEST(StatisticsRecorderPerfTest, RegisterAndLookup_AllCores) {
+  RunRegisterAndLookupPerfTest(
+      "RegisterAndLookup_AllCores",
+      static_cast<size_t>(SysInfo::NumberOfProcessors()));
+}
+
+}  // namespace base
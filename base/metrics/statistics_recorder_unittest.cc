@@ -246,6 +246,35 @@ TEST_P(StatisticsRecorderTest, FindHistogram) {
   EXPECT_FALSE(StatisticsRecorder::FindHistogram("TestHistogram"));
 }
 
+TEST_P(StatisticsRecorderTest, TemporaryRecorderSwapsHistograms) {
+  // The histograms are not created in persistent memory, so that they can't be
+  // imported into the other recorder.
+  Histogram* histogram1 = CreateHistogram("TestHistogram1", 1, 1000, 10);
+  EXPECT_EQ(histogram1,
+            StatisticsRecorder::RegisterOrDeleteDuplicate(histogram1));
+  EXPECT_EQ(1u, StatisticsRecorder::GetHistogramCount());
+
+  // A temporary recorder starts out without any histograms.
+  std::unique_ptr<StatisticsRecorder> temp_sr =
+      StatisticsRecorder::CreateTemporaryForTesting();
+  EXPECT_EQ(0u, StatisticsRecorder::GetHistogramCount());
+  EXPECT_FALSE(StatisticsRecorder::FindHistogram("TestHistogram1"));
+
+  Histogram* histogram2 = CreateHistogram("TestHistogram2", 1, 1000, 10);
+  EXPECT_EQ(histogram2,
+            StatisticsRecorder::RegisterOrDeleteDuplicate(histogram2));
+  EXPECT_THAT(StatisticsRecorder::GetHistograms(),
+              UnorderedElementsAre(histogram2));
+
+  // Deleting it restores the histograms of the previous recorder.
+  temp_sr.reset();
+  EXPECT_THAT(StatisticsRecorder::GetHistograms(),
+              UnorderedElementsAre(histogram1));
+  EXPECT_EQ(histogram1, StatisticsRecorder::FindHistogram("TestHistogram1"));
+  EXPECT_FALSE(StatisticsRecorder::FindHistogram("TestHistogram2"));
+  delete histogram2;
+}
+
 TEST_P(StatisticsRecorderTest, WithName) {
   Histogram::FactoryGet("TestHistogram1", 1, 1000, 10, Histogram::kNoFlags);
   Histogram::FactoryGet("TestHistogram2", 1, 1000, 10, Histogram::kNoFlags);
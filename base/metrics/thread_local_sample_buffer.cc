@@ -0,0 +1,173 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/metrics/thread_local_sample_buffer.h"
+
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/memory/ptr_util.h"
+#include "base/metrics/histogram.h"
+#include "base/no_destructor.h"
+#include "base/ranges/algorithm.h"
+#include "base/threading/thread_local.h"
+#include "base/threading/thread_local_storage.h"
+
+namespace base {
+
+namespace {
+
+// All the live buffers, so that snapshots can flush the samples other threads
+// buffered. |lock| is always acquired before the lock of a buffer.
+struct BufferRegistry {
+  Lock lock;
+  std::vector<ThreadLocalSampleBuffer*> buffers GUARDED_BY(lock);
+};
+
+BufferRegistry& GetBufferRegistry() {
+  static NoDestructor<BufferRegistry> registry;
+  return *registry;
+}
+
+ThreadLocalOwnedPointer<ThreadLocalSampleBuffer>& GetThreadLocalBuffer() {
+  static NoDestructor<ThreadLocalOwnedPointer<ThreadLocalSampleBuffer>> buffer;
+  return *buffer;
+}
+
+}  // namespace
+
+ThreadLocalSampleBuffer::ThreadLocalSampleBuffer() = default;
+
+ThreadLocalSampleBuffer::~ThreadLocalSampleBuffer() {
+  BufferRegistry& registry = GetBufferRegistry();
+  std::array<Entry, kMaxEntries> entries;
+  size_t count;
+  {
+    AutoLock registry_lock(registry.lock);
+    auto it = ranges::find(registry.buffers, this);
+    CHECK(it != registry.buffers.end());
+    registry.buffers.erase(it);
+    AutoLock buffer_lock(lock_);
+    count = TakeEntries(nullptr, entries);
+  }
+  AccumulateEntries(entries.data(), count);
+}
+
+// static
+void ThreadLocalSampleBuffer::Accumulate(Histogram* histogram,
+                                         HistogramBase::Sample value,
+                                         HistogramBase::Count count) {
+  ThreadLocalSampleBuffer* buffer = GetForCurrentThread();
+  if (!buffer || count >= kMaxBufferedSamples) {
+    Entry entry = {histogram, value, count};
+    AccumulateEntries(&entry, 1);
+    return;
+  }
+
+  std::array<Entry, kMaxEntries> flushed;
+  size_t flushed_count = 0;
+  {
+    AutoLock buffer_lock(buffer->lock_);
+    Entry* entry = nullptr;
+    for (size_t i = 0; i < buffer->entry_count_; ++i) {
+      if (buffer->entries_[i].histogram == histogram &&
+          buffer->entries_[i].value == value) {
+        entry = &buffer->entries_[i];
+        break;
+      }
+    }
+    if (!entry) {
+      if (buffer->entry_count_ == kMaxEntries) {
+        flushed_count = buffer->TakeEntries(nullptr, flushed);
+      }
+      entry = &buffer->entries_[buffer->entry_count_++];
+      *entry = {histogram, value, 0};
+    }
+    entry->count += count;
+    buffer->buffered_samples_ += count;
+    if (buffer->buffered_samples_ >= kMaxBufferedSamples &&
+        flushed_count == 0) {
+      flushed_count = buffer->TakeEntries(nullptr, flushed);
+    }
+  }
+  AccumulateEntries(flushed.data(), flushed_count);
+}
+
+// static
+void ThreadLocalSampleBuffer::FlushHistogram(const Histogram* histogram) {
+  DCHECK(histogram);
+  FlushAllBuffers(histogram);
+}
+
+// static
+void ThreadLocalSampleBuffer::FlushAllForTesting() {
+  FlushAllBuffers(nullptr);
+}
+
+// static
+ThreadLocalSampleBuffer* ThreadLocalSampleBuffer::GetForCurrentThread() {
+  if (ThreadLocalStorage::HasBeenDestroyed()) {
+    return nullptr;
+  }
+  ThreadLocalOwnedPointer<ThreadLocalSampleBuffer>& tls_buffer =
+      GetThreadLocalBuffer();
+  ThreadLocalSampleBuffer* buffer = tls_buffer.Get();
+  if (buffer) {
+    return buffer;
+  }
+
+  buffer = new ThreadLocalSampleBuffer();
+  {
+    BufferRegistry& registry = GetBufferRegistry();
+    AutoLock registry_lock(registry.lock);
+    registry.buffers.push_back(buffer);
+  }
+  tls_buffer.Set(WrapUnique(buffer));
+  return buffer;
+}
+
+// static
+void ThreadLocalSampleBuffer::FlushAllBuffers(const Histogram* histogram) {
+  BufferRegistry& registry = GetBufferRegistry();
+  std::vector<Entry> entries;
+  {
+    AutoLock registry_lock(registry.lock);
+    for (ThreadLocalSampleBuffer* buffer : registry.buffers) {
+      std::array<Entry, kMaxEntries> taken;
+      AutoLock buffer_lock(buffer->lock_);
+      size_t count = buffer->TakeEntries(histogram, taken);
+      entries.insert(entries.end(), taken.begin(), taken.begin() + count);
+    }
+  }
+  AccumulateEntries(entries.data(), entries.size());
+}
+
+// static
+void ThreadLocalSampleBuffer::AccumulateEntries(const Entry* entries,
+                                                size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    entries[i].histogram->unlogged_samples_->Accumulate(entries[i].value,
+                                                        entries[i].count);
+  }
+}
+
+size_t ThreadLocalSampleBuffer::TakeEntries(
+    const Histogram* histogram,
+    std::array<Entry, kMaxEntries>& out) {
+  size_t taken = 0;
+  size_t kept = 0;
+  for (size_t i = 0; i < entry_count_; ++i) {
+    if (!histogram || entries_[i].histogram == histogram) {
+      buffered_samples_ -= entries_[i].count;
+      out[taken++] = entries_[i];
+    } else {
+      entries_[kept++] = entries_[i];
+    }
+  }
+  entry_count_ = kept;
+  DCHECK_GE(buffered_samples_, 0);
+  return taken;
+}
+
+}  // namespace base
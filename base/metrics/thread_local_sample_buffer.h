@@ -0,0 +1,96 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_METRICS_THREAD_LOCAL_SAMPLE_BUFFER_H_
+#define BASE_METRICS_THREAD_LOCAL_SAMPLE_BUFFER_H_
+
+#include <stddef.h>
+
+#include <array>
+
+#include "base/base_export.h"
+#include "base/memory/raw_ptr.h"
+#include "base/metrics/histogram_base.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+
+namespace base {
+
+class Histogram;
+
+// Buffers the samples of histograms that have the
+// HistogramBase::kThreadLocalBuffered flag in a small per-thread buffer, so
+// that threads recording the same hot histogram don't contend on the cache
+// lines of its shared SampleVector counts. Each thread only takes the lock of
+// its own buffer, which is uncontended except while a snapshot is taken.
+//
+// A thread's buffered samples are accumulated into the histograms when its
+// buffer runs out of entries, after |kMaxBufferedSamples| samples, when the
+// thread exits, and when any of the histograms is snapshotted. So snapshots
+// always include every sample recorded before them, and per-thread memory is
+// bounded by |kMaxEntries|. Readers that bypass snapshots, such as another
+// process reading the persistent memory of a histogram, may lag by up to
+// |kMaxBufferedSamples| samples per thread.
+class BASE_EXPORT ThreadLocalSampleBuffer {
+ public:
+  // The number of distinct (histogram, sample) pairs a thread can buffer.
+  static constexpr size_t kMaxEntries = 16;
+  // The number of samples a thread buffers before they are flushed.
+  static constexpr HistogramBase::Count kMaxBufferedSamples = 256;
+
+  ThreadLocalSampleBuffer(const ThreadLocalSampleBuffer&) = delete;
+  ThreadLocalSampleBuffer& operator=(const ThreadLocalSampleBuffer&) = delete;
+
+  // Flushes the buffered samples of the thread that is exiting.
+  ~ThreadLocalSampleBuffer();
+
+  // Buffers |count| samples of |value| for |histogram| on the calling thread.
+  // |value| must already be clamped to the range of |histogram|.
+  static void Accumulate(Histogram* histogram,
+                         HistogramBase::Sample value,
+                         HistogramBase::Count count);
+
+  // Accumulates the samples that all threads buffered for |histogram| into it.
+  static void FlushHistogram(const Histogram* histogram);
+
+  // Accumulates the samples that all threads buffered into their histograms.
+  static void FlushAllForTesting();
+
+ private:
+  struct Entry {
+    raw_ptr<const Histogram> histogram;
+    HistogramBase::Sample value = 0;
+    HistogramBase::Count count = 0;
+  };
+
+  ThreadLocalSampleBuffer();
+
+  // Returns the buffer of the calling thread, creating it if needed. Returns
+  // null if thread local storage was already torn down on this thread.
+  static ThreadLocalSampleBuffer* GetForCurrentThread();
+
+  // Takes the entries of |histogram|, or all entries if it is null, from the
+  // buffers of all threads and accumulates them.
+  static void FlushAllBuffers(const Histogram* histogram);
+
+  // Accumulates |entries| into their histograms. Called without holding any
+  // buffer lock.
+  static void AccumulateEntries(const Entry* entries, size_t count);
+
+  // Moves all entries, or only those of |histogram| if not null, to |out|.
+  // Returns the number of entries moved. The buffer may belong to another
+  // thread, hence the lock.
+  size_t TakeEntries(const Histogram* histogram,
+                     std::array<Entry, kMaxEntries>& out)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  Lock lock_;
+  std::array<Entry, kMaxEntries> entries_ GUARDED_BY(lock_);
+  size_t entry_count_ GUARDED_BY(lock_) = 0;
+  HistogramBase::Count buffered_samples_ GUARDED_BY(lock_) = 0;
+};
+
+}  // namespace base
+
+#endif  // BASE_METRICS_THREAD_LOCAL_SAMPLE_BUFFER_H_
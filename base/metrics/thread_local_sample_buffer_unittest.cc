@@ -0,0 +1,131 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/metrics/thread_local_sample_buffer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/memory/raw_ptr.h"
+#include "base/metrics/histogram.h"
+#include "base/metrics/histogram_samples.h"
+#include "base/metrics/statistics_recorder.h"
+#include "base/threading/simple_thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+class AddSamplesThread : public SimpleThread {
+ public:
+  AddSamplesThread(HistogramBase* histogram, int num_samples)
+      : SimpleThread("AddSamplesThread"),
+        histogram_(histogram),
+        num_samples_(num_samples) {}
+
+  // SimpleThread:
+  void Run() override {
+    for (int i = 0; i < num_samples_; ++i) {
+      histogram_->Add(i % 10);
+    }
+  }
+
+ private:
+  const raw_ptr<HistogramBase> histogram_;
+  const int num_samples_;
+};
+
+}  // namespace
+
+class ThreadLocalSampleBufferTest : public testing::Test {
+ protected:
+  ThreadLocalSampleBufferTest()
+      : statistics_recorder_(StatisticsRecorder::CreateTemporaryForTesting()) {}
+
+  HistogramBase* CreateBufferedHistogram(const std::string& name) {
+    return Histogram::FactoryGet(name, 1, 100, 50,
+                                 HistogramBase::kThreadLocalBuffered);
+  }
+
+ private:
+  std::unique_ptr<StatisticsRecorder> statistics_recorder_;
+};
+
+TEST_F(ThreadLocalSampleBufferTest, SnapshotsIncludeBufferedSamples) {
+  HistogramBase* histogram = CreateBufferedHistogram("TLSBTest.Snapshot");
+  ASSERT_TRUE(histogram->HasFlags(HistogramBase::kThreadLocalBuffered));
+
+  histogram->Add(5);
+  histogram->AddCount(7, 3);
+  std::unique_ptr<HistogramSamples> samples = histogram->SnapshotSamples();
+  EXPECT_EQ(4, samples->TotalCount());
+  EXPECT_EQ(1, samples->GetCount(5));
+  EXPECT_EQ(3, samples->GetCount(7));
+
+  histogram->Add(5);
+  samples = histogram->SnapshotDelta();
+  EXPECT_EQ(5, samples->TotalCount());
+  EXPECT_EQ(2, samples->GetCount(5));
+  EXPECT_EQ(0, histogram->SnapshotDelta()->TotalCount());
+}
+
+TEST_F(ThreadLocalSampleBufferTest, ManyDistinctSamples) {
+  HistogramBase* histogram = CreateBufferedHistogram("TLSBTest.Distinct");
+
+  // More distinct values than a buffer has entries, and more samples than it
+  // buffers before flushing.
+  const int kNumValues =
+      static_cast<int>(ThreadLocalSampleBuffer::kMaxEntries) * 3;
+  const int kRepetitions = ThreadLocalSampleBuffer::kMaxBufferedSamples / 10;
+  for (int r = 0; r < kRepetitions; ++r) {
+    for (int i = 1; i <= kNumValues; ++i) {
+      histogram->Add(i);
+    }
+  }
+  histogram->AddCount(1, ThreadLocalSampleBuffer::kMaxBufferedSamples);
+
+  std::unique_ptr<HistogramSamples> samples = histogram->SnapshotSamples();
+  EXPECT_EQ(kNumValues * kRepetitions +
+                ThreadLocalSampleBuffer::kMaxBufferedSamples,
+            samples->TotalCount());
+  EXPECT_EQ(kRepetitions + ThreadLocalSampleBuffer::kMaxBufferedSamples,
+            samples->GetCount(1));
+}
+
+TEST_F(ThreadLocalSampleBufferTest, SamplesFromManyThreads) {
+  HistogramBase* histogram = CreateBufferedHistogram("TLSBTest.Threads");
+
+  constexpr int kNumThreads = 8;
+  constexpr int kSamplesPerThread = 1005;
+  std::vector<std::unique_ptr<AddSamplesThread>> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.push_back(
+        std::make_unique<AddSamplesThread>(histogram, kSamplesPerThread));
+    threads.back()->Start();
+  }
+  for (auto& thread : threads) {
+    thread->Join();
+  }
+
+  // Samples the threads still had buffered were flushed when they exited.
+  std::unique_ptr<HistogramSamples> samples = histogram->SnapshotSamples();
+  EXPECT_EQ(kNumThreads * kSamplesPerThread, samples->TotalCount());
+  EXPECT_EQ(kNumThreads * 101, samples->GetCount(1));
+}
+
+TEST_F(ThreadLocalSampleBufferTest, UnbufferedHistogramsAreUnaffected) {
+  HistogramBase* buffered = CreateBufferedHistogram("TLSBTest.Buffered");
+  HistogramBase* unbuffered = Histogram::FactoryGet(
+      "TLSBTest.Unbuffered", 1, 100, 50, HistogramBase::kNoFlags);
+
+  buffered->Add(3);
+  unbuffered->Add(3);
+  ThreadLocalSampleBuffer::FlushAllForTesting();
+  EXPECT_EQ(1, buffered->SnapshotSamples()->GetCount(3));
+  EXPECT_EQ(1, unbuffered->SnapshotSamples()->GetCount(3));
+}
+
+}  // namespace base
@@ -5,9 +5,16 @@
 #include "base/observer_list.h"
 
 #include <memory>
+#include <vector>
 
 #include "base/check_op.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "base/location.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/observer_list_threadsafe.h"
 #include "base/strings/stringprintf.h"
+#include "base/threading/thread.h"
 #include "base/time/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "testing/perf/perf_result_reporter.h"
@@ -20,12 +27,14 @@ namespace base {
 
 constexpr char kMetricPrefixObserverList[] = "ObserverList.";
 constexpr char kMetricNotifyTimePerObserver[] = "notify_time_per_observer";
+constexpr char kMetricNotifyTimePerDelivery[] = "notify_time_per_delivery";
 
 namespace {
 
 perf_test::PerfResultReporter SetUpReporter(const std::string& story_name) {
   perf_test::PerfResultReporter reporter(kMetricPrefixObserverList, story_name);
   reporter.RegisterImportantMetric(kMetricNotifyTimePerObserver, "ns");
+  reporter.RegisterImportantMetric(kMetricNotifyTimePerDelivery, "ns");
   return reporter;
 }
 
@@ -127,4 +136,72 @@ TYPED_TEST(ObserverListPerfTest, NotifyPerformance) {
   }
 }
 
+// Observer for ObserverListThreadSafe. Each instance is only ever notified on
+// the thread it was added on, so the counter needs no synchronization.
+class ThreadSafeListObserver {
+ public:
+  void Observe() { ++count_; }
+  int count() const { return count_; }
+
+ private:
+  int count_ = 0;
+};
+
+// Performance test for cross-sequence notifications through
+// base::ObserverListThreadSafe: Notify() is called from the main thread and
+// delivered to observers living on |thread_count| other threads.
+TEST(ObserverListThreadSafePerfTest, NotifyThroughput) {
+  constexpr int kMaxThreads = 8;
+#if DCHECK_IS_ON()
+  constexpr int kNotifications = 10000;
+#else
+  constexpr int kNotifications = 100000;
+#endif
+  using ObserverListType = ObserverListThreadSafe<ThreadSafeListObserver>;
+
+  for (int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+    auto list = MakeRefCounted<ObserverListType>();
+    std::vector<std::unique_ptr<Thread>> threads;
+    std::vector<std::unique_ptr<ThreadSafeListObserver>> observers;
+    for (int i = 0; i < thread_count; ++i) {
+      threads.push_back(
+          std::make_unique<Thread>(StringPrintf("ObserverThread%d", i)));
+      ASSERT_TRUE(threads.back()->Start());
+      observers.push_back(std::make_unique<ThreadSafeListObserver>());
+      threads.back()->task_runner()->PostTask(
+          FROM_HERE,
+          BindOnce(IgnoreResult(&ObserverListType::AddObserver), list,
+                   Unretained(observers.back().get())));
+    }
+    for (auto& thread : threads)
+      thread->FlushForTesting();
+
+    TimeTicks start = TimeTicks::Now();
+    for (int i = 0; i < kNotifications; ++i)
+      list->Notify(FROM_HERE, &ThreadSafeListObserver::Observe);
+    // Each thread runs its notifications in posting order, so flushing
+    // guarantees that all of them have been delivered.
+    for (auto& thread : threads)
+      thread->FlushForTesting();
+    TimeDelta duration = TimeTicks::Now() - start;
+
+    int deliveries = 0;
+    for (auto& o : observers) {
+      EXPECT_EQ(kNotifications, o->count());
+      deliveries += o->count();
+    }
+
+    for (auto& o : observers)
+      list->RemoveObserver(o.get());
+    for (auto& thread : threads)
+      thread->Stop();
+
+    auto reporter = SetUpReporter(
+        StringPrintf("ThreadSafeObserver_%d_threads", thread_count));
+    reporter.AddResult(kMetricNotifyTimePerDelivery,
+                       duration.InNanoseconds() /
+                           static_cast<double>(deliveries));
+  }
+}
+
 }  // namespace base
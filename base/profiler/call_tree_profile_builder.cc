@@ -0,0 +1,95 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/profiler/call_tree_profile_builder.h"
+
+#include "base/check_op.h"
+#include "base/profiler/frame.h"
+
+namespace base {
+
+CallTreeProfileBuilder::Delta::Delta() = default;
+
+CallTreeProfileBuilder::Delta::Delta(Delta&&) = default;
+
+CallTreeProfileBuilder::Delta& CallTreeProfileBuilder::Delta::operator=(
+    Delta&&) = default;
+
+CallTreeProfileBuilder::Delta::~Delta() = default;
+
+CallTreeProfileBuilder::CallTreeProfileBuilder(size_t max_nodes)
+    : max_nodes_(max_nodes) {
+  DCHECK_GT(max_nodes_, 0u);
+}
+
+CallTreeProfileBuilder::~CallTreeProfileBuilder() = default;
+
+ModuleCache* CallTreeProfileBuilder::GetModuleCache() {
+  return &module_cache_;
+}
+
+void CallTreeProfileBuilder::OnSampleCompleted(std::vector<Frame> frames,
+                                               TimeTicks sample_timestamp) {
+  if (frames.empty()) {
+    return;
+  }
+
+  AutoLock auto_lock(lock_);
+  // `frames` starts with the innermost frame, so the tree is walked from the
+  // back.
+  size_t node = kNoParent;
+  for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+    const size_t child = GetOrAddNode(node, *it);
+    if (child == kNoParent) {
+      ++truncated_samples_;
+      break;
+    }
+    node = child;
+  }
+  if (node != kNoParent) {
+    ++sample_counts_[node];
+  }
+}
+
+void CallTreeProfileBuilder::OnProfileCompleted(TimeDelta profile_duration,
+                                                TimeDelta sampling_period) {}
+
+CallTreeProfileBuilder::Delta CallTreeProfileBuilder::TakeDelta() {
+  AutoLock auto_lock(lock_);
+  Delta delta;
+  delta.new_nodes.assign(nodes_.begin() + exported_node_count_, nodes_.end());
+  exported_node_count_ = nodes_.size();
+  for (size_t i = 0; i < sample_counts_.size(); ++i) {
+    if (sample_counts_[i]) {
+      delta.sample_counts.emplace_back(i, sample_counts_[i]);
+      sample_counts_[i] = 0;
+    }
+  }
+  delta.truncated_samples = truncated_samples_;
+  truncated_samples_ = 0;
+  return delta;
+}
+
+size_t CallTreeProfileBuilder::GetOrAddNode(size_t parent,
+                                            const Frame& frame) {
+  const uintptr_t offset =
+      frame.module ? frame.instruction_pointer - frame.module->GetBaseAddress()
+                   : frame.instruction_pointer;
+  const NodeKey key(parent, frame.module, offset);
+  auto it = node_indices_.find(key);
+  if (it != node_indices_.end()) {
+    return it->second;
+  }
+  if (nodes_.size() == max_nodes_) {
+    return kNoParent;
+  }
+
+  const size_t index = nodes_.size();
+  nodes_.push_back({parent, frame.module, offset});
+  sample_counts_.push_back(0);
+  node_indices_.emplace(key, index);
+  return index;
+}
+
+}  // namespace base
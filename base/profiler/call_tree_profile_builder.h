@@ -0,0 +1,113 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_PROFILER_CALL_TREE_PROFILE_BUILDER_H_
+#define BASE_PROFILER_CALL_TREE_PROFILE_BUILDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "base/base_export.h"
+#include "base/memory/raw_ptr.h"
+#include "base/profiler/module_cache.h"
+#include "base/profiler/profile_builder.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+
+namespace base {
+
+// A ProfileBuilder that aggregates samples into a call tree as they are
+// recorded, instead of keeping each sample. Equal stacks share their nodes, so
+// the memory used depends on the number of distinct call paths rather than on
+// how long the profile runs, and is bounded by `max_nodes`.
+//
+// This is meant for continuous profiling of a thread at low frequency, e.g.
+// with SamplingParams::samples_per_profile set to
+// std::numeric_limits<int>::max(). The aggregated counts are exported with
+// TakeDelta(), which can be called from any thread while sampling continues.
+class BASE_EXPORT CallTreeProfileBuilder : public ProfileBuilder {
+ public:
+  // Parent of the nodes for outermost frames.
+  static constexpr size_t kNoParent = static_cast<size_t>(-1);
+
+  // A frame in the call tree. Nodes are identified by their index in the order
+  // they were added, starting at 0.
+  struct Node {
+    // Index of the node of the calling frame, or kNoParent.
+    size_t parent = kNoParent;
+    // The module of the frame, owned by GetModuleCache(). Null if the frame's
+    // module couldn't be found.
+    raw_ptr<const ModuleCache::Module> module;
+    // The instruction pointer of the frame, relative to `module`'s base
+    // address if there is a module.
+    uintptr_t offset = 0;
+  };
+
+  // What was recorded since the previous TakeDelta().
+  struct BASE_EXPORT Delta {
+    Delta();
+    Delta(Delta&&);
+    Delta& operator=(Delta&&);
+    ~Delta();
+
+    // The nodes added since the previous delta, in index order. The index of
+    // the first one is the number of nodes in the previous deltas.
+    std::vector<Node> new_nodes;
+    // (node index, count) of the samples whose innermost recorded frame is at
+    // that node, for the nodes that had any.
+    std::vector<std::pair<size_t, size_t>> sample_counts;
+    // Samples recorded at a shallower node than their innermost frame, or not
+    // recorded at all, because the tree had reached `max_nodes`.
+    size_t truncated_samples = 0;
+  };
+
+  explicit CallTreeProfileBuilder(size_t max_nodes);
+
+  CallTreeProfileBuilder(const CallTreeProfileBuilder&) = delete;
+  CallTreeProfileBuilder& operator=(const CallTreeProfileBuilder&) = delete;
+
+  ~CallTreeProfileBuilder() override;
+
+  // ProfileBuilder:
+  ModuleCache* GetModuleCache() override;
+  void OnSampleCompleted(std::vector<Frame> frames,
+                         TimeTicks sample_timestamp) override;
+  void OnProfileCompleted(TimeDelta profile_duration,
+                          TimeDelta sampling_period) override;
+
+  // Returns what was recorded since the previous call, and resets the counts.
+  Delta TakeDelta();
+
+ private:
+  // (parent index, module, offset) of a node.
+  using NodeKey = std::tuple<size_t, const ModuleCache::Module*, uintptr_t>;
+
+  // Returns the index of the child of `parent` for `frame`, adding it if there
+  // is room. Returns kNoParent if there isn't.
+  size_t GetOrAddNode(size_t parent, const Frame& frame)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  const size_t max_nodes_;
+
+  // Only used on the profiler thread.
+  ModuleCache module_cache_;
+
+  Lock lock_;
+  std::vector<Node> nodes_ GUARDED_BY(lock_);
+  std::map<NodeKey, size_t> node_indices_ GUARDED_BY(lock_);
+  // Per node, the samples recorded since the previous delta.
+  std::vector<size_t> sample_counts_ GUARDED_BY(lock_);
+  // Number of nodes that were already in a delta.
+  size_t exported_node_count_ GUARDED_BY(lock_) = 0;
+  size_t truncated_samples_ GUARDED_BY(lock_) = 0;
+};
+
+}  // namespace base
+
+#endif  // BASE_PROFILER_CALL_TREE_PROFILE_BUILDER_H_
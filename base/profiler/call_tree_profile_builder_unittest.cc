@@ -0,0 +1,93 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/profiler/call_tree_profile_builder.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/profiler/frame.h"
+#include "base/profiler/stack_sampling_profiler_test_util.h"
+#include "base/time/time.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+constexpr size_t kNoParent = CallTreeProfileBuilder::kNoParent;
+
+void RecordSample(CallTreeProfileBuilder& builder, std::vector<Frame> frames) {
+  builder.OnSampleCompleted(std::move(frames), TimeTicks::Now());
+}
+
+}  // namespace
+
+TEST(CallTreeProfileBuilderTest, AggregatesEqualStacks) {
+  TestModule module(0x1000, 0x1000);
+  CallTreeProfileBuilder builder(/*max_nodes=*/10);
+
+  // Frames go from innermost to outermost.
+  RecordSample(builder, {Frame(0x1020, &module), Frame(0x1010, &module)});
+  RecordSample(builder, {Frame(0x1020, &module), Frame(0x1010, &module)});
+  RecordSample(builder, {Frame(0x1030, &module), Frame(0x1010, &module)});
+  RecordSample(builder, {Frame(0x5000, nullptr)});
+
+  CallTreeProfileBuilder::Delta delta = builder.TakeDelta();
+  ASSERT_EQ(4u, delta.new_nodes.size());
+  EXPECT_EQ(kNoParent, delta.new_nodes[0].parent);
+  EXPECT_EQ(&module, delta.new_nodes[0].module);
+  EXPECT_EQ(0x10u, delta.new_nodes[0].offset);
+  EXPECT_EQ(0u, delta.new_nodes[1].parent);
+  EXPECT_EQ(0x20u, delta.new_nodes[1].offset);
+  EXPECT_EQ(0u, delta.new_nodes[2].parent);
+  EXPECT_EQ(0x30u, delta.new_nodes[2].offset);
+  EXPECT_EQ(kNoParent, delta.new_nodes[3].parent);
+  EXPECT_EQ(nullptr, delta.new_nodes[3].module);
+  EXPECT_EQ(0x5000u, delta.new_nodes[3].offset);
+  EXPECT_THAT(delta.sample_counts,
+              ElementsAre(Pair(1u, 2u), Pair(2u, 1u), Pair(3u, 1u)));
+  EXPECT_EQ(0u, delta.truncated_samples);
+}
+
+TEST(CallTreeProfileBuilderTest, DeltasOnlyHaveNewData) {
+  TestModule module(0x1000, 0x1000);
+  CallTreeProfileBuilder builder(/*max_nodes=*/10);
+
+  RecordSample(builder, {Frame(0x1010, &module)});
+  builder.TakeDelta();
+
+  CallTreeProfileBuilder::Delta delta = builder.TakeDelta();
+  EXPECT_TRUE(delta.new_nodes.empty());
+  EXPECT_TRUE(delta.sample_counts.empty());
+
+  RecordSample(builder, {Frame(0x1010, &module)});
+  RecordSample(builder, {Frame(0x1020, &module)});
+  delta = builder.TakeDelta();
+  ASSERT_EQ(1u, delta.new_nodes.size());
+  EXPECT_EQ(0x20u, delta.new_nodes[0].offset);
+  EXPECT_THAT(delta.sample_counts, ElementsAre(Pair(0u, 1u), Pair(1u, 1u)));
+}
+
+TEST(CallTreeProfileBuilderTest, TruncatesAtMaxNodes) {
+  TestModule module(0x1000, 0x1000);
+  CallTreeProfileBuilder builder(/*max_nodes=*/2);
+
+  RecordSample(builder, {Frame(0x1030, &module), Frame(0x1020, &module),
+                         Frame(0x1010, &module)});
+  RecordSample(builder, {Frame(0x1040, &module)});
+
+  CallTreeProfileBuilder::Delta delta = builder.TakeDelta();
+  EXPECT_EQ(2u, delta.new_nodes.size());
+  // The first sample is recorded at the deepest node that fit, the second one
+  // isn't recorded.
+  EXPECT_THAT(delta.sample_counts, ElementsAre(Pair(1u, 1u)));
+  EXPECT_EQ(2u, delta.truncated_samples);
+}
+
+}  // namespace base
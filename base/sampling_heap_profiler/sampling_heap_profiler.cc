@@ -55,6 +55,17 @@ ThreadLocalData* GetThreadLocalData() {
 #endif
 }
 
+// Returns the number of allocations `sample` stands for, at least 1.
+size_t GetEstimatedCount(const SamplingHeapProfiler::Sample& sample) {
+  if (!sample.size) {
+    return 1;
+  }
+  return std::max<size_t>(
+      static_cast<size_t>(
+          std::llround(static_cast<double>(sample.total) / sample.size)),
+      1);
+}
+
 #if BUILDFLAG(CAN_UNWIND_WITH_FRAME_POINTERS)
 BASE_FEATURE(kAvoidFramePointers,
              "AndroidHeapSamplerAvoidFramePointers",
@@ -262,7 +273,12 @@ void SamplingHeapProfiler::SampleAdded(void* address,
   // the sampling heap profiler failed to observe the destruction -- possibly
   // because the sampling heap profiler was temporarily disabled. We should
   // override the old entry.
-  samples_.insert_or_assign(address, std::move(sample));
+  AddToStackTotals(sample);
+  auto [it, inserted] = samples_.try_emplace(address, std::move(sample));
+  if (!inserted) {
+    RemoveFromStackTotals(it->second);
+    it->second = std::move(sample);
+  }
 }
 
 void SamplingHeapProfiler::CaptureNativeStack(const char* context,
@@ -291,10 +307,34 @@ const char* SamplingHeapProfiler::RecordString(const char* string) {
   return string ? *strings_.insert(string).first : nullptr;
 }
 
+void SamplingHeapProfiler::AddToStackTotals(const Sample& sample) {
+  StackTotals& totals = stack_totals_[sample.stack];
+  totals.total += sample.total;
+  totals.count += GetEstimatedCount(sample);
+  ++totals.samples;
+}
+
+void SamplingHeapProfiler::RemoveFromStackTotals(const Sample& sample) {
+  auto it = stack_totals_.find(sample.stack);
+  CHECK(it != stack_totals_.end());
+  StackTotals& totals = it->second;
+  if (--totals.samples == 0) {
+    stack_totals_.erase(it);
+    return;
+  }
+  totals.total -= sample.total;
+  totals.count -= GetEstimatedCount(sample);
+}
+
 void SamplingHeapProfiler::SampleRemoved(void* address) {
   DCHECK(base::PoissonAllocationSampler::ScopedMuteThreadSamples::IsMuted());
   base::AutoLock lock(mutex_);
-  samples_.erase(address);
+  auto it = samples_.find(address);
+  if (it == samples_.end()) {
+    return;
+  }
+  RemoveFromStackTotals(it->second);
+  samples_.erase(it);
 }
 
 std::vector<SamplingHeapProfiler::Sample> SamplingHeapProfiler::GetSamples(
@@ -314,6 +354,14 @@ std::vector<SamplingHeapProfiler::Sample> SamplingHeapProfiler::GetSamples(
   return samples;
 }
 
+SamplingHeapProfiler::StackTotalsMap
+SamplingHeapProfiler::GetLiveTotalsByStack() {
+  // See GetSamples().
+  PoissonAllocationSampler::ScopedMuteThreadSamples no_samples_scope;
+  AutoLock lock(mutex_);
+  return stack_totals_;
+}
+
 std::vector<const char*> SamplingHeapProfiler::GetStrings() {
   PoissonAllocationSampler::ScopedMuteThreadSamples no_samples_scope;
   AutoLock lock(mutex_);
@@ -340,6 +388,7 @@ void SamplingHeapProfiler::ClearSamplesForTesting() {
   DCHECK(PoissonAllocationSampler::AreHookedSamplesMuted());
   base::AutoLock lock(mutex_);
   samples_.clear();
+  stack_totals_.clear();
   // Since hooked samples are muted, any samples that are waiting to take the
   // lock in SampleAdded will be discarded. Tests can now call
   // PoissonAllocationSampler::RecordAlloc with allocator type kManualForTesting
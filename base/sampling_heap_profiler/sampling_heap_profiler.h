@@ -6,6 +6,7 @@
 #define BASE_SAMPLING_HEAP_PROFILER_SAMPLING_HEAP_PROFILER_H_
 
 #include <atomic>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -59,6 +60,20 @@ class BASE_EXPORT SamplingHeapProfiler
     uint32_t ordinal;
   };
 
+  // Live totals of the samples that share a call stack.
+  struct StackTotals {
+    // Sum of Sample::total.
+    size_t total = 0;
+    // Estimated number of allocations the samples stand for.
+    size_t count = 0;
+    // Number of samples.
+    size_t samples = 0;
+  };
+
+  // Keyed by Sample::stack. A std::map, since comparing stacks usually stops
+  // at one of the first frames, where hashing would go over the whole stack.
+  using StackTotalsMap = std::map<std::vector<const void*>, StackTotals>;
+
   // On Android this is logged to UMA - keep in sync AndroidStackUnwinder in
   // enums.xml.
   enum class StackUnwinder {
@@ -94,6 +109,11 @@ class BASE_EXPORT SamplingHeapProfiler
   // set to 0.
   std::vector<Sample> GetSamples(uint32_t profile_id);
 
+  // Returns the totals of all the live samples, per call stack. This is
+  // cheaper than aggregating GetSamples(0): the totals are kept up to date as
+  // samples get added and removed, so this only copies one entry per stack.
+  StackTotalsMap GetLiveTotalsByStack();
+
   // List of strings used in the profile call stacks.
   std::vector<const char*> GetStrings();
 
@@ -126,6 +146,9 @@ class BASE_EXPORT SamplingHeapProfiler
   void SampleRemoved(void* address) override;
 
   void CaptureNativeStack(const char* context, Sample* sample);
+  void AddToStackTotals(const Sample& sample) EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void RemoveFromStackTotals(const Sample& sample)
+      EXCLUSIVE_LOCKS_REQUIRED(mutex_);
   const char* RecordString(const char* string) EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
   // Delete all samples recorded, to ensure the profiler is in a consistent
@@ -140,6 +163,9 @@ class BASE_EXPORT SamplingHeapProfiler
   // Samples of the currently live allocations.
   std::unordered_map<void*, Sample> samples_ GUARDED_BY(mutex_);
 
+  // Totals of `samples_` per call stack.
+  StackTotalsMap stack_totals_ GUARDED_BY(mutex_);
+
   // Contains pointers to static sample context strings that are never deleted.
   std::unordered_set<const char*> strings_ GUARDED_BY(mutex_);
 
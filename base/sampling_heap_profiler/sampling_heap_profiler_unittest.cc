@@ -53,6 +53,10 @@ class SamplingHeapProfilerTest : public ::testing::Test {
     return PoissonAllocationSampler::GetNextSampleInterval(mean_interval);
   }
 
+  static void ClearSamples() {
+    SamplingHeapProfiler::Get()->ClearSamplesForTesting();
+  }
+
   static int GetRunningSessionsCount() {
     return SamplingHeapProfiler::Get()->running_sessions_;
   }
@@ -377,4 +381,43 @@ TEST_F(SamplingHeapProfilerTest, HookedAllocatorMuted) {
   EXPECT_TRUE(collector.sample_removed);
 }
 
+TEST_F(SamplingHeapProfilerTest, LiveTotalsByStack) {
+  ScopedSuppressRandomnessForTesting suppress;
+  PoissonAllocationSampler::ScopedMuteHookedSamplesForTesting mute_hooks;
+  auto* profiler = SamplingHeapProfiler::Get();
+  auto* sampler = PoissonAllocationSampler::Get();
+  ClearSamples();
+  profiler->SetSamplingInterval(1024);
+  profiler->Start();
+
+  // Allocations made from the same call site share a stack.
+  void* const kAddresses[] = {reinterpret_cast<void*>(0x1000),
+                              reinterpret_cast<void*>(0x2000)};
+  for (void* address : kAddresses) {
+    sampler->OnAllocation(AllocationNotificationData(
+        address, 10000, nullptr, AllocationSubsystem::kManualForTesting));
+  }
+
+  std::vector<SamplingHeapProfiler::Sample> samples = profiler->GetSamples(0);
+  ASSERT_EQ(2u, samples.size());
+  SamplingHeapProfiler::StackTotalsMap totals =
+      profiler->GetLiveTotalsByStack();
+  ASSERT_EQ(1u, totals.size());
+  EXPECT_EQ(samples[0].stack, totals.begin()->first);
+  EXPECT_EQ(2u, totals.begin()->second.samples);
+  EXPECT_EQ(samples[0].total + samples[1].total, totals.begin()->second.total);
+
+  sampler->OnFree(FreeNotificationData(kAddresses[0],
+                                       AllocationSubsystem::kManualForTesting));
+  totals = profiler->GetLiveTotalsByStack();
+  ASSERT_EQ(1u, totals.size());
+  EXPECT_EQ(1u, totals.begin()->second.samples);
+
+  sampler->OnFree(FreeNotificationData(kAddresses[1],
+                                       AllocationSubsystem::kManualForTesting));
+  EXPECT_TRUE(profiler->GetLiveTotalsByStack().empty());
+
+  profiler->Stop();
+}
+
 }  // namespace base
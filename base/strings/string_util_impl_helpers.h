@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <optional>
 #include <string_view>
+#include <type_traits>
 
 #include "base/check.h"
 #include "base/check_op.h"
@@ -152,19 +153,25 @@ std::basic_string<CharT> CollapseWhitespaceT(
   return result;
 }
 
+// Returns a mask of the bits that are set in a machine word holding
+// |sizeof(MachineWord) / sizeof(Char)| characters iff any of them isn't ASCII.
 template <class Char>
-bool DoIsStringASCII(const Char* characters, size_t length) {
+constexpr MachineWord NonASCIIMask() {
   // Bitmasks to detect non ASCII characters for character sizes of 8, 16 and 32
   // bits.
   constexpr MachineWord NonASCIIMasks[] = {
       0, MachineWord(0x8080808080808080ULL), MachineWord(0xFF80FF80FF80FF80ULL),
       0, MachineWord(0xFFFFFF80FFFFFF80ULL),
   };
+  static_assert(NonASCIIMasks[sizeof(Char)], "Error: Invalid Mask");
+  return NonASCIIMasks[sizeof(Char)];
+}
 
+template <class Char>
+bool DoIsStringASCII(const Char* characters, size_t length) {
   if (!length)
     return true;
-  constexpr MachineWord non_ascii_bit_mask = NonASCIIMasks[sizeof(Char)];
-  static_assert(non_ascii_bit_mask, "Error: Invalid Mask");
+  constexpr MachineWord non_ascii_bit_mask = NonASCIIMask<Char>();
   MachineWord all_char_bits = 0;
   const Char* end = characters + length;
 
@@ -201,6 +208,39 @@ bool DoIsStringASCII(const Char* characters, size_t length) {
   return !(all_char_bits & non_ascii_bit_mask);
 }
 
+// Returns the number of ASCII characters at the start of |characters|, i.e.
+// the index of the first non-ASCII character or |length| if there is none.
+// Like DoIsStringASCII(), this looks at a machine word at a time, so that the
+// long runs of ASCII in typical text are skipped quickly.
+template <class Char>
+size_t CountLeadingASCII(const Char* characters, size_t length) {
+  constexpr MachineWord non_ascii_bit_mask = NonASCIIMask<Char>();
+  const Char* const begin = characters;
+  const Char* const end = characters + length;
+  auto is_ascii = [](Char c) {
+    return static_cast<std::make_unsigned_t<Char>>(c) < 0x80;
+  };
+
+  // Prologue: align the input.
+  while (characters < end && !IsMachineWordAligned(characters)) {
+    if (!is_ascii(*characters))
+      return static_cast<size_t>(characters - begin);
+    ++characters;
+  }
+
+  // Skip whole words of ASCII, then find the non-ASCII character within the
+  // word that stopped the loop, if any.
+  constexpr size_t chars_per_word = sizeof(MachineWord) / sizeof(Char);
+  while (static_cast<size_t>(end - characters) >= chars_per_word &&
+         !(*(reinterpret_cast<const MachineWord*>(characters)) &
+           non_ascii_bit_mask)) {
+    characters += chars_per_word;
+  }
+  while (characters < end && is_ascii(*characters))
+    ++characters;
+  return static_cast<size_t>(characters - begin);
+}
+
 template <bool (*Validator)(base_icu::UChar32)>
 inline bool DoIsStringUTF8(StringPiece str) {
   const uint8_t* src = reinterpret_cast<const uint8_t*>(str.data());
@@ -208,6 +248,12 @@ inline bool DoIsStringUTF8(StringPiece str) {
   size_t char_index = 0;
 
   while (char_index < src_len) {
+    // ASCII is valid for every Validator, so skip runs of it at once.
+    if (src[char_index] < 0x80) {
+      char_index += CountLeadingASCII(str.data() + char_index,
+                                      src_len - char_index);
+      continue;
+    }
     base_icu::UChar32 code_point;
     CBU8_NEXT(src, char_index, src_len, code_point);
     if (!Validator(code_point))
@@ -5,7 +5,9 @@
 #include "base/strings/string_util.h"
 
 #include <cinttypes>
+#include <string>
 
+#include "base/strings/utf_string_conversions.h"
 #include "base/time/time.h"
 #include "build/build_config.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -43,4 +45,52 @@ TEST(StringUtilTest, DISABLED_IsStringASCIIPerf) {
   }
 }
 
+// Returns |length| bytes of UTF-8 text in which every |ascii_run|th character
+// is a three byte CJK character, and the others are ASCII.
+std::string MakeUTF8Text(size_t length, size_t ascii_run) {
+  std::string str;
+  while (str.size() + 3 <= length) {
+    for (size_t i = 0; i < ascii_run && str.size() < length - 3; ++i)
+      str.push_back(static_cast<char>('a' + i % 26));
+    str.append("\xe7\xbd\x91");
+  }
+  str.resize(length, ' ');
+  return str;
+}
+
+void MeasureUTFConversions(size_t length, size_t ascii_run) {
+  const std::string utf8 = MakeUTF8Text(length, ascii_run);
+  const std::u16string utf16 = UTF8ToUTF16(utf8);
+  const size_t iterations = 100000000 / length;
+
+  TimeTicks t0 = TimeTicks::Now();
+  for (size_t i = 0; i < iterations; ++i)
+    IsStringUTF8(utf8);
+  TimeTicks t1 = TimeTicks::Now();
+  for (size_t i = 0; i < iterations; ++i)
+    UTF8ToUTF16(utf8);
+  TimeTicks t2 = TimeTicks::Now();
+  for (size_t i = 0; i < iterations; ++i)
+    UTF16ToUTF8(utf16);
+  TimeTicks t3 = TimeTicks::Now();
+
+  // Throughput in bytes of UTF-8 per microsecond, i.e. MB/s.
+  auto throughput = [&](TimeDelta time) {
+    return static_cast<double>(length * iterations) / time.InMicrosecondsF();
+  };
+  printf(
+      "length:\t%zu\tascii-run:\t%zu\tIsStringUTF8-MBps:\t%.0f"
+      "\tUTF8ToUTF16-MBps:\t%.0f\tUTF16ToUTF8-MBps:\t%.0f\n",
+      length, ascii_run, throughput(t1 - t0), throughput(t2 - t1),
+      throughput(t3 - t2));
+}
+
+TEST(StringUtilTest, DISABLED_UTFConversionsPerf) {
+  for (size_t length = 16; length <= 4096; length *= 4) {
+    // From CJK text to mostly ASCII text.
+    for (size_t ascii_run : {0u, 1u, 8u, 64u, 1024u})
+      MeasureUTFConversions(length, ascii_run);
+  }
+}
+
 }  // namespace base
@@ -14,6 +14,7 @@
 
 #include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
+#include "base/strings/string_util_impl_helpers.h"
 #include "base/strings/utf_ostream_operators.h"
 #include "base/strings/utf_string_conversion_utils.h"
 #include "base/third_party/icu/icu_utf.h"
@@ -95,6 +96,41 @@ void UnicodeAppendUnsafe(Char* out,
   out[(*size)++] = static_cast<Char>(code_point);
 }
 
+// AppendASCIIUnsafe ----------------------------------------------------------
+// Copies |len| ASCII codeunits, which are the same in all encodings, to the
+// output string. Output string has to have enough space for them. This loop
+// is simple enough for compilers to vectorize it into widening or narrowing
+// SIMD copies.
+
+template <typename SrcChar, typename DestChar>
+void AppendASCIIUnsafe(const SrcChar* src,
+                       size_t len,
+                       DestChar* out,
+                       size_t* size) {
+  DestChar* const dest = out + *size;
+  for (size_t i = 0; i < len; ++i) {
+    dest[i] = static_cast<DestChar>(src[i]);
+  }
+  *size += len;
+}
+
+// Copies the run of ASCII starting at |src[*i]| to the output string and
+// advances |*i| past it. Returns false if |src[*i]| isn't ASCII.
+template <typename SrcChar, typename DestChar>
+bool AppendASCIIRunUnsafe(const SrcChar* src,
+                          size_t src_len,
+                          size_t* i,
+                          DestChar* out,
+                          size_t* size) {
+  if (static_cast<std::make_unsigned_t<SrcChar>>(src[*i]) >= 0x80) {
+    return false;
+  }
+  const size_t run = internal::CountLeadingASCII(src + *i, src_len - *i);
+  AppendASCIIUnsafe(src + *i, run, out, size);
+  *i += run;
+  return true;
+}
+
 // DoUTFConversion ------------------------------------------------------------
 // Main driver of UTFConversion specialized for different Src encodings.
 // dest has to have enough room for the converted text.
@@ -107,6 +143,10 @@ bool DoUTFConversion(const char* src,
   bool success = true;
 
   for (size_t i = 0; i < src_len;) {
+    if (AppendASCIIRunUnsafe(src, src_len, &i, dest, dest_len)) {
+      continue;
+    }
+
     base_icu::UChar32 code_point;
     CBU8_NEXT(reinterpret_cast<const uint8_t*>(src), i, src_len, code_point);
 
@@ -141,6 +181,10 @@ bool DoUTFConversion(const char16_t* src,
   // Always have another symbol in order to avoid checking boundaries in the
   // middle of the surrogate pair.
   while (i + 1 < src_len) {
+    if (AppendASCIIRunUnsafe(src, src_len, &i, dest, dest_len)) {
+      continue;
+    }
+
     base_icu::UChar32 code_point;
 
     if (CBU16_IS_LEAD(src[i]) && CBU16_IS_TRAIL(src[i + 1])) {
@@ -195,7 +239,11 @@ bool DoUTFConversion(const wchar_t* src,
 
 template <typename InputString, typename DestString>
 bool UTFConversion(const InputString& src_str, DestString* dest_str) {
-  if (IsStringASCII(src_str)) {
+  // Most strings are entirely ASCII, and need neither the worst case sized
+  // buffer below nor any decoding.
+  const size_t ascii_prefix_len =
+      internal::CountLeadingASCII(src_str.data(), src_str.length());
+  if (ascii_prefix_len == src_str.length()) {
     dest_str->assign(src_str.begin(), src_str.end());
     return true;
   }
@@ -211,7 +259,10 @@ bool UTFConversion(const InputString& src_str, DestString* dest_str) {
   size_t src_len = src_str.length();
   size_t dest_len = 0;
 
-  bool res = DoUTFConversion(src_str.data(), src_len, dest, &dest_len);
+  // Don't scan the ASCII prefix a second time.
+  AppendASCIIUnsafe(src_str.data(), ascii_prefix_len, dest, &dest_len);
+  bool res = DoUTFConversion(src_str.data() + ascii_prefix_len,
+                             src_len - ascii_prefix_len, dest, &dest_len);
 
   dest_str->resize(dest_len);
   dest_str->shrink_to_fit();
@@ -6,6 +6,8 @@
 
 #include <stddef.h>
 
+#include <string>
+
 #include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "build/build_config.h"
@@ -181,6 +183,40 @@ TEST(UTFStringConversionsTest, ConvertUTF32ToUTF8) {
 }
 #endif  // defined(WCHAR_T_IS_32_BIT)
 
+// Runs of ASCII are copied a machine word at a time, so test non-ASCII and
+// invalid input at every position and alignment relative to them.
+TEST(UTFStringConversionsTest, ConvertASCIIRuns) {
+  const std::string kASCII = "0123456789abcdefghijklmnopqrstuvwxyz";
+  for (size_t offset = 0; offset < 9; ++offset) {
+    for (size_t len = 0; offset + len <= kASCII.size(); ++len) {
+      const std::string ascii = kASCII.substr(offset, len);
+      const std::u16string ascii16 = ASCIIToUTF16(ascii);
+      SCOPED_TRACE(ascii);
+
+      // "网" between two runs of ASCII.
+      const std::string utf8 = ascii + "\xe7\xbd\x91" + ascii;
+      const std::u16string utf16 = ascii16 + u"\x7f51" + ascii16;
+      std::u16string converted16;
+      EXPECT_TRUE(UTF8ToUTF16(utf8.data(), utf8.size(), &converted16));
+      EXPECT_EQ(utf16, converted16);
+      std::string converted8;
+      EXPECT_TRUE(UTF16ToUTF8(utf16.data(), utf16.size(), &converted8));
+      EXPECT_EQ(utf8, converted8);
+      EXPECT_TRUE(IsStringUTF8(utf8));
+
+      // Invalid input right after a run of ASCII.
+      const std::string invalid8 = ascii + "\xff" + ascii;
+      EXPECT_FALSE(UTF8ToUTF16(invalid8.data(), invalid8.size(), &converted16));
+      EXPECT_EQ(ascii16 + u"\xfffd" + ascii16, converted16);
+      EXPECT_FALSE(IsStringUTF8(invalid8));
+      const std::u16string invalid16 = ascii16 + u"\xd800" + ascii16;
+      EXPECT_FALSE(
+          UTF16ToUTF8(invalid16.data(), invalid16.size(), &converted8));
+      EXPECT_EQ(ascii + "\xef\xbf\xbd" + ascii, converted8);
+    }
+  }
+}
+
 TEST(UTFStringConversionsTest, ConvertMultiString) {
   static char16_t multi16[] = {'f',  'o', 'o', '\0', 'b',  'a', 'r',
                                '\0', 'b', 'a', 'z',  '\0', '\0'};
@@ -5,6 +5,7 @@
 #include "base/substring_set_matcher/substring_set_matcher.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include <algorithm>
 #include <queue>
@@ -79,6 +80,7 @@ bool SubstringSetMatcher::Build(
   }
   tree_.reserve(GetTreeSize(patterns));
   BuildAhoCorasickTree(patterns);
+  BuildRootEdges();
 
   // Sanity check that no new allocations happened in the tree and our computed
   // size was correct.
@@ -101,15 +103,25 @@ bool SubstringSetMatcher::Match(
   AccumulateMatchesForNode(root, matches);
 
   const AhoCorasickNode* current_node = root;
-  for (const char c : text) {
-    NodeID child = current_node->GetEdge(static_cast<unsigned char>(c));
+  const size_t text_size = text.size();
+  for (size_t i = 0; i < text_size; ++i) {
+    if (current_node == root) {
+      // Characters without an edge out of the root would leave us at the
+      // root, so skip them without looking at the trie.
+      i = SkipToRootEdge(text, i);
+      if (i == text_size) {
+        break;
+      }
+    }
+    const unsigned char c = static_cast<unsigned char>(text[i]);
+    NodeID child = GetChild(current_node, c);
 
     // If the child not can't be found, progressively iterate over the longest
     // proper suffix of the string represented by the current node. In a sense
     // we are pruning prefixes from the text.
     while (child == kInvalidNodeID && current_node != root) {
       current_node = &tree_[current_node->failure()];
-      child = current_node->GetEdge(static_cast<unsigned char>(c));
+      child = GetChild(current_node, c);
     }
 
     if (child != kInvalidNodeID) {
@@ -135,15 +147,25 @@ bool SubstringSetMatcher::AnyMatch(const std::string& text) const {
   }
 
   const AhoCorasickNode* current_node = root;
-  for (const char c : text) {
-    NodeID child = current_node->GetEdge(static_cast<unsigned char>(c));
+  const size_t text_size = text.size();
+  for (size_t i = 0; i < text_size; ++i) {
+    if (current_node == root) {
+      // Characters without an edge out of the root would leave us at the
+      // root, so skip them without looking at the trie.
+      i = SkipToRootEdge(text, i);
+      if (i == text_size) {
+        break;
+      }
+    }
+    const unsigned char c = static_cast<unsigned char>(text[i]);
+    NodeID child = GetChild(current_node, c);
 
     // If the child not can't be found, progressively iterate over the longest
     // proper suffix of the string represented by the current node. In a sense
     // we are pruning prefixes from the text.
     while (child == kInvalidNodeID && current_node != root) {
       current_node = &tree_[current_node->failure()];
-      child = current_node->GetEdge(static_cast<unsigned char>(c));
+      child = GetChild(current_node, c);
     }
 
     if (child != kInvalidNodeID) {
@@ -164,7 +186,8 @@ bool SubstringSetMatcher::AnyMatch(const std::string& text) const {
 }
 
 size_t SubstringSetMatcher::EstimateMemoryUsage() const {
-  return base::trace_event::EstimateMemoryUsage(tree_);
+  return base::trace_event::EstimateMemoryUsage(tree_) +
+         base::trace_event::EstimateMemoryUsage(root_edges_);
 }
 
 // static
@@ -322,6 +345,51 @@ void SubstringSetMatcher::CreateFailureAndOutputEdges() {
   }
 }
 
+void SubstringSetMatcher::BuildRootEdges() {
+  const AhoCorasickNode& root = tree_[kRootID];
+  size_t num_root_labels = 0;
+  for (unsigned edge_idx = 0; edge_idx < root.num_edges(); ++edge_idx) {
+    const AhoCorasickEdge& edge = root.edges()[edge_idx];
+    if (edge.label >= kFirstSpecialLabel) {
+      continue;
+    }
+    // Only allocated if there is an edge at all, so that IsEmpty() holds.
+    if (root_edges_.empty()) {
+      root_edges_.assign(kFirstSpecialLabel, kInvalidNodeID);
+    }
+    root_edges_[edge.label] = edge.node_id;
+    single_root_label_ = static_cast<int>(edge.label);
+    ++num_root_labels;
+  }
+  if (num_root_labels != 1) {
+    single_root_label_ = -1;
+  }
+}
+
+size_t SubstringSetMatcher::SkipToRootEdge(const std::string& text,
+                                           size_t pos) const {
+  const size_t text_size = text.size();
+  if (root_edges_.empty()) {
+    // No pattern has a first character, so we never leave the root.
+    return text_size;
+  }
+  if (single_root_label_ >= 0) {
+    // memchr() is vectorized by the C library, which beats the table below
+    // when every match has to start with the same character.
+    const void* found =
+        memchr(text.data() + pos, single_root_label_, text_size - pos);
+    return found ? static_cast<size_t>(static_cast<const char*>(found) -
+                                       text.data())
+                 : text_size;
+  }
+  const NodeID* const root_edges = root_edges_.data();
+  while (pos < text_size &&
+         root_edges[static_cast<unsigned char>(text[pos])] == kInvalidNodeID) {
+    ++pos;
+  }
+  return pos;
+}
+
 void SubstringSetMatcher::AccumulateMatchesForNode(
     const AhoCorasickNode* node,
     std::set<MatcherStringPattern::ID>* matches) const {
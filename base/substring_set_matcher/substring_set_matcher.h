@@ -53,6 +53,11 @@ class BASE_EXPORT SubstringSetMatcher {
   //    Let k = range of char. Generally 256.
   //    Let z = number of matches returned.
   // Complexity = O(t * logk + zlogz)
+  //
+  // Text positions that don't start any pattern while no partial match is in
+  // progress are skipped via a dense table of the root's edges, without
+  // visiting the trie; this is where most of the text goes when matching
+  // realistic rule sets.
   bool Match(const std::string& text,
              std::set<MatcherStringPattern::ID>* matches) const;
 
@@ -322,6 +327,21 @@ class BASE_EXPORT SubstringSetMatcher {
 
   void CreateFailureAndOutputEdges();
 
+  // Fills |root_edges_| and |single_root_label_| from the edges of the root.
+  void BuildRootEdges();
+
+  // Returns the index of the first character of |text|, at or after |pos|,
+  // that has an edge out of the root, or |text.size()| if there is none.
+  size_t SkipToRootEdge(const std::string& text, size_t pos) const;
+
+  // Returns the child of |node| for |label|, or kInvalidNodeID.
+  NodeID GetChild(const AhoCorasickNode* node, unsigned char label) const {
+    if (node == tree_.data()) {
+      return root_edges_[label];
+    }
+    return node->GetEdge(label);
+  }
+
   // Adds all pattern IDs to |matches| which are a suffix of the string
   // represented by |node|.
   void AccumulateMatchesForNode(
@@ -331,6 +351,18 @@ class BASE_EXPORT SubstringSetMatcher {
   // The nodes of a Aho-Corasick tree.
   std::vector<AhoCorasickNode> tree_;
 
+  // The children of the root, indexed directly by character. The root is by
+  // far the most visited and the widest node, so this replaces its linear
+  // edge search by a single load (for 1 kB per matcher), and lets
+  // SkipToRootEdge() scan text that can't start any pattern with one lookup
+  // per character. Characters without an edge map to kInvalidNodeID. Empty if
+  // the root has no character edges.
+  std::vector<NodeID> root_edges_;
+
+  // If the root has exactly one character edge, its label, so that
+  // SkipToRootEdge() can use memchr(). Otherwise -1.
+  int single_root_label_ = -1;
+
   bool is_empty_ = true;
 };
 
@@ -5,6 +5,7 @@
 #include "base/substring_set_matcher/substring_set_matcher.h"
 
 #include <limits>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -81,6 +82,81 @@ TEST(SubstringSetMatcherPerfTest, RandomKeys) {
       (base::trace_event::EstimateMemoryUsage(matcher) * 1.0 / (1 << 20)));
 }
 
+// Returns |num_patterns| distinct patterns of random lengths in [8, 24), each
+// starting with one of |first_chars|, followed by 'a' to 'z'.
+std::vector<MatcherStringPattern> GetRandomPatterns(
+    size_t num_patterns,
+    const std::string& first_chars) {
+  std::vector<MatcherStringPattern> patterns;
+  std::set<std::string> pattern_strings;
+  for (size_t i = 0; i < num_patterns; i++) {
+    std::string str(1, first_chars[base::RandGenerator(first_chars.size())]);
+    str += GetRandomString(base::RandInt(7, 22));
+    if (base::Contains(pattern_strings, str))
+      continue;
+    pattern_strings.insert(str);
+    patterns.emplace_back(str, i);
+  }
+  return patterns;
+}
+
+// Matches 10000 URL-like texts of 100 characters against |patterns|, and
+// reports the total match time.
+void RunMatchManyTexts(const std::string& story_name,
+                       const std::vector<MatcherStringPattern>& patterns) {
+  SubstringSetMatcher matcher;
+  ASSERT_TRUE(matcher.Build(patterns));
+
+  const size_t kNumTexts = 10000;
+  const size_t kTextLen = 100;
+  std::vector<std::string> texts;
+  for (size_t i = 0; i < kNumTexts; i++) {
+    std::string text = GetRandomString(kTextLen);
+    // Sprinkle in separators, as hosts and paths of URLs would.
+    for (size_t j = 0; j < kTextLen; j += base::RandInt(4, 12))
+      text[j] = (j % 2) ? '/' : '.';
+    texts.push_back(std::move(text));
+  }
+
+  base::ElapsedTimer match_timer;
+  size_t num_matching_texts = 0;
+  for (const std::string& text : texts) {
+    std::set<MatcherStringPattern::ID> matches;
+    if (matcher.Match(text, &matches))
+      num_matching_texts++;
+  }
+  base::TimeDelta match_time = match_timer.Elapsed();
+
+  const char* kMatchTime = ".match_time";
+  const char* kMatchingTexts = ".matching_texts";
+  auto reporter =
+      perf_test::PerfResultReporter("SubstringSetMatcher", story_name);
+  reporter.RegisterImportantMetric(kMatchTime, "us");
+  reporter.RegisterFyiMetric(kMatchingTexts, "count");
+  reporter.AddResult(kMatchTime, match_time);
+  reporter.AddResult(kMatchingTexts, num_matching_texts);
+}
+
+// Tests the common case of URL rule sets where most patterns start with a
+// separator, so that most of the text can't start a match and is skipped
+// without visiting the trie.
+TEST(SubstringSetMatcherPerfTest, SeparatorPrefixedKeys) {
+  RunMatchManyTexts("SeparatorPrefixedKeys", GetRandomPatterns(5000, "./"));
+}
+
+// As above, but with a single first character, which is skipped to with
+// memchr().
+TEST(SubstringSetMatcherPerfTest, SingleFirstCharKeys) {
+  RunMatchManyTexts("SingleFirstCharKeys", GetRandomPatterns(5000, "/"));
+}
+
+// Tests patterns which can start anywhere in the text, where every character
+// is looked up in the root table.
+TEST(SubstringSetMatcherPerfTest, DenseKeys) {
+  RunMatchManyTexts("DenseKeys",
+                    GetRandomPatterns(5000, "abcdefghijklmnopqrstuvwxyz"));
+}
+
 }  // namespace
 
 }  // namespace base
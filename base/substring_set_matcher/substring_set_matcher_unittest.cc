@@ -198,6 +198,38 @@ TEST(SubstringSetMatcherTest, TestEmptyMatcher) {
   EXPECT_TRUE(matcher.IsEmpty());
 }
 
+// Test that text which can't start any pattern is skipped correctly, both if
+// all patterns start with the same character and if they don't, including for
+// characters with the high bit set.
+TEST(SubstringSetMatcherTest, SkipsTextNotStartingPatterns) {
+  const std::string kHighBitPattern = "\xff\x80x";
+  for (bool single_first_char : {true, false}) {
+    std::vector<MatcherStringPattern> patterns;
+    patterns.emplace_back(kHighBitPattern, 1);
+    patterns.emplace_back("\xff" "ab", 2);
+    if (!single_first_char) {
+      patterns.emplace_back("bc", 3);
+    }
+    SubstringSetMatcher matcher;
+    ASSERT_TRUE(matcher.Build(patterns));
+
+    std::set<MatcherStringPattern::ID> matches;
+    EXPECT_TRUE(matcher.Match("zzz\xff\xff\x80xzz\xff" "abc", &matches));
+    std::set<MatcherStringPattern::ID> expected = {1, 2};
+    if (!single_first_char) {
+      expected.insert(3);
+    }
+    EXPECT_EQ(expected, matches);
+
+    matches.clear();
+    EXPECT_FALSE(matcher.Match("zzzzz\xff\x80", &matches));
+    EXPECT_TRUE(matches.empty());
+    EXPECT_FALSE(matcher.AnyMatch("zzzzz\xff\x80"));
+    EXPECT_FALSE(matcher.AnyMatch(""));
+    EXPECT_TRUE(matcher.AnyMatch("zz" + kHighBitPattern));
+  }
+}
+
 // Test a case where we have more than 256 edges from one node
 // (the “a” node gets one for each possible ASCII bytes, and then
 // one for the output link).
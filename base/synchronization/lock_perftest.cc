@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+
 #include "base/compiler_specific.h"
 #include "base/memory/raw_ptr.h"
 #include "base/synchronization/lock.h"
@@ -22,6 +24,8 @@ constexpr char kMetricPrefixLock[] = "Lock.";
 constexpr char kMetricLockUnlockThroughput[] = "lock_unlock_throughput";
 constexpr char kStoryBaseline[] = "baseline_story";
 constexpr char kStoryWithCompetingThread[] = "with_competing_thread";
+constexpr char kStoryWithCompetingBackgroundThread[] =
+    "with_competing_background_thread";
 
 perf_test::PerfResultReporter SetUpReporter(const std::string& story_name) {
   perf_test::PerfResultReporter reporter(kMetricPrefixLock, story_name);
@@ -59,14 +63,21 @@ class Spin : public PlatformThread::Delegate {
   std::atomic<bool> should_stop_;
 };
 
-}  // namespace
-
-TEST(LockPerfTest, Simple) {
+// Measures the throughput of this thread acquiring and releasing a lock that a
+// thread of type `competing_thread_type` keeps acquiring and releasing too.
+void RunWithCompetingThread(ThreadType competing_thread_type,
+                            const std::string& story_name) {
   LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
-  [[maybe_unused]] uint32_t data = 0;
+  uint32_t data = 0;
 
   Lock lock;
 
+  // Starts a competing thread executing the same loop as this thread.
+  Spin thread_main(&lock, &data);
+  PlatformThreadHandle thread_handle;
+  ASSERT_TRUE(PlatformThread::CreateWithType(0, &thread_main, &thread_handle,
+                                             competing_thread_type));
+
   do {
     lock.Acquire();
     data += 1;
@@ -74,21 +85,21 @@ TEST(LockPerfTest, Simple) {
     timer.NextLap();
   } while (!timer.HasTimeLimitExpired());
 
-  auto reporter = SetUpReporter(kStoryBaseline);
+  thread_main.Stop();
+  PlatformThread::Join(thread_handle);
+
+  auto reporter = SetUpReporter(story_name);
   reporter.AddResult(kMetricLockUnlockThroughput, timer.LapsPerSecond());
 }
 
-TEST(LockPerfTest, WithCompetingThread) {
+}  // namespace
+
+TEST(LockPerfTest, Simple) {
   LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
-  uint32_t data = 0;
+  [[maybe_unused]] uint32_t data = 0;
 
   Lock lock;
 
-  // Starts a competing thread executing the same loop as this thread.
-  Spin thread_main(&lock, &data);
-  PlatformThreadHandle thread_handle;
-  ASSERT_TRUE(PlatformThread::Create(0, &thread_main, &thread_handle));
-
   do {
     lock.Acquire();
     data += 1;
@@ -96,10 +107,19 @@ TEST(LockPerfTest, WithCompetingThread) {
     timer.NextLap();
   } while (!timer.HasTimeLimitExpired());
 
-  thread_main.Stop();
-  PlatformThread::Join(thread_handle);
-
-  auto reporter = SetUpReporter(kStoryWithCompetingThread);
+  auto reporter = SetUpReporter(kStoryBaseline);
   reporter.AddResult(kMetricLockUnlockThroughput, timer.LapsPerSecond());
 }
+
+TEST(LockPerfTest, WithCompetingThread) {
+  RunWithCompetingThread(ThreadType::kDefault, kStoryWithCompetingThread);
+}
+
+// Contention with a background thread is where priority inversion happens, and
+// where priority inheritance (see Lock::HandlesMultipleThreadPriorities()) adds
+// its overhead.
+TEST(LockPerfTest, WithCompetingBackgroundThread) {
+  RunWithCompetingThread(ThreadType::kBackground,
+                         kStoryWithCompetingBackgroundThread);
+}
 }  // namespace base
@@ -330,6 +330,7 @@ TaskAnnotator::LongTaskTracker::~LongTaskTracker() {
                       task_start_time_, [&](perfetto::EventContext& ctx) {
                         TaskAnnotator::EmitTaskLocation(ctx, pending_task_);
                         EmitReceivedIPCDetails(ctx);
+                        EmitTaskBacktrace(ctx);
                       });
     TRACE_EVENT_END("scheduler.long_tasks",
                     perfetto::Track::ThreadScoped(task_annotator_),
@@ -375,6 +376,28 @@ void TaskAnnotator::LongTaskTracker::EmitReceivedIPCDetails(
 #endif
 }
 
+void TaskAnnotator::LongTaskTracker::EmitTaskBacktrace(
+    perfetto::EventContext& ctx) {
+  if (!pending_task_.task_backtrace[0]) {
+    return;
+  }
+#if BUILDFLAG(ENABLE_BASE_TRACING)
+  ctx.AddDebugAnnotation(
+      "task_backtrace", [&](perfetto::TracedValue context) {
+        auto array = std::move(context).WriteArray();
+        for (const void* program_counter : pending_task_.task_backtrace) {
+          if (!program_counter) {
+            break;
+          }
+          array.Append(program_counter);
+        }
+      });
+  if (pending_task_.task_backtrace_overflow) {
+    ctx.AddDebugAnnotation("task_backtrace_overflow", true);
+  }
+#endif
+}
+
 // This method is used to record the queueing time and task start time for tasks
 // that may be of interest during a trace, even if they are not considered long
 // tasks. For example, input - the queue time and flow information is required
@@ -171,6 +171,11 @@ class BASE_EXPORT [[maybe_unused, nodiscard]] TaskAnnotator::LongTaskTracker {
  private:
   void EmitReceivedIPCDetails(perfetto::EventContext& ctx);
 
+  // Writes the program counters of the PostTask() calls that led to this task,
+  // from the closest, so that a long task can be attributed to the code that
+  // caused it to be posted rather than only to its immediate poster.
+  void EmitTaskBacktrace(perfetto::EventContext& ctx);
+
   const AutoReset<LongTaskTracker*> resetter_;
 
   // For tracking task duration.
@@ -199,6 +199,7 @@ class NonMainThreadImpl;
 namespace cc {
 class CategorizedWorkerPoolImpl;
 class CategorizedWorkerPoolJob;
+class CategorizedWorkerPoolWorkStealing;
 class CategorizedWorkerPool;
 class CompletionEvent;
 class TileTaskManagerImpl;
@@ -846,6 +847,7 @@ class BASE_EXPORT
   friend class blink::WebRtcVideoFrameAdapter;
   friend class cc::CategorizedWorkerPoolImpl;
   friend class cc::CategorizedWorkerPoolJob;
+  friend class cc::CategorizedWorkerPoolWorkStealing;
   friend class cc::CategorizedWorkerPool;
   friend class cc::TileTaskManagerImpl;
   friend class content::DesktopCaptureDevice;
@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_set.h"
 #include "base/notreached.h"
 #include "base/ranges/algorithm.h"
 #include "base/time/time.h"
@@ -974,6 +975,10 @@ void KeyframeEffect::MarkKeyframeModelsForDeletion(
                                 monotonic_time);
     marked_keyframe_model_for_deletion = true;
   };
+  // Groups already found to contain an unfinished keyframe model. Nothing in
+  // this loop can finish a model, so other finished members of these groups
+  // can be skipped without rescanning the whole list.
+  base::flat_set<int> groups_with_unfinished_keyframe_models;
 
   // Non-aborted KeyframeModels are marked for deletion after a corresponding
   // AnimationEvent::Type::kFinished event is sent or received. This means that
@@ -1014,6 +1019,11 @@ void KeyframeEffect::MarkKeyframeModelsForDeletion(
     if (NeedsFinishedEvent(cc_keyframe_model))
       continue;
 
+    if (groups_with_unfinished_keyframe_models.contains(
+            cc_keyframe_model->group())) {
+      continue;
+    }
+
     // If a keyframe model is finished, and not already marked for deletion,
     // find out if all other keyframe models in the same group are also
     // finished.
@@ -1030,8 +1040,10 @@ void KeyframeEffect::MarkKeyframeModelsForDeletion(
                   NeedsFinishedEvent(keyframe_model));
         });
 
-    if (a_keyframe_model_in_same_group_is_not_finished)
+    if (a_keyframe_model_in_same_group_is_not_finished) {
+      groups_with_unfinished_keyframe_models.insert(cc_keyframe_model->group());
       continue;
+    }
 
     // Now remove all the keyframe models which belong to the same group and are
     // not yet aborted. These will be set to WAITING_FOR_DELETION which also
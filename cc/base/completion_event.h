@@ -5,6 +5,8 @@
 #ifndef CC_BASE_COMPLETION_EVENT_H_
 #define CC_BASE_COMPLETION_EVENT_H_
 
+#include <algorithm>
+
 #include "base/check.h"
 #include "base/synchronization/waitable_event.h"
 #include "base/threading/thread_restrictions.h"
@@ -41,6 +43,8 @@ class CompletionEvent {
 #endif
     // http://crbug.com/902653
     base::ScopedAllowBaseSyncPrimitivesOutsideBlockingScope allow_wait;
+    if (SpinUntilSignaled(kMaxSpinTime))
+      return;
     event_.Wait();
   }
 
@@ -51,7 +55,10 @@ class CompletionEvent {
 #endif
     // http://crbug.com/902653
     base::ScopedAllowBaseSyncPrimitivesOutsideBlockingScope allow_wait;
-    if (event_.TimedWait(max_time))
+    const base::TimeTicks start = base::TimeTicks::Now();
+    if (SpinUntilSignaled(std::min(max_time, kMaxSpinTime)))
+      return true;
+    if (event_.TimedWait(max_time - (base::TimeTicks::Now() - start)))
       return true;
 #if DCHECK_IS_ON()
     waited_ = false;
@@ -70,6 +77,23 @@ class CompletionEvent {
   }
 
  private:
+  // How long Wait() and TimedWait() check for the event before going to sleep.
+  // The other thread often signals right away (e.g. when there's little to
+  // raster), and catching that saves a kernel sleep and wake-up, which costs
+  // more than this on loaded devices.
+  static constexpr base::TimeDelta kMaxSpinTime = base::Microseconds(20);
+
+  // Returns true if the event got signaled within `max_time`, consuming the
+  // signal like Wait() does.
+  bool SpinUntilSignaled(base::TimeDelta max_time) {
+    const base::TimeTicks end = base::TimeTicks::Now() + max_time;
+    do {
+      if (event_.IsSignaled())
+        return true;
+    } while (base::TimeTicks::Now() < end);
+    return false;
+  }
+
   base::WaitableEvent event_;
 #if DCHECK_IS_ON()
   // Used to assert that Wait() and Signal() are each called exactly once.
@@ -193,6 +193,10 @@ BASE_FEATURE(kPaintWithGlobalToneMapFilter,
              "PaintWithGlobalToneMapFilter",
              base::FEATURE_ENABLED_BY_DEFAULT);
 
+BASE_FEATURE(kOneCopyStagingRing,
+             "OneCopyStagingRing",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 BASE_FEATURE(kMetricsBackfillAdjustmentHoldback,
              "MetricsBackfillAdjustmentHoldback",
              base::FEATURE_DISABLED_BY_DEFAULT);
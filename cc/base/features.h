@@ -175,6 +175,10 @@ CC_BASE_EXPORT BASE_DECLARE_FEATURE(kMetricsTracingCalculationReduction);
 CC_BASE_EXPORT BASE_DECLARE_FEATURE(kPaintWithGainmapShader);
 CC_BASE_EXPORT BASE_DECLARE_FEATURE(kPaintWithGlobalToneMapFilter);
 
+// When enabled, one-copy raster stages tiles in a ring of persistently mapped
+// shared memory buffers instead of mapping pooled buffers for every tile.
+CC_BASE_EXPORT BASE_DECLARE_FEATURE(kOneCopyStagingRing);
+
 // When enabled we will restore older FrameSequenceTracker sequence order
 // enforcing that can miss backfilled frames.
 CC_BASE_EXPORT BASE_DECLARE_FEATURE(kMetricsBackfillAdjustmentHoldback);
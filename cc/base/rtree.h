@@ -10,16 +10,23 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "base/check_op.h"
+#include "base/containers/span.h"
 #include "base/memory/raw_ptr_exclusion.h"
 #include "base/numerics/clamped_math.h"
+#include "build/build_config.h"
 #include "ui/gfx/geometry/rect.h"
 
+#if defined(ARCH_CPU_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
 namespace cc {
 
 // The following description and most of the implementation is borrowed from
@@ -87,6 +94,28 @@ class RTree {
   // container.
   void SearchRefs(const gfx::Rect& query, std::vector<const T*>* results) const;
 
+  // Builds a flattened copy of the tree bounds in which the bounds of each
+  // node's children are stored in structure-of-arrays form. This is opt-in
+  // since it costs extra memory; it lets SearchBatch test a query against all
+  // of a node's children at once using SIMD. Must be called after Build(), and
+  // is discarded by Reset().
+  void BuildPackedLayout();
+  bool has_packed_layout() const { return !packed_nodes_.empty(); }
+
+  // Runs each query in `queries` and calls result_handler with the index of
+  // the query, the payload and the rect of each element that intersects it.
+  // For any one query, results are reported in the order they appeared in the
+  // initial container, as with Search. Uses the packed layout if it was built
+  // and falls back to Search otherwise.
+  template <typename ResultFunctor>
+  void SearchBatch(base::span<const gfx::Rect> queries,
+                   const ResultFunctor& result_handler) const;
+
+  // Same as above, but `results` is resized to the number of queries and
+  // (*results)[i] holds the payloads of elements intersecting queries[i].
+  void SearchBatch(base::span<const gfx::Rect> queries,
+                   std::vector<std::vector<T>>* results) const;
+
   // Returns the total bounds of all items in this rtree.
   std::optional<gfx::Rect> bounds() const;
 
@@ -132,6 +161,32 @@ class RTree {
     explicit Node(uint16_t level) : level(level) {}
   };
 
+  // The number of lanes in a PackedNode, which is kMaxChildren rounded up to
+  // a multiple of four so that bounds can be compared four at a time.
+  static constexpr int kPackedLanes = (kMaxChildren + 3) & ~3;
+
+  // Mirror of nodes_[i] with the children's bounds stored as separate arrays
+  // of edges. Unused lanes have an inverted rect so they never intersect.
+  struct PackedNode {
+    alignas(16) int32_t left[kPackedLanes];
+    alignas(16) int32_t top[kPackedLanes];
+    alignas(16) int32_t right[kPackedLanes];
+    alignas(16) int32_t bottom[kPackedLanes];
+    // For internal nodes, the index in nodes_ of each child's subtree.
+    uint32_t subtree_index[kMaxChildren];
+    uint16_t num_children = 0u;
+    uint16_t level = 0u;
+  };
+
+  // Returns a bitmask with bit i set if `query` intersects child i of `node`.
+  static uint32_t IntersectingChildren(const PackedNode& node,
+                                       const gfx::Rect& query);
+
+  template <typename ResultFunctor>
+  void SearchPackedRecursive(uint32_t node_index,
+                             const gfx::Rect& query,
+                             const ResultFunctor& result_handler) const;
+
   template <typename ResultFunctor>
   void SearchRecursive(Node<T>* root,
                        const gfx::Rect& query,
@@ -156,6 +211,9 @@ class RTree {
   std::vector<Node<T>> nodes_;
   Branch<T> root_;
 
+  // Optional flattened bounds, parallel to nodes_. See BuildPackedLayout().
+  std::vector<PackedNode> packed_nodes_;
+
   // If false, the rtree encountered overflow does not have reliable bounds.
   bool has_valid_bounds_ = true;
 };
@@ -385,6 +443,138 @@ void RTree<T>::SearchRecursiveFallback(
   }
 }
 
+template <typename T>
+void RTree<T>::BuildPackedLayout() {
+  packed_nodes_.clear();
+  if (num_data_elements_ == 0) {
+    return;
+  }
+  packed_nodes_.resize(nodes_.size());
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    const Node<T>& node = nodes_[i];
+    PackedNode& packed = packed_nodes_[i];
+    packed.num_children = node.num_children;
+    packed.level = node.level;
+    for (int k = 0; k < kPackedLanes; ++k) {
+      if (k < node.num_children) {
+        const gfx::Rect& bounds = node.children[k].bounds;
+        packed.left[k] = bounds.x();
+        packed.top[k] = bounds.y();
+        packed.right[k] = bounds.right();
+        packed.bottom[k] = bounds.bottom();
+      } else {
+        packed.left[k] = packed.top[k] = std::numeric_limits<int32_t>::max();
+        packed.right[k] = packed.bottom[k] =
+            std::numeric_limits<int32_t>::min();
+      }
+    }
+    for (uint16_t k = 0; k < node.num_children; ++k) {
+      packed.subtree_index[k] =
+          node.level == 0
+              ? 0u
+              : static_cast<uint32_t>(node.children[k].subtree - nodes_.data());
+    }
+  }
+}
+
+// static
+template <typename T>
+uint32_t RTree<T>::IntersectingChildren(const PackedNode& node,
+                                        const gfx::Rect& query) {
+  // This matches gfx::Rect::Intersects() for non-empty rects: all children
+  // bounds are non-empty, and callers skip empty queries.
+  uint32_t mask = 0u;
+#if defined(ARCH_CPU_X86_FAMILY)
+  const __m128i q_left = _mm_set1_epi32(query.x());
+  const __m128i q_top = _mm_set1_epi32(query.y());
+  const __m128i q_right = _mm_set1_epi32(query.right());
+  const __m128i q_bottom = _mm_set1_epi32(query.bottom());
+  for (int k = 0; k < kPackedLanes; k += 4) {
+    const __m128i left =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(&node.left[k]));
+    const __m128i top =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(&node.top[k]));
+    const __m128i right =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(&node.right[k]));
+    const __m128i bottom =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(&node.bottom[k]));
+    __m128i hit = _mm_and_si128(_mm_cmplt_epi32(q_left, right),
+                                _mm_cmplt_epi32(left, q_right));
+    hit = _mm_and_si128(hit, _mm_and_si128(_mm_cmplt_epi32(q_top, bottom),
+                                           _mm_cmplt_epi32(top, q_bottom)));
+    mask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(hit)))
+            << k;
+  }
+#else
+  // Written branch-free so that the compiler can vectorize it.
+  for (int k = 0; k < kPackedLanes; ++k) {
+    const uint32_t hit = (query.x() < node.right[k]) &
+                         (node.left[k] < query.right()) &
+                         (query.y() < node.bottom[k]) &
+                         (node.top[k] < query.bottom());
+    mask |= hit << k;
+  }
+#endif
+  return mask;
+}
+
+template <typename T>
+template <typename ResultFunctor>
+void RTree<T>::SearchPackedRecursive(
+    uint32_t node_index,
+    const gfx::Rect& query,
+    const ResultFunctor& result_handler) const {
+  const PackedNode& packed = packed_nodes_[node_index];
+  uint32_t mask = IntersectingChildren(packed, query);
+  // Visit set bits from lowest to highest to preserve child order.
+  for (uint16_t i = 0; mask; ++i, mask >>= 1) {
+    if (!(mask & 1u)) {
+      continue;
+    }
+    if (packed.level == 0) {
+      const Branch<T>& branch = nodes_[node_index].children[i];
+      result_handler(branch.payload, branch.bounds);
+    } else {
+      SearchPackedRecursive(packed.subtree_index[i], query, result_handler);
+    }
+  }
+}
+
+template <typename T>
+template <typename ResultFunctor>
+void RTree<T>::SearchBatch(base::span<const gfx::Rect> queries,
+                           const ResultFunctor& result_handler) const {
+  if (num_data_elements_ == 0) {
+    return;
+  }
+  const bool use_packed = has_packed_layout() && has_valid_bounds_;
+  const uint32_t root_index =
+      static_cast<uint32_t>(root_.subtree - nodes_.data());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    const gfx::Rect& query = queries[i];
+    auto handler = [&result_handler, i](const T& payload,
+                                        const gfx::Rect& rect) {
+      result_handler(i, payload, rect);
+    };
+    if (!use_packed) {
+      Search(query, handler);
+    } else if (!query.IsEmpty() && query.Intersects(root_.bounds)) {
+      SearchPackedRecursive(root_index, query, handler);
+    }
+  }
+}
+
+template <typename T>
+void RTree<T>::SearchBatch(base::span<const gfx::Rect> queries,
+                           std::vector<std::vector<T>>* results) const {
+  results->clear();
+  results->resize(queries.size());
+  SearchBatch(queries, [results](size_t query_index, const T& payload,
+                                 const gfx::Rect&) {
+    (*results)[query_index].push_back(payload);
+  });
+}
+
 template <typename T>
 std::optional<gfx::Rect> RTree<T>::bounds() const {
   if (has_valid_bounds_) {
@@ -417,6 +607,7 @@ void RTree<T>::Reset() {
   num_data_elements_ = 0;
   root_.subtree = nullptr;
   nodes_.clear();
+  packed_nodes_.clear();
   root_.bounds = gfx::Rect();
   has_valid_bounds_ = true;
 }
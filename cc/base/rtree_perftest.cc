@@ -23,6 +23,13 @@ size_t Accumulate(const Container& container) {
   return result;
 }
 
+size_t AccumulateRefs(const std::vector<const size_t*>& container) {
+  size_t result = 0;
+  for (const size_t* index : container)
+    result += *index;
+  return result;
+}
+
 class RTreePerfTest : public testing::Test {
  public:
   RTreePerfTest()
@@ -69,6 +76,67 @@ class RTreePerfTest : public testing::Test {
     reporter.AddResult("_search", timer_.LapsPerSecond());
   }
 
+  // Compares running a batch of queries one at a time through Search and
+  // SearchRefs with running them through SearchBatch on the packed layout.
+  void RunSearchBatchTest(const std::string& test_name, int rect_count) {
+    std::vector<gfx::Rect> rects = BuildRects(rect_count);
+    std::vector<gfx::Rect> queries = BuildQueries(rect_count);
+    RTree<size_t> rtree;
+    rtree.Build(rects);
+
+    timer_.Reset();
+    do {
+      std::vector<size_t> results;
+      for (const auto& query : queries) {
+        rtree.Search(query, &results);
+        Accumulate(results);
+      }
+      timer_.NextLap();
+    } while (!timer_.HasTimeLimitExpired());
+    double search_laps_per_second = timer_.LapsPerSecond();
+
+    timer_.Reset();
+    do {
+      std::vector<const size_t*> results;
+      for (const auto& query : queries) {
+        rtree.SearchRefs(query, &results);
+        AccumulateRefs(results);
+      }
+      timer_.NextLap();
+    } while (!timer_.HasTimeLimitExpired());
+    double search_refs_laps_per_second = timer_.LapsPerSecond();
+
+    rtree.BuildPackedLayout();
+    timer_.Reset();
+    do {
+      std::vector<std::vector<size_t>> results;
+      rtree.SearchBatch(queries, &results);
+      for (const auto& query_results : results) {
+        Accumulate(query_results);
+      }
+      timer_.NextLap();
+    } while (!timer_.HasTimeLimitExpired());
+
+    perf_test::PerfResultReporter reporter = SetUpReporter(test_name);
+    reporter.AddResult("_batch_search", search_laps_per_second);
+    reporter.AddResult("_batch_search_refs", search_refs_laps_per_second);
+    reporter.AddResult("_batch_search_packed", timer_.LapsPerSecond());
+  }
+
+  // Returns a mix of small, tile-sized and large queries spread over the
+  // rects returned by BuildRects().
+  std::vector<gfx::Rect> BuildQueries(int rect_count) {
+    int width = std::sqrt(rect_count);
+    std::vector<gfx::Rect> result;
+    for (int i = 0; i < 64; ++i) {
+      int x = (i * 7) % (width + 1);
+      int y = (i * 13) % (width + 1);
+      int size = (i % 4 == 0) ? width / 2 + 1 : (i % 4) * 2;
+      result.push_back(gfx::Rect(x, y, size, size));
+    }
+    return result;
+  }
+
   std::vector<gfx::Rect> BuildRects(int count) {
     std::vector<gfx::Rect> result;
     int width = std::sqrt(count);
@@ -89,6 +157,9 @@ class RTreePerfTest : public testing::Test {
     perf_test::PerfResultReporter reporter("rtree", story_name);
     reporter.RegisterImportantMetric("_construct", "runs/s");
     reporter.RegisterImportantMetric("_search", "runs/s");
+    reporter.RegisterImportantMetric("_batch_search", "runs/s");
+    reporter.RegisterImportantMetric("_batch_search_refs", "runs/s");
+    reporter.RegisterImportantMetric("_batch_search_packed", "runs/s");
     return reporter;
   }
 
@@ -109,5 +180,12 @@ TEST_F(RTreePerfTest, Search) {
   RunSearchTest("100000", 100000);
 }
 
+TEST_F(RTreePerfTest, SearchBatch) {
+  RunSearchBatchTest("100", 100);
+  RunSearchBatchTest("1000", 1000);
+  RunSearchBatchTest("10000", 10000);
+  RunSearchBatchTest("100000", 100000);
+}
+
 }  // namespace
 }  // namespace cc
@@ -323,4 +323,105 @@ TEST(RTreeTest, InvalidBoundsGetAllBounds) {
   EXPECT_EQ(all_bounds, expected_all_bounds);
 }
 
+TEST(RTreeTest, SearchBatchMatchesSearch) {
+  std::vector<gfx::Rect> rects;
+  for (int y = 0; y < 50; ++y) {
+    for (int x = 0; x < 50; ++x) {
+      rects.push_back(gfx::Rect(x * 3, y * 3, 5, 5));
+    }
+  }
+
+  std::vector<gfx::Rect> queries = {
+      gfx::Rect(0, 0, 1, 1),     gfx::Rect(10, 10, 20, 7),
+      gfx::Rect(-10, -10, 5, 5), gfx::Rect(0, 0, 200, 200),
+      gfx::Rect(149, 149, 1, 1), gfx::Rect(),
+      gfx::Rect(73, 12, 1, 90)};
+
+  RTree<size_t> rtree;
+  rtree.Build(rects);
+
+  for (bool packed : {false, true}) {
+    if (packed) {
+      rtree.BuildPackedLayout();
+    }
+    EXPECT_EQ(packed, rtree.has_packed_layout());
+
+    std::vector<std::vector<size_t>> batch_results;
+    rtree.SearchBatch(queries, &batch_results);
+    ASSERT_EQ(queries.size(), batch_results.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+      std::vector<size_t> results;
+      rtree.Search(queries[i], &results);
+      EXPECT_EQ(results, batch_results[i]) << "query " << i;
+    }
+  }
+
+  rtree.Reset();
+  EXPECT_FALSE(rtree.has_packed_layout());
+}
+
+TEST(RTreeTest, SearchBatchReportsRects) {
+  std::vector<gfx::Rect> rects = {gfx::Rect(0, 0, 10, 10),
+                                  gfx::Rect(20, 0, 10, 10)};
+  RTree<size_t> rtree;
+  rtree.Build(rects);
+  rtree.BuildPackedLayout();
+
+  std::vector<gfx::Rect> queries = {gfx::Rect(5, 5, 20, 1),
+                                    gfx::Rect(25, 5, 1, 1)};
+  std::vector<std::pair<size_t, size_t>> hits;
+  rtree.SearchBatch(queries, [&](size_t query_index, const size_t& payload,
+                                 const gfx::Rect& rect) {
+    EXPECT_EQ(rects[payload], rect);
+    EXPECT_TRUE(rect.Intersects(queries[query_index]));
+    hits.emplace_back(query_index, payload);
+  });
+  std::vector<std::pair<size_t, size_t>> expected = {{0, 0}, {0, 1}, {1, 1}};
+  EXPECT_EQ(expected, hits);
+}
+
+TEST(RTreeTest, SearchBatchSingleElementAndEmpty) {
+  std::vector<gfx::Rect> queries = {gfx::Rect(0, 0, 10, 10)};
+  std::vector<std::vector<size_t>> results;
+
+  RTree<size_t> empty_rtree;
+  empty_rtree.Build(std::vector<gfx::Rect>());
+  empty_rtree.BuildPackedLayout();
+  EXPECT_FALSE(empty_rtree.has_packed_layout());
+  empty_rtree.SearchBatch(queries, &results);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_TRUE(results[0].empty());
+
+  RTree<size_t> rtree;
+  rtree.Build(std::vector<gfx::Rect>({gfx::Rect(5, 5, 1, 1)}));
+  rtree.BuildPackedLayout();
+  rtree.SearchBatch(queries, &results);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(std::vector<size_t>({0}), results[0]);
+}
+
+TEST(RTreeTest, InvalidBoundsSearchBatch) {
+  std::vector<gfx::Rect> rects;
+  rects.push_back(gfx::Rect(-INT_MAX, -INT_MAX, INT_MAX, INT_MAX));
+  rects.push_back(gfx::Rect(100, 100, 10, 10));
+  rects.push_back(gfx::Rect(105, 105, 10, 10));
+  rects.push_back(gfx::Rect(-50, -50, 10, 10));
+  rects.push_back(gfx::Rect(INT_MAX - 100, INT_MAX - 100, 10, 10));
+
+  RTree<size_t> rtree;
+  rtree.Build(rects);
+  rtree.BuildPackedLayout();
+  EXPECT_FALSE(rtree.has_valid_bounds());
+
+  // The packed layout is bypassed, but searching should still work.
+  std::vector<gfx::Rect> queries = {
+      gfx::Rect(0, 0, INT_MAX, INT_MAX),
+      gfx::Rect(-INT_MAX, -INT_MAX, INT_MAX, INT_MAX)};
+  std::vector<std::vector<size_t>> results;
+  rtree.SearchBatch(queries, &results);
+  ASSERT_EQ(2u, results.size());
+  EXPECT_EQ(results[0], std::vector<size_t>({1, 2, 4}));
+  EXPECT_EQ(results[1], std::vector<size_t>({0, 3}));
+}
+
 }  // namespace cc
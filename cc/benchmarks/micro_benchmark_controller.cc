@@ -13,6 +13,7 @@
 #include "base/task/single_thread_task_runner.h"
 #include "base/values.h"
 #include "cc/benchmarks/invalidation_benchmark.h"
+#include "cc/benchmarks/paint_op_serialization_benchmark.h"
 #include "cc/benchmarks/rasterize_and_record_benchmark.h"
 #include "cc/benchmarks/unittest_only_benchmark.h"
 #include "cc/trees/layer_tree_host.h"
@@ -31,6 +32,9 @@ std::unique_ptr<MicroBenchmark> CreateBenchmark(
   if (name == "invalidation_benchmark") {
     return std::make_unique<InvalidationBenchmark>(std::move(settings),
                                                    std::move(callback));
+  } else if (name == "paint_op_serialization_benchmark") {
+    return std::make_unique<PaintOpSerializationBenchmark>(
+        std::move(settings), std::move(callback));
   } else if (name == "rasterize_and_record_benchmark") {
     return std::make_unique<RasterizeAndRecordBenchmark>(std::move(settings),
                                                          std::move(callback));
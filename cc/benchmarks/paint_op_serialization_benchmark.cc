@@ -0,0 +1,180 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/benchmarks/paint_op_serialization_benchmark.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "base/system/sys_info.h"
+#include "base/timer/lap_timer.h"
+#include "base/values.h"
+#include "cc/layers/content_layer_client.h"
+#include "cc/layers/layer.h"
+#include "cc/layers/picture_layer.h"
+#include "cc/paint/display_item_list.h"
+#include "cc/paint/image_provider.h"
+#include "cc/paint/paint_cache.h"
+#include "cc/paint/paint_op_buffer_serializer.h"
+#include "cc/paint/paint_op_writer.h"
+#include "cc/paint/transfer_cache_serialize_helper.h"
+#include "cc/trees/layer_tree_host.h"
+#include "ui/gfx/geometry/rect.h"
+
+namespace cc {
+
+namespace {
+
+const int kDefaultRepeatCount = 10;
+const size_t kSerializedBufferSize = 32 * 1024 * 1024;
+const size_t kPaintCacheBudget = 4 * 1024 * 1024;
+
+// Parameters for base::LapTimer.
+const int kTimeLimitMillis = 1;
+const int kWarmupRuns = 0;
+const int kTimeCheckInterval = 1;
+
+// Images don't affect the cost of serializing the ops themselves, so they are
+// all skipped.
+class SkipImageProvider : public ImageProvider {
+ public:
+  ScopedResult GetRasterContent(const DrawImage& draw_image) override {
+    return ScopedResult();
+  }
+};
+
+class NoopTransferCacheSerializeHelper : public TransferCacheSerializeHelper {
+ protected:
+  bool LockEntryInternal(const EntryKey& key) override { return false; }
+  uint32_t CreateEntryInternal(const ClientTransferCacheEntry& entry,
+                               char* memory) override {
+    return 0u;
+  }
+  void FlushEntriesInternal(std::set<EntryKey> keys) override {}
+};
+
+// Serializes `buffer` into `memory` and returns the number of bytes written, or
+// 0 on failure. Each call uses fresh caches so that the outputs are
+// comparable.
+size_t SerializeBuffer(const PaintOpBuffer& buffer,
+                     const gfx::Rect& rect,
+                     size_t max_concurrency,
+                     char* memory) {
+  SkipImageProvider image_provider;
+  NoopTransferCacheSerializeHelper transfer_cache;
+  ClientPaintCache paint_cache(kPaintCacheBudget);
+  PaintOp::SerializeOptions options(
+      &image_provider, &transfer_cache, &paint_cache,
+      /*strike_server=*/nullptr, /*color_space=*/nullptr,
+      /*skottie_serialization_history=*/nullptr, /*can_use_lcd_text=*/false,
+      /*context_supports_distance_field_text=*/false,
+      /*max_texture_size=*/0);
+
+  PaintOpBufferSerializer::Preamble preamble;
+  preamble.content_size = gfx::Size(rect.right(), rect.bottom());
+  preamble.full_raster_rect = rect;
+  preamble.playback_rect = rect;
+
+  SimpleBufferSerializer serializer(memory, kSerializedBufferSize, options);
+  if (max_concurrency) {
+    serializer.SerializeInParallel(buffer, nullptr, preamble, max_concurrency);
+  } else {
+    serializer.Serialize(buffer, nullptr, preamble);
+  }
+  return serializer.valid() ? serializer.written() : 0u;
+}
+
+base::TimeDelta TimeSerializeBuffer(const PaintOpBuffer& buffer,
+                                    const gfx::Rect& rect,
+                                    size_t max_concurrency,
+                                    int repeat_count,
+                                    char* memory) {
+  base::TimeDelta min_time = base::TimeDelta::Max();
+  for (int i = 0; i < repeat_count; ++i) {
+    // Run for a minimum amount of time to avoid problems with timer
+    // quantization when the buffer is very small.
+    base::LapTimer timer(kWarmupRuns, base::Milliseconds(kTimeLimitMillis),
+                         kTimeCheckInterval);
+    do {
+      SerializeBuffer(buffer, rect, max_concurrency, memory);
+      timer.NextLap();
+    } while (!timer.HasTimeLimitExpired());
+    min_time = std::min(min_time, timer.TimePerLap());
+  }
+  return min_time;
+}
+
+}  // namespace
+
+PaintOpSerializationBenchmark::PaintOpSerializationBenchmark(
+    base::Value::Dict settings,
+    MicroBenchmark::DoneCallback callback)
+    : MicroBenchmark(std::move(callback)),
+      repeat_count_(kDefaultRepeatCount),
+      max_concurrency_(
+          static_cast<size_t>(base::SysInfo::NumberOfProcessors())) {
+  auto repeat_count = settings.FindInt("repeat_count");
+  if (repeat_count.has_value())
+    repeat_count_ = *repeat_count;
+
+  auto max_concurrency = settings.FindInt("max_concurrency");
+  if (max_concurrency.has_value() && *max_concurrency > 0)
+    max_concurrency_ = static_cast<size_t>(*max_concurrency);
+}
+
+PaintOpSerializationBenchmark::~PaintOpSerializationBenchmark() = default;
+
+void PaintOpSerializationBenchmark::DidUpdateLayers(
+    LayerTreeHost* layer_tree_host) {
+  layer_tree_host_ = layer_tree_host;
+  for (auto* layer : *layer_tree_host)
+    layer->RunMicroBenchmark(this);
+
+  base::Value::Dict result;
+  result.Set("layers_serialized", layers_serialized_);
+  result.Set("serialized_bytes", static_cast<int>(serialized_bytes_));
+  result.Set("max_concurrency", static_cast<int>(max_concurrency_));
+  result.Set("serialize_time_ms", serialize_time_.InMillisecondsF());
+  result.Set("parallel_serialize_time_ms",
+             parallel_serialize_time_.InMillisecondsF());
+  result.Set("outputs_match", outputs_match_);
+  NotifyDone(std::move(result));
+}
+
+void PaintOpSerializationBenchmark::RunOnLayer(PictureLayer* layer) {
+  DCHECK(layer_tree_host_);
+
+  if (!layer->draws_content())
+    return;
+
+  scoped_refptr<DisplayItemList> display_list =
+      layer->client()->PaintContentsToDisplayList();
+  gfx::Rect rect = display_list->bounds().value_or(gfx::Rect(layer->bounds()));
+  if (rect.IsEmpty())
+    return;
+
+  const PaintOpBuffer& buffer = display_list->paint_op_buffer_;
+  auto serial_memory =
+      PaintOpWriter::AllocateAlignedBuffer<char>(kSerializedBufferSize);
+  auto parallel_memory =
+      PaintOpWriter::AllocateAlignedBuffer<char>(kSerializedBufferSize);
+  size_t serial_bytes = SerializeBuffer(buffer, rect, 0u, serial_memory.get());
+  size_t parallel_bytes =
+      SerializeBuffer(buffer, rect, max_concurrency_, parallel_memory.get());
+  outputs_match_ &=
+      serial_bytes == parallel_bytes &&
+      std::equal(serial_memory.get(), serial_memory.get() + serial_bytes,
+                 parallel_memory.get());
+
+  serialize_time_ += TimeSerializeBuffer(buffer, rect, 0u, repeat_count_,
+                                         serial_memory.get());
+  parallel_serialize_time_ +=
+      TimeSerializeBuffer(buffer, rect, max_concurrency_, repeat_count_,
+                          parallel_memory.get());
+  serialized_bytes_ += serial_bytes;
+  ++layers_serialized_;
+}
+
+}  // namespace cc
@@ -0,0 +1,46 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CC_BENCHMARKS_PAINT_OP_SERIALIZATION_BENCHMARK_H_
+#define CC_BENCHMARKS_PAINT_OP_SERIALIZATION_BENCHMARK_H_
+
+#include <stddef.h>
+
+#include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "cc/benchmarks/micro_benchmark.h"
+
+namespace cc {
+
+class LayerTreeHost;
+
+// Serializes the display list of each picture layer the way OOP raster does,
+// both with PaintOpBufferSerializer::Serialize() and with
+// PaintOpBufferSerializer::SerializeInParallel(), and reports the time taken
+// by each along with whether their outputs matched.
+class CC_EXPORT PaintOpSerializationBenchmark : public MicroBenchmark {
+ public:
+  explicit PaintOpSerializationBenchmark(base::Value::Dict settings,
+                                         MicroBenchmark::DoneCallback callback);
+  ~PaintOpSerializationBenchmark() override;
+
+  // Implements MicroBenchmark interface.
+  void DidUpdateLayers(LayerTreeHost* layer_tree_host) override;
+  void RunOnLayer(PictureLayer* layer) override;
+
+ private:
+  int repeat_count_;
+  size_t max_concurrency_;
+
+  raw_ptr<LayerTreeHost> layer_tree_host_ = nullptr;
+  int layers_serialized_ = 0;
+  size_t serialized_bytes_ = 0;
+  bool outputs_match_ = true;
+  base::TimeDelta serialize_time_;
+  base::TimeDelta parallel_serialize_time_;
+};
+
+}  // namespace cc
+
+#endif  // CC_BENCHMARKS_PAINT_OP_SERIALIZATION_BENCHMARK_H_
@@ -9,7 +9,9 @@
 #include <algorithm>
 #include <limits>
 #include <optional>
+#include <set>
 #include <string>
+#include <utility>
 
 #include "base/functional/bind.h"
 #include "base/memory/ptr_util.h"
@@ -20,6 +22,9 @@
 #include "cc/layers/picture_layer.h"
 #include "cc/layers/recording_source.h"
 #include "cc/paint/display_item_list.h"
+#include "cc/paint/paint_cache.h"
+#include "cc/paint/paint_op.h"
+#include "cc/paint/paint_op_buffer.h"
 #include "cc/trees/layer_tree_host.h"
 #include "ui/gfx/geometry/rect.h"
 
@@ -73,6 +78,21 @@ void RasterizeAndRecordBenchmark::DidUpdateLayers(
                static_cast<int>(record_results_.paint_op_memory_usage));
   results_.Set("paint_op_count",
                static_cast<int>(record_results_.paint_op_count));
+  results_.Set("paint_flags_count",
+               static_cast<int>(record_results_.paint_flags_count));
+  results_.Set("cacheable_paint_flags_count",
+               static_cast<int>(record_results_.cacheable_paint_flags_count));
+  results_.Set("unique_paint_flags_count",
+               static_cast<int>(record_results_.unique_paint_flags_count));
+  base::Value::Dict paint_op_type_counts;
+  for (size_t i = 0; i < record_results_.paint_op_type_counts.size(); ++i) {
+    if (!record_results_.paint_op_type_counts[i])
+      continue;
+    paint_op_type_counts.Set(
+        PaintOpTypeToString(static_cast<PaintOpType>(i)),
+        static_cast<int>(record_results_.paint_op_type_counts[i]));
+  }
+  results_.Set("paint_op_type_counts", std::move(paint_op_type_counts));
   results_.Set("record_time_ms", paint_benchmark_result.record_time_ms);
   results_.Set("record_time_caching_disabled_ms",
                paint_benchmark_result.record_time_caching_disabled_ms);
@@ -117,6 +137,22 @@ void RasterizeAndRecordBenchmark::RunOnLayer(PictureLayer* layer) {
       painter->PaintContentsToDisplayList();
   record_results_.paint_op_memory_usage += display_list->BytesUsed();
   record_results_.paint_op_count += display_list->TotalOpCount();
+
+  std::set<PaintFlagsCacheKey> unique_flags;
+  for (const PaintOp& op : display_list->paint_op_buffer_) {
+    ++record_results_.paint_op_type_counts[static_cast<size_t>(op.GetType())];
+    if (!op.IsPaintOpWithFlags())
+      continue;
+    ++record_results_.paint_flags_count;
+    std::optional<PaintFlagsCacheKey> key = PaintFlagsCacheKey::FromFlags(
+        static_cast<const PaintOpWithFlags&>(op).flags);
+    if (!key)
+      continue;
+    ++record_results_.cacheable_paint_flags_count;
+    unique_flags.insert(*key);
+  }
+  record_results_.unique_paint_flags_count += unique_flags.size();
+
   gfx::Rect bounds =
       display_list->bounds().value_or(gfx::Rect(layer->bounds()));
   record_results_.pixels_recorded += bounds.size().Area64();
@@ -7,6 +7,7 @@
 
 #include <stddef.h>
 
+#include <array>
 #include <map>
 #include <memory>
 #include <utility>
@@ -18,6 +19,7 @@
 #include "base/values.h"
 #include "cc/benchmarks/micro_benchmark_controller.h"
 #include "cc/layers/recording_source.h"
+#include "cc/paint/paint_op.h"
 
 namespace cc {
 
@@ -43,6 +45,16 @@ class RasterizeAndRecordBenchmark : public MicroBenchmark {
     int pixels_recorded = 0;
     size_t paint_op_memory_usage = 0;
     size_t paint_op_count = 0;
+    // Ops with flags, and how many of those have flags that can be sent
+    // through the paint cache.
+    size_t paint_flags_count = 0;
+    size_t cacheable_paint_flags_count = 0;
+    // Distinct cacheable flags per layer, i.e. how many of them would be sent
+    // inline when the layer is serialized with an empty paint cache.
+    size_t unique_paint_flags_count = 0;
+    // Top-level op counts indexed by PaintOpType, so that raster changes can
+    // be attributed to the op types a page actually records.
+    std::array<size_t, PaintOp::kNumOpTypes> paint_op_type_counts = {};
   };
 
   RecordResults record_results_;
@@ -575,6 +575,10 @@ std::optional<SnapSearchResult> SnapContainerData::FindClosestValidAreaInternal(
     }
   };
 
+  // Hoisted out of the loop below, which visits every snap area.
+  const bool prefer_closer_covering =
+      base::FeatureList::IsEnabled(features::kScrollSnapPreferCloserCovering);
+
   for (const SnapAreaData& area : snap_area_list_) {
     if (!strategy.IsValidSnapArea(axis, area))
       continue;
@@ -591,7 +595,7 @@ std::optional<SnapSearchResult> SnapContainerData::FindClosestValidAreaInternal(
     SnapSearchResult candidate = GetSnapSearchResult(axis, area);
     evaluate(candidate, area);
     if (should_consider_covering &&
-        (base::FeatureList::IsEnabled(features::kScrollSnapPreferCloserCovering)
+        (prefer_closer_covering
              ? CanCoverSnapportOnAxis(axis, snapport(), area.rect)
              : IsSnapportCoveredOnAxis(axis, intended_position, area.rect))) {
       if (std::optional<SnapSearchResult> covering =
@@ -17,6 +17,7 @@
 #include "base/no_destructor.h"
 #include "base/sequence_checker.h"
 #include "base/trace_event/trace_event.h"
+#include "cc/base/region.h"
 #include "cc/paint/image_provider.h"
 #include "cc/paint/paint_filter.h"
 #include "cc/paint/paint_op_buffer.h"
@@ -31,13 +32,42 @@ namespace cc {
 namespace {
 const int kMaxRectsSize = 256;
 
+// Don't bother patching the previous map if the invalidation covers more than
+// this fraction of the recording, the full walk is cheaper in that case.
+constexpr float kMaxInvalidatedAreaRatioForIncremental = 0.5f;
+
+void AddRect(DiscardableImageMap::Rects& rects, const gfx::Rect& image_rect) {
+  if (rects.size() >= kMaxRectsSize) {
+    rects.back().Union(image_rect);
+  } else {
+    rects.push_back(image_rect);
+  }
+}
+
+void AddDecodingMode(
+    base::flat_map<PaintImage::Id, PaintImage::DecodingMode>& decoding_modes,
+    const PaintImage& paint_image) {
+  auto decoding_mode_it = decoding_modes.find(paint_image.stable_id());
+  // Use the decoding mode if we don't have one yet, otherwise use the more
+  // conservative one of the two existing ones.
+  if (decoding_mode_it == decoding_modes.end()) {
+    decoding_modes[paint_image.stable_id()] = paint_image.decoding_mode();
+  } else {
+    decoding_mode_it->second = PaintImage::GetConservative(
+        decoding_mode_it->second, paint_image.decoding_mode());
+  }
+}
+
 class DiscardableImageGenerator {
  public:
+  // If |offsets| is provided, only the top level ops at those offsets in
+  // |buffer| are walked.
   DiscardableImageGenerator(int width,
                             int height,
-                            const PaintOpBuffer& buffer) {
+                            const PaintOpBuffer& buffer,
+                            const std::vector<size_t>* offsets = nullptr) {
     SkNoDrawCanvas canvas(width, height);
-    GatherDiscardableImages(buffer, nullptr, &canvas);
+    GatherDiscardableImages(buffer, nullptr, &canvas, offsets);
   }
   ~DiscardableImageGenerator() = default;
 
@@ -65,6 +95,9 @@ class DiscardableImageGenerator {
     return content_color_usage_;
   }
   bool contains_hbd_images() const { return contains_hbd_images_; }
+  bool has_rects_without_draw_images() const {
+    return has_rects_without_draw_images_;
+  }
 
  private:
   class ImageGatheringProvider : public ImageProvider {
@@ -92,10 +125,12 @@ class DiscardableImageGenerator {
   // op (for instance, with PaintRecord backed PaintShaders),
   // |top_level_op_rect| is set to the rect for that op. If provided, the
   // |top_level_op_rect| will be used as the rect for tracking the position of
-  // this image in the top-level buffer.
+  // this image in the top-level buffer. If |offsets| is provided, only the ops
+  // at those offsets are walked.
   void GatherDiscardableImages(const PaintOpBuffer& buffer,
                                const gfx::Rect* top_level_op_rect,
-                               SkNoDrawCanvas* canvas) {
+                               SkNoDrawCanvas* canvas,
+                               const std::vector<size_t>* offsets = nullptr) {
     if (!buffer.HasDiscardableImages())
       return;
 
@@ -105,7 +140,8 @@ class DiscardableImageGenerator {
     PlaybackParams params(nullptr, canvas->getLocalToDevice());
     // TODO(khushalsagar): Optimize out save/restore blocks if there are no
     // images in the draw ops between them.
-    for (const PaintOp& op : buffer) {
+    for (const PaintOp& op :
+         PaintOpBuffer::CompositeIterator(buffer, offsets)) {
       // We need to play non-draw ops on the SkCanvas since they can affect the
       // transform/clip state.
       if (!op.IsDrawOp())
@@ -297,25 +333,10 @@ class DiscardableImageGenerator {
         contains_hbd_images_ = true;
     }
 
-    auto& rects = image_id_to_rects_[paint_image.stable_id()];
-    if (rects.size() >= kMaxRectsSize) {
-      rects.back().Union(image_rect);
-    } else {
-      rects.push_back(image_rect);
-    }
+    AddRect(image_id_to_rects_[paint_image.stable_id()], image_rect);
 
-    if (paint_image.IsLazyGenerated()) {
-      auto decoding_mode_it = decoding_mode_map_.find(paint_image.stable_id());
-      // Use the decoding mode if we don't have one yet, otherwise use the more
-      // conservative one of the two existing ones.
-      if (decoding_mode_it == decoding_mode_map_.end()) {
-        decoding_mode_map_[paint_image.stable_id()] =
-            paint_image.decoding_mode();
-      } else {
-        decoding_mode_it->second = PaintImage::GetConservative(
-            decoding_mode_it->second, paint_image.decoding_mode());
-      }
-    }
+    if (paint_image.IsLazyGenerated())
+      AddDecodingMode(decoding_mode_map_, paint_image);
 
     if (paint_image.ShouldAnimate()) {
       animated_images_metadata_.emplace_back(
@@ -342,6 +363,8 @@ class DiscardableImageGenerator {
       image_set_.emplace_back(DrawImage(std::move(paint_image), use_dark_mode,
                                         src_irect, filter_quality, matrix),
                               image_rect);
+    } else {
+      has_rects_without_draw_images_ = true;
     }
   }
 
@@ -357,6 +380,7 @@ class DiscardableImageGenerator {
 
   gfx::ContentColorUsage content_color_usage_ = gfx::ContentColorUsage::kSRGB;
   bool contains_hbd_images_ = false;
+  bool has_rects_without_draw_images_ = false;
 };
 
 }  // namespace
@@ -383,6 +407,98 @@ void DiscardableImageMap::Generate(const PaintOpBuffer& paint_op_buffer,
   decoding_mode_map_ = generator.TakeDecodingModeMap();
   contains_hbd_images_ = generator.contains_hbd_images();
   content_color_usage_ = generator.content_color_usage();
+  has_rects_without_draw_images_ = generator.has_rects_without_draw_images();
+  DCHECK_CALLED_ON_VALID_SEQUENCE(images_rtree_sequence_checker_);
+  CHECK(!images_rtree_);
+  DETACH_FROM_SEQUENCE(images_rtree_sequence_checker_);
+}
+
+// static
+bool DiscardableImageMap::CanGenerateIncrementallyFrom(
+    const DiscardableImageMap& previous,
+    const gfx::Rect& bounds,
+    const Region& invalidation) {
+  // Everything kept from |previous| must be derivable from its DrawImages,
+  // which isn't the case for paint worklets, animated images and images that
+  // are only tracked for their rects.
+  if (!previous.paint_worklet_inputs_.empty() ||
+      !previous.animated_images_metadata_.empty() ||
+      previous.has_rects_without_draw_images_) {
+    return false;
+  }
+
+  const gfx::Rect invalidation_bounds =
+      gfx::IntersectRects(invalidation.bounds(), bounds);
+  return invalidation_bounds.size().Area64() <=
+         bounds.size().Area64() * kMaxInvalidatedAreaRatioForIncremental;
+}
+
+void DiscardableImageMap::GenerateIncremental(
+    const DiscardableImageMap& previous,
+    const PaintOpBuffer& paint_op_buffer,
+    const gfx::Rect& bounds,
+    const Region& invalidation,
+    const std::vector<size_t>& offsets) {
+  TRACE_EVENT1("cc", "DiscardableImageMap::GenerateIncremental", "op_count",
+               offsets.size());
+  DCHECK(CanGenerateIncrementallyFrom(previous, bounds, invalidation));
+  DCHECK(images_.empty());
+
+  if (!paint_op_buffer.HasDiscardableImages()) {
+    return;
+  }
+
+  // An image belongs to the new recording if its rect intersects the
+  // invalidation and to the previous one otherwise. Nothing outside the
+  // invalidation changed, so the images kept from |previous| are exactly the
+  // ones the full walk would produce there.
+  std::vector<std::pair<DrawImage, gfx::Rect>> images;
+  for (const auto& image : previous.images_) {
+    if (invalidation.Intersects(image.second)) {
+      continue;
+    }
+    images.push_back(image);
+    const PaintImage& paint_image = image.first.paint_image();
+    AddRect(image_id_to_rects_[paint_image.stable_id()], image.second);
+    if (paint_image.IsLazyGenerated())
+      AddDecodingMode(decoding_mode_map_, paint_image);
+    content_color_usage_ =
+        std::max(content_color_usage_, paint_image.GetContentColorUsage());
+    contains_hbd_images_ |= paint_image.is_high_bit_depth();
+  }
+
+  // Only the ops intersecting the invalidation are walked, but they may also
+  // draw images outside of it which are already accounted for above.
+  DiscardableImageGenerator generator(bounds.right(), bounds.bottom(),
+                                      paint_op_buffer, &offsets);
+  for (auto& image : generator.TakeImages()) {
+    if (invalidation.Intersects(image.second)) {
+      images.push_back(std::move(image));
+    }
+  }
+  for (auto& [id, rects] : generator.TakeImageIdToRectsMap()) {
+    for (const gfx::Rect& rect : rects) {
+      if (invalidation.Intersects(rect)) {
+        AddRect(image_id_to_rects_[id], rect);
+      }
+    }
+  }
+  for (const auto& [id, decoding_mode] : generator.TakeDecodingModeMap()) {
+    auto decoding_mode_it = decoding_mode_map_.find(id);
+    if (decoding_mode_it == decoding_mode_map_.end()) {
+      decoding_mode_map_[id] = decoding_mode;
+    } else {
+      decoding_mode_it->second =
+          PaintImage::GetConservative(decoding_mode_it->second, decoding_mode);
+    }
+  }
+  images_ = std::move(images);
+  animated_images_metadata_ = generator.TakeAnimatedImagesMetadata();
+  paint_worklet_inputs_ = generator.TakePaintWorkletInputs();
+  contains_hbd_images_ |= generator.contains_hbd_images();
+  content_color_usage_ =
+      std::max(content_color_usage_, generator.content_color_usage());
+  has_rects_without_draw_images_ = generator.has_rects_without_draw_images();
   DCHECK_CALLED_ON_VALID_SEQUENCE(images_rtree_sequence_checker_);
   CHECK(!images_rtree_);
   DETACH_FROM_SEQUENCE(images_rtree_sequence_checker_);
@@ -30,6 +30,7 @@
 namespace cc {
 class DiscardableImageStore;
 class PaintOpBuffer;
+class Region;
 
 // This class is used for generating discardable images data (see DrawImage
 // for the type of data it stores). It allows the client to query a particular
@@ -73,6 +74,24 @@ class CC_PAINT_EXPORT DiscardableImageMap {
   void Reset();
   void Generate(const PaintOpBuffer& paint_op_buffer, const gfx::Rect& bounds);
 
+  // Returns whether GenerateIncremental() can be used to patch |previous|
+  // rather than generating the map from scratch. This requires everything in
+  // |previous| to be derivable from its images, and |invalidation| to be small
+  // enough compared to |bounds| for the patch to be cheaper.
+  static bool CanGenerateIncrementallyFrom(const DiscardableImageMap& previous,
+                                           const gfx::Rect& bounds,
+                                           const Region& invalidation);
+  // Generates the map for |paint_op_buffer| by patching |previous|, the map of
+  // the recording |paint_op_buffer| replaces, instead of walking every op.
+  // |invalidation| must cover every difference between the two recordings and
+  // |offsets| must include every top level op intersecting it, in increasing
+  // order. Images of |previous| outside |invalidation| are kept as is.
+  void GenerateIncremental(const DiscardableImageMap& previous,
+                           const PaintOpBuffer& paint_op_buffer,
+                           const gfx::Rect& bounds,
+                           const Region& invalidation,
+                           const std::vector<size_t>& offsets);
+
   // This should only be called once from the compositor thread at commit time.
   base::flat_map<PaintImage::Id, PaintImage::DecodingMode>
   TakeDecodingModeMap();
@@ -104,6 +123,8 @@ class CC_PAINT_EXPORT DiscardableImageMap {
   base::flat_map<PaintImage::Id, PaintImage::DecodingMode> decoding_mode_map_;
   gfx::ContentColorUsage content_color_usage_ = gfx::ContentColorUsage::kSRGB;
   bool contains_hbd_images_ = false;
+  // Set if |image_id_to_rects_| tracks images that aren't in |images_|.
+  bool has_rects_without_draw_images_ = false;
 
   SEQUENCE_CHECKER(images_rtree_sequence_checker_);
 
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "base/check.h"
 #include "base/containers/contains.h"
@@ -16,6 +17,7 @@
 #include "base/test/gtest_util.h"
 #include "base/values.h"
 #include "cc/base/region.h"
+#include "cc/paint/display_item_list.h"
 #include "cc/paint/paint_flags.h"
 #include "cc/paint/paint_op_buffer.h"
 #include "cc/paint/paint_recorder.h"
@@ -77,6 +79,23 @@ PaintRecord CreateRecording(const PaintImage& discardable_image,
   return buffer.ReleaseAsRecord();
 }
 
+// Creates a list that draws each of |images| as its own display item in a row
+// of 512x512 cells.
+scoped_refptr<DisplayItemList> CreateImageRowList(
+    const std::vector<PaintImage>& images) {
+  auto display_list = base::MakeRefCounted<DisplayItemList>();
+  for (size_t i = 0; i < images.size(); ++i) {
+    const gfx::Rect cell(static_cast<int>(i) * 512, 0, 512, 512);
+    display_list->StartPaint();
+    display_list->push<DrawImageOp>(images[i], cell.x(), cell.y());
+    display_list->EndPaintOfUnpaired(
+        gfx::Rect(cell.origin(), gfx::Size(images[i].width(),
+                                           images[i].height())));
+  }
+  display_list->Finalize();
+  return display_list;
+}
+
 }  // namespace
 
 class DiscardableImageMapTest : public testing::Test {
@@ -1295,6 +1314,82 @@ TEST_F(DiscardableImageMapTest,
 
 #endif  // BUILDFLAG(SKIA_SUPPORT_SKOTTIE)
 
+TEST_F(DiscardableImageMapTest, GenerateIncrementalPatchesInvalidatedImages) {
+  std::vector<PaintImage> images;
+  for (int i = 0; i < 4; ++i)
+    images.push_back(CreateDiscardablePaintImage(gfx::Size(500, 500)));
+  scoped_refptr<DisplayItemList> previous_list = CreateImageRowList(images);
+  previous_list->GenerateDiscardableImagesMetadataForTesting();
+
+  // Replace the image in the third cell.
+  std::vector<PaintImage> new_images = images;
+  new_images[2] = CreateDiscardablePaintImage(gfx::Size(500, 500));
+  const Region invalidation(gfx::Rect(1024, 0, 512, 512));
+  scoped_refptr<DisplayItemList> patched_list = CreateImageRowList(new_images);
+  patched_list->GenerateDiscardableImagesMetadataFrom(*previous_list,
+                                                      invalidation);
+  scoped_refptr<DisplayItemList> full_list = CreateImageRowList(new_images);
+  full_list->GenerateDiscardableImagesMetadataForTesting();
+
+  const DiscardableImageMap& patched_map =
+      patched_list->discardable_image_map();
+  const DiscardableImageMap& full_map = full_list->discardable_image_map();
+  std::vector<PositionScaleDrawImage> patched_images =
+      GetDiscardableImagesInRect(patched_map, gfx::Rect(4096, 512));
+  EXPECT_EQ(patched_images.size(),
+            GetDiscardableImagesInRect(full_map, gfx::Rect(4096, 512)).size());
+  EXPECT_THAT(patched_images, SizeIs(4));
+  for (const PaintImage& image : new_images) {
+    const PaintImage::Id id = image.stable_id();
+    EXPECT_EQ(ImageRectsToRegion(patched_map.GetRectsForImage(id)),
+              ImageRectsToRegion(full_map.GetRectsForImage(id)));
+  }
+  EXPECT_TRUE(patched_map.GetRectsForImage(images[2].stable_id()).empty());
+  EXPECT_THAT(patched_list->TakeDecodingModeMap(),
+              testing::UnorderedElementsAreArray(
+                  full_list->TakeDecodingModeMap()));
+}
+
+TEST_F(DiscardableImageMapTest, GenerateIncrementalFallsBackToFullGeneration) {
+  std::vector<FrameMetadata> frames = {
+      FrameMetadata(true, base::Milliseconds(1)),
+      FrameMetadata(true, base::Milliseconds(1))};
+  std::vector<PaintImage> images = {
+      CreateAnimatedImage(gfx::Size(500, 500), frames),
+      CreateDiscardablePaintImage(gfx::Size(500, 500))};
+  scoped_refptr<DisplayItemList> previous_list = CreateImageRowList(images);
+  previous_list->GenerateDiscardableImagesMetadataForTesting();
+  ASSERT_THAT(
+      previous_list->discardable_image_map().animated_images_metadata(),
+      SizeIs(1));
+
+  // Animated images can't be carried over from the previous map, so the whole
+  // list is walked again.
+  const Region invalidation(gfx::Rect(512, 0, 512, 512));
+  EXPECT_FALSE(DiscardableImageMap::CanGenerateIncrementallyFrom(
+      previous_list->discardable_image_map(), gfx::Rect(4096, 4096),
+      invalidation));
+  images[1] = CreateDiscardablePaintImage(gfx::Size(500, 500));
+  scoped_refptr<DisplayItemList> new_list = CreateImageRowList(images);
+  new_list->GenerateDiscardableImagesMetadataFrom(*previous_list,
+                                                  invalidation);
+  const DiscardableImageMap& image_map = new_list->discardable_image_map();
+  EXPECT_THAT(image_map.animated_images_metadata(), SizeIs(1));
+  EXPECT_THAT(GetDiscardableImagesInRect(image_map, gfx::Rect(1024, 512)),
+              SizeIs(2));
+
+  // Invalidating most of the recording also walks the whole list.
+  scoped_refptr<DisplayItemList> static_list =
+      CreateImageRowList({CreateDiscardablePaintImage(gfx::Size(500, 500))});
+  static_list->GenerateDiscardableImagesMetadataForTesting();
+  EXPECT_TRUE(DiscardableImageMap::CanGenerateIncrementallyFrom(
+      static_list->discardable_image_map(), gfx::Rect(4096, 4096),
+      invalidation));
+  EXPECT_FALSE(DiscardableImageMap::CanGenerateIncrementallyFrom(
+      static_list->discardable_image_map(), gfx::Rect(4096, 4096),
+      Region(gfx::Rect(4096, 3000))));
+}
+
 class DiscardableImageMapColorSpaceTest
     : public DiscardableImageMapTest,
       public testing::WithParamInterface<gfx::ColorSpace> {};
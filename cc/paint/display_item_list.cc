@@ -7,10 +7,12 @@
 #include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "base/trace_event/trace_event.h"
 #include "base/trace_event/traced_value.h"
 #include "cc/base/math_util.h"
+#include "cc/base/region.h"
 #include "cc/debug/picture_debug_util.h"
 #include "cc/paint/paint_op_buffer_iterator.h"
 #include "cc/paint/solid_color_analyzer.h"
@@ -312,6 +314,34 @@ void DisplayItemList::GenerateDiscardableImagesMetadataForTesting() const {
   GenerateDiscardableImagesMetadata();
 }
 
+void DisplayItemList::GenerateDiscardableImagesMetadataFrom(
+    const DisplayItemList& previous,
+    const Region& invalidation) const {
+  DCHECK_NE(this, &previous);
+  base::AutoLock lock(image_generation_lock_);
+  if (image_map_) {
+    return;
+  }
+
+  const gfx::Rect bounds = this->bounds().value_or(kMaxBounds);
+  {
+    base::AutoLock previous_lock(previous.image_generation_lock_);
+    if (previous.image_map_ &&
+        DiscardableImageMap::CanGenerateIncrementallyFrom(
+            *previous.image_map_, bounds, invalidation)) {
+      std::vector<size_t> offsets;
+      if (rtree_.has_valid_bounds()) {
+        rtree_.Search(invalidation.bounds(), &offsets);
+      }
+      image_map_.emplace();
+      image_map_->GenerateIncremental(*previous.image_map_, paint_op_buffer_,
+                                      bounds, invalidation, offsets);
+      return;
+    }
+  }
+  GenerateDiscardableImagesMetadata();
+}
+
 void DisplayItemList::GenerateDiscardableImagesMetadata() const {
   image_generation_lock_.AssertAcquired();
   CHECK(!image_map_);
@@ -39,6 +39,7 @@ class TracedValue;
 }  // namespace base::trace_event
 
 namespace cc {
+class Region;
 
 // DisplayItemList is a container of paint operations. One can populate the list
 // using StartPaint, followed by push{,_with_data,_with_array} functions
@@ -174,6 +175,15 @@ class CC_PAINT_EXPORT DisplayItemList
   void EmitTraceSnapshot() const;
   void GenerateDiscardableImagesMetadataForTesting() const;
 
+  // Generates the discardable image metadata of this list from the metadata
+  // of |previous|, the list this one replaces, only walking the ops that
+  // intersect |invalidation|. |invalidation| must cover every difference
+  // between the two lists. Falls back to generating the metadata from scratch
+  // if |previous| hasn't generated its metadata or can't be patched. Does
+  // nothing if the metadata has already been generated.
+  void GenerateDiscardableImagesMetadataFrom(const DisplayItemList& previous,
+                                             const Region& invalidation) const;
+
   gfx::Rect VisualRectForTesting(int index) {
     return visual_rects_[static_cast<size_t>(index)];
   }
@@ -219,6 +229,8 @@ class CC_PAINT_EXPORT DisplayItemList
  private:
   friend class DisplayItemListTest;
   friend class PaintOpBufferSerializer;
+  friend class PaintOpSerializationBenchmark;
+  friend class RasterizeAndRecordBenchmark;
   friend gpu::raster::RasterImplementation;
   friend gpu::raster::RasterImplementationGLES;
 
@@ -6,6 +6,8 @@
 
 #include <utility>
 
+#include "base/check_op.h"
+
 namespace cc {
 namespace {
 
@@ -87,6 +89,19 @@ DrawImage::DrawImage(const DrawImage& other,
       frame_index_(frame_index),
       target_color_params_(target_color_params) {}
 
+DrawImage::DrawImage(const DrawImage& other, PaintImage image)
+    : paint_image_(std::move(image)),
+      use_dark_mode_(other.use_dark_mode_),
+      src_rect_(other.src_rect_),
+      filter_quality_(other.filter_quality_),
+      scale_(other.scale_),
+      matrix_is_decomposable_(other.matrix_is_decomposable_),
+      frame_index_(other.frame_index_),
+      target_color_params_(other.target_color_params_) {
+  DCHECK_EQ(paint_image_.width(), other.paint_image_.width());
+  DCHECK_EQ(paint_image_.height(), other.paint_image_.height());
+}
+
 DrawImage::DrawImage(const DrawImage& other) = default;
 DrawImage::DrawImage(DrawImage&& other) = default;
 DrawImage::~DrawImage() = default;
@@ -47,6 +47,9 @@ class CC_PAINT_EXPORT DrawImage {
             float scale_adjustment,
             size_t frame_index,
             const TargetColorParams& target_color_params);
+  // Constructs a DrawImage from |other| with |image| substituted for its
+  // PaintImage. |image| must have the same dimensions as the original.
+  DrawImage(const DrawImage& other, PaintImage image);
   DrawImage(const DrawImage& other);
   DrawImage(DrawImage&& other);
   ~DrawImage();
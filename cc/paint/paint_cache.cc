@@ -4,6 +4,7 @@
 
 #include "cc/paint/paint_cache.h"
 
+#include "base/bit_cast.h"
 #include "base/check_op.h"
 #include "base/containers/flat_set.h"
 #include "base/notreached.h"
@@ -22,10 +23,31 @@ void EraseFromMap(T* map, size_t n, const volatile PaintCacheId* ids) {
 
 }  // namespace
 
+// static
+std::optional<PaintFlagsCacheKey> PaintFlagsCacheKey::FromFlags(
+    const PaintFlags& flags) {
+  if (flags.path_effect_ || flags.shader_ || flags.color_filter_ ||
+      flags.draw_looper_ || flags.image_filter_) {
+    return std::nullopt;
+  }
+
+  PaintFlagsCacheKey key;
+  key.bits_ = {base::bit_cast<uint32_t>(flags.color_.fR),
+               base::bit_cast<uint32_t>(flags.color_.fG),
+               base::bit_cast<uint32_t>(flags.color_.fB),
+               base::bit_cast<uint32_t>(flags.color_.fA),
+               base::bit_cast<uint32_t>(flags.width_),
+               base::bit_cast<uint32_t>(flags.miter_limit_),
+               flags.bitfields_uint_};
+  return key;
+}
+
 constexpr size_t ClientPaintCache::kNoCachingBudget;
 
 ClientPaintCache::ClientPaintCache(size_t max_budget_bytes)
-    : cache_map_(CacheMap::NO_AUTO_EVICT), max_budget_(max_budget_bytes) {}
+    : cache_map_(CacheMap::NO_AUTO_EVICT),
+      max_budget_(max_budget_bytes),
+      flags_map_(FlagsMap::NO_AUTO_EVICT) {}
 ClientPaintCache::~ClientPaintCache() = default;
 
 bool ClientPaintCache::Get(PaintCacheDataType type, PaintCacheId id) {
@@ -52,8 +74,43 @@ void ClientPaintCache::EraseFromMap(Iterator it) {
   cache_map_.Erase(it);
 }
 
+std::optional<PaintCacheId> ClientPaintCache::GetFlags(
+    const PaintFlagsCacheKey& key) {
+  auto it = flags_map_.Get(key);
+  if (it == flags_map_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+std::optional<PaintCacheId> ClientPaintCache::PutFlags(
+    const PaintFlagsCacheKey& key) {
+  if (max_budget_ == kNoCachingBudget) {
+    return std::nullopt;
+  }
+  DCHECK(flags_map_.Peek(key) == flags_map_.end());
+
+  PaintCacheId slot;
+  if (!free_flags_slots_.empty()) {
+    slot = free_flags_slots_.back();
+    free_flags_slots_.pop_back();
+  } else if (next_flags_slot_ < kMaxCachedPaintFlags) {
+    slot = next_flags_slot_++;
+  } else {
+    // The service side entry is overwritten when the new flags are received.
+    auto lru_it = flags_map_.rbegin();
+    slot = lru_it->second;
+    flags_map_.Erase(lru_it);
+  }
+
+  pending_flags_.push_back(key);
+  flags_map_.Put(key, slot);
+  return slot;
+}
+
 void ClientPaintCache::FinalizePendingEntries() {
   pending_entries_.clear();
+  pending_flags_.clear();
 }
 
 void ClientPaintCache::AbortPendingEntries() {
@@ -63,6 +120,17 @@ void ClientPaintCache::AbortPendingEntries() {
     EraseFromMap(it);
   }
   pending_entries_.clear();
+
+  // The slots of aborted flags may still hold the flags they were taken from
+  // on the service side, but those are no longer referenced by the client.
+  for (const auto& key : pending_flags_) {
+    auto it = flags_map_.Peek(key);
+    if (it != flags_map_.end()) {
+      free_flags_slots_.push_back(it->second);
+      flags_map_.Erase(it);
+    }
+  }
+  pending_flags_.clear();
 }
 
 void ClientPaintCache::Purge(PurgedData* purged_data) {
@@ -80,10 +148,14 @@ void ClientPaintCache::Purge(PurgedData* purged_data) {
 
 bool ClientPaintCache::PurgeAll() {
   DCHECK(pending_entries_.empty());
+  DCHECK(pending_flags_.empty());
 
-  bool has_data = !cache_map_.empty();
+  bool has_data = !cache_map_.empty() || !flags_map_.empty();
   cache_map_.Clear();
   bytes_used_ = 0u;
+  flags_map_.Clear();
+  free_flags_slots_.clear();
+  next_flags_slot_ = 0u;
   return has_data;
 }
 
@@ -102,6 +174,23 @@ bool ServicePaintCache::GetPath(PaintCacheId id, SkPath* path) const {
   return true;
 }
 
+bool ServicePaintCache::PutFlags(PaintCacheId id, const PaintFlags& flags) {
+  if (id >= kMaxCachedPaintFlags) {
+    return false;
+  }
+  cached_flags_.insert_or_assign(id, flags);
+  return true;
+}
+
+bool ServicePaintCache::GetFlags(PaintCacheId id, PaintFlags* flags) const {
+  auto it = cached_flags_.find(id);
+  if (it == cached_flags_.end()) {
+    return false;
+  }
+  *flags = it->second;
+  return true;
+}
+
 void ServicePaintCache::Purge(PaintCacheDataType type,
                               size_t n,
                               const volatile PaintCacheId* ids) {
@@ -116,6 +205,7 @@ void ServicePaintCache::Purge(PaintCacheDataType type,
 
 void ServicePaintCache::PurgeAll() {
   cached_paths_.clear();
+  cached_flags_.clear();
 }
 
 }  // namespace cc
@@ -5,13 +5,17 @@
 #ifndef CC_PAINT_PAINT_CACHE_H_
 #define CC_PAINT_PAINT_CACHE_H_
 
+#include <array>
 #include <map>
+#include <optional>
 #include <set>
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/lru_cache.h"
 #include "cc/paint/paint_export.h"
+#include "cc/paint/paint_flags.h"
 #include "third_party/abseil-cpp/absl/container/inlined_vector.h"
 #include "third_party/skia/include/core/SkPath.h"
 #include "third_party/skia/include/core/SkTextBlob.h"
@@ -35,6 +39,11 @@ namespace cc {
 // controlled PaintCache with a tighter budget is better for these data types
 // since it avoids the need for cross-process ref-counting required by the
 // TransferCache.
+//
+// PaintFlags are cached too, since most draw ops in a recording share a handful
+// of flags values (text in particular). Unlike other entries they are stored in
+// a fixed number of service side slots which the ClientPaintCache assigns and
+// overwrites, so they never need to be purged explicitly.
 
 using PaintCacheId = uint32_t;
 using PaintCacheIds = std::vector<PaintCacheId>;
@@ -50,6 +59,31 @@ enum class PaintCacheEntryState : uint32_t {
 constexpr size_t PaintCacheDataTypeCount =
     static_cast<uint32_t>(PaintCacheDataType::kLast) + 1u;
 
+// The number of service side slots for cached PaintFlags.
+constexpr PaintCacheId kMaxCachedPaintFlags = 256u;
+
+// Identifies the value of a PaintFlags without any effects attached, which
+// are the only flags that are cached.
+class CC_PAINT_EXPORT PaintFlagsCacheKey {
+ public:
+  // Returns nullopt if |flags| has effects attached and can't be cached.
+  static std::optional<PaintFlagsCacheKey> FromFlags(const PaintFlags& flags);
+
+  bool operator<(const PaintFlagsCacheKey& other) const {
+    return bits_ < other.bits_;
+  }
+  bool operator==(const PaintFlagsCacheKey& other) const {
+    return bits_ == other.bits_;
+  }
+
+ private:
+  PaintFlagsCacheKey() = default;
+
+  // The bit patterns of the color, width, miter limit and bitfields of the
+  // flags. Comparing bits rather than floats keeps the ordering well defined.
+  std::array<uint32_t, 7> bits_;
+};
+
 class CC_PAINT_EXPORT ClientPaintCache {
  public:
   // If ClientPaintCache is constructed with a max_budget_bytes of
@@ -85,9 +119,19 @@ class CC_PAINT_EXPORT ClientPaintCache {
 
   size_t bytes_used() const { return bytes_used_; }
 
+  // Returns the service side slot holding the flags identified by |key|, if
+  // they have been sent to the ServicePaintCache.
+  std::optional<PaintCacheId> GetFlags(const PaintFlagsCacheKey& key);
+  // Assigns a service side slot to the flags identified by |key|, which must
+  // not be cached already, reusing the least recently used slot if all of them
+  // are taken. The flags should then be sent inline along with the slot.
+  // Returns nullopt if caching is disabled.
+  std::optional<PaintCacheId> PutFlags(const PaintFlagsCacheKey& key);
+
  private:
   using CacheKey = std::pair<PaintCacheDataType, PaintCacheId>;
   using CacheMap = base::LRUCache<CacheKey, size_t>;
+  using FlagsMap = base::LRUCache<PaintFlagsCacheKey, PaintCacheId>;
 
   template <typename Iterator>
   void EraseFromMap(Iterator it);
@@ -100,6 +144,13 @@ class CC_PAINT_EXPORT ClientPaintCache {
   // send them to the service-side cache. This is necessary to ensure we
   // maintain an accurate mirror of the service-side state.
   absl::InlinedVector<CacheKey, 1> pending_entries_;
+
+  // Cached flags and the slots they occupy in the ServicePaintCache. Slots
+  // which were never assigned or whose entry was aborted are reused first.
+  FlagsMap flags_map_;
+  PaintCacheIds free_flags_slots_;
+  PaintCacheId next_flags_slot_ = 0u;
+  absl::InlinedVector<PaintFlagsCacheKey, 1> pending_flags_;
 };
 
 class CC_PAINT_EXPORT ServicePaintCache {
@@ -114,15 +165,24 @@ class CC_PAINT_EXPORT ServicePaintCache {
   // |path| pointed memory. Returns false, if the entry is not found.
   bool GetPath(PaintCacheId id, SkPath* path) const;
 
+  // Stores |flags| received from the client in slot |id|, replacing the flags
+  // previously stored there. Returns false if |id| is not a valid slot.
+  bool PutFlags(PaintCacheId id, const PaintFlags& flags);
+
+  // Retrieves the flags stored in slot |id|. Returns false if the slot is
+  // empty.
+  bool GetFlags(PaintCacheId id, PaintFlags* flags) const;
+
   void Purge(PaintCacheDataType type,
              size_t n,
              const volatile PaintCacheId* ids);
   void PurgeAll();
-  bool empty() const { return cached_paths_.empty(); }
+  bool empty() const { return cached_paths_.empty() && cached_flags_.empty(); }
 
  private:
   using PathMap = std::map<PaintCacheId, SkPath>;
   PathMap cached_paths_;
+  base::flat_map<PaintCacheId, PaintFlags> cached_flags_;
 };
 
 }  // namespace cc
@@ -4,6 +4,10 @@
 
 #include "cc/paint/paint_cache.h"
 
+#include <optional>
+
+#include "cc/paint/paint_flags.h"
+#include "cc/paint/paint_shader.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace cc {
@@ -17,6 +21,12 @@ SkPath CreatePath() {
   return path;
 }
 
+PaintFlagsCacheKey CreateFlagsKey(float width) {
+  PaintFlags flags;
+  flags.setStrokeWidth(width);
+  return *PaintFlagsCacheKey::FromFlags(flags);
+}
+
 class PaintCacheTest : public ::testing::TestWithParam<uint32_t> {
  public:
   PaintCacheDataType GetType() {
@@ -104,5 +114,99 @@ INSTANTIATE_TEST_SUITE_P(
     PaintCacheTest,
     ::testing::Values(static_cast<uint32_t>(PaintCacheDataType::kPath)));
 
+TEST(PaintFlagsCacheKeyTest, FromFlags) {
+  PaintFlags flags;
+  flags.setColor(SK_ColorRED);
+  ASSERT_TRUE(PaintFlagsCacheKey::FromFlags(flags));
+
+  PaintFlags same_flags;
+  same_flags.setColor(SK_ColorRED);
+  EXPECT_EQ(*PaintFlagsCacheKey::FromFlags(flags),
+            *PaintFlagsCacheKey::FromFlags(same_flags));
+
+  PaintFlags other_flags = flags;
+  other_flags.setAntiAlias(!flags.isAntiAlias());
+  EXPECT_FALSE(*PaintFlagsCacheKey::FromFlags(flags) ==
+               *PaintFlagsCacheKey::FromFlags(other_flags));
+
+  // Flags with effects can't be cached.
+  flags.setShader(PaintShader::MakeColor(SkColors::kBlue));
+  EXPECT_FALSE(PaintFlagsCacheKey::FromFlags(flags));
+}
+
+TEST(PaintFlagsCacheTest, ClientBasic) {
+  ClientPaintCache client_cache(kDefaultBudget);
+  const PaintFlagsCacheKey key = CreateFlagsKey(1.f);
+  EXPECT_FALSE(client_cache.GetFlags(key));
+
+  std::optional<PaintCacheId> id = client_cache.PutFlags(key);
+  ASSERT_TRUE(id);
+  EXPECT_LT(*id, kMaxCachedPaintFlags);
+  client_cache.FinalizePendingEntries();
+  EXPECT_EQ(client_cache.GetFlags(key), id);
+
+  EXPECT_NE(client_cache.PutFlags(CreateFlagsKey(2.f)), id);
+  client_cache.FinalizePendingEntries();
+  EXPECT_EQ(client_cache.GetFlags(key), id);
+}
+
+TEST(PaintFlagsCacheTest, ClientNoCachingBudget) {
+  ClientPaintCache client_cache(ClientPaintCache::kNoCachingBudget);
+  EXPECT_FALSE(client_cache.PutFlags(CreateFlagsKey(1.f)));
+  EXPECT_FALSE(client_cache.GetFlags(CreateFlagsKey(1.f)));
+}
+
+TEST(PaintFlagsCacheTest, ClientReusesLeastRecentlyUsedSlot) {
+  ClientPaintCache client_cache(kDefaultBudget);
+  for (PaintCacheId i = 0u; i < kMaxCachedPaintFlags; ++i) {
+    EXPECT_EQ(client_cache.PutFlags(CreateFlagsKey(static_cast<float>(i))), i);
+  }
+  client_cache.FinalizePendingEntries();
+
+  // Touch the first flags so that the second ones are the least recently used.
+  EXPECT_EQ(client_cache.GetFlags(CreateFlagsKey(0.f)), 0u);
+  EXPECT_EQ(client_cache.PutFlags(
+                CreateFlagsKey(static_cast<float>(kMaxCachedPaintFlags))),
+            1u);
+  client_cache.FinalizePendingEntries();
+  EXPECT_FALSE(client_cache.GetFlags(CreateFlagsKey(1.f)));
+  EXPECT_EQ(client_cache.GetFlags(CreateFlagsKey(0.f)), 0u);
+}
+
+TEST(PaintFlagsCacheTest, ClientAbortPendingEntries) {
+  ClientPaintCache client_cache(kDefaultBudget);
+  std::optional<PaintCacheId> id = client_cache.PutFlags(CreateFlagsKey(1.f));
+  ASSERT_TRUE(id);
+  client_cache.AbortPendingEntries();
+  EXPECT_FALSE(client_cache.GetFlags(CreateFlagsKey(1.f)));
+
+  // The slot of the aborted entry is handed out again.
+  EXPECT_EQ(client_cache.PutFlags(CreateFlagsKey(2.f)), id);
+  client_cache.FinalizePendingEntries();
+  EXPECT_TRUE(client_cache.GetFlags(CreateFlagsKey(2.f)));
+
+  EXPECT_TRUE(client_cache.PurgeAll());
+  EXPECT_FALSE(client_cache.GetFlags(CreateFlagsKey(2.f)));
+  EXPECT_FALSE(client_cache.PurgeAll());
+}
+
+TEST(PaintFlagsCacheTest, ServiceBasic) {
+  ServicePaintCache service_cache;
+  PaintFlags flags;
+  flags.setColor(SK_ColorGREEN);
+
+  PaintFlags cached_flags;
+  EXPECT_FALSE(service_cache.GetFlags(0u, &cached_flags));
+  EXPECT_FALSE(service_cache.PutFlags(kMaxCachedPaintFlags, flags));
+  EXPECT_TRUE(service_cache.PutFlags(0u, flags));
+  EXPECT_TRUE(service_cache.GetFlags(0u, &cached_flags));
+  EXPECT_TRUE(cached_flags.EqualsForTesting(flags));
+
+  EXPECT_FALSE(service_cache.empty());
+  service_cache.PurgeAll();
+  EXPECT_TRUE(service_cache.empty());
+  EXPECT_FALSE(service_cache.GetFlags(0u, &cached_flags));
+}
+
 }  // namespace
 }  // namespace cc
@@ -234,6 +234,7 @@ class CC_PAINT_EXPORT PaintFlags {
   bool HasDiscardableImages() const;
 
  private:
+  friend class PaintFlagsCacheKey;
   friend class PaintOpReader;
   friend class PaintOpWriter;
 
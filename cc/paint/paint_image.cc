@@ -235,6 +235,24 @@ bool PaintImage::Decode(SkPixmap pixmap,
   }
 }
 
+bool PaintImage::DecodeSubset(SkPixmap pixmap,
+                              const SkIRect& subset,
+                              size_t frame_index,
+                              GeneratorClientId client_id) const {
+  DCHECK(pixmap.dimensions() == GetSupportedDecodeSize(pixmap.dimensions()));
+  DCHECK(SkIRect::MakeSize(pixmap.dimensions()).contains(subset));
+  if (!paint_image_generator_) {
+    return DecodeFromSkImage(pixmap, frame_index, client_id);
+  }
+  return paint_image_generator_->GetPixelsForSubset(
+      pixmap, subset, frame_index, client_id, stable_id());
+}
+
+bool PaintImage::SupportsSubsetDecode() const {
+  return paint_image_generator_ &&
+         paint_image_generator_->SupportsSubsetDecode();
+}
+
 bool PaintImage::DecodeYuv(const SkYUVAPixmaps& pixmaps,
                            size_t frame_index,
                            AuxImage aux_image,
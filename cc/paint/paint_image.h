@@ -243,6 +243,19 @@ class CC_PAINT_EXPORT PaintImage {
               AuxImage aux_image,
               GeneratorClientId client_id) const;
 
+  // Decodes the part of the image covered by |subset| into |pixmap|, which is
+  // sized for the whole image at a supported decode size. Only generators that
+  // SupportsSubsetDecode() decode less than the whole image, see
+  // PaintImageGenerator::GetPixelsForSubset(). Pixels outside of |subset| are
+  // unspecified until they are decoded by another call.
+  bool DecodeSubset(SkPixmap pixmap,
+                    const SkIRect& subset,
+                    size_t frame_index,
+                    GeneratorClientId client_id) const;
+
+  // Returns true if DecodeSubset() decodes less than the whole image.
+  bool SupportsSubsetDecode() const;
+
   // Decode the image into YUV into |pixmaps|.
   //  - SkPixmaps owned by |pixmaps| are preallocated to store the
   //    planar data. They must have have color types, row bytes,
@@ -377,6 +390,7 @@ class CC_PAINT_EXPORT PaintImage {
   friend class ScopedRasterFlags;
   friend class PaintOpReader;
 
+  friend class ImageContentDedupCache;
   friend class PlaybackImageProvider;
   friend class DrawImageRectOp;
   friend class DrawImageOp;
@@ -9,6 +9,7 @@
 
 #include "base/atomic_sequence_num.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkSize.h"
 
 namespace cc {
@@ -26,6 +27,20 @@ PaintImage::ContentId PaintImageGenerator::GetContentIdForFrame(
   return generator_content_id_;
 }
 
+bool PaintImageGenerator::SupportsSubsetDecode() const {
+  return false;
+}
+
+bool PaintImageGenerator::GetPixelsForSubset(
+    SkPixmap dst_pixmap,
+    const SkIRect& subset,
+    size_t frame_index,
+    PaintImage::GeneratorClientId client_id,
+    uint32_t lazy_pixel_ref) {
+  DCHECK(SkIRect::MakeSize(dst_pixmap.dimensions()).contains(subset));
+  return GetPixels(dst_pixmap, frame_index, client_id, lazy_pixel_ref);
+}
+
 SkISize PaintImageGenerator::GetSupportedDecodeSize(
     const SkISize& requested_size) const {
   // The base class just returns the original size as the only supported decode
@@ -12,6 +12,7 @@
 #include "cc/paint/paint_image.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkRect.h"
 #include "third_party/skia/include/core/SkSize.h"
 #include "third_party/skia/include/core/SkYUVAPixmaps.h"
 
@@ -42,6 +43,23 @@ class CC_PAINT_EXPORT PaintImageGenerator : public SkRefCnt {
                          PaintImage::GeneratorClientId client_id,
                          uint32_t lazy_pixel_ref) = 0;
 
+  // Returns true if GetPixelsForSubset() can decode part of the image for less
+  // than the cost of decoding all of it, e.g. for progressive or row-based
+  // formats.
+  virtual bool SupportsSubsetDecode() const;
+
+  // Like GetPixels(), but only the pixels in |subset| need to be decoded.
+  // |dst_pixmap| is still sized for the whole image at a supported decode size,
+  // and |subset| is in its coordinates, so that the caller can first decode the
+  // part of the image that visible tiles need and complete the same pixmap
+  // with other subsets later. Pixels outside of |subset| may be left untouched.
+  // The default implementation decodes the whole image.
+  virtual bool GetPixelsForSubset(SkPixmap dst_pixmap,
+                                  const SkIRect& subset,
+                                  size_t frame_index,
+                                  PaintImage::GeneratorClientId client_id,
+                                  uint32_t lazy_pixel_ref);
+
   // Returns true if the generator supports YUV decoding, providing the details
   // about planar configuration and conversion to RGB in |info|.
   // |supported_data_types| indicates the allowed bit depth and types allowed
@@ -52,6 +52,40 @@ TEST(PaintImageTest, DecodesCorrectFrames) {
   generator->reset_frames_decoded();
 }
 
+TEST(PaintImageTest, DecodeSubset) {
+  SkImageInfo info = SkImageInfo::MakeN32Premul(10, 10);
+  sk_sp<FakePaintImageGenerator> generator =
+      sk_make_sp<FakePaintImageGenerator>(info);
+  PaintImage image = PaintImageBuilder::WithDefault()
+                         .set_id(PaintImage::GetNextId())
+                         .set_paint_image_generator(generator)
+                         .TakePaintImage();
+  std::vector<size_t> memory(info.computeMinByteSize());
+  SkPixmap pixmap(info, memory.data(), info.minRowBytes());
+  const SkIRect subset = SkIRect::MakeXYWH(0, 0, 10, 4);
+
+  // Generators that don't support subset decodes decode the whole image.
+  EXPECT_FALSE(image.SupportsSubsetDecode());
+  EXPECT_TRUE(image.DecodeSubset(pixmap, subset, 0u,
+                                 PaintImage::GetNextGeneratorClientId()));
+  EXPECT_EQ(generator->frames_decoded().count(0u), 1u);
+  EXPECT_TRUE(generator->decode_subsets().empty());
+  generator->reset_frames_decoded();
+
+  generator->SetSupportsSubsetDecode();
+  EXPECT_TRUE(image.SupportsSubsetDecode());
+  EXPECT_TRUE(image.DecodeSubset(pixmap, subset, 0u,
+                                 PaintImage::GetNextGeneratorClientId()));
+  ASSERT_EQ(generator->decode_subsets().size(), 1u);
+  EXPECT_EQ(generator->decode_subsets()[0], subset);
+
+  // Images that aren't lazy generated have nothing to decode lazily.
+  PaintImage bitmap_image = CreateBitmapImage(gfx::Size(10, 10));
+  EXPECT_FALSE(bitmap_image.SupportsSubsetDecode());
+  EXPECT_TRUE(bitmap_image.DecodeSubset(
+      pixmap, subset, 0u, PaintImage::GetNextGeneratorClientId()));
+}
+
 TEST(PaintImageTest, SupportedDecodeSize) {
   SkISize full_size = SkISize::Make(10, 10);
   std::vector<SkISize> supported_sizes = {SkISize::Make(5, 5)};
@@ -586,10 +586,12 @@ void DrawSkottieOp::Serialize(PaintOpWriter& writer,
   writer.Write(skottie);
 
   SkottieFrameDataMap images_to_serialize = images;
+  SkottieColorMap color_map_to_serialize = color_map;
   SkottieTextPropertyValueMap text_map_to_serialize = text_map;
   if (writer.options().skottie_serialization_history) {
     writer.options().skottie_serialization_history->FilterNewSkottieFrameState(
-        *skottie, images_to_serialize, text_map_to_serialize);
+        *skottie, images_to_serialize, color_map_to_serialize,
+        text_map_to_serialize);
   }
 
   SerializeSkottieMap<SkottieFrameData>(
@@ -599,7 +601,7 @@ void DrawSkottieOp::Serialize(PaintOpWriter& writer,
         SerializeSkottieFrameData(current_ctm, frame_data, writer);
       });
   SerializeSkottieMap<SkColor>(
-      color_map, writer,
+      color_map_to_serialize, writer,
       [](const SkColor& color, PaintOpWriter& writer) { writer.Write(color); });
   SerializeSkottieMap<SkottieTextPropertyValue>(
       text_map_to_serialize, writer,
@@ -134,6 +134,12 @@ class CC_PAINT_EXPORT PaintOpBuffer : public SkRefCnt {
     bool context_supports_distance_field_text = true;
     int max_texture_size = 0;
 
+    // If true, PaintFlags without effects are sent through |paint_cache| and
+    // referenced by id once the service side has them. The client must call
+    // FinalizePendingEntries() or AbortPendingEntries() on |paint_cache| after
+    // each op, depending on whether it is sent.
+    bool use_paint_cache_for_flags = false;
+
     // TODO(crbug.com/1096123): Cleanup after study completion.
     //
     // If true, perform serializaion in a way that avoids serializing transient
@@ -4,12 +4,20 @@
 
 #include "cc/paint/paint_op_buffer_serializer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "base/bits.h"
 #include "base/functional/bind.h"
+#include "base/memory/aligned_memory.h"
+#include "base/memory/raw_ref.h"
+#include "base/task/post_job.h"
+#include "base/task/task_traits.h"
 #include "base/trace_event/trace_event.h"
 #include "cc/paint/clear_for_opaque_raster.h"
 #include "cc/paint/display_item_list.h"
@@ -48,8 +56,183 @@ std::unique_ptr<SkCanvas> MakeAnalysisCanvas(
              : std::make_unique<SkNoDrawCanvas>(kMaxExtent, kMaxExtent);
 }
 
+// Chunks with fewer ops than this are not worth handing to another thread.
+constexpr size_t kMinOpsPerParallelChunk = 64;
+// Aim for a few chunks per thread so that uneven chunks balance out.
+constexpr size_t kParallelChunksPerThread = 4;
+// Arenas are grown until a chunk fits or this size is exceeded, in which case
+// the chunk is serialized on the calling thread instead.
+constexpr size_t kMaxParallelArenaSize = 16 * 1024 * 1024;
+
+// Returns true if serializing `op` neither reads nor writes state shared
+// between ops (the paint cache, transfer cache, image provider and strike
+// server), so that it can happen on another thread without changing the
+// output. Ops with flags use the paint cache if |use_paint_cache_for_flags|.
+bool CanSerializeOpInParallel(const PaintOp& op,
+                              bool use_paint_cache_for_flags) {
+  switch (op.GetType()) {
+    case PaintOpType::kClipRect:
+    case PaintOpType::kClipRRect:
+    case PaintOpType::kConcat:
+    case PaintOpType::kDrawColor:
+    case PaintOpType::kNoop:
+    case PaintOpType::kRestore:
+    case PaintOpType::kRotate:
+    case PaintOpType::kSave:
+    case PaintOpType::kSaveLayerAlpha:
+    case PaintOpType::kScale:
+    case PaintOpType::kSetMatrix:
+    case PaintOpType::kSetNodeId:
+    case PaintOpType::kTranslate:
+      return true;
+    case PaintOpType::kDrawArc:
+    case PaintOpType::kDrawDRRect:
+    case PaintOpType::kDrawIRect:
+    case PaintOpType::kDrawLine:
+    case PaintOpType::kDrawOval:
+    case PaintOpType::kDrawRect:
+    case PaintOpType::kDrawRRect:
+    case PaintOpType::kSaveLayer: {
+      if (use_paint_cache_for_flags) {
+        return false;
+      }
+      // Shaders and filters can contain images and records.
+      const PaintFlags& flags = static_cast<const PaintOpWithFlags&>(op).flags;
+      return !flags.HasShader() && !flags.getImageFilter();
+    }
+    default:
+      return false;
+  }
+}
+
+// Returns true for ops that change the transform or clip of the canvas
+// without a corresponding save.
+bool IsStateOp(PaintOpType type) {
+  switch (type) {
+    case PaintOpType::kClipPath:
+    case PaintOpType::kClipRect:
+    case PaintOpType::kClipRRect:
+    case PaintOpType::kConcat:
+    case PaintOpType::kRotate:
+    case PaintOpType::kScale:
+    case PaintOpType::kSetMatrix:
+    case PaintOpType::kTranslate:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsSaveOp(PaintOpType type) {
+  return type == PaintOpType::kSave || type == PaintOpType::kSaveLayer ||
+         type == PaintOpType::kSaveLayerAlpha;
+}
+
+// Returns true for ops after which the canvas state can't be reproduced by
+// replaying the top level state ops, e.g. nested records whose transforms
+// apply to the parent record.
+bool IsSplitBarrier(const PaintOp& op) {
+  return op.GetType() == PaintOpType::kDrawRecord ||
+         op.GetType() == PaintOpType::kDrawScrollingContents;
+}
+
 }  // namespace
 
+// A range of top level ops of the buffer, starting and ending with a balanced
+// save/restore stack.
+struct PaintOpBufferSerializer::ParallelChunk {
+  std::vector<size_t> offsets;
+  // The range of the top level state ops (see IsStateOp()) that precede this
+  // chunk, [0, state_ops_begin), and that are part of it,
+  // [state_ops_begin, state_ops_end).
+  size_t state_ops_begin = 0;
+  size_t state_ops_end = 0;
+  bool can_serialize_in_parallel = true;
+
+  // Set once the chunk was serialized into `memory` on a worker.
+  bool serialized = false;
+  std::unique_ptr<char, base::AlignedFreeDeleter> memory;
+  size_t size = 0;
+};
+
+class PaintOpBufferSerializer::ParallelSerializeState {
+  STACK_ALLOCATED();
+
+ public:
+  ParallelSerializeState(const PaintOpBuffer& buffer,
+                         std::vector<ParallelChunk*> pending_chunks,
+                         const std::vector<size_t>& state_op_offsets,
+                         const Preamble& preamble,
+                         const PaintOp::SerializeOptions& options,
+                         size_t max_concurrency)
+      : buffer_(buffer),
+        pending_chunks_(std::move(pending_chunks)),
+        state_op_offsets_(state_op_offsets),
+        preamble_(preamble),
+        options_(options),
+        max_concurrency_(max_concurrency),
+        num_incomplete_chunks_(pending_chunks_.size()) {
+    // Workers may not use any of the state shared between ops. The chunks
+    // they get don't need it, so this is only a safety net.
+    options_.image_provider = nullptr;
+    options_.transfer_cache = nullptr;
+    options_.paint_cache = nullptr;
+    options_.strike_server = nullptr;
+    options_.skottie_serialization_history = nullptr;
+  }
+
+  void Run(base::JobDelegate* delegate) {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= pending_chunks_.size()) {
+        return;
+      }
+      SerializeChunkInArena(*pending_chunks_[index]);
+      num_incomplete_chunks_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const {
+    return std::min(max_concurrency_,
+                    num_incomplete_chunks_.load(std::memory_order_relaxed));
+  }
+
+ private:
+  void SerializeChunkInArena(ParallelChunk& chunk) {
+    size_t size = 0;
+    for (PaintOpBuffer::OffsetIterator iter(*buffer_, chunk.offsets); iter;
+         ++iter) {
+      size += iter->aligned_size;
+    }
+    // Serialized ops are usually smaller than the recorded ones, but leave
+    // room for ops with larger serialized forms (e.g. matrices).
+    size = base::bits::AlignUp(2 * size + PaintOpWriter::kHeaderBytes,
+                               PaintOpWriter::kMaxAlignment);
+    for (; size <= kMaxParallelArenaSize; size *= 2) {
+      auto memory = PaintOpWriter::AllocateAlignedBuffer<char>(size);
+      SimpleBufferSerializer serializer(memory.get(), size, options_);
+      static_cast<PaintOpBufferSerializer&>(serializer).SerializeChunk(
+          *buffer_, chunk, *state_op_offsets_, *preamble_);
+      if (serializer.valid()) {
+        chunk.memory = std::move(memory);
+        chunk.size = serializer.written();
+        chunk.serialized = true;
+        return;
+      }
+    }
+  }
+
+  const raw_ref<const PaintOpBuffer> buffer_;
+  const std::vector<ParallelChunk*> pending_chunks_;
+  const raw_ref<const std::vector<size_t>> state_op_offsets_;
+  const raw_ref<const Preamble> preamble_;
+  PaintOp::SerializeOptions options_;
+  const size_t max_concurrency_;
+
+  std::atomic<size_t> next_chunk_{0};
+  std::atomic<size_t> num_incomplete_chunks_;
+};
+
 PaintOpBufferSerializer::PaintOpBufferSerializer(
     SerializeCallback serialize_cb,
     void* callback_data,
@@ -82,6 +265,166 @@ void PaintOpBufferSerializer::Serialize(const PaintOpBuffer& buffer,
   RestoreToCount(canvas.get(), save_count, params);
 }
 
+void PaintOpBufferSerializer::SerializeInParallel(
+    const PaintOpBuffer& buffer,
+    const std::vector<size_t>* offsets,
+    const Preamble& preamble,
+    size_t max_concurrency) {
+  DCHECK_EQ(serialized_op_count_, 0u);
+  if (!append_serialized_cb_ || max_concurrency < 2 ||
+      buffer.size() < 2 * kMinOpsPerParallelChunk) {
+    Serialize(buffer, offsets, preamble);
+    return;
+  }
+
+  std::vector<size_t> all_offsets;
+  if (!offsets) {
+    all_offsets.reserve(buffer.size());
+    size_t offset = 0;
+    for (PaintOpBuffer::Iterator iter(buffer); iter; ++iter) {
+      all_offsets.push_back(offset);
+      offset += iter->aligned_size;
+    }
+    offsets = &all_offsets;
+  }
+
+  // Split the top level ops into chunks wherever the save/restore stack is
+  // balanced. Past a barrier, everything stays in a single chunk.
+  const size_t target_chunk_size =
+      std::max(kMinOpsPerParallelChunk,
+               offsets->size() / (max_concurrency * kParallelChunksPerThread));
+  std::vector<ParallelChunk> chunks(1);
+  std::vector<size_t> state_op_offsets;
+  int depth = 0;
+  bool can_split = true;
+  size_t index = 0;
+  for (PaintOpBuffer::OffsetIterator iter(buffer, *offsets); iter;
+       ++iter, ++index) {
+    const PaintOp& op = *iter;
+    const PaintOpType type = op.GetType();
+    ParallelChunk& chunk = chunks.back();
+    chunk.offsets.push_back((*offsets)[index]);
+    chunk.can_serialize_in_parallel &= CanSerializeOpInParallel(
+        op, options_.use_paint_cache_for_flags);
+
+    if (IsSaveOp(type)) {
+      ++depth;
+    } else if (type == PaintOpType::kRestore) {
+      if (depth == 0) {
+        // An unmatched restore pops the preamble's save, which the calling
+        // thread's canvas needs to see.
+        can_split = false;
+        chunk.can_serialize_in_parallel = false;
+      }
+      depth = std::max(depth - 1, 0);
+    } else if (depth == 0) {
+      if (IsStateOp(type)) {
+        state_op_offsets.push_back((*offsets)[index]);
+      }
+      can_split &= !IsSplitBarrier(op);
+    }
+
+    if (can_split && depth == 0 && chunk.offsets.size() >= target_chunk_size) {
+      chunk.state_ops_end = state_op_offsets.size();
+      chunks.emplace_back();
+      chunks.back().state_ops_begin = state_op_offsets.size();
+    }
+  }
+  if (chunks.back().offsets.empty()) {
+    chunks.pop_back();
+  }
+  chunks.back().state_ops_end = state_op_offsets.size();
+  // The last chunk may leave saves behind, which RestoreToCount() below
+  // relies on the calling thread's canvas to know about.
+  chunks.back().can_serialize_in_parallel &= depth == 0;
+
+  std::vector<ParallelChunk*> pending_chunks;
+  for (ParallelChunk& chunk : chunks) {
+    if (chunk.can_serialize_in_parallel) {
+      pending_chunks.push_back(&chunk);
+    }
+  }
+  if (pending_chunks.size() < 2) {
+    Serialize(buffer, offsets, preamble);
+    return;
+  }
+
+  ParallelSerializeState state(buffer, std::move(pending_chunks),
+                               state_op_offsets, preamble, options_,
+                               max_concurrency);
+  // The calling thread participates in Join(), so this makes progress even if
+  // the thread pool is busy.
+  base::CreateJob(
+      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+      base::BindRepeating(&ParallelSerializeState::Run,
+                          base::Unretained(&state)),
+      base::BindRepeating(&ParallelSerializeState::GetMaxConcurrency,
+                          base::Unretained(&state)))
+      .Join();
+
+  // Stitch the chunks together on the calling thread, in order, keeping the
+  // analysis canvas in the same state it would have had in Serialize().
+  std::unique_ptr<SkCanvas> canvas = MakeAnalysisCanvas(options_);
+  PlaybackParams params = MakeParams(canvas.get());
+  int save_count = canvas->getSaveCount();
+  Save(canvas.get(), params);
+  SerializePreamble(canvas.get(), preamble, params);
+  PlaybackParams buffer_params = MakeParams(canvas.get());
+  for (const ParallelChunk& chunk : chunks) {
+    if (!valid_) {
+      break;
+    }
+    if (!chunk.serialized) {
+      SerializeBufferWithParams(canvas.get(), buffer_params, buffer,
+                                &chunk.offsets);
+      continue;
+    }
+
+    std::vector<size_t> chunk_state_op_offsets(
+        state_op_offsets.begin() + chunk.state_ops_begin,
+        state_op_offsets.begin() + chunk.state_ops_end);
+    analysis_only_ = true;
+    for (PaintOpBuffer::OffsetIterator iter(buffer, chunk_state_op_offsets);
+         iter; ++iter) {
+      SerializeOp(canvas.get(), *iter, nullptr, buffer_params);
+    }
+    analysis_only_ = false;
+
+    if (!append_serialized_cb_(callback_data_, chunk.memory.get(),
+                               chunk.size)) {
+      valid_ = false;
+    }
+  }
+  RestoreToCount(canvas.get(), save_count, params);
+}
+
+void PaintOpBufferSerializer::SerializeChunk(
+    const PaintOpBuffer& buffer,
+    const ParallelChunk& chunk,
+    const std::vector<size_t>& state_op_offsets,
+    const Preamble& preamble) {
+  std::unique_ptr<SkCanvas> canvas = MakeAnalysisCanvas(options_);
+  PlaybackParams params = MakeParams(canvas.get());
+
+  // Reproduce the canvas state at the start of the chunk without emitting
+  // anything, then serialize the chunk's ops as SerializeBuffer() would.
+  analysis_only_ = true;
+  Save(canvas.get(), params);
+  SerializePreamble(canvas.get(), preamble, params);
+  PlaybackParams buffer_params = MakeParams(canvas.get());
+  std::vector<size_t> preceding_state_op_offsets(
+      state_op_offsets.begin(),
+      state_op_offsets.begin() + chunk.state_ops_begin);
+  for (PaintOpBuffer::OffsetIterator iter(buffer, preceding_state_op_offsets);
+       iter; ++iter) {
+    SerializeOp(canvas.get(), *iter, nullptr, buffer_params);
+  }
+  analysis_only_ = false;
+
+  SerializeBufferWithParams(canvas.get(), buffer_params, buffer,
+                            &chunk.offsets);
+}
+
 void PaintOpBufferSerializer::Serialize(const PaintOpBuffer& buffer) {
   std::unique_ptr<SkCanvas> canvas = MakeAnalysisCanvas(options_);
   SerializeBuffer(canvas.get(), buffer, nullptr);
@@ -359,6 +702,9 @@ bool PaintOpBufferSerializer::SerializeOp(SkCanvas* canvas,
   // Playback on analysis canvas first to make sure the canvas transform is set
   // correctly for analysis of records in filters.
   PlaybackOnAnalysisCanvas(canvas, op, flags_to_serialize, params);
+  if (analysis_only_) {
+    return true;
+  }
 
   size_t bytes = serialize_cb_(callback_data_, op, options_, flags_to_serialize,
                                canvas->getLocalToDevice(), params.original_ctm);
@@ -421,7 +767,9 @@ SimpleBufferSerializer::SimpleBufferSerializer(
                               this,
                               options),
       memory_(memory),
-      total_(size) {}
+      total_(size) {
+  set_append_serialized_cb(&SimpleBufferSerializer::AppendToMemory);
+}
 
 SimpleBufferSerializer::~SimpleBufferSerializer() = default;
 
@@ -445,4 +793,14 @@ size_t SimpleBufferSerializer::SerializeToMemoryImpl(
   return bytes;
 }
 
+bool SimpleBufferSerializer::AppendToMemoryImpl(const char* data,
+                                                size_t size) {
+  if (size > total_ - written_) {
+    return false;
+  }
+  memcpy(static_cast<char*>(memory_) + written_, data, size);
+  written_ += size;
+  return true;
+}
+
 }  // namespace cc
@@ -29,6 +29,11 @@ class CC_PAINT_EXPORT PaintOpBufferSerializer {
                                        const PaintFlags*,
                                        const SkM44&,
                                        const SkM44&);
+  // Appends `size` bytes that were already produced by PaintOp::Serialize()
+  // for one or more ops. Returns false if the bytes don't fit.
+  using AppendSerializedCallback = bool (*)(void*,
+                                            const char* data,
+                                            size_t size);
 
   PaintOpBufferSerializer(SerializeCallback serialize_cb,
                           void* callback_data,
@@ -77,9 +82,38 @@ class CC_PAINT_EXPORT PaintOpBufferSerializer {
                  const gfx::Rect& playback_rect,
                  const gfx::SizeF& post_scale);
 
+  // Same as the preamble version of Serialize(), but the top level ops of
+  // `buffer` are split into chunks at points where the save/restore stack is
+  // balanced. Chunks that only contain ops which don't touch shared
+  // serialization state (images, text, cached paths, nested records) are
+  // serialized concurrently on base::ThreadPool into separate arenas and then
+  // appended in order; all other chunks are serialized on the calling thread.
+  // The output is byte-identical to Serialize(). `max_concurrency` bounds the
+  // number of threads, including the calling one. Falls back to Serialize()
+  // if the subclass doesn't support appending serialized bytes.
+  void SerializeInParallel(const PaintOpBuffer& buffer,
+                           const std::vector<size_t>* offsets,
+                           const Preamble& preamble,
+                           size_t max_concurrency);
+
   bool valid() const { return valid_; }
 
+ protected:
+  void set_append_serialized_cb(AppendSerializedCallback append_serialized_cb) {
+    append_serialized_cb_ = append_serialized_cb;
+  }
+
  private:
+  struct ParallelChunk;
+  class ParallelSerializeState;
+
+  // Serializes the ops at `chunk.offsets` as if the preamble and the top level
+  // state ops of `chunk` preceding it had been serialized on the same canvas,
+  // but only emits the chunk's own ops.
+  void SerializeChunk(const PaintOpBuffer& buffer,
+                      const ParallelChunk& chunk,
+                      const std::vector<size_t>& state_op_offsets,
+                      const Preamble& preamble);
   void SerializePreamble(SkCanvas* canvas,
                          const Preamble& preamble,
                          const PlaybackParams& params);
@@ -125,10 +159,14 @@ class CC_PAINT_EXPORT PaintOpBufferSerializer {
 
   SerializeCallback serialize_cb_;
   void* callback_data_;
+  AppendSerializedCallback append_serialized_cb_ = nullptr;
   PaintOp::SerializeOptions options_;
 
   size_t serialized_op_count_ = 0;
   bool valid_ = true;
+  // If true, ops are only played back on the analysis canvas to reproduce its
+  // state, without being serialized.
+  bool analysis_only_ = false;
 };
 
 // Serializes the ops in the memory available, fails on overflow.
@@ -159,6 +197,13 @@ class CC_PAINT_EXPORT SimpleBufferSerializer : public PaintOpBufferSerializer {
                                 original_ctm);
   }
 
+  bool AppendToMemoryImpl(const char* data, size_t size);
+
+  static bool AppendToMemory(void* instance, const char* data, size_t size) {
+    return reinterpret_cast<SimpleBufferSerializer*>(instance)
+        ->AppendToMemoryImpl(data, size);
+  }
+
   void* memory_;
   const size_t total_;
   size_t written_ = 0u;
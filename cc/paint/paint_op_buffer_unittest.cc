@@ -5,6 +5,7 @@
 #include "cc/paint/paint_op_buffer.h"
 
 #include <algorithm>
+#include <optional>
 #include <string>
 
 #include "base/functional/bind.h"
@@ -12,11 +13,13 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
+#include "base/test/task_environment.h"
 #include "cc/paint/decoded_draw_image.h"
 #include "cc/paint/display_item_list.h"
 #include "cc/paint/draw_looper.h"
 #include "cc/paint/image_provider.h"
 #include "cc/paint/image_transfer_cache_entry.h"
+#include "cc/paint/paint_cache.h"
 #include "cc/paint/paint_flags.h"
 #include "cc/paint/paint_image_builder.h"
 #include "cc/paint/paint_op_buffer_iterator.h"
@@ -2276,6 +2279,100 @@ TEST(PaintOpSerializationTest, CompleteBufferSerialization) {
                   PaintOpEq<RestoreOp>())));
 }
 
+// Serializes `buffer` with a fresh set of serialization state, either serially
+// or in parallel, and returns the serialized bytes.
+std::vector<char> SerializeWithPreamble(
+    const PaintOpBuffer& buffer,
+    const PaintOpBufferSerializer::Preamble& preamble,
+    size_t max_concurrency) {
+  constexpr size_t kSize = 1024 * 1024;
+  auto memory = AllocateSerializedBuffer(kSize);
+  TestOptionsProvider options_provider;
+  SimpleBufferSerializer serializer(memory.get(), kSize,
+                                    options_provider.serialize_options());
+  if (max_concurrency) {
+    serializer.SerializeInParallel(buffer, nullptr, preamble, max_concurrency);
+  } else {
+    serializer.Serialize(buffer, nullptr, preamble);
+  }
+  EXPECT_TRUE(serializer.valid());
+  return std::vector<char>(memory.get(), memory.get() + serializer.written());
+}
+
+TEST(PaintOpSerializationTest, SerializeInParallelMatchesSerialize) {
+  base::test::TaskEnvironment task_environment;
+
+  PaintOpBuffer buffer;
+  PaintFlags flags;
+  flags.setColor(SK_ColorRED);
+  SkPath path;
+  path.addCircle(5, 5, 4);
+  // A top level transform that chunks after the first one need to replay.
+  buffer.push<TranslateOp>(3.f, 4.f);
+  for (int i = 0; i < 200; ++i) {
+    buffer.push<SaveOp>();
+    buffer.push<TranslateOp>(10.f * i, 0.f);
+    buffer.push<ClipRectOp>(SkRect::MakeWH(20, 20), SkClipOp::kIntersect,
+                            false);
+    buffer.push<DrawRectOp>(SkRect::MakeWH(i % 30, 10), flags);
+    if (i % 7 == 0) {
+      // Chunks with paths use the paint cache and stay on the calling thread.
+      buffer.push<DrawPathOp>(path, flags);
+    }
+    if (i % 5 == 0) {
+      // A foldable sequence.
+      buffer.push<SaveLayerAlphaOp>(0.5f);
+      buffer.push<DrawOvalOp>(SkRect::MakeWH(5, 5), flags);
+      buffer.push<RestoreOp>();
+    }
+    buffer.push<RestoreOp>();
+    if (i % 50 == 0) {
+      buffer.push<ScaleOp>(1.1f, 0.9f);
+    }
+  }
+  // Unbalanced saves at the end are restored by the serializer.
+  buffer.push<SaveOp>();
+  buffer.push<DrawColorOp>(SkColors::kBlue, SkBlendMode::kSrcOver);
+
+  PaintOpBufferSerializer::Preamble preamble;
+  preamble.content_size = gfx::Size(3000, 100);
+  preamble.full_raster_rect = gfx::Rect(10, 0, 1000, 50);
+  preamble.playback_rect = gfx::Rect(20, 0, 500, 40);
+  preamble.post_scale = gfx::Vector2dF(2.f, 2.f);
+  preamble.requires_clear = false;
+
+  std::vector<char> expected =
+      SerializeWithPreamble(buffer, preamble, /*max_concurrency=*/0);
+  EXPECT_FALSE(expected.empty());
+  for (size_t max_concurrency : {1u, 2u, 4u, 8u}) {
+    EXPECT_EQ(expected, SerializeWithPreamble(buffer, preamble,
+                                              max_concurrency))
+        << "max_concurrency " << max_concurrency;
+  }
+}
+
+TEST(PaintOpSerializationTest, SerializeInParallelWithUnmatchedRestore) {
+  base::test::TaskEnvironment task_environment;
+
+  PaintOpBuffer buffer;
+  PaintFlags flags;
+  for (int i = 0; i < 300; ++i) {
+    buffer.push<DrawRectOp>(SkRect::MakeXYWH(i, 0, 1, 1), flags);
+    if (i == 150) {
+      // Pops the preamble's save, which prevents any further splitting.
+      buffer.push<RestoreOp>();
+    }
+  }
+
+  PaintOpBufferSerializer::Preamble preamble;
+  preamble.content_size = gfx::Size(300, 10);
+  preamble.full_raster_rect = gfx::Rect(preamble.content_size);
+  preamble.playback_rect = preamble.full_raster_rect;
+
+  EXPECT_EQ(SerializeWithPreamble(buffer, preamble, /*max_concurrency=*/0),
+            SerializeWithPreamble(buffer, preamble, /*max_concurrency=*/4));
+}
+
 TEST(PaintOpSerializationTest, Preamble) {
   PaintOpBufferSerializer::Preamble preamble;
   preamble.content_size = gfx::Size(30, 40);
@@ -4277,6 +4374,56 @@ TEST(PaintOpBufferTest, PathCaching) {
       path.getGenerationID(), &cached_path));
 }
 
+TEST(PaintOpBufferTest, FlagsCaching) {
+  PaintFlags flags;
+  flags.setColor(SK_ColorRED);
+  flags.setAntiAlias(true);
+
+  PaintOpBuffer buffer;
+  buffer.push<DrawRectOp>(SkRect::MakeWH(10, 10), flags);
+  buffer.push<DrawRectOp>(SkRect::MakeWH(20, 20), flags);
+
+  TestOptionsProvider options_provider;
+  auto uncached_memory = AllocateSerializedBuffer();
+  SimpleBufferSerializer uncached_serializer(
+      uncached_memory.get(), kDefaultSerializedBufferSize,
+      options_provider.serialize_options());
+  uncached_serializer.Serialize(buffer);
+  EXPECT_FALSE(options_provider.client_paint_cache()->GetFlags(
+      *PaintFlagsCacheKey::FromFlags(flags)));
+
+  PaintOp::SerializeOptions serialize_options =
+      options_provider.serialize_options();
+  serialize_options.use_paint_cache_for_flags = true;
+  auto memory = AllocateSerializedBuffer();
+  SimpleBufferSerializer serializer(memory.get(), kDefaultSerializedBufferSize,
+                                    serialize_options);
+  serializer.Serialize(buffer);
+  // The second op only refers to the flags sent with the first one.
+  EXPECT_LT(serializer.written(), uncached_serializer.written());
+
+  std::optional<PaintCacheId> id =
+      options_provider.client_paint_cache()->GetFlags(
+          *PaintFlagsCacheKey::FromFlags(flags));
+  ASSERT_TRUE(id);
+
+  sk_sp<PaintOpBuffer> deserialized_buffer =
+      PaintOpBuffer::MakeFromMemory(memory.get(), serializer.written(),
+                                    options_provider.deserialize_options());
+  ASSERT_TRUE(deserialized_buffer);
+  EXPECT_THAT(*deserialized_buffer,
+              ElementsAre(PaintOpIs<DrawRectOp>(), PaintOpIs<DrawRectOp>()));
+  for (const PaintOp& op : *deserialized_buffer) {
+    EXPECT_TRUE(
+        static_cast<const DrawRectOp&>(op).flags.EqualsForTesting(flags));
+  }
+
+  PaintFlags cached_flags;
+  EXPECT_TRUE(
+      options_provider.service_paint_cache()->GetFlags(*id, &cached_flags));
+  EXPECT_TRUE(cached_flags.EqualsForTesting(flags));
+}
+
 TEST(PaintOpBufferTest, ShrinkToFit) {
   PaintOpBuffer buffer;
   EXPECT_EQ(sizeof(PaintOpBuffer), buffer.bytes_used());
@@ -281,6 +281,48 @@ void PaintOpReader::Read(SkPath* path) {
 }
 
 void PaintOpReader::Read(PaintFlags* flags) {
+  uint32_t entry_state_int = 0u;
+  ReadSimple(&entry_state_int);
+  if (entry_state_int > static_cast<uint32_t>(PaintCacheEntryState::kLast)) {
+    SetInvalid(DeserializationError::kInvalidPaintCacheFlagsEntry);
+  }
+  if (!valid_)
+    return;
+
+  auto entry_state = static_cast<PaintCacheEntryState>(entry_state_int);
+  PaintCacheId id = 0u;
+  switch (entry_state) {
+    case PaintCacheEntryState::kEmpty:
+      SetInvalid(DeserializationError::kInvalidPaintCacheFlagsEntry);
+      return;
+    case PaintCacheEntryState::kCached:
+      ReadSimple(&id);
+      if (!valid_)
+        return;
+      if (!options_.paint_cache ||
+          !options_.paint_cache->GetFlags(id, flags)) {
+        SetInvalid(DeserializationError::kMissingPaintCacheFlagsEntry);
+      }
+      return;
+    case PaintCacheEntryState::kInlined:
+      ReadSimple(&id);
+      break;
+    case PaintCacheEntryState::kInlinedDoNotCache:
+      break;
+  }
+
+  ReadFlagsInline(flags);
+  if (!valid_ || entry_state != PaintCacheEntryState::kInlined)
+    return;
+
+  // Only flags without effects are cached.
+  if (!PaintFlagsCacheKey::FromFlags(*flags) || !options_.paint_cache ||
+      !options_.paint_cache->PutFlags(id, *flags)) {
+    SetInvalid(DeserializationError::kInvalidPaintCacheFlagsEntry);
+  }
+}
+
+void PaintOpReader::ReadFlagsInline(PaintFlags* flags) {
   Read(&flags->color_);
   Read(&flags->width_);
   Read(&flags->miter_limit_);
@@ -228,8 +228,10 @@ class CC_PAINT_EXPORT PaintOpReader {
     kSkGainmapInfoDeserializationFailure = 54,
     kHdrMetadataDeserializeFailure = 55,
     kNonFiniteSkColor4f = 56,
+    kInvalidPaintCacheFlagsEntry = 57,
+    kMissingPaintCacheFlagsEntry = 58,
 
-    kMaxValue = kNonFiniteSkColor4f
+    kMaxValue = kMissingPaintCacheFlagsEntry
   };
 
   template <typename T>
@@ -258,6 +260,10 @@ class CC_PAINT_EXPORT PaintOpReader {
   void Read(sk_sp<ColorFilter>* filter);
   void Read(sk_sp<PathEffect>* effect);
 
+  // Reads the fields of |flags| following the paint cache entry state written
+  // ahead of them, see Read(PaintFlags*).
+  void ReadFlagsInline(PaintFlags* flags);
+
   // The main entry point is Read(sk_sp<PaintFilter>* filter) which calls one of
   // the following functions depending on read type.
   void ReadColorFilterPaintFilter(
@@ -267,6 +267,31 @@ void PaintOpWriter::Write(const PaintFlags& flags, const SkM44& current_ctm) {
   if (flags.path_effect_ == nullptr && flags.color_filter_ == nullptr &&
       flags.draw_looper_ == nullptr && flags.image_filter_ == nullptr &&
       flags.shader_ == nullptr) {
+    // Flags without effects are typically shared by many ops, so they are
+    // sent to the service side paint cache once and referenced by slot after
+    // that.
+    std::optional<PaintCacheId> id;
+    if (options_.paint_cache && options_.use_paint_cache_for_flags &&
+        !options_.for_identifiability_study) {
+      const std::optional<PaintFlagsCacheKey> key =
+          PaintFlagsCacheKey::FromFlags(flags);
+      DCHECK(key);
+      id = options_.paint_cache->GetFlags(*key);
+      if (id) {
+        WriteSimpleMultiple(
+            static_cast<uint32_t>(PaintCacheEntryState::kCached), *id);
+        return;
+      }
+      id = options_.paint_cache->PutFlags(*key);
+    }
+    if (id) {
+      WriteSimpleMultiple(static_cast<uint32_t>(PaintCacheEntryState::kInlined),
+                          *id);
+    } else {
+      WriteSimple(
+          static_cast<uint32_t>(PaintCacheEntryState::kInlinedDoNotCache));
+    }
+
     // Fast path for when there is nothing complicated to write.
     // NOTE: size_t is written as two 32-bit zeros (see WriteSize()).
     WriteSimpleMultiple(
@@ -284,6 +309,7 @@ void PaintOpWriter::Write(const PaintFlags& flags, const SkM44& current_ctm) {
     return;
   }
 
+  WriteSimple(static_cast<uint32_t>(PaintCacheEntryState::kInlinedDoNotCache));
   WriteSimple(flags.color_);
   Write(flags.width_);
   Write(flags.miter_limit_);
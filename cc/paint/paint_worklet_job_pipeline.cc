@@ -0,0 +1,72 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/paint/paint_worklet_job_pipeline.h"
+
+#include <bit>
+#include <utility>
+
+#include "base/metrics/histogram_macros.h"
+
+namespace cc {
+
+PaintWorkletJobPipeline::Entry::Entry(PaintWorkletId worklet_id,
+                                      PaintWorkletJob job,
+                                      base::TimeTicks dispatch_time)
+    : worklet_id(worklet_id),
+      job(std::move(job)),
+      dispatch_time(dispatch_time) {}
+
+PaintWorkletJobPipeline::Entry::Entry(Entry&& other) = default;
+
+PaintWorkletJobPipeline::Entry::~Entry() = default;
+
+PaintWorkletJobPipeline::Ring::Ring(size_t capacity)
+    : slots_(capacity), mask_(capacity - 1) {
+  CHECK(std::has_single_bit(capacity));
+}
+
+PaintWorkletJobPipeline::Ring::~Ring() = default;
+
+PaintWorkletJobPipeline::PaintWorkletJobPipeline(size_t capacity)
+    : capacity_(capacity), jobs_(capacity), results_(capacity) {}
+
+PaintWorkletJobPipeline::~PaintWorkletJobPipeline() = default;
+
+void PaintWorkletJobPipeline::PushJob(PaintWorkletId worklet_id,
+                                      PaintWorkletJob job) {
+  DCHECK(CanPushJob());
+  ++in_flight_jobs_;
+  jobs_.Push(Entry(worklet_id, std::move(job), base::TimeTicks::Now()));
+  // The depth includes jobs being painted and painted jobs the compositor
+  // hasn't picked up yet, since both delay the job that was just pushed.
+  UMA_HISTOGRAM_COUNTS_100("PaintWorklet.JobPipeline.QueueDepth",
+                           in_flight_jobs_);
+}
+
+std::optional<PaintWorkletJobPipeline::Entry>
+PaintWorkletJobPipeline::PopResult() {
+  std::optional<Entry> entry = results_.Pop();
+  if (!entry) {
+    return std::nullopt;
+  }
+  DCHECK_GT(in_flight_jobs_, 0u);
+  --in_flight_jobs_;
+  UMA_HISTOGRAM_CUSTOM_MICROSECONDS_TIMES(
+      "PaintWorklet.JobPipeline.RoundTripLatency",
+      base::TimeTicks::Now() - entry->dispatch_time, base::Microseconds(10),
+      base::Milliseconds(500), 50);
+  return entry;
+}
+
+std::optional<PaintWorkletJobPipeline::Entry>
+PaintWorkletJobPipeline::PopJob() {
+  return jobs_.Pop();
+}
+
+void PaintWorkletJobPipeline::PushResult(Entry entry) {
+  results_.Push(std::move(entry));
+}
+
+}  // namespace cc
@@ -0,0 +1,132 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CC_PAINT_PAINT_WORKLET_JOB_PIPELINE_H_
+#define CC_PAINT_PAINT_WORKLET_JOB_PIPELINE_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "base/time/time.h"
+#include "cc/paint/paint_export.h"
+#include "cc/paint/paint_worklet_job.h"
+
+namespace cc {
+
+// PaintWorkletJobPipeline carries PaintWorkletJobs from the compositor thread
+// to the worklet thread, and the painted jobs back, through two persistent
+// fixed size single-producer/single-consumer rings. Unlike dispatching a
+// PaintWorkletJobMap per frame, handing jobs over allocates nothing and takes
+// no lock: the rings' slots are allocated once, jobs are moved in and out of
+// them, and each side only ever advances its own index.
+//
+// The compositor thread is the only caller of PushJob() and PopResult(), and
+// the worklet thread the only caller of PopJob() and PushResult(). Waking up
+// the other thread is up to the caller, the pipeline only moves the data.
+class CC_PAINT_EXPORT PaintWorkletJobPipeline {
+ public:
+  struct CC_PAINT_EXPORT Entry {
+    Entry(PaintWorkletId worklet_id,
+          PaintWorkletJob job,
+          base::TimeTicks dispatch_time);
+    Entry(Entry&& other);
+    ~Entry();
+
+    PaintWorkletId worklet_id;
+    PaintWorkletJob job;
+    // When the compositor pushed the job, used for the round trip latency.
+    base::TimeTicks dispatch_time;
+  };
+
+  static constexpr size_t kDefaultCapacity = 64;
+
+  // |capacity| is the number of jobs each ring can hold, and must be a power of
+  // two.
+  explicit PaintWorkletJobPipeline(size_t capacity = kDefaultCapacity);
+  PaintWorkletJobPipeline(const PaintWorkletJobPipeline&) = delete;
+  ~PaintWorkletJobPipeline();
+
+  PaintWorkletJobPipeline& operator=(const PaintWorkletJobPipeline&) = delete;
+
+  // Compositor thread. Returns whether there is room for another job, i.e.
+  // whether fewer than |capacity| jobs are in flight. PushJob() must only be
+  // called when it does.
+  bool CanPushJob() const { return in_flight_jobs_ < capacity_; }
+  void PushJob(PaintWorkletId worklet_id, PaintWorkletJob job);
+  // Compositor thread. Returns the next painted job, if any.
+  std::optional<Entry> PopResult();
+
+  // Worklet thread. Returns the next job to paint, if any.
+  std::optional<Entry> PopJob();
+  // Worklet thread. Hands back a job popped with PopJob() once its output is
+  // set.
+  void PushResult(Entry entry);
+
+  // The number of jobs pushed whose results haven't been popped yet.
+  // Compositor thread.
+  size_t InFlightJobCount() const { return in_flight_jobs_; }
+
+ private:
+  // A ring of |capacity| slots, that one thread pushes to and another pops
+  // from. The producer owns |tail_| and the consumer |head_|; a slot is
+  // published by the release store of the index that covers it.
+  class Ring {
+   public:
+    explicit Ring(size_t capacity);
+    Ring(const Ring&) = delete;
+    ~Ring();
+
+    Ring& operator=(const Ring&) = delete;
+
+    // The pipeline never has more entries in flight than a ring can hold, so
+    // there is always room.
+    void Push(Entry entry) {
+      const size_t tail = tail_.load(std::memory_order_relaxed);
+      CHECK_LT(tail - head_.load(std::memory_order_acquire), slots_.size());
+      std::optional<Entry>& slot = slots_[tail & mask_];
+      DCHECK(!slot);
+      slot.emplace(std::move(entry));
+      tail_.store(tail + 1, std::memory_order_release);
+    }
+
+    std::optional<Entry> Pop() {
+      const size_t head = head_.load(std::memory_order_relaxed);
+      if (head == tail_.load(std::memory_order_acquire)) {
+        return std::nullopt;
+      }
+      std::optional<Entry>& slot = slots_[head & mask_];
+      std::optional<Entry> entry = std::move(slot);
+      slot.reset();
+      head_.store(head + 1, std::memory_order_release);
+      return entry;
+    }
+
+    // Exact when called from either end, approximate from anywhere else.
+    size_t Size() const {
+      return tail_.load(std::memory_order_acquire) -
+             head_.load(std::memory_order_acquire);
+    }
+
+   private:
+    std::vector<std::optional<Entry>> slots_;
+    const size_t mask_;
+    // Kept on separate cache lines so that the two threads don't contend.
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+  };
+
+  const size_t capacity_;
+  Ring jobs_;
+  Ring results_;
+  size_t in_flight_jobs_ = 0;
+};
+
+}  // namespace cc
+
+#endif  // CC_PAINT_PAINT_WORKLET_JOB_PIPELINE_H_
@@ -0,0 +1,154 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/paint/paint_worklet_job_pipeline.h"
+
+#include <optional>
+#include <utility>
+
+#include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "base/threading/platform_thread.h"
+#include "base/threading/simple_thread.h"
+#include "cc/paint/paint_op.h"
+#include "cc/paint/paint_op_buffer.h"
+#include "cc/test/test_paint_worklet_input.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace cc {
+namespace {
+
+PaintWorkletJob CreateJob(int layer_id) {
+  return PaintWorkletJob(
+      layer_id,
+      base::MakeRefCounted<TestPaintWorkletInput>(gfx::SizeF(100, 100)),
+      PaintWorkletJob::AnimatedPropertyValues());
+}
+
+PaintRecord CreateOutput() {
+  PaintOpBuffer buffer;
+  buffer.push<SaveOp>();
+  buffer.push<RestoreOp>();
+  return buffer.ReleaseAsRecord();
+}
+
+// Plays the worklet thread: paints |job_count| jobs and hands them back.
+class FakeWorklet : public base::DelegateSimpleThread::Delegate {
+ public:
+  FakeWorklet(PaintWorkletJobPipeline* pipeline, int job_count)
+      : pipeline_(pipeline), job_count_(job_count) {}
+
+  void Run() override {
+    for (int painted = 0; painted < job_count_;) {
+      std::optional<PaintWorkletJobPipeline::Entry> entry =
+          pipeline_->PopJob();
+      if (!entry) {
+        base::PlatformThread::YieldCurrentThread();
+        continue;
+      }
+      entry->job.SetOutput(CreateOutput());
+      pipeline_->PushResult(std::move(*entry));
+      ++painted;
+    }
+  }
+
+ private:
+  const raw_ptr<PaintWorkletJobPipeline> pipeline_;
+  const int job_count_;
+};
+
+TEST(PaintWorkletJobPipelineTest, RoundTrip) {
+  base::HistogramTester histogram_tester;
+  PaintWorkletJobPipeline pipeline(4u);
+  EXPECT_FALSE(pipeline.PopJob());
+  EXPECT_FALSE(pipeline.PopResult());
+
+  pipeline.PushJob(1, CreateJob(10));
+  pipeline.PushJob(2, CreateJob(20));
+  EXPECT_EQ(pipeline.InFlightJobCount(), 2u);
+
+  std::optional<PaintWorkletJobPipeline::Entry> entry = pipeline.PopJob();
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->worklet_id, 1);
+  EXPECT_EQ(entry->job.layer_id(), 10);
+  entry->job.SetOutput(CreateOutput());
+  pipeline.PushResult(std::move(*entry));
+  // The result is only picked up by the compositor, not handed out again.
+  entry = pipeline.PopJob();
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->worklet_id, 2);
+  EXPECT_FALSE(pipeline.PopJob());
+  pipeline.PushResult(std::move(*entry));
+
+  entry = pipeline.PopResult();
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->worklet_id, 1);
+  EXPECT_FALSE(entry->job.output().empty());
+  entry = pipeline.PopResult();
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->worklet_id, 2);
+  EXPECT_TRUE(entry->job.output().empty());
+  EXPECT_FALSE(pipeline.PopResult());
+  EXPECT_EQ(pipeline.InFlightJobCount(), 0u);
+
+  histogram_tester.ExpectBucketCount("PaintWorklet.JobPipeline.QueueDepth", 1,
+                                     1);
+  histogram_tester.ExpectBucketCount("PaintWorklet.JobPipeline.QueueDepth", 2,
+                                     1);
+  histogram_tester.ExpectTotalCount("PaintWorklet.JobPipeline.RoundTripLatency",
+                                    2);
+}
+
+TEST(PaintWorkletJobPipelineTest, Capacity) {
+  PaintWorkletJobPipeline pipeline(2u);
+  EXPECT_TRUE(pipeline.CanPushJob());
+  pipeline.PushJob(1, CreateJob(1));
+  pipeline.PushJob(2, CreateJob(2));
+  EXPECT_FALSE(pipeline.CanPushJob());
+
+  // Jobs count against the capacity until their results are popped.
+  std::optional<PaintWorkletJobPipeline::Entry> entry = pipeline.PopJob();
+  pipeline.PushResult(std::move(*entry));
+  EXPECT_FALSE(pipeline.CanPushJob());
+  EXPECT_TRUE(pipeline.PopResult());
+  EXPECT_TRUE(pipeline.CanPushJob());
+
+  // The rings wrap around.
+  pipeline.PushJob(3, CreateJob(3));
+  EXPECT_EQ(pipeline.PopJob()->worklet_id, 2);
+  EXPECT_EQ(pipeline.PopJob()->worklet_id, 3);
+}
+
+TEST(PaintWorkletJobPipelineTest, ConcurrentWorkletThread) {
+  constexpr int kJobCount = 1000;
+  PaintWorkletJobPipeline pipeline(8u);
+  FakeWorklet worklet(&pipeline, kJobCount);
+  base::DelegateSimpleThread worklet_thread(&worklet, "FakeWorklet");
+  worklet_thread.Start();
+
+  int next_job = 0;
+  int next_result = 0;
+  while (next_result < kJobCount) {
+    while (next_job < kJobCount && pipeline.CanPushJob()) {
+      pipeline.PushJob(next_job, CreateJob(next_job));
+      ++next_job;
+    }
+    std::optional<PaintWorkletJobPipeline::Entry> entry = pipeline.PopResult();
+    if (!entry) {
+      base::PlatformThread::YieldCurrentThread();
+      continue;
+    }
+    // Results come back in dispatch order and with their output.
+    EXPECT_EQ(entry->worklet_id, next_result);
+    EXPECT_EQ(entry->job.layer_id(), next_result);
+    EXPECT_FALSE(entry->job.output().empty());
+    ++next_result;
+  }
+  worklet_thread.Join();
+  EXPECT_EQ(pipeline.InFlightJobCount(), 0u);
+}
+
+}  // namespace
+}  // namespace cc
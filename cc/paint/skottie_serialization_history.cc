@@ -32,8 +32,10 @@ bool SkottieSerializationHistory::SkottieFrameDataId::operator!=(
 
 SkottieSerializationHistory::SkottieWrapperHistory::SkottieWrapperHistory(
     const SkottieFrameDataMap& initial_images,
+    const SkottieColorMap& initial_color_map,
     const SkottieTextPropertyValueMap& initial_text_map)
-    : accumulated_text_map_(initial_text_map) {
+    : accumulated_color_map_(initial_color_map),
+      accumulated_text_map_(initial_text_map) {
   for (const auto& image_asset_pair : initial_images) {
     DVLOG(1) << "Received initial image for asset " << image_asset_pair.first;
     last_frame_data_per_asset_.emplace(
@@ -54,9 +56,11 @@ SkottieSerializationHistory::SkottieWrapperHistory::~SkottieWrapperHistory() =
 
 void SkottieSerializationHistory::SkottieWrapperHistory::FilterNewState(
     SkottieFrameDataMap& images,
+    SkottieColorMap& color_map,
     SkottieTextPropertyValueMap& text_map) {
   ++current_sequence_id_;
   FilterNewFrameImages(images);
+  FilterNewColorPropertyValues(color_map);
   FilterNewTextPropertyValues(text_map);
 }
 
@@ -84,6 +88,25 @@ void SkottieSerializationHistory::SkottieWrapperHistory::FilterNewFrameImages(
   }
 }
 
+void SkottieSerializationHistory::SkottieWrapperHistory::
+    FilterNewColorPropertyValues(SkottieColorMap& color_map_in) {
+  auto color_map_in_iter = color_map_in.begin();
+  while (color_map_in_iter != color_map_in.end()) {
+    const SkottieResourceIdHash& node = color_map_in_iter->first;
+    auto [accumulated_iter, is_new_insertion] =
+        accumulated_color_map_.insert(*color_map_in_iter);
+    SkColor& old_color = accumulated_iter->second;
+    if (!is_new_insertion && old_color == color_map_in_iter->second) {
+      DVLOG(4) << "No update to color property value for node" << node;
+      color_map_in_iter = color_map_in.erase(color_map_in_iter);
+    } else {
+      DVLOG(1) << "New color available for node " << node;
+      old_color = color_map_in_iter->second;
+      ++color_map_in_iter;
+    }
+  }
+}
+
 void SkottieSerializationHistory::SkottieWrapperHistory::
     FilterNewTextPropertyValues(SkottieTextPropertyValueMap& text_map_in) {
   auto text_map_in_iter = text_map_in.begin();
@@ -113,17 +136,18 @@ SkottieSerializationHistory::~SkottieSerializationHistory() = default;
 void SkottieSerializationHistory::FilterNewSkottieFrameState(
     const SkottieWrapper& skottie,
     SkottieFrameDataMap& images,
+    SkottieColorMap& color_map,
     SkottieTextPropertyValueMap& text_map) {
   DCHECK(skottie.is_valid());
   base::AutoLock lock(mutex_);
-  auto [result_iterator, is_new_insertion] =
-      history_per_animation_.try_emplace(skottie.id(), images, text_map);
+  auto [result_iterator, is_new_insertion] = history_per_animation_.try_emplace(
+      skottie.id(), images, color_map, text_map);
   if (is_new_insertion) {
     DVLOG(1) << "Encountered new SkottieWrapper with id " << skottie.id()
              << " and " << images.size() << " images";
   } else {
     SkottieWrapperHistory& skottie_history_found = result_iterator->second;
-    skottie_history_found.FilterNewState(images, text_map);
+    skottie_history_found.FilterNewState(images, color_map, text_map);
   }
 }
 
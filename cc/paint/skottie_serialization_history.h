@@ -11,6 +11,7 @@
 #include "cc/paint/paint_export.h"
 #include "cc/paint/paint_flags.h"
 #include "cc/paint/paint_image.h"
+#include "cc/paint/skottie_color_map.h"
 #include "cc/paint/skottie_frame_data.h"
 #include "cc/paint/skottie_resource_metadata.h"
 #include "cc/paint/skottie_text_property_value.h"
@@ -47,12 +48,13 @@ class CC_PAINT_EXPORT SkottieSerializationHistory {
       delete;
   ~SkottieSerializationHistory();
 
-  // Given the set of |images| and the |text_map| in the |skottie| animation's
-  // new frame, filter out the entries whose contents have not changed since the
-  // last frame. If an entry *has* changed, it is kept in its corresponding
-  // output argument and the history is updated internally.
+  // Given the set of |images|, the |color_map| and the |text_map| in the
+  // |skottie| animation's new frame, filter out the entries whose contents have
+  // not changed since the last frame. If an entry *has* changed, it is kept in
+  // its corresponding output argument and the history is updated internally.
   void FilterNewSkottieFrameState(const SkottieWrapper& skottie,
                                   SkottieFrameDataMap& images,
+                                  SkottieColorMap& color_map,
                                   SkottieTextPropertyValueMap& text_map);
 
   // Purges the history of any Skottie animations that have been inactive for
@@ -88,12 +90,14 @@ class CC_PAINT_EXPORT SkottieSerializationHistory {
     static constexpr int kInitialSequenceId = 1;
 
     SkottieWrapperHistory(const SkottieFrameDataMap& initial_images,
+                          const SkottieColorMap& initial_color_map,
                           const SkottieTextPropertyValueMap& initial_text_map);
     SkottieWrapperHistory(const SkottieWrapperHistory& other);
     SkottieWrapperHistory& operator=(const SkottieWrapperHistory& other);
     ~SkottieWrapperHistory();
 
     void FilterNewState(SkottieFrameDataMap& images,
+                        SkottieColorMap& color_map,
                         SkottieTextPropertyValueMap& text_map);
 
     // The "sequence_id" is incremented each time the caller tries to update an
@@ -110,12 +114,14 @@ class CC_PAINT_EXPORT SkottieSerializationHistory {
 
    private:
     void FilterNewFrameImages(SkottieFrameDataMap& images);
+    void FilterNewColorPropertyValues(SkottieColorMap& color_map);
     void FilterNewTextPropertyValues(SkottieTextPropertyValueMap& text_map);
 
     int current_sequence_id_ = kInitialSequenceId;
     int sequence_id_at_last_purge_check_ = kInitialSequenceId;
     base::flat_map<SkottieResourceIdHash, SkottieFrameDataId>
         last_frame_data_per_asset_;
+    SkottieColorMap accumulated_color_map_;
     SkottieTextPropertyValueMap accumulated_text_map_;
   };
 
@@ -35,6 +35,7 @@ class SkottieSerializationHistoryTest : public ::testing::Test {
 
   SkottieSerializationHistory history_;
   SkottieFrameDataMap empty_images;
+  SkottieColorMap empty_color_map;
   SkottieTextPropertyValueMap empty_text_map;
 };
 
@@ -52,7 +53,8 @@ TEST_F(SkottieSerializationHistoryTest, FilterNewSkottieFrameImages) {
       {HashSkottieResourceId("asset_b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images, UnorderedElementsAre(
                           SkottieImageIs("asset_a", image_1,
                                          PaintFlags::FilterQuality::kMedium),
@@ -65,7 +67,8 @@ TEST_F(SkottieSerializationHistoryTest, FilterNewSkottieFrameImages) {
       {HashSkottieResourceId("asset_b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images,
               UnorderedElementsAre(SkottieImageIs(
                   "asset_a", image_3, PaintFlags::FilterQuality::kMedium)));
@@ -76,12 +79,14 @@ TEST_F(SkottieSerializationHistoryTest, FilterNewSkottieFrameImages) {
       {HashSkottieResourceId("asset_b"),
        {image_4, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images,
               UnorderedElementsAre(SkottieImageIs(
                   "asset_b", image_4, PaintFlags::FilterQuality::kMedium)));
 
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images, IsEmpty());
 }
 
@@ -99,26 +104,30 @@ TEST_F(SkottieSerializationHistoryTest, HandlesEmptyImages) {
       {HashSkottieResourceId("asset_b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images,
               Contains(SkottieImageIs("asset_a", blank_image,
                                       PaintFlags::FilterQuality::kMedium)));
 
   images = {{HashSkottieResourceId("asset_a"),
              {image_1, PaintFlags::FilterQuality::kMedium}}};
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images,
               Contains(SkottieImageIs("asset_a", image_1,
                                       PaintFlags::FilterQuality::kMedium)));
 
   images = {{HashSkottieResourceId("asset_a"),
              {blank_image, PaintFlags::FilterQuality::kMedium}}};
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images,
               Contains(SkottieImageIs("asset_a", blank_image,
                                       PaintFlags::FilterQuality::kMedium)));
 
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images, IsEmpty());
 }
 
@@ -131,7 +140,8 @@ TEST_F(SkottieSerializationHistoryTest, FilterNewSkottieFrameText) {
       {HashSkottieResourceId("node_b"),
        SkottieTextPropertyValue("test_1b", gfx::RectF(2, 2, 2, 2))},
   };
-  history_.FilterNewSkottieFrameState(*skottie, empty_images, text_map);
+  history_.FilterNewSkottieFrameState(*skottie, empty_images, empty_color_map,
+                                      text_map);
   EXPECT_THAT(text_map,
               UnorderedElementsAre(
                   SkottieTextIs("node_a", "test_1a", gfx::RectF(1, 1, 1, 1)),
@@ -143,7 +153,8 @@ TEST_F(SkottieSerializationHistoryTest, FilterNewSkottieFrameText) {
       {HashSkottieResourceId("node_b"),
        SkottieTextPropertyValue("test_1b", gfx::RectF(2, 2, 2, 2))},
   };
-  history_.FilterNewSkottieFrameState(*skottie, empty_images, text_map);
+  history_.FilterNewSkottieFrameState(*skottie, empty_images, empty_color_map,
+                                      text_map);
   EXPECT_THAT(text_map, UnorderedElementsAre(SkottieTextIs(
                             "node_a", "test_2a", gfx::RectF(1, 1, 1, 1))));
 
@@ -153,14 +164,41 @@ TEST_F(SkottieSerializationHistoryTest, FilterNewSkottieFrameText) {
       {HashSkottieResourceId("node_b"),
        SkottieTextPropertyValue("test_1b", gfx::RectF(2, 2, 2, 2))},
   };
-  history_.FilterNewSkottieFrameState(*skottie, empty_images, text_map);
+  history_.FilterNewSkottieFrameState(*skottie, empty_images, empty_color_map,
+                                      text_map);
   EXPECT_THAT(text_map, UnorderedElementsAre(SkottieTextIs(
                             "node_a", "test_2a", gfx::RectF(3, 3, 3, 3))));
 
-  history_.FilterNewSkottieFrameState(*skottie, empty_images, text_map);
+  history_.FilterNewSkottieFrameState(*skottie, empty_images, empty_color_map,
+                                      text_map);
   EXPECT_THAT(text_map, IsEmpty());
 }
 
+TEST_F(SkottieSerializationHistoryTest, FilterNewSkottieFrameColors) {
+  auto skottie = CreateSkottie(gfx::Size(10, 10), 1);
+
+  SkottieColorMap color_map = {SkottieMapColor("node_a", SK_ColorRED),
+                               SkottieMapColor("node_b", SK_ColorGREEN)};
+  history_.FilterNewSkottieFrameState(*skottie, empty_images, color_map,
+                                      empty_text_map);
+  EXPECT_THAT(color_map,
+              UnorderedElementsAre(SkottieMapColor("node_a", SK_ColorRED),
+                                   SkottieMapColor("node_b", SK_ColorGREEN)));
+
+  color_map = {SkottieMapColor("node_a", SK_ColorBLUE),
+               SkottieMapColor("node_b", SK_ColorGREEN)};
+  history_.FilterNewSkottieFrameState(*skottie, empty_images, color_map,
+                                      empty_text_map);
+  EXPECT_THAT(color_map,
+              UnorderedElementsAre(SkottieMapColor("node_a", SK_ColorBLUE)));
+
+  color_map = {SkottieMapColor("node_a", SK_ColorBLUE),
+               SkottieMapColor("node_b", SK_ColorGREEN)};
+  history_.FilterNewSkottieFrameState(*skottie, empty_images, color_map,
+                                      empty_text_map);
+  EXPECT_THAT(color_map, IsEmpty());
+}
+
 TEST_F(SkottieSerializationHistoryTest,
        FilterNewSkottieFrameImagesTakesQualityIntoAccount) {
   auto skottie = CreateSkottieFromString(
@@ -174,7 +212,8 @@ TEST_F(SkottieSerializationHistoryTest,
       {HashSkottieResourceId("asset_b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
 
   images = {
       {HashSkottieResourceId("asset_a"),
@@ -182,7 +221,8 @@ TEST_F(SkottieSerializationHistoryTest,
       {HashSkottieResourceId("asset_b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie, images, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie, images, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images,
               UnorderedElementsAre(SkottieImageIs(
                   "asset_a", image_1, PaintFlags::FilterQuality::kHigh)));
@@ -211,8 +251,10 @@ TEST_F(SkottieSerializationHistoryTest,
       {HashSkottieResourceId("asset_2b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_text_map);
-  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_color_map,
+                                      empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(
       images_2,
       UnorderedElementsAre(SkottieImageIs("asset_2a", image_1,
@@ -232,8 +274,10 @@ TEST_F(SkottieSerializationHistoryTest,
       {HashSkottieResourceId("asset_2b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_text_map);
-  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_color_map,
+                                      empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images_2,
               UnorderedElementsAre(SkottieImageIs(
                   "asset_2a", image_4, PaintFlags::FilterQuality::kMedium)));
@@ -259,18 +303,23 @@ TEST_F(SkottieSerializationHistoryTest, RequestInactiveAnimationsPurge) {
       {HashSkottieResourceId("asset_2b"),
        {image_2, PaintFlags::FilterQuality::kMedium}},
   };
-  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_text_map);
-  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_color_map,
+                                      empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_color_map,
+                                      empty_text_map);
 
   history_.RequestInactiveAnimationsPurge();
-  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_color_map,
+                                      empty_text_map);
 
   // Only |skottie_2| should be purged here since |skottie_1| was updated after
   // the first purge.
   history_.RequestInactiveAnimationsPurge();
 
-  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_text_map);
-  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_1, images_1, empty_color_map,
+                                      empty_text_map);
+  history_.FilterNewSkottieFrameState(*skottie_2, images_2, empty_color_map,
+                                      empty_text_map);
   EXPECT_THAT(images_1, IsEmpty());
   // History for |skottie_2| should start again.
   EXPECT_THAT(
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/command_line.h"
+#include "base/containers/circular_deque.h"
 #include "base/containers/contains.h"
 #include "base/feature_list.h"
 #include "base/functional/bind.h"
@@ -36,6 +37,17 @@ BASE_FEATURE(kUseCompositorJob,
              "UseCompositorJob",
              base::FEATURE_ENABLED_BY_DEFAULT);
 
+// Uses CategorizedWorkerPoolWorkStealing instead of the pools above. Takes
+// precedence over kUseCompositorJob.
+BASE_FEATURE(kUseWorkStealingCompositorWorkerPool,
+             "UseWorkStealingCompositorWorkerPool",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+// Maximum number of tasks a CategorizedWorkerPoolWorkStealing worker moves to
+// its deque at once, and maximum number of completed tasks it holds on to
+// before handing them back to the work queue.
+constexpr size_t kMaxTasksPerRefill = 8;
+
 // Task categories running at normal thread priority.
 constexpr TaskCategory kNormalThreadPriorityCategories[] = {
     TASK_CATEGORY_NONCONCURRENT_FOREGROUND, TASK_CATEGORY_FOREGROUND,
@@ -85,6 +97,27 @@ class CategorizedWorkerPoolThread : public base::SimpleThread {
   scoped_refptr<base::SingleThreadTaskRunner> background_task_runner_;
 };
 
+// A thread which forwards to CategorizedWorkerPoolWorkStealing::Run with its
+// worker.
+class CategorizedWorkerPoolWorkStealingThread : public base::SimpleThread {
+ public:
+  CategorizedWorkerPoolWorkStealingThread(
+      const std::string& name_prefix,
+      const Options& options,
+      CategorizedWorkerPoolWorkStealing* pool,
+      CategorizedWorkerPoolWorkStealing::Worker* worker)
+      : SimpleThread(name_prefix, options), pool_(pool), worker_(worker) {}
+
+  // base::SimpleThread:
+  void BeforeRun() override { pool_->ThreadWillRun(tid()); }
+
+  void Run() override { pool_->Run(worker_); }
+
+ private:
+  const raw_ptr<CategorizedWorkerPoolWorkStealing> pool_;
+  const raw_ptr<CategorizedWorkerPoolWorkStealing::Worker> worker_;
+};
+
 scoped_refptr<CategorizedWorkerPool>& GetWorkerPool() {
   static base::NoDestructor<scoped_refptr<CategorizedWorkerPool>> worker_pool;
   return *worker_pool;
@@ -671,6 +704,469 @@ size_t CategorizedWorkerPoolJob::GetMaxJobConcurrency(
   return num_foreground_tasks + num_background_tasks;
 }
 
+// Ready to run tasks owned by a single worker thread, sorted by the rank of
+// their category in |categories_| and then by priority. The owner pops from the
+// front. Thieves take the front half too: the owner is busy running a task, so
+// the highest priority tasks it holds would otherwise wait the longest.
+class CategorizedWorkerPoolWorkStealing::Worker {
+ public:
+  Worker(size_t index,
+         base::span<const TaskCategory> categories,
+         size_t num_peers,
+         base::ConditionVariable* has_ready_to_run_tasks_cv)
+      : index_(index),
+        categories_(categories),
+        num_peers_(num_peers),
+        has_ready_to_run_tasks_cv_(has_ready_to_run_tasks_cv) {}
+
+  Worker(const Worker&) = delete;
+  Worker& operator=(const Worker&) = delete;
+
+  ~Worker() { DCHECK(tasks_.empty()); }
+
+  size_t index() const { return index_; }
+  base::span<const TaskCategory> categories() const { return categories_; }
+  // Number of workers running |categories_|, including this one.
+  size_t num_peers() const { return num_peers_; }
+  base::ConditionVariable* has_ready_to_run_tasks_cv() const {
+    return has_ready_to_run_tasks_cv_;
+  }
+
+  // Returns true if |other| runs the same categories, which means the two
+  // workers may steal from each other.
+  bool IsPeer(const Worker& other) const {
+    return categories_.data() == other.categories_.data();
+  }
+
+  void PushTask(TaskGraphWorkQueue::PrioritizedTask task) {
+    base::AutoLock lock(lock_);
+    auto it = std::upper_bound(
+        tasks_.begin(), tasks_.end(), task,
+        [this](const TaskGraphWorkQueue::PrioritizedTask& a,
+               const TaskGraphWorkQueue::PrioritizedTask& b) {
+          return RunsBefore(a, b);
+        });
+    tasks_.insert(it, std::move(task));
+  }
+
+  std::optional<TaskGraphWorkQueue::PrioritizedTask> PopTask() {
+    base::AutoLock lock(lock_);
+    if (tasks_.empty()) {
+      return std::nullopt;
+    }
+    TaskGraphWorkQueue::PrioritizedTask task = std::move(tasks_.front());
+    tasks_.pop_front();
+    return task;
+  }
+
+  // Moves the first half of |tasks_|, rounded up, to |stolen_tasks| in order.
+  void StealTasks(TaskGraphWorkQueue::PrioritizedTask::Vector* stolen_tasks) {
+    base::AutoLock lock(lock_);
+    size_t num_stolen_tasks = (tasks_.size() + 1) / 2;
+    for (size_t i = 0; i < num_stolen_tasks; ++i) {
+      stolen_tasks->push_back(std::move(tasks_.front()));
+      tasks_.pop_front();
+    }
+  }
+
+  // Moves all tasks that belong to |task_namespace| to |tasks|.
+  void TakeTasksInNamespace(
+      const TaskGraphWorkQueue::TaskNamespace* task_namespace,
+      TaskGraphWorkQueue::PrioritizedTask::Vector* tasks) {
+    base::AutoLock lock(lock_);
+    base::circular_deque<TaskGraphWorkQueue::PrioritizedTask> remaining_tasks;
+    for (auto& task : tasks_) {
+      if (task.task_namespace == task_namespace) {
+        tasks->push_back(std::move(task));
+      } else {
+        remaining_tasks.push_back(std::move(task));
+      }
+    }
+    tasks_.swap(remaining_tasks);
+  }
+
+  bool HasTasks() const {
+    base::AutoLock lock(lock_);
+    return !tasks_.empty();
+  }
+
+ private:
+  bool RunsBefore(const TaskGraphWorkQueue::PrioritizedTask& a,
+                  const TaskGraphWorkQueue::PrioritizedTask& b) const {
+    size_t a_rank = CategoryRank(a.category);
+    size_t b_rank = CategoryRank(b.category);
+    if (a_rank != b_rank) {
+      return a_rank < b_rank;
+    }
+    // In this system, numerically lower priority is run first.
+    return a.priority < b.priority;
+  }
+
+  size_t CategoryRank(uint16_t category) const {
+    auto it = base::ranges::find(categories_, category);
+    DCHECK(it != categories_.end());
+    return static_cast<size_t>(it - categories_.begin());
+  }
+
+  const size_t index_;
+  const base::span<const TaskCategory> categories_;
+  const size_t num_peers_;
+  const raw_ptr<base::ConditionVariable> has_ready_to_run_tasks_cv_;
+
+  mutable base::Lock lock_;
+  base::circular_deque<TaskGraphWorkQueue::PrioritizedTask> tasks_
+      GUARDED_BY(lock_);
+};
+
+CategorizedWorkerPoolWorkStealing::CategorizedWorkerPoolWorkStealing(
+    Delegate* delegate)
+    : delegate_(delegate),
+      has_task_for_normal_priority_thread_cv_(&lock_),
+      has_task_for_background_priority_thread_cv_(&lock_) {
+  // Declare the two ConditionVariables which are used by worker threads to
+  // sleep-while-idle as such to avoid throwing off //base heuristics.
+  has_task_for_normal_priority_thread_cv_.declare_only_used_while_idle();
+  has_task_for_background_priority_thread_cv_.declare_only_used_while_idle();
+}
+
+CategorizedWorkerPoolWorkStealing::~CategorizedWorkerPoolWorkStealing() =
+    default;
+
+void CategorizedWorkerPoolWorkStealing::Start(int max_concurrency_foreground) {
+  DCHECK(workers_.empty());
+  DCHECK(threads_.empty());
+
+  // |max_concurrency_foreground| normal workers and 1 background worker are
+  // created. All workers exist before any thread starts, as threads look up
+  // their peers in |workers_| without holding |lock_|.
+  const size_t num_threads = max_concurrency_foreground + 1;
+  workers_.reserve(num_threads);
+  for (int i = 0; i < max_concurrency_foreground; i++) {
+    workers_.push_back(std::make_unique<Worker>(
+        workers_.size(), kNormalThreadPriorityCategories,
+        max_concurrency_foreground, &has_task_for_normal_priority_thread_cv_));
+  }
+  workers_.push_back(std::make_unique<Worker>(
+      workers_.size(), kBackgroundThreadPriorityCategories, 1u,
+      &has_task_for_background_priority_thread_cv_));
+
+  threads_.reserve(num_threads);
+  for (int i = 0; i < max_concurrency_foreground; i++) {
+    auto thread = std::make_unique<CategorizedWorkerPoolWorkStealingThread>(
+        base::StringPrintf("CompositorTileWorker%d", i + 1),
+        base::SimpleThread::Options(), this, workers_[i].get());
+    thread->StartAsync();
+    threads_.push_back(std::move(thread));
+  }
+
+  base::SimpleThread::Options thread_options;
+// TODO(1326996): Figure out whether !IS_MAC can be lifted here.
+#if !BUILDFLAG(IS_MAC)
+  thread_options.thread_type = base::ThreadType::kBackground;
+#endif
+
+  auto thread = std::make_unique<CategorizedWorkerPoolWorkStealingThread>(
+      "CompositorTileWorkerBackground", thread_options, this,
+      workers_.back().get());
+  thread->StartAsync();
+  threads_.push_back(std::move(thread));
+
+  DCHECK_EQ(num_threads, threads_.size());
+}
+
+void CategorizedWorkerPoolWorkStealing::Shutdown() {
+  {
+    base::ScopedAllowBaseSyncPrimitivesOutsideBlockingScope allow_wait;
+    WaitForTasksToFinishRunning(namespace_token_);
+  }
+
+  CollectCompletedTasks(namespace_token_, &completed_tasks_);
+  // Shutdown raster threads.
+  {
+    base::AutoLock lock(lock_);
+
+    DCHECK(!work_queue_.HasReadyToRunTasks());
+    DCHECK(!work_queue_.HasAnyNamespaces());
+
+    DCHECK(!shutdown_);
+    shutdown_ = true;
+
+    // Wake up all workers so they exit.
+    has_task_for_normal_priority_thread_cv_.Broadcast();
+    has_task_for_background_priority_thread_cv_.Broadcast();
+  }
+  while (!threads_.empty()) {
+    threads_.back()->Join();
+    threads_.pop_back();
+  }
+  workers_.clear();
+}
+
+void CategorizedWorkerPoolWorkStealing::ThreadWillRun(
+    base::PlatformThreadId tid) {
+  if (delegate_) {
+    delegate_->NotifyThreadWillRun(tid);
+  }
+}
+
+// Overridden from base::TaskRunner:
+bool CategorizedWorkerPoolWorkStealing::PostDelayedTask(
+    const base::Location& from_here,
+    base::OnceClosure task,
+    base::TimeDelta delay) {
+  base::AutoLock lock(lock_);
+
+  // Remove completed tasks.
+  DCHECK(completed_tasks_.empty());
+  CollectCompletedTasksWithLockAcquired(namespace_token_, &completed_tasks_);
+
+  std::erase_if(tasks_, [this](const scoped_refptr<Task>& e)
+                            EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+                              return base::Contains(this->completed_tasks_, e);
+                            });
+
+  tasks_.push_back(base::MakeRefCounted<ClosureTask>(std::move(task)));
+  graph_.Reset();
+  for (const auto& graph_task : tasks_) {
+    // Delayed tasks are assigned FOREGROUND category, ensuring that they run as
+    // soon as possible once their delay has expired.
+    graph_.nodes.push_back(
+        TaskGraph::Node(graph_task.get(), TASK_CATEGORY_FOREGROUND,
+                        0u /* priority */, 0u /* dependencies */));
+  }
+
+  ScheduleTasksWithLockAcquired(namespace_token_, &graph_);
+  completed_tasks_.clear();
+  return true;
+}
+
+void CategorizedWorkerPoolWorkStealing::Run(Worker* worker) {
+  TaskGraphWorkQueue::PrioritizedTask::Vector completed_tasks;
+
+  while (true) {
+    std::optional<TaskGraphWorkQueue::PrioritizedTask> prioritized_task =
+        worker->PopTask();
+    if (!prioritized_task) {
+      prioritized_task = StealTask(worker);
+    }
+
+    if (prioritized_task) {
+      TRACE_EVENT(
+          "toplevel", "TaskGraphRunner::RunTask",
+          perfetto::Flow::Global(prioritized_task->task->trace_task_id()),
+          [&](perfetto::EventContext ctx) {
+            ctx.event<perfetto::protos::pbzero::ChromeTrackEvent>()
+                ->set_chrome_raster_task()
+                ->set_source_frame_number(
+                    prioritized_task->task->frame_number());
+          });
+
+      prioritized_task->task->RunOnWorkerThread();
+      completed_tasks.push_back(std::move(*prioritized_task));
+
+      // Hand completed tasks back right away if that doesn't mean waiting
+      // for |lock_|, so that their dependents become ready to run as soon as
+      // possible. Under contention, complete them in batches.
+      if (completed_tasks.size() >= kMaxTasksPerRefill) {
+        base::AutoLock lock(lock_);
+        CompleteTasksWithLockAcquired(&completed_tasks);
+      } else if (lock_.Try()) {
+        CompleteTasksWithLockAcquired(&completed_tasks);
+        lock_.Release();
+      }
+      continue;
+    }
+
+    base::AutoLock lock(lock_);
+    CompleteTasksWithLockAcquired(&completed_tasks);
+
+    if (RefillWithLockAcquired(worker)) {
+      continue;
+    }
+
+    // A peer refilled its deque after StealTask() looked at it. Try again
+    // rather than going to sleep while there is work this worker can do.
+    if (HasStealableTasksWithLockAcquired(worker->categories())) {
+      continue;
+    }
+
+    // We are no longer running tasks, which may allow another category to
+    // start running. Signal other worker threads.
+    SignalHasReadyToRunTasksWithLockAcquired();
+
+    // Make sure the END of the last trace event emitted before going idle
+    // is flushed to perfetto.
+    // TODO(crbug.com/1021571): Remove this once fixed.
+    PERFETTO_INTERNAL_ADD_EMPTY_EVENT();
+
+    // Exit when shutdown is set and no more tasks are pending.
+    if (shutdown_) {
+      break;
+    }
+
+    // Wait for more tasks. Tasks only enter worker deques from |work_queue_|
+    // while holding |lock_|, and stealing only moves them between workers
+    // that are awake, so this cannot leave work behind with all peers asleep.
+    worker->has_ready_to_run_tasks_cv()->Wait();
+  }
+}
+
+void CategorizedWorkerPoolWorkStealing::FlushForTesting() {
+  base::AutoLock lock(lock_);
+
+  while (!work_queue_.HasFinishedRunningTasksInAllNamespaces()) {
+    has_namespaces_with_finished_running_tasks_cv_.Wait();
+  }
+}
+
+void CategorizedWorkerPoolWorkStealing::ScheduleTasks(NamespaceToken token,
+                                                      TaskGraph* graph) {
+  TRACE_EVENT2("disabled-by-default-cc.debug",
+               "CategorizedWorkerPool::ScheduleTasks", "num_nodes",
+               graph->nodes.size(), "num_edges", graph->edges.size());
+  {
+    base::AutoLock lock(lock_);
+    ScheduleTasksWithLockAcquired(token, graph);
+  }
+}
+
+void CategorizedWorkerPoolWorkStealing::ScheduleTasksWithLockAcquired(
+    NamespaceToken token,
+    TaskGraph* graph) {
+  DCHECK(token.IsValid());
+  DCHECK(!TaskGraphWorkQueue::DependencyMismatch(graph));
+  DCHECK(!shutdown_);
+
+  // Tasks of this namespace that are waiting in a worker deque have been
+  // handed out by |work_queue_| but have not started running. Return them so
+  // that the new graph either schedules them again or cancels them.
+  if (auto* task_namespace = work_queue_.GetNamespaceForToken(token)) {
+    TaskGraphWorkQueue::PrioritizedTask::Vector unstarted_tasks;
+    for (const auto& worker : workers_) {
+      worker->TakeTasksInNamespace(task_namespace, &unstarted_tasks);
+    }
+    for (auto& unstarted_task : unstarted_tasks) {
+      work_queue_.ReturnUnstartedTask(std::move(unstarted_task));
+    }
+  }
+
+  work_queue_.ScheduleTasks(token, graph);
+
+  // There may be more work available, so wake up another worker thread.
+  SignalHasReadyToRunTasksWithLockAcquired();
+}
+
+bool CategorizedWorkerPoolWorkStealing::RefillWithLockAcquired(
+    Worker* worker) {
+  lock_.AssertAcquired();
+
+  size_t num_tasks = 0;
+  for (TaskCategory category : worker->categories()) {
+    // Take a fair share of the ready to run tasks, so that peers find work
+    // in the queue rather than all having to steal from this worker.
+    size_t num_ready_tasks = work_queue_.NumReadyTasksForCategory(category);
+    size_t num_tasks_for_category =
+        (num_ready_tasks + worker->num_peers() - 1) / worker->num_peers();
+    for (size_t i = 0; i < num_tasks_for_category &&
+                       num_tasks < kMaxTasksPerRefill &&
+                       ShouldRunTaskForCategoryWithLockAcquired(category);
+         ++i) {
+      worker->PushTask(work_queue_.GetNextTaskToRun(category));
+      ++num_tasks;
+    }
+  }
+  if (!num_tasks) {
+    return false;
+  }
+
+  // There may be more work available, so wake up another worker thread.
+  SignalHasReadyToRunTasksWithLockAcquired();
+  return true;
+}
+
+std::optional<TaskGraphWorkQueue::PrioritizedTask>
+CategorizedWorkerPoolWorkStealing::StealTask(Worker* worker) {
+  const size_t num_workers = workers_.size();
+  for (size_t i = 1; i < num_workers; ++i) {
+    Worker* victim = workers_[(worker->index() + i) % num_workers].get();
+    if (!worker->IsPeer(*victim)) {
+      continue;
+    }
+
+    TaskGraphWorkQueue::PrioritizedTask::Vector stolen_tasks;
+    victim->StealTasks(&stolen_tasks);
+    if (stolen_tasks.empty()) {
+      continue;
+    }
+
+    // |stolen_tasks| is sorted. Run the first one and keep the rest.
+    for (size_t j = 1; j < stolen_tasks.size(); ++j) {
+      worker->PushTask(std::move(stolen_tasks[j]));
+    }
+    return std::move(stolen_tasks.front());
+  }
+  return std::nullopt;
+}
+
+bool CategorizedWorkerPoolWorkStealing::HasStealableTasksWithLockAcquired(
+    base::span<const TaskCategory> categories) {
+  lock_.AssertAcquired();
+
+  return base::ranges::any_of(
+      workers_, [categories](const std::unique_ptr<Worker>& worker) {
+        return worker->categories().data() == categories.data() &&
+               worker->HasTasks();
+      });
+}
+
+void CategorizedWorkerPoolWorkStealing::CompleteTasksWithLockAcquired(
+    TaskGraphWorkQueue::PrioritizedTask::Vector* completed_tasks) {
+  lock_.AssertAcquired();
+
+  if (completed_tasks->empty()) {
+    return;
+  }
+
+  for (auto& completed_task : *completed_tasks) {
+    auto* task_namespace = completed_task.task_namespace.get();
+    work_queue_.CompleteTask(std::move(completed_task));
+
+    // If namespace has finished running all tasks, wake up origin threads.
+    if (work_queue_.HasFinishedRunningTasksInNamespace(task_namespace)) {
+      has_namespaces_with_finished_running_tasks_cv_.Signal();
+    }
+  }
+  completed_tasks->clear();
+
+  // Dependents of the completed tasks may be ready to run now.
+  SignalHasReadyToRunTasksWithLockAcquired();
+}
+
+void CategorizedWorkerPoolWorkStealing::
+    SignalHasReadyToRunTasksWithLockAcquired() {
+  lock_.AssertAcquired();
+
+  for (TaskCategory category : kNormalThreadPriorityCategories) {
+    if (ShouldRunTaskForCategoryWithLockAcquired(category)) {
+      has_task_for_normal_priority_thread_cv_.Signal();
+      return;
+    }
+  }
+  if (HasStealableTasksWithLockAcquired(kNormalThreadPriorityCategories)) {
+    has_task_for_normal_priority_thread_cv_.Signal();
+    return;
+  }
+
+  // Due to the early returns above, this only runs when there are no tasks to
+  // run on normal priority threads.
+  for (TaskCategory category : kBackgroundThreadPriorityCategories) {
+    if (ShouldRunTaskForCategoryWithLockAcquired(category)) {
+      has_task_for_background_priority_thread_cv_.Signal();
+      return;
+    }
+  }
+}
+
 CategorizedWorkerPool* CategorizedWorkerPool::GetOrCreate(Delegate* delegate) {
   if (GetWorkerPool()) {
     return GetWorkerPool().get();
@@ -688,11 +1184,14 @@ CategorizedWorkerPool* CategorizedWorkerPool::GetOrCreate(Delegate* delegate) {
     CHECK_GT(num_raster_threads, 0);
   }
 
-  scoped_refptr<CategorizedWorkerPool> categorized_worker_pool =
-      base::FeatureList::IsEnabled(kUseCompositorJob)
-          ? scoped_refptr<CategorizedWorkerPool>(new CategorizedWorkerPoolJob())
-          : scoped_refptr<CategorizedWorkerPool>(
-                new CategorizedWorkerPoolImpl(delegate));
+  scoped_refptr<CategorizedWorkerPool> categorized_worker_pool;
+  if (base::FeatureList::IsEnabled(kUseWorkStealingCompositorWorkerPool)) {
+    categorized_worker_pool = new CategorizedWorkerPoolWorkStealing(delegate);
+  } else if (base::FeatureList::IsEnabled(kUseCompositorJob)) {
+    categorized_worker_pool = new CategorizedWorkerPoolJob();
+  } else {
+    categorized_worker_pool = new CategorizedWorkerPoolImpl(delegate);
+  }
   categorized_worker_pool->Start(num_raster_threads);
   GetWorkerPool() = std::move(categorized_worker_pool);
   return GetWorkerPool().get();
@@ -228,6 +228,89 @@ class CC_EXPORT CategorizedWorkerPoolJob : public CategorizedWorkerPool {
   base::JobHandle foreground_job_handle_;
 };
 
+// A CategorizedWorkerPool in which every worker thread owns a deque of ready to
+// run tasks. Workers refill their deque in batches from |work_queue_|, run tasks
+// from it without taking |lock_|, and steal from the deques of workers that run
+// the same categories once their own deque runs dry. Completed tasks are handed
+// back to |work_queue_| whenever |lock_| is uncontended, and in batches
+// otherwise. A task that sits in a worker deque counts as running as far as
+// |work_queue_| is concerned; ScheduleTasks() returns such tasks to
+// |work_queue_| before replacing the graph, so TaskGraphRunner semantics are
+// the same as for the other implementations.
+class CC_EXPORT CategorizedWorkerPoolWorkStealing
+    : public CategorizedWorkerPool {
+ public:
+  explicit CategorizedWorkerPoolWorkStealing(Delegate* delegate = nullptr);
+
+  void ThreadWillRun(base::PlatformThreadId tid);
+
+  // Overridden from base::TaskRunner:
+  bool PostDelayedTask(const base::Location& from_here,
+                       base::OnceClosure task,
+                       base::TimeDelta delay) override;
+
+  // Overridden from TaskGraphRunner:
+  void ScheduleTasks(NamespaceToken token, TaskGraph* graph) override;
+
+  // Overridden from CategorizedWorkerPool:
+  void FlushForTesting() override;
+  void Start(int max_concurrency_foreground) override;
+  void Shutdown() override;
+
+  // Per-thread state. Defined in the .cc file.
+  class Worker;
+
+  // Runs tasks for |worker| until Shutdown() is called.
+  void Run(Worker* worker);
+
+ private:
+  ~CategorizedWorkerPoolWorkStealing() override;
+
+  void ScheduleTasksWithLockAcquired(NamespaceToken token, TaskGraph* graph)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  // Moves a batch of ready to run tasks for |worker|'s categories from
+  // |work_queue_| to |worker|'s deque. Returns false if there was nothing to
+  // move.
+  bool RefillWithLockAcquired(Worker* worker) EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  // Steals tasks from a worker running the same categories as |worker|. Moves
+  // half of the victim's tasks to |worker|'s deque and returns the one with the
+  // highest priority.
+  std::optional<TaskGraphWorkQueue::PrioritizedTask> StealTask(Worker* worker);
+
+  // Returns true if a worker running |categories| holds a task that another
+  // worker could steal.
+  bool HasStealableTasksWithLockAcquired(
+      base::span<const TaskCategory> categories)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  // Hands |completed_tasks| back to |work_queue_| and clears the vector.
+  void CompleteTasksWithLockAcquired(
+      TaskGraphWorkQueue::PrioritizedTask::Vector* completed_tasks)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  // Helper function which signals worker threads if tasks are ready to run.
+  void SignalHasReadyToRunTasksWithLockAcquired()
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  const raw_ptr<Delegate> delegate_;
+
+  // One entry per thread, background thread last. Not modified after Start(),
+  // so workers can look each other up without holding |lock_|.
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // The actual threads where work is done.
+  std::vector<std::unique_ptr<base::SimpleThread>> threads_;
+
+  // Condition variables for foreground and background threads.
+  base::ConditionVariable has_task_for_normal_priority_thread_cv_;
+  base::ConditionVariable has_task_for_background_priority_thread_cv_;
+
+  // Set during shutdown. Tells Run() to return when no more tasks are pending.
+  bool shutdown_ GUARDED_BY(lock_) = false;
+};
+
 }  // namespace cc
 
 #endif  // CC_RASTER_CATEGORIZED_WORKER_POOL_H_
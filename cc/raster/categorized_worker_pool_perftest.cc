@@ -0,0 +1,161 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+#include "base/memory/scoped_refptr.h"
+#include "base/notreached.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "cc/raster/categorized_worker_pool.h"
+#include "cc/raster/task_category.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace cc {
+namespace {
+
+static const int kTimeLimitMillis = 2000;
+static const int kWarmupRuns = 5;
+static const int kTimeCheckInterval = 10;
+
+// Thread counts swept by the scaling tests.
+const int kNumThreads[] = {1, 2, 4, 8, 16};
+
+class PerfTaskImpl : public Task {
+ public:
+  typedef std::vector<scoped_refptr<PerfTaskImpl>> Vector;
+
+  explicit PerfTaskImpl(int work_iterations)
+      : work_iterations_(work_iterations) {}
+  PerfTaskImpl(const PerfTaskImpl&) = delete;
+  PerfTaskImpl& operator=(const PerfTaskImpl&) = delete;
+
+  // Overridden from Task:
+  void RunOnWorkerThread() override {
+    // Busy work standing in for rasterization, so that tasks overlap.
+    volatile int sum = 0;
+    for (int i = 0; i < work_iterations_; ++i) {
+      sum = sum + i;
+    }
+  }
+
+  void Reset() { state().Reset(); }
+
+ private:
+  ~PerfTaskImpl() override = default;
+
+  const int work_iterations_;
+};
+
+enum class PoolType { kImpl, kWorkStealing };
+
+class CategorizedWorkerPoolPerfTest : public testing::TestWithParam<PoolType> {
+ public:
+  CategorizedWorkerPoolPerfTest()
+      : timer_(kWarmupRuns,
+               base::Milliseconds(kTimeLimitMillis),
+               kTimeCheckInterval) {}
+
+  // Schedules a graph of |num_tasks| independent tasks, all of which a single
+  // top level task depends on, and waits for it to finish running. This is
+  // repeated for every entry in |kNumThreads|.
+  void RunScheduleAndExecuteTasksTest(const std::string& test_name,
+                                      int num_tasks,
+                                      int work_iterations) {
+    for (int num_threads : kNumThreads) {
+      scoped_refptr<CategorizedWorkerPool> worker_pool = CreateWorkerPool();
+      worker_pool->Start(num_threads);
+      NamespaceToken namespace_token = worker_pool->GenerateNamespaceToken();
+
+      PerfTaskImpl::Vector tasks;
+      for (int i = 0; i < num_tasks; ++i) {
+        tasks.push_back(base::MakeRefCounted<PerfTaskImpl>(work_iterations));
+      }
+      auto top_level_task = base::MakeRefCounted<PerfTaskImpl>(0);
+
+      // Avoid unnecessary heap allocations by reusing the same graph and
+      // completed tasks vector.
+      TaskGraph graph;
+      Task::Vector completed_tasks;
+
+      timer_.Reset();
+      do {
+        graph.Reset();
+        // Tasks run have finished state. Reset them to be considered as new
+        // for scheduling again.
+        for (auto& task : tasks) {
+          task->Reset();
+          graph.nodes.emplace_back(task, TASK_CATEGORY_FOREGROUND,
+                                   static_cast<uint16_t>(graph.nodes.size()),
+                                   0u);
+          graph.edges.emplace_back(task.get(), top_level_task.get());
+        }
+        top_level_task->Reset();
+        graph.nodes.emplace_back(top_level_task, TASK_CATEGORY_FOREGROUND, 0u,
+                                 static_cast<uint32_t>(tasks.size()));
+
+        worker_pool->ScheduleTasks(namespace_token, &graph);
+        worker_pool->WaitForTasksToFinishRunning(namespace_token);
+        worker_pool->CollectCompletedTasks(namespace_token, &completed_tasks);
+        completed_tasks.clear();
+        timer_.NextLap();
+      } while (!timer_.HasTimeLimitExpired());
+
+      worker_pool->Shutdown();
+
+      perf_test::PerfResultReporter reporter(
+          "", test_name + "_" + base::NumberToString(num_threads) + "_threads");
+      reporter.RegisterImportantMetric("execute_tasks" + TestModifierString(),
+                                       "runs/s");
+      reporter.AddResult("execute_tasks" + TestModifierString(),
+                         timer_.LapsPerSecond());
+    }
+  }
+
+ private:
+  scoped_refptr<CategorizedWorkerPool> CreateWorkerPool() const {
+    switch (GetParam()) {
+      case PoolType::kImpl:
+        return base::MakeRefCounted<CategorizedWorkerPoolImpl>();
+      case PoolType::kWorkStealing:
+        return base::MakeRefCounted<CategorizedWorkerPoolWorkStealing>();
+    }
+    NOTREACHED_NORETURN();
+  }
+
+  std::string TestModifierString() const {
+    switch (GetParam()) {
+      case PoolType::kImpl:
+        return "_categorized_worker_pool";
+      case PoolType::kWorkStealing:
+        return "_work_stealing_worker_pool";
+    }
+    NOTREACHED_NORETURN();
+  }
+
+  base::LapTimer timer_;
+};
+
+// Scheduling overhead dominates, which maximizes contention.
+TEST_P(CategorizedWorkerPoolPerfTest, ScheduleAndExecuteEmptyTasks) {
+  RunScheduleAndExecuteTasksTest("256_empty", 256, 0);
+}
+
+TEST_P(CategorizedWorkerPoolPerfTest, ScheduleAndExecuteTasks) {
+  RunScheduleAndExecuteTasksTest("256_short", 256, 1000);
+  RunScheduleAndExecuteTasksTest("64_long", 64, 100000);
+}
+
+INSTANTIATE_TEST_SUITE_P(All,
+                         CategorizedWorkerPoolPerfTest,
+                         testing::Values(PoolType::kImpl,
+                                         PoolType::kWorkStealing));
+
+}  // namespace
+}  // namespace cc
@@ -5,6 +5,7 @@
 #include "cc/raster/categorized_worker_pool.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/functional/callback.h"
 #include "base/task/sequenced_task_runner.h"
@@ -85,17 +86,28 @@ class CategorizedWorkerPoolTaskGraphRunnerTestDelegate {
       base::MakeRefCounted<T>();
 };
 
-class CategorizedWorkerPoolTest : public testing::TestWithParam<bool> {
+enum class PoolType { kImpl, kJob, kWorkStealing };
+
+class CategorizedWorkerPoolTest : public testing::TestWithParam<PoolType> {
  protected:
   CategorizedWorkerPoolTest() = default;
   ~CategorizedWorkerPoolTest() override = default;
 
   void SetUp() override {
-    categorized_worker_pool_ =
-        GetParam() ? scoped_refptr<CategorizedWorkerPool>(
-                         base::MakeRefCounted<CategorizedWorkerPoolImpl>())
-                   : scoped_refptr<CategorizedWorkerPool>(
-                         base::MakeRefCounted<CategorizedWorkerPoolJob>());
+    switch (GetParam()) {
+      case PoolType::kImpl:
+        categorized_worker_pool_ =
+            base::MakeRefCounted<CategorizedWorkerPoolImpl>();
+        break;
+      case PoolType::kJob:
+        categorized_worker_pool_ =
+            base::MakeRefCounted<CategorizedWorkerPoolJob>();
+        break;
+      case PoolType::kWorkStealing:
+        categorized_worker_pool_ =
+            base::MakeRefCounted<CategorizedWorkerPoolWorkStealing>();
+        break;
+    }
     categorized_worker_pool_->Start(kNumThreads);
     namespace_token_ = categorized_worker_pool_->GenerateNamespaceToken();
   }
@@ -182,9 +194,48 @@ TEST_P(CategorizedWorkerPoolTest,
   categorized_worker_pool_->FlushForTesting();
 }
 
+// Verify that every task runs exactly once when graphs are replaced while
+// tasks are queued, and that tasks dropped from the graph are canceled instead.
+TEST_P(CategorizedWorkerPoolTest, RescheduleRunsOrCancelsEveryTaskOnce) {
+  constexpr size_t kNumTasks = 500;
+  std::vector<scoped_refptr<Task>> tasks;
+  std::vector<int> run_counts(kNumTasks, 0);
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    tasks.push_back(base::MakeRefCounted<ClosureTask>(
+        base::BindLambdaForTesting([&run_counts, i]() { ++run_counts[i]; })));
+  }
+
+  // Each graph keeps every other task of the previous one, so queued tasks
+  // keep getting rescheduled or canceled while workers run the rest.
+  for (size_t stride = 1; stride <= 16; stride *= 2) {
+    TaskGraph graph;
+    for (size_t i = 0; i < kNumTasks; i += stride) {
+      if (tasks[i]->state().IsCanceled()) {
+        continue;
+      }
+      graph.nodes.push_back(TaskGraph::Node(tasks[i], TASK_CATEGORY_FOREGROUND,
+                                            /* priority=*/0u,
+                                            /* dependencies=*/0u));
+    }
+    categorized_worker_pool_->ScheduleTasks(namespace_token_, &graph);
+  }
+  categorized_worker_pool_->WaitForTasksToFinishRunning(namespace_token_);
+
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    if (tasks[i]->state().IsFinished()) {
+      EXPECT_EQ(1, run_counts[i]);
+    } else {
+      EXPECT_TRUE(tasks[i]->state().IsCanceled());
+      EXPECT_EQ(0, run_counts[i]);
+    }
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(All,
                          CategorizedWorkerPoolTest,
-                         testing::Values(false, true));
+                         testing::Values(PoolType::kImpl,
+                                         PoolType::kJob,
+                                         PoolType::kWorkStealing));
 
 }  // namespace cc
 
@@ -202,6 +253,11 @@ INSTANTIATE_TYPED_TEST_SUITE_P(
     TaskRunnerTest,
     cc::CategorizedWorkerPoolTestDelegate<cc::CategorizedWorkerPoolJob>);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(CategorizedWorkerPoolWorkStealing,
+                               TaskRunnerTest,
+                               cc::CategorizedWorkerPoolTestDelegate<
+                                   cc::CategorizedWorkerPoolWorkStealing>);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(CategorizedWorkerPoolImpl,
                                SequencedTaskRunnerTest,
                                cc::CategorizedWorkerPoolSequencedTestDelegate<
@@ -210,6 +266,10 @@ INSTANTIATE_TYPED_TEST_SUITE_P(CategorizedWorkerPoolJob,
                                SequencedTaskRunnerTest,
                                cc::CategorizedWorkerPoolSequencedTestDelegate<
                                    cc::CategorizedWorkerPoolJob>);
+INSTANTIATE_TYPED_TEST_SUITE_P(CategorizedWorkerPoolWorkStealing,
+                               SequencedTaskRunnerTest,
+                               cc::CategorizedWorkerPoolSequencedTestDelegate<
+                                   cc::CategorizedWorkerPoolWorkStealing>);
 
 }  // namespace base
 
@@ -257,6 +317,26 @@ INSTANTIATE_TYPED_TEST_SUITE_P(
     CategorizedWorkerPoolJob_1_5_Threads,
     TaskGraphRunnerTest,
     CategorizedWorkerPoolJobTaskGraphRunnerTestDelegate_1_5);
+using CategorizedWorkerPoolWorkStealingTaskGraphRunnerTestDelegate_1_5 =
+    ::testing::Types<CategorizedWorkerPoolTaskGraphRunnerTestDelegate<
+                         CategorizedWorkerPoolWorkStealing,
+                         1>,
+                     CategorizedWorkerPoolTaskGraphRunnerTestDelegate<
+                         CategorizedWorkerPoolWorkStealing,
+                         2>,
+                     CategorizedWorkerPoolTaskGraphRunnerTestDelegate<
+                         CategorizedWorkerPoolWorkStealing,
+                         3>,
+                     CategorizedWorkerPoolTaskGraphRunnerTestDelegate<
+                         CategorizedWorkerPoolWorkStealing,
+                         4>,
+                     CategorizedWorkerPoolTaskGraphRunnerTestDelegate<
+                         CategorizedWorkerPoolWorkStealing,
+                         5>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(
+    CategorizedWorkerPoolWorkStealing_1_5_Threads,
+    TaskGraphRunnerTest,
+    CategorizedWorkerPoolWorkStealingTaskGraphRunnerTestDelegate_1_5);
 
 // Single threaded tests.
 using CategorizedWorkerPoolImplTaskGraphRunnerTestDelegate =
@@ -273,5 +353,13 @@ INSTANTIATE_TYPED_TEST_SUITE_P(
     CategorizedWorkerPoolJob,
     SingleThreadTaskGraphRunnerTest,
     CategorizedWorkerPoolJobTaskGraphRunnerTestDelegate);
+using CategorizedWorkerPoolWorkStealingTaskGraphRunnerTestDelegate =
+    CategorizedWorkerPoolTaskGraphRunnerTestDelegate<
+        CategorizedWorkerPoolWorkStealing,
+        1>;
+INSTANTIATE_TYPED_TEST_SUITE_P(
+    CategorizedWorkerPoolWorkStealing,
+    SingleThreadTaskGraphRunnerTest,
+    CategorizedWorkerPoolWorkStealingTaskGraphRunnerTestDelegate);
 
 }  // namespace cc
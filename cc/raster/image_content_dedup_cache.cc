@@ -0,0 +1,101 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/raster/image_content_dedup_cache.h"
+
+#include <tuple>
+
+#include "base/containers/span.h"
+#include "cc/paint/paint_image_generator.h"
+#include "third_party/skia/include/core/SkData.h"
+
+namespace cc {
+
+bool ImageContentDedupCache::ContentKey::operator<(
+    const ContentKey& other) const {
+  return std::tie(digest, width, height, color_type, alpha_type) <
+         std::tie(other.digest, other.width, other.height, other.color_type,
+                  other.alpha_type);
+}
+
+ImageContentDedupCache::ImageContentDedupCache(size_t max_entries)
+    : content_id_to_key_(max_entries), canonical_images_(max_entries) {}
+
+ImageContentDedupCache::~ImageContentDedupCache() = default;
+
+// static
+bool ImageContentDedupCache::IsEligible(const PaintImage& image) {
+  // Only images decoded from encoded data can be keyed on that data. Partially
+  // loaded images get a new content id every time more data arrives, so
+  // hashing them would mostly be wasted work.
+  return image.paint_image_generator_ &&
+         image.completion_state() == PaintImage::CompletionState::kDone;
+}
+
+PaintImage ImageContentDedupCache::GetCanonicalImage(const PaintImage& image,
+                                                     Result* result) {
+  *result = Result::kNone;
+  if (!IsEligible(image)) {
+    return image;
+  }
+
+  const PaintImage::ContentId content_id =
+      image.GetContentIdForFrame(PaintImage::kDefaultFrameIndex);
+  {
+    base::AutoLock hold(lock_);
+    auto key_it = content_id_to_key_.Get(content_id);
+    if (key_it != content_id_to_key_.end()) {
+      auto image_it = canonical_images_.Get(key_it->second);
+      if (image_it != canonical_images_.end()) {
+        return image_it->second;
+      }
+
+      // The canonical image was evicted, this image takes its place.
+      ContentKey key = key_it->second;
+      canonical_images_.Put(std::move(key), PaintImage(image));
+      *result = Result::kMiss;
+      return image;
+    }
+  }
+
+  // Hash the encoded data without holding the lock, since it can be large.
+  sk_sp<SkData> encoded_data = image.paint_image_generator_->GetEncodedData();
+  if (!encoded_data || encoded_data->isEmpty()) {
+    return image;
+  }
+  const SkImageInfo info = image.GetSkImageInfo();
+  ContentKey key = {base::SHA1HashSpan(base::make_span(encoded_data->bytes(),
+                                                       encoded_data->size())),
+                    info.width(), info.height(), info.colorType(),
+                    info.alphaType()};
+
+  base::AutoLock hold(lock_);
+  content_id_to_key_.Put(PaintImage::ContentId(content_id), ContentKey(key));
+  auto image_it = canonical_images_.Get(key);
+  if (image_it == canonical_images_.end()) {
+    canonical_images_.Put(std::move(key), PaintImage(image));
+    *result = Result::kMiss;
+    return image;
+  }
+
+  // Another thread may have registered this same image while the lock was
+  // released, which must not be counted as a hit.
+  if (image_it->second.stable_id() != image.stable_id()) {
+    *result = Result::kHit;
+  }
+  return image_it->second;
+}
+
+void ImageContentDedupCache::Clear() {
+  base::AutoLock hold(lock_);
+  content_id_to_key_.Clear();
+  canonical_images_.Clear();
+}
+
+size_t ImageContentDedupCache::GetCanonicalImageCountForTesting() const {
+  base::AutoLock hold(lock_);
+  return canonical_images_.size();
+}
+
+}  // namespace cc
@@ -0,0 +1,88 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CC_RASTER_IMAGE_CONTENT_DEDUP_CACHE_H_
+#define CC_RASTER_IMAGE_CONTENT_DEDUP_CACHE_H_
+
+#include <stddef.h>
+
+#include "base/containers/lru_cache.h"
+#include "base/hash/sha1.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "cc/cc_export.h"
+#include "cc/paint/paint_image.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+
+namespace cc {
+
+// ImageContentDedupCache maps lazy generated PaintImages that are backed by
+// byte-identical encoded data onto a single canonical PaintImage. Pages often
+// reference the same resource through several PaintImages (for instance the
+// same sprite loaded from different urls), and since the ImageDecodeCache keys
+// decodes by PaintImage, each of them would otherwise be decoded and budgeted
+// separately. Substituting the canonical image before going to the decode
+// cache makes all of them share one DecodedDrawImage for any given target
+// scale and color params.
+//
+// This class is thread-safe and is meant to be shared by all raster workers.
+class CC_EXPORT ImageContentDedupCache {
+ public:
+  // The outcome of a GetCanonicalImage() call, which the caller can use for
+  // metrics.
+  enum class Result {
+    // The image is not eligible for deduplication, or its content has already
+    // been seen and accounted for.
+    kNone,
+    // The image's content was seen for the first time and the image is now the
+    // canonical image for it.
+    kMiss,
+    // The image's content matches the content of another image, which is
+    // returned in its place.
+    kHit,
+  };
+
+  static constexpr size_t kDefaultMaxEntries = 256;
+
+  explicit ImageContentDedupCache(size_t max_entries = kDefaultMaxEntries);
+  ImageContentDedupCache(const ImageContentDedupCache&) = delete;
+  ~ImageContentDedupCache();
+
+  ImageContentDedupCache& operator=(const ImageContentDedupCache&) = delete;
+
+  // Returns the PaintImage that should be decoded in place of |image|. This is
+  // |image| itself unless a different image with the same encoded data and
+  // image info was seen earlier. The encoded data is hashed only the first
+  // time a given content id is seen.
+  PaintImage GetCanonicalImage(const PaintImage& image, Result* result);
+
+  // Drops all state, for instance under memory pressure.
+  void Clear();
+
+  size_t GetCanonicalImageCountForTesting() const;
+
+ private:
+  // Identifies the content of an image. The image info is included so that
+  // images are only deduplicated if they decode to the same pixels.
+  struct ContentKey {
+    bool operator<(const ContentKey& other) const;
+
+    base::SHA1Digest digest;
+    int width;
+    int height;
+    SkColorType color_type;
+    SkAlphaType alpha_type;
+  };
+
+  static bool IsEligible(const PaintImage& image);
+
+  mutable base::Lock lock_;
+  base::LRUCache<PaintImage::ContentId, ContentKey> content_id_to_key_
+      GUARDED_BY(lock_);
+  base::LRUCache<ContentKey, PaintImage> canonical_images_ GUARDED_BY(lock_);
+};
+
+}  // namespace cc
+
+#endif  // CC_RASTER_IMAGE_CONTENT_DEDUP_CACHE_H_
@@ -0,0 +1,115 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/raster/image_content_dedup_cache.h"
+
+#include <utility>
+
+#include "cc/paint/paint_image_builder.h"
+#include "cc/test/fake_paint_image_generator.h"
+#include "cc/test/skia_common.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "ui/gfx/geometry/size.h"
+
+namespace cc {
+namespace {
+
+sk_sp<SkData> CreateEncodedData(const char* content) {
+  return SkData::MakeWithCString(content);
+}
+
+PaintImage CreateEncodedImage(sk_sp<SkData> encoded_data,
+                              const gfx::Size& size = gfx::Size(10, 10)) {
+  auto generator = sk_make_sp<FakePaintImageGenerator>(
+      SkImageInfo::MakeN32Premul(size.width(), size.height()));
+  generator->SetEncodedData(std::move(encoded_data));
+  return PaintImageBuilder::WithDefault()
+      .set_id(PaintImage::GetNextId())
+      .set_paint_image_generator(std::move(generator))
+      .TakePaintImage();
+}
+
+TEST(ImageContentDedupCacheTest, DedupsIdenticalContent) {
+  ImageContentDedupCache cache;
+  PaintImage first = CreateEncodedImage(CreateEncodedData("image"));
+  PaintImage second = CreateEncodedImage(CreateEncodedData("image"));
+
+  ImageContentDedupCache::Result result;
+  EXPECT_EQ(cache.GetCanonicalImage(first, &result).stable_id(),
+            first.stable_id());
+  EXPECT_EQ(result, ImageContentDedupCache::Result::kMiss);
+
+  EXPECT_EQ(cache.GetCanonicalImage(second, &result).stable_id(),
+            first.stable_id());
+  EXPECT_EQ(result, ImageContentDedupCache::Result::kHit);
+
+  // Lookups for content that has already been accounted for don't count again.
+  EXPECT_EQ(cache.GetCanonicalImage(second, &result).stable_id(),
+            first.stable_id());
+  EXPECT_EQ(result, ImageContentDedupCache::Result::kNone);
+  EXPECT_EQ(cache.GetCanonicalImage(first, &result).stable_id(),
+            first.stable_id());
+  EXPECT_EQ(result, ImageContentDedupCache::Result::kNone);
+  EXPECT_EQ(cache.GetCanonicalImageCountForTesting(), 1u);
+}
+
+TEST(ImageContentDedupCacheTest, KeepsDistinctContentApart) {
+  ImageContentDedupCache cache;
+  PaintImage first = CreateEncodedImage(CreateEncodedData("first"));
+  PaintImage second = CreateEncodedImage(CreateEncodedData("second"));
+  // Same encoded data, but not the same decoded dimensions.
+  PaintImage third =
+      CreateEncodedImage(CreateEncodedData("first"), gfx::Size(20, 20));
+
+  ImageContentDedupCache::Result result;
+  for (const PaintImage& image : {first, second, third}) {
+    EXPECT_EQ(cache.GetCanonicalImage(image, &result).stable_id(),
+              image.stable_id());
+    EXPECT_EQ(result, ImageContentDedupCache::Result::kMiss);
+  }
+  EXPECT_EQ(cache.GetCanonicalImageCountForTesting(), 3u);
+}
+
+TEST(ImageContentDedupCacheTest, IgnoresIneligibleImages) {
+  ImageContentDedupCache cache;
+  PaintImage bitmap_image = CreateBitmapImage(gfx::Size(10, 10));
+  // FakePaintImageGenerator provides no encoded data by default.
+  PaintImage no_data_image = CreateDiscardablePaintImage(gfx::Size(10, 10));
+  PaintImage partial_image =
+      PaintImageBuilder::WithCopy(CreateEncodedImage(CreateEncodedData("image")))
+          .set_completion_state(PaintImage::CompletionState::kPartiallyDone)
+          .TakePaintImage();
+
+  ImageContentDedupCache::Result result;
+  for (const PaintImage& image : {bitmap_image, no_data_image, partial_image}) {
+    EXPECT_EQ(cache.GetCanonicalImage(image, &result).stable_id(),
+              image.stable_id());
+    EXPECT_EQ(result, ImageContentDedupCache::Result::kNone);
+  }
+  EXPECT_EQ(cache.GetCanonicalImageCountForTesting(), 0u);
+}
+
+TEST(ImageContentDedupCacheTest, ReplacesEvictedCanonicalImage) {
+  ImageContentDedupCache cache(1u);
+  PaintImage first = CreateEncodedImage(CreateEncodedData("first"));
+  PaintImage second = CreateEncodedImage(CreateEncodedData("second"));
+  PaintImage first_copy = CreateEncodedImage(CreateEncodedData("first"));
+
+  ImageContentDedupCache::Result result;
+  cache.GetCanonicalImage(first, &result);
+  cache.GetCanonicalImage(second, &result);
+  EXPECT_EQ(cache.GetCanonicalImageCountForTesting(), 1u);
+
+  // |first| was evicted, so its content is registered again.
+  EXPECT_EQ(cache.GetCanonicalImage(first_copy, &result).stable_id(),
+            first_copy.stable_id());
+  EXPECT_EQ(result, ImageContentDedupCache::Result::kMiss);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetCanonicalImageCountForTesting(), 0u);
+}
+
+}  // namespace
+}  // namespace cc
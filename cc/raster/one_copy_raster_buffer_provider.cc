@@ -349,7 +349,11 @@ bool OneCopyRasterBufferProvider::PlaybackToStagingBuffer(
     }
   }
 
-  auto mapping = staging_buffer->client_shared_image->Map();
+  std::unique_ptr<gpu::ClientSharedImage::ScopedMapping> mapping =
+      std::move(staging_buffer->persistent_mapping);
+  if (!mapping) {
+    mapping = staging_buffer->client_shared_image->Map();
+  }
   if (!mapping) {
     LOG(ERROR) << "MapSharedImage Failed.";
     return false;
@@ -365,6 +369,13 @@ bool OneCopyRasterBufferProvider::PlaybackToStagingBuffer(
 
   staging_buffer->content_id = new_content_id;
 
+  // Staging ring buffers are only reused once the GPU is done with them, so
+  // shared memory can stay mapped while the copy is pending. GPU native
+  // buffers are unmapped as usual.
+  if (staging_buffer->ring_index && staging_buffer->is_shared_memory) {
+    staging_buffer->persistent_mapping = std::move(mapping);
+  }
+
   return true;
 }
 
@@ -4,8 +4,13 @@
 
 #include "cc/raster/playback_image_provider.h"
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 #include "base/functional/bind.h"
+#include "base/numerics/safe_conversions.h"
+#include "cc/base/histograms.h"
+#include "cc/raster/image_content_dedup_cache.h"
 #include "cc/tiles/image_decode_cache.h"
 #include "gpu/command_buffer/common/mailbox.h"
 
@@ -17,6 +22,20 @@ void UnrefImageFromCache(DrawImage draw_image,
   cache->DrawWithImageFinished(draw_image, decoded_draw_image);
 }
 
+// Estimates the size of the decode of |draw_image| at its raster scale, which
+// is the memory saved by sharing it with another image.
+size_t EstimateDecodedSize(const DrawImage& draw_image) {
+  const SkImageInfo info = draw_image.paint_image().GetSkImageInfo();
+  const float scale = std::clamp(
+      std::max(draw_image.scale().width(), draw_image.scale().height()), 0.f,
+      1.f);
+  const int width =
+      std::max(1, static_cast<int>(std::ceil(info.width() * scale)));
+  const int height =
+      std::max(1, static_cast<int>(std::ceil(info.height() * scale)));
+  return info.makeWH(width, height).computeMinByteSize();
+}
+
 }  // namespace
 
 PlaybackImageProvider::PlaybackImageProvider(
@@ -29,13 +48,34 @@ PlaybackImageProvider::PlaybackImageProvider(
   DCHECK(cache_);
 }
 
-PlaybackImageProvider::~PlaybackImageProvider() = default;
+PlaybackImageProvider::~PlaybackImageProvider() {
+  ReportContentDedupMetrics();
+}
 
-PlaybackImageProvider::PlaybackImageProvider(PlaybackImageProvider&& other) =
-    default;
+PlaybackImageProvider::PlaybackImageProvider(PlaybackImageProvider&& other)
+    : cache_(std::move(other.cache_)),
+      target_color_params_(std::move(other.target_color_params_)),
+      settings_(std::move(other.settings_)),
+      content_dedup_hits_(std::exchange(other.content_dedup_hits_, 0)),
+      content_dedup_misses_(std::exchange(other.content_dedup_misses_, 0)),
+      content_dedup_bytes_saved_(
+          std::exchange(other.content_dedup_bytes_saved_, 0u)) {}
 
 PlaybackImageProvider& PlaybackImageProvider::operator=(
-    PlaybackImageProvider&& other) = default;
+    PlaybackImageProvider&& other) {
+  if (this == &other) {
+    return *this;
+  }
+  ReportContentDedupMetrics();
+  cache_ = std::move(other.cache_);
+  target_color_params_ = std::move(other.target_color_params_);
+  settings_ = std::move(other.settings_);
+  content_dedup_hits_ = std::exchange(other.content_dedup_hits_, 0);
+  content_dedup_misses_ = std::exchange(other.content_dedup_misses_, 0);
+  content_dedup_bytes_saved_ =
+      std::exchange(other.content_dedup_bytes_saved_, 0u);
+  return *this;
+}
 
 ImageProvider::ScopedResult PlaybackImageProvider::GetRasterContent(
     const DrawImage& draw_image) {
@@ -57,7 +97,8 @@ ImageProvider::ScopedResult PlaybackImageProvider::GetRasterContent(
                            ? PaintImage::kDefaultFrameIndex
                            : it->second;
 
-  DrawImage adjusted_image(draw_image, 1.f, frame_index, target_color_params_);
+  DrawImage adjusted_image(GetDedupedDrawImage(draw_image), 1.f, frame_index,
+                           target_color_params_);
   if (!cache_->UseCacheForDrawImage(adjusted_image)) {
     if (settings_->raster_mode == RasterMode::kOop) {
       return ScopedResult(DecodedDrawImage(paint_image.GetMailbox(),
@@ -82,6 +123,61 @@ ImageProvider::ScopedResult PlaybackImageProvider::GetRasterContent(
                      decoded_draw_image));
 }
 
+DrawImage PlaybackImageProvider::GetDedupedDrawImage(
+    const DrawImage& draw_image) {
+  if (!settings_->content_dedup_cache) {
+    return draw_image;
+  }
+
+  ImageContentDedupCache::Result result;
+  PaintImage canonical_image =
+      settings_->content_dedup_cache->GetCanonicalImage(
+          draw_image.paint_image(), &result);
+  switch (result) {
+    case ImageContentDedupCache::Result::kNone:
+      break;
+    case ImageContentDedupCache::Result::kMiss:
+      content_dedup_misses_++;
+      break;
+    case ImageContentDedupCache::Result::kHit:
+      content_dedup_hits_++;
+      content_dedup_bytes_saved_ += EstimateDecodedSize(draw_image);
+      break;
+  }
+
+  if (canonical_image.stable_id() == draw_image.paint_image().stable_id()) {
+    return draw_image;
+  }
+  return DrawImage(draw_image, std::move(canonical_image));
+}
+
+void PlaybackImageProvider::ReportContentDedupMetrics() {
+  if (!content_dedup_hits_ && !content_dedup_misses_) {
+    return;
+  }
+
+  // It is safe to use the UMA macros here with runtime generated strings
+  // because the client name should be initialized once in the process, before
+  // recording any metrics here.
+  const char* client_name = GetClientNameForMetrics();
+  if (client_name) {
+    UMA_HISTOGRAM_COUNTS_1000(
+        base::StringPrintf("Renderer4.%s.ImageContentDedup.Hits", client_name),
+        content_dedup_hits_);
+    UMA_HISTOGRAM_COUNTS_1000(
+        base::StringPrintf("Renderer4.%s.ImageContentDedup.Misses",
+                           client_name),
+        content_dedup_misses_);
+    UMA_HISTOGRAM_MEMORY_KB(
+        base::StringPrintf("Renderer4.%s.ImageContentDedup.BytesSavedKb",
+                           client_name),
+        base::saturated_cast<int>(content_dedup_bytes_saved_ / 1024));
+  }
+  content_dedup_hits_ = 0;
+  content_dedup_misses_ = 0;
+  content_dedup_bytes_saved_ = 0u;
+}
+
 PlaybackImageProvider::Settings::Settings() = default;
 PlaybackImageProvider::Settings::Settings(PlaybackImageProvider::Settings&&) =
     default;
@@ -14,6 +14,7 @@
 #include "ui/gfx/color_space.h"
 
 namespace cc {
+class ImageContentDedupCache;
 class ImageDecodeCache;
 
 // PlaybackImageProvider is used to replace lazy generated PaintImages with
@@ -39,6 +40,11 @@ class CC_EXPORT PlaybackImageProvider : public ImageProvider {
 
     // Indicates the raster backend that will be consuming the decoded images.
     RasterMode raster_mode = RasterMode::kSoftware;
+
+    // If provided, lazy generated images with identical encoded data are
+    // decoded through a single canonical PaintImage. Must outlive the
+    // provider.
+    raw_ptr<ImageContentDedupCache> content_dedup_cache = nullptr;
   };
 
   // If no settings are provided, all images are skipped during rasterization.
@@ -57,9 +63,19 @@ class CC_EXPORT PlaybackImageProvider : public ImageProvider {
       const DrawImage& draw_image) override;
 
  private:
+  // Returns the image to decode for |draw_image|, after deduplicating its
+  // content with |settings_->content_dedup_cache|.
+  DrawImage GetDedupedDrawImage(const DrawImage& draw_image);
+  void ReportContentDedupMetrics();
+
   raw_ptr<ImageDecodeCache, DanglingUntriaged> cache_;
   TargetColorParams target_color_params_;
   std::optional<Settings> settings_;
+
+  // Content deduplication stats, reported when the provider is destroyed.
+  int content_dedup_hits_ = 0;
+  int content_dedup_misses_ = 0;
+  size_t content_dedup_bytes_saved_ = 0u;
 };
 
 }  // namespace cc
@@ -8,10 +8,13 @@
 #include <vector>
 
 #include "cc/paint/paint_image_builder.h"
+#include "cc/raster/image_content_dedup_cache.h"
+#include "cc/test/fake_paint_image_generator.h"
 #include "cc/test/skia_common.h"
 #include "cc/test/stub_decode_cache.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkM44.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -204,5 +207,46 @@ TEST(PlaybackImageProviderTest, IgnoresImagesNotSupportedByCache) {
   EXPECT_EQ(cache.refed_image_count(), 0);
 }
 
+TEST(PlaybackImageProviderTest, DedupsImagesWithIdenticalContent) {
+  MockDecodeCache cache;
+  ImageContentDedupCache dedup_cache;
+  std::optional<PlaybackImageProvider::Settings> settings;
+  settings.emplace();
+  settings->content_dedup_cache = &dedup_cache;
+  PlaybackImageProvider provider(&cache, TargetColorParams(),
+                                 std::move(settings));
+
+  auto create_image = [](const char* content) {
+    auto generator = sk_make_sp<FakePaintImageGenerator>(
+        SkImageInfo::MakeN32Premul(10, 10));
+    generator->SetEncodedData(SkData::MakeWithCString(content));
+    return PaintImageBuilder::WithDefault()
+        .set_id(PaintImage::GetNextId())
+        .set_paint_image_generator(std::move(generator))
+        .TakePaintImage();
+  };
+  PaintImage first = create_image("image");
+  PaintImage second = create_image("image");
+  PaintImage other = create_image("other");
+
+  SkIRect rect = SkIRect::MakeWH(10, 10);
+  SkM44 matrix = SkM44::Scale(0.5f, 0.5f);
+  for (const PaintImage& image : {first, second}) {
+    auto decode = provider.GetRasterContent(DrawImage(
+        image, false, rect, PaintFlags::FilterQuality::kMedium, matrix));
+    EXPECT_TRUE(decode);
+    ASSERT_TRUE(cache.last_image().paint_image());
+    EXPECT_EQ(cache.last_image().paint_image().stable_id(), first.stable_id());
+    // Everything except the image itself is preserved.
+    EXPECT_EQ(cache.last_image().scale(), SkSize::Make(0.5f, 0.5f));
+    EXPECT_EQ(cache.last_image().src_rect(), rect);
+  }
+
+  provider.GetRasterContent(DrawImage(
+      other, false, rect, PaintFlags::FilterQuality::kMedium, matrix));
+  EXPECT_EQ(cache.last_image().paint_image().stable_id(), other.stable_id());
+  EXPECT_EQ(cache.images_decoded(), 3);
+}
+
 }  // namespace
 }  // namespace cc
@@ -4,6 +4,7 @@
 
 #include "cc/raster/staging_buffer_pool.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -16,6 +17,7 @@
 #include "base/task/single_thread_task_runner.h"
 #include "base/trace_event/memory_dump_manager.h"
 #include "cc/base/container_util.h"
+#include "cc/base/features.h"
 #include "components/viz/common/gpu/raster_context_provider.h"
 #include "components/viz/common/resources/resource_sizes.h"
 #include "gpu/command_buffer/client/context_support.h"
@@ -41,6 +43,10 @@ const int kMaxCheckForQueryResultAvailableAttempts = 256;
 // Delay before a staging buffer might be released.
 const int kStagingBufferExpirationDelayMs = 1000;
 
+// Maximum number of buffers in the staging ring. The ring never uses more than
+// half of the staging buffer budget, the rest is left to pooled buffers.
+const size_t kMaxStagingRingBuffers = 16;
+
 bool CheckForQueryResult(gpu::raster::RasterInterface* ri, GLuint query_id) {
   DCHECK(query_id);
   GLuint complete = 1;
@@ -76,6 +82,7 @@ StagingBuffer::StagingBuffer(const gfx::Size& size,
     : size(size), format(format) {}
 
 StagingBuffer::~StagingBuffer() {
+  DCHECK(!persistent_mapping);
   DCHECK(!client_shared_image);
   DCHECK_EQ(query_id, 0u);
 }
@@ -86,6 +93,7 @@ void StagingBuffer::DestroyGLResources(gpu::raster::RasterInterface* ri,
     ri->DeleteQueriesEXT(1, &query_id);
     query_id = 0;
   }
+  persistent_mapping.reset();
   if (client_shared_image) {
     sii->DestroySharedImage(sync_token, std::move(client_shared_image));
   }
@@ -106,6 +114,8 @@ StagingBufferPool::StagingBufferPool(
     : task_runner_(std::move(task_runner)),
       worker_context_provider_(worker_context_provider),
       use_partial_raster_(use_partial_raster),
+      use_staging_ring_(
+          base::FeatureList::IsEnabled(features::kOneCopyStagingRing)),
       max_staging_buffer_usage_in_bytes_(max_staging_buffer_usage_in_bytes),
       staging_buffer_usage_in_bytes_(0),
       free_staging_buffer_usage_in_bytes_(0),
@@ -133,12 +143,13 @@ StagingBufferPool::~StagingBufferPool() {
 void StagingBufferPool::Shutdown() {
   base::AutoLock lock(lock_);
 
-  if (buffers_.empty())
+  if (buffers_.empty() && ring_buffers_.empty())
     return;
 
   ReleaseBuffersNotUsedSince(base::TimeTicks() + base::TimeDelta::Max());
   DCHECK_EQ(staging_buffer_usage_in_bytes_, 0);
   DCHECK_EQ(free_staging_buffer_usage_in_bytes_, 0);
+  DCHECK(ring_buffers_.empty());
 }
 
 void StagingBufferPool::ReleaseStagingBuffer(
@@ -146,7 +157,15 @@ void StagingBufferPool::ReleaseStagingBuffer(
   base::AutoLock lock(lock_);
 
   staging_buffer->last_usage = base::TimeTicks::Now();
-  busy_buffers_.push_back(std::move(staging_buffer));
+  if (staging_buffer->ring_index) {
+    ring_last_usage_ = staging_buffer->last_usage;
+    size_t index = *staging_buffer->ring_index;
+    DCHECK_LT(index, ring_buffers_.size());
+    DCHECK(!ring_buffers_[index]);
+    ring_buffers_[index] = std::move(staging_buffer);
+  } else {
+    busy_buffers_.push_back(std::move(staging_buffer));
+  }
 
   ScheduleReduceMemoryUsage();
 }
@@ -156,12 +175,24 @@ bool StagingBufferPool::OnMemoryDump(
     base::trace_event::ProcessMemoryDump* pmd) {
   base::AutoLock lock(lock_);
 
+  int ring_usage_in_bytes = 0;
+  int ring_occupied_usage_in_bytes = 0;
+  GetRingUsage(&ring_usage_in_bytes, &ring_occupied_usage_in_bytes);
+  if (use_staging_ring_) {
+    MemoryAllocatorDump* ring_dump =
+        pmd->CreateAllocatorDump("cc/one_copy/staging_ring");
+    ring_dump->AddScalar(MemoryAllocatorDump::kNameSize,
+                         MemoryAllocatorDump::kUnitsBytes, ring_usage_in_bytes);
+    ring_dump->AddScalar("occupied_size", MemoryAllocatorDump::kUnitsBytes,
+                         ring_occupied_usage_in_bytes);
+  }
+
   if (args.level_of_detail == MemoryDumpLevelOfDetail::kBackground) {
     std::string dump_name("cc/one_copy/staging_memory");
     MemoryAllocatorDump* dump = pmd->CreateAllocatorDump(dump_name);
     dump->AddScalar(MemoryAllocatorDump::kNameSize,
                     MemoryAllocatorDump::kUnitsBytes,
-                    staging_buffer_usage_in_bytes_);
+                    staging_buffer_usage_in_bytes_ + ring_usage_in_bytes);
   } else {
     for (const StagingBuffer* buffer : buffers_) {
       buffer->OnMemoryDump(
@@ -222,6 +253,12 @@ std::unique_ptr<StagingBuffer> StagingBufferPool::AcquireStagingBuffer(
       worker_context_provider_->SharedImageInterface();
   DCHECK(ri);
 
+  if (use_staging_ring_ && !(use_partial_raster_ && previous_content_id)) {
+    staging_buffer = AcquireRingBuffer(size, format, ri, sii);
+    if (staging_buffer)
+      return staging_buffer;
+  }
+
   // Check if any busy buffers have become available.
   while (!busy_buffers_.empty()) {
     // Early out if query isn't used, or if query isn't complete yet.  Query is
@@ -301,14 +338,117 @@ std::unique_ptr<StagingBuffer> StagingBufferPool::AcquireStagingBuffer(
   return staging_buffer;
 }
 
+std::unique_ptr<StagingBuffer> StagingBufferPool::AcquireRingBuffer(
+    const gfx::Size& size,
+    viz::SharedImageFormat format,
+    gpu::raster::RasterInterface* ri,
+    gpu::SharedImageInterface* sii) {
+  // Smaller tiles, such as the ones at the edge of a layer, are staged in the
+  // top left corner of a ring buffer.
+  if (ring_buffers_.empty() || format != ring_buffer_format_ ||
+      size.width() > ring_buffer_size_.width() ||
+      size.height() > ring_buffer_size_.height()) {
+    if (!ReleaseRingBuffers(ri, sii))
+      return nullptr;
+
+    int buffer_usage_in_bytes = format.EstimatedSizeInBytes(size);
+    if (buffer_usage_in_bytes <= 0)
+      return nullptr;
+    size_t ring_size = std::clamp<size_t>(
+        max_staging_buffer_usage_in_bytes_ / 2 / buffer_usage_in_bytes, 1u,
+        kMaxStagingRingBuffers);
+    for (size_t i = 0; i < ring_size; ++i) {
+      auto staging_buffer = std::make_unique<StagingBuffer>(size, format);
+      staging_buffer->ring_index = i;
+      ring_buffers_.push_back(std::move(staging_buffer));
+    }
+    ring_next_ = 0u;
+    ring_buffer_size_ = size;
+    ring_buffer_format_ = format;
+  }
+
+  // Slots are reused strictly in order, so only the next one needs to be
+  // checked. If it isn't available the pool is still there to fall back to.
+  std::unique_ptr<StagingBuffer>& slot = ring_buffers_[ring_next_];
+  if (!slot || !IsRingBufferAvailable(*slot, ri))
+    return nullptr;
+
+  ring_next_ = (ring_next_ + 1) % ring_buffers_.size();
+  ring_last_usage_ = base::TimeTicks::Now();
+  return std::move(slot);
+}
+
+bool StagingBufferPool::IsRingBufferAvailable(
+    const StagingBuffer& staging_buffer,
+    gpu::raster::RasterInterface* ri) const {
+  // GPU native buffers may be read by the GPU until the copy completes, which
+  // is tracked with a query when supported.
+  if (!staging_buffer.is_shared_memory && staging_buffer.query_id)
+    return CheckForQueryResult(ri, staging_buffer.query_id);
+
+  // Shared memory is consumed when the copy is issued on the service side, so
+  // the sync token generated after the copy fences reuse of the buffer.
+  // IsSyncTokenSignaled() is thread-safe.
+  return !staging_buffer.sync_token.HasData() ||
+         worker_context_provider_->ContextSupport()->IsSyncTokenSignaled(
+             staging_buffer.sync_token);
+}
+
+bool StagingBufferPool::IsRingIdle() const {
+  return !ring_buffers_.empty() && !base::Contains(ring_buffers_, nullptr);
+}
+
+bool StagingBufferPool::ReleaseRingBuffers(gpu::raster::RasterInterface* ri,
+                                           gpu::SharedImageInterface* sii) {
+  if (base::Contains(ring_buffers_, nullptr))
+    return false;
+
+  for (auto& staging_buffer : ring_buffers_)
+    staging_buffer->DestroyGLResources(ri, sii);
+  ring_buffers_.clear();
+  ring_next_ = 0u;
+  return true;
+}
+
+void StagingBufferPool::GetRingUsage(int* usage_in_bytes,
+                                     int* occupied_usage_in_bytes) const {
+  *usage_in_bytes = 0;
+  *occupied_usage_in_bytes = 0;
+  if (ring_buffers_.empty())
+    return;
+
+  int buffer_usage_in_bytes =
+      ring_buffer_format_.EstimatedSizeInBytes(ring_buffer_size_);
+  for (const auto& staging_buffer : ring_buffers_) {
+    // Buffers in use by raster are counted as allocated, even though their
+    // SharedImage may not have been created yet.
+    if (!staging_buffer) {
+      *usage_in_bytes += buffer_usage_in_bytes;
+      *occupied_usage_in_bytes += buffer_usage_in_bytes;
+      continue;
+    }
+    if (!staging_buffer->client_shared_image)
+      continue;
+    *usage_in_bytes += buffer_usage_in_bytes;
+    if (staging_buffer->sync_token.HasData() &&
+        !worker_context_provider_->ContextSupport()->IsSyncTokenSignaled(
+            staging_buffer->sync_token)) {
+      *occupied_usage_in_bytes += buffer_usage_in_bytes;
+    }
+  }
+}
+
 base::TimeTicks StagingBufferPool::GetUsageTimeForLRUBuffer() {
+  base::TimeTicks usage_time;
   if (!free_buffers_.empty())
-    return free_buffers_.front()->last_usage;
-
-  if (!busy_buffers_.empty())
-    return busy_buffers_.front()->last_usage;
+    usage_time = free_buffers_.front()->last_usage;
+  else if (!busy_buffers_.empty())
+    usage_time = busy_buffers_.front()->last_usage;
 
-  return base::TimeTicks();
+  if (IsRingIdle() && (usage_time.is_null() || ring_last_usage_ < usage_time)) {
+    usage_time = ring_last_usage_;
+  }
+  return usage_time;
 }
 
 void StagingBufferPool::ScheduleReduceMemoryUsage() {
@@ -331,13 +471,13 @@ void StagingBufferPool::ReduceMemoryUsage() {
 
   reduce_memory_usage_pending_ = false;
 
-  if (free_buffers_.empty() && busy_buffers_.empty())
+  if (free_buffers_.empty() && busy_buffers_.empty() && !IsRingIdle())
     return;
 
   base::TimeTicks current_time = base::TimeTicks::Now();
   ReleaseBuffersNotUsedSince(current_time - staging_buffer_expiration_delay_);
 
-  if (free_buffers_.empty() && busy_buffers_.empty())
+  if (free_buffers_.empty() && busy_buffers_.empty() && !IsRingIdle())
     return;
 
   reduce_memory_usage_pending_ = true;
@@ -385,6 +525,13 @@ void StagingBufferPool::ReleaseBuffersNotUsedSince(base::TimeTicks time) {
       busy_buffers_.pop_front();
     }
 
+    // The ring is released as a whole once none of its buffers have been used
+    // since |time|.
+    if (IsRingIdle() && ring_last_usage_ <= time &&
+        ReleaseRingBuffers(ri, sii)) {
+      destroyed_buffers = true;
+    }
+
     if (destroyed_buffers) {
       ri->OrderingBarrierCHROMIUM();
       worker_context_provider_->ContextSupport()->FlushPendingWork();
@@ -8,7 +8,9 @@
 #include <stdint.h>
 
 #include <memory>
+#include <optional>
 #include <set>
+#include <vector>
 
 #include "base/containers/circular_deque.h"
 #include "base/memory/memory_pressure_listener.h"
@@ -71,6 +73,14 @@ struct StagingBuffer {
 
   // Whether the underlying buffer is shared memory or GPU native.
   bool is_shared_memory = false;
+
+  // Index of this buffer in the StagingBufferPool's staging ring, if it belongs
+  // to the ring rather than to the pool.
+  std::optional<size_t> ring_index;
+
+  // Shared memory ring buffers stay mapped between uses, so that raster
+  // doesn't need to map them for every tile.
+  std::unique_ptr<gpu::ClientSharedImage::ScopedMapping> persistent_mapping;
 };
 
 class CC_EXPORT StagingBufferPool final
@@ -91,6 +101,9 @@ class CC_EXPORT StagingBufferPool final
   bool OnMemoryDump(const base::trace_event::MemoryDumpArgs& args,
                     base::trace_event::ProcessMemoryDump* pmd) override;
 
+  // Returns a buffer from the staging ring if it is enabled and its next slot
+  // is no longer used by the GPU, and a buffer from the pool otherwise. The
+  // ring is not used when a pooled buffer may allow partial raster.
   std::unique_ptr<StagingBuffer> AcquireStagingBuffer(
       const gfx::Size& size,
       viz::SharedImageFormat format,
@@ -98,6 +111,28 @@ class CC_EXPORT StagingBufferPool final
   void ReleaseStagingBuffer(std::unique_ptr<StagingBuffer> staging_buffer);
 
  private:
+  // Returns the next slot of the staging ring, or nullptr if it is still in
+  // use. The ring holds buffers of a single size and format, and is replaced
+  // if |format| differs or |size| doesn't fit and no slot is in use.
+  std::unique_ptr<StagingBuffer> AcquireRingBuffer(
+      const gfx::Size& size,
+      viz::SharedImageFormat format,
+      gpu::raster::RasterInterface* ri,
+      gpu::SharedImageInterface* sii) EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  bool IsRingBufferAvailable(const StagingBuffer& staging_buffer,
+                             gpu::raster::RasterInterface* ri) const;
+  // Returns true if the ring has buffers and none of them are used by raster.
+  bool IsRingIdle() const EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Destroys all ring buffers. Returns false, without destroying anything, if
+  // any of them is in use by raster.
+  bool ReleaseRingBuffers(gpu::raster::RasterInterface* ri,
+                          gpu::SharedImageInterface* sii)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Returns the memory used by ring buffers and how much of it is either in
+  // use by raster or waiting for the GPU.
+  void GetRingUsage(int* usage_in_bytes, int* occupied_usage_in_bytes) const
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
   void AddStagingBuffer(const StagingBuffer* staging_buffer,
                         viz::SharedImageFormat format)
       EXCLUSIVE_LOCKS_REQUIRED(lock_);
@@ -125,6 +160,7 @@ class CC_EXPORT StagingBufferPool final
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   const raw_ptr<viz::RasterContextProvider> worker_context_provider_;
   const bool use_partial_raster_;
+  const bool use_staging_ring_;
 
   mutable base::Lock lock_;
   // |lock_| must be acquired when accessing the following members.
@@ -142,6 +178,14 @@ class CC_EXPORT StagingBufferPool final
   bool reduce_memory_usage_pending_ GUARDED_BY(lock_);
   base::RepeatingClosure reduce_memory_usage_callback_ GUARDED_BY(lock_);
 
+  // The staging ring. Slots are handed out in order, and are null while the
+  // buffer they hold is used by raster.
+  std::vector<std::unique_ptr<StagingBuffer>> ring_buffers_ GUARDED_BY(lock_);
+  size_t ring_next_ GUARDED_BY(lock_) = 0u;
+  gfx::Size ring_buffer_size_ GUARDED_BY(lock_);
+  viz::SharedImageFormat ring_buffer_format_ GUARDED_BY(lock_);
+  base::TimeTicks ring_last_usage_ GUARDED_BY(lock_);
+
   std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 
   base::WeakPtrFactory<StagingBufferPool> weak_ptr_factory_{this};
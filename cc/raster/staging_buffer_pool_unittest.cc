@@ -6,7 +6,10 @@
 
 #include "base/run_loop.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
+#include "cc/base/features.h"
+#include "components/viz/common/resources/shared_image_format.h"
 #include "components/viz/test/test_context_provider.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -44,4 +47,54 @@ TEST(StagingBufferPoolTest, ShutdownImmediatelyAfterCreation) {
   // No crash.
 }
 
+TEST(StagingBufferPoolTest, StagingRingReusesBuffersInOrder) {
+  base::test::ScopedFeatureList feature_list(features::kOneCopyStagingRing);
+  auto context_provider = viz::TestContextProvider::CreateWorker();
+  const gfx::Size size(256, 256);
+  const viz::SharedImageFormat format = viz::SinglePlaneFormat::kRGBA_8888;
+  // The ring may use half of the budget, which is two buffers here.
+  int max_staging_buffer_usage_in_bytes =
+      4 * static_cast<int>(format.EstimatedSizeInBytes(size));
+  auto pool = std::make_unique<StagingBufferPool>(
+      base::SingleThreadTaskRunner::GetCurrentDefault(), context_provider.get(),
+      /*use_partial_raster=*/false, max_staging_buffer_usage_in_bytes);
+
+  std::unique_ptr<StagingBuffer> first =
+      pool->AcquireStagingBuffer(size, format, 0u);
+  std::unique_ptr<StagingBuffer> second =
+      pool->AcquireStagingBuffer(size, format, 0u);
+  EXPECT_EQ(first->ring_index, 0u);
+  EXPECT_EQ(second->ring_index, 1u);
+
+  // All of the ring is in use, so the pool provides the buffer.
+  std::unique_ptr<StagingBuffer> pooled =
+      pool->AcquireStagingBuffer(size, format, 0u);
+  EXPECT_FALSE(pooled->ring_index);
+
+  // A larger buffer can't replace the ring while it is in use.
+  std::unique_ptr<StagingBuffer> other_size =
+      pool->AcquireStagingBuffer(gfx::Size(512, 512), format, 0u);
+  EXPECT_FALSE(other_size->ring_index);
+
+  // Released buffers without pending GPU work are reused in order.
+  StagingBuffer* first_ptr = first.get();
+  pool->ReleaseStagingBuffer(std::move(first));
+  pool->ReleaseStagingBuffer(std::move(second));
+  std::unique_ptr<StagingBuffer> reused =
+      pool->AcquireStagingBuffer(size, format, 0u);
+  EXPECT_EQ(reused.get(), first_ptr);
+
+  // Smaller tiles fit in ring buffers.
+  std::unique_ptr<StagingBuffer> smaller =
+      pool->AcquireStagingBuffer(gfx::Size(128, 128), format, 0u);
+  EXPECT_EQ(smaller->ring_index, 1u);
+  EXPECT_EQ(smaller->size, size);
+  pool->ReleaseStagingBuffer(std::move(smaller));
+
+  pool->ReleaseStagingBuffer(std::move(reused));
+  pool->ReleaseStagingBuffer(std::move(pooled));
+  pool->ReleaseStagingBuffer(std::move(other_size));
+  pool->Shutdown();
+}
+
 }  // namespace cc
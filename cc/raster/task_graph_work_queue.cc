@@ -361,6 +361,23 @@ void TaskGraphWorkQueue::CompleteTask(PrioritizedTask completed_task) {
   task_namespace->completed_tasks.push_back(std::move(task));
 }
 
+void TaskGraphWorkQueue::ReturnUnstartedTask(PrioritizedTask unstarted_task) {
+  TaskNamespace* task_namespace = unstarted_task.task_namespace;
+  scoped_refptr<Task> task(std::move(unstarted_task.task));
+
+  // Remove task from |running_tasks|.
+  auto it = base::ranges::find(task_namespace->running_tasks, task,
+                               &CategorizedTask::second);
+  DCHECK(it != task_namespace->running_tasks.end());
+  std::swap(*it, task_namespace->running_tasks.back());
+  task_namespace->running_tasks.pop_back();
+
+  // The task never ran, so it goes back to the state it had before it was
+  // scheduled. ScheduleTasks() takes it from there.
+  DCHECK(task->state().IsRunning());
+  task->state().Reset();
+}
+
 void TaskGraphWorkQueue::CollectCompletedTasks(NamespaceToken token,
                                                Task::Vector* completed_tasks) {
   auto it = namespaces_.find(token);
@@ -103,6 +103,13 @@ class CC_EXPORT TaskGraphWorkQueue {
   // tasks and updating the list of |ready_to_run_namespaces|.
   void CompleteTask(PrioritizedTask completed_task);
 
+  // Undoes GetNextTaskToRun() for a task that was handed out but never ran.
+  // The task is removed from its namespace's list of running tasks and reset
+  // to the new state, but it is not added back to |ready_to_run_tasks|. The
+  // caller must follow up with ScheduleTasks() for the task's namespace, which
+  // either schedules the task again or cancels it.
+  void ReturnUnstartedTask(PrioritizedTask unstarted_task);
+
   // Helper which populates a vector of completed tasks from the provided
   // namespace.
   void CollectCompletedTasks(NamespaceToken token,
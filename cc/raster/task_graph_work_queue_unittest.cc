@@ -217,5 +217,54 @@ TEST(TaskGraphWorkQueueTest, TestTaskWithDifferentPriority) {
   }
 }
 
+// Tasks returned unstarted are rescheduled if they are still part of the new
+// graph, and canceled otherwise.
+TEST(TaskGraphWorkQueueTest, TestReturnUnstartedTask) {
+  TaskGraphWorkQueue work_queue;
+  NamespaceToken token = work_queue.GenerateNamespaceToken();
+
+  scoped_refptr<FakeTaskImpl> task1(new FakeTaskImpl());
+  scoped_refptr<FakeTaskImpl> task2(new FakeTaskImpl());
+  TaskGraph graph1;
+  graph1.nodes.push_back(TaskGraph::Node(task1.get(), 0u, 0u, 0u));
+  graph1.nodes.push_back(TaskGraph::Node(task2.get(), 0u, 1u, 0u));
+  work_queue.ScheduleTasks(token, &graph1);
+
+  // Hand out both tasks, then return them without running them.
+  TaskGraphWorkQueue::PrioritizedTask prioritized_task1 =
+      work_queue.GetNextTaskToRun(0u);
+  TaskGraphWorkQueue::PrioritizedTask prioritized_task2 =
+      work_queue.GetNextTaskToRun(0u);
+  EXPECT_EQ(prioritized_task1.task.get(), task1.get());
+  EXPECT_EQ(prioritized_task2.task.get(), task2.get());
+  EXPECT_FALSE(work_queue.HasReadyToRunTasks());
+  EXPECT_EQ(2u, work_queue.NumRunningTasksForCategory(0u));
+
+  work_queue.ReturnUnstartedTask(std::move(prioritized_task1));
+  work_queue.ReturnUnstartedTask(std::move(prioritized_task2));
+  EXPECT_EQ(0u, work_queue.NumRunningTasksForCategory(0u));
+  EXPECT_TRUE(task1->state().IsNew());
+  EXPECT_TRUE(task2->state().IsNew());
+
+  // Schedule a graph that only contains |task2|.
+  TaskGraph graph2;
+  graph2.nodes.push_back(TaskGraph::Node(task2.get(), 0u, 0u, 0u));
+  work_queue.ScheduleTasks(token, &graph2);
+
+  // |task1| is canceled.
+  Task::Vector completed_tasks;
+  work_queue.CollectCompletedTasks(token, &completed_tasks);
+  ASSERT_EQ(1u, completed_tasks.size());
+  EXPECT_EQ(task1.get(), completed_tasks[0].get());
+  EXPECT_TRUE(task1->state().IsCanceled());
+
+  // |task2| is ready to run again.
+  TaskGraphWorkQueue::PrioritizedTask prioritized_task =
+      work_queue.GetNextTaskToRun(0u);
+  EXPECT_EQ(prioritized_task.task.get(), task2.get());
+  work_queue.CompleteTask(std::move(prioritized_task));
+  EXPECT_FALSE(work_queue.HasReadyToRunTasks());
+}
+
 }  // namespace
 }  // namespace cc
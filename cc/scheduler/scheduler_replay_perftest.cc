@@ -0,0 +1,129 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stddef.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/time/time.h"
+#include "cc/scheduler/scheduler_settings.h"
+#include "cc/test/scheduler_replay.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace cc {
+namespace {
+
+// Replays the trace in this file instead of the built-in one, e.g. one
+// recorded from a device with --scheduler-replay-trace=/path/to/trace.json.
+// See SchedulerReplay::ParseTrace() for the format.
+const char kTraceSwitch[] = "scheduler-replay-trace";
+
+const int kSyntheticFrameCount = 600;
+constexpr base::TimeDelta kInterval = base::Microseconds(16667);
+
+// A 60Hz trace where the main thread usually fits in a frame, but regularly
+// goes long, with occasional raster spikes and compositor animations. The
+// periods are coprime so that the slow frames don't always line up.
+std::vector<SchedulerReplayFrame> CreateSyntheticTrace() {
+  std::vector<SchedulerReplayFrame> frames;
+  for (int i = 0; i < kSyntheticFrameCount; ++i) {
+    SchedulerReplayFrame frame;
+    frame.frame_time = base::TimeTicks() + kInterval * (i + 1);
+    frame.deadline = frame.frame_time + kInterval;
+    frame.interval = kInterval;
+    frame.has_main_frame_update = i % 4 != 3;
+    frame.main_thread_duration = base::Milliseconds(6);
+    if (i % 7 == 0) {
+      frame.main_thread_duration = base::Milliseconds(24);
+    } else if (i % 13 == 0) {
+      frame.main_thread_duration = base::Milliseconds(40);
+    }
+    frame.raster_duration =
+        i % 5 == 0 ? base::Milliseconds(14) : base::Milliseconds(4);
+    frame.has_impl_frame_update = i % 3 == 0;
+    frames.push_back(frame);
+  }
+  return frames;
+}
+
+std::vector<SchedulerReplayFrame> LoadTrace() {
+  base::FilePath path =
+      base::CommandLine::ForCurrentProcess()->GetSwitchValuePath(kTraceSwitch);
+  if (path.empty()) {
+    return CreateSyntheticTrace();
+  }
+  std::string json;
+  CHECK(base::ReadFileToString(path, &json)) << path;
+  std::optional<std::vector<SchedulerReplayFrame>> frames =
+      SchedulerReplay::ParseTrace(json);
+  CHECK(frames) << "Malformed trace " << path;
+  return std::move(*frames);
+}
+
+class SchedulerReplayPerfTest : public testing::Test {
+ public:
+  void SetUp() override { frames_ = LoadTrace(); }
+
+  void RunReplay(const std::string& story, const SchedulerSettings& settings) {
+    SchedulerReplayStats stats = SchedulerReplay(settings).Run(frames_);
+
+    perf_test::PerfResultReporter reporter("scheduler_replay", story);
+    reporter.RegisterImportantMetric("_dropped_frames", "count");
+    reporter.RegisterImportantMetric("_dropped_frame_percent", "%");
+    reporter.RegisterImportantMetric("_latency_p95", "ms");
+    reporter.RegisterFyiMetric("_latency_mean", "ms");
+    reporter.RegisterFyiMetric("_latency_max", "ms");
+    reporter.RegisterFyiMetric("_main_frames_committed", "count");
+    reporter.AddResult("_dropped_frames", stats.dropped_frames);
+    reporter.AddResult("_dropped_frame_percent", stats.DroppedFramePercent());
+    reporter.AddResult("_latency_p95",
+                       stats.LatencyPercentile(0.95).InMillisecondsF());
+    reporter.AddResult("_latency_mean", stats.MeanLatency().InMillisecondsF());
+    reporter.AddResult("_latency_max",
+                       stats.LatencyPercentile(1.0).InMillisecondsF());
+    reporter.AddResult("_main_frames_committed", stats.main_frames_committed);
+  }
+
+ private:
+  std::vector<SchedulerReplayFrame> frames_;
+};
+
+TEST_F(SchedulerReplayPerfTest, Default) {
+  RunReplay("default", SchedulerSettings());
+}
+
+TEST_F(SchedulerReplayPerfTest, MainFrameBeforeCommit) {
+  SchedulerSettings settings;
+  settings.main_frame_before_commit_enabled = true;
+  RunReplay("main_frame_before_commit", settings);
+}
+
+TEST_F(SchedulerReplayPerfTest, MainFrameBeforeActivation) {
+  SchedulerSettings settings;
+  settings.main_frame_before_activation_enabled = true;
+  RunReplay("main_frame_before_activation", settings);
+}
+
+TEST_F(SchedulerReplayPerfTest, CommitToActiveTree) {
+  SchedulerSettings settings;
+  settings.commit_to_active_tree = true;
+  RunReplay("commit_to_active_tree", settings);
+}
+
+TEST_F(SchedulerReplayPerfTest, WaitForAllPipelineStagesBeforeDraw) {
+  SchedulerSettings settings;
+  settings.wait_for_all_pipeline_stages_before_draw = true;
+  RunReplay("wait_for_all_pipeline_stages_before_draw", settings);
+}
+
+}  // namespace
+}  // namespace cc
@@ -0,0 +1,153 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/test/scheduler_replay.h"
+
+#include <optional>
+#include <vector>
+
+#include "base/time/time.h"
+#include "cc/scheduler/scheduler_settings.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace cc {
+namespace {
+
+constexpr base::TimeDelta kInterval = base::Microseconds(16667);
+
+std::vector<SchedulerReplayFrame> CreateTrace(
+    int frame_count,
+    base::TimeDelta main_thread_duration,
+    base::TimeDelta raster_duration) {
+  std::vector<SchedulerReplayFrame> frames;
+  for (int i = 0; i < frame_count; ++i) {
+    SchedulerReplayFrame frame;
+    frame.frame_time = base::TimeTicks() + kInterval * (i + 1);
+    frame.deadline = frame.frame_time + kInterval;
+    frame.interval = kInterval;
+    frame.has_main_frame_update = true;
+    frame.main_thread_duration = main_thread_duration;
+    frame.raster_duration = raster_duration;
+    frames.push_back(frame);
+  }
+  return frames;
+}
+
+TEST(SchedulerReplayTest, FastMainThreadDropsNoFrames) {
+  SchedulerReplayStats stats =
+      SchedulerReplay(SchedulerSettings())
+          .Run(CreateTrace(60, base::Milliseconds(2), base::Milliseconds(2)));
+  EXPECT_GT(stats.drawn_frames, 50u);
+  EXPECT_GT(stats.main_frames_committed, 50u);
+  EXPECT_EQ(stats.dropped_frames, 0u);
+  EXPECT_EQ(stats.latencies.size(), stats.drawn_frames);
+  EXPECT_LE(stats.LatencyPercentile(1.0), 3 * kInterval);
+}
+
+TEST(SchedulerReplayTest, SlowMainThreadDropsFrames) {
+  SchedulerReplayStats fast_stats =
+      SchedulerReplay(SchedulerSettings())
+          .Run(CreateTrace(60, base::Milliseconds(2), base::Milliseconds(2)));
+  SchedulerReplayStats slow_stats =
+      SchedulerReplay(SchedulerSettings())
+          .Run(CreateTrace(60, base::Milliseconds(30), base::Milliseconds(2)));
+  EXPECT_GT(slow_stats.dropped_frames, 0u);
+  EXPECT_GT(slow_stats.DroppedFramePercent(), 0.0);
+  EXPECT_LT(slow_stats.main_frames_committed, fast_stats.main_frames_committed);
+  EXPECT_GT(slow_stats.MeanLatency(), fast_stats.MeanLatency());
+}
+
+TEST(SchedulerReplayTest, ImplOnlyUpdatesAreDrawn) {
+  std::vector<SchedulerReplayFrame> frames =
+      CreateTrace(30, base::Milliseconds(2), base::Milliseconds(2));
+  // After the first main frame, only the compositor has updates.
+  for (size_t i = 1; i < frames.size(); ++i) {
+    frames[i].has_main_frame_update = false;
+    frames[i].has_impl_frame_update = true;
+  }
+  SchedulerReplayStats stats = SchedulerReplay(SchedulerSettings()).Run(frames);
+  EXPECT_EQ(stats.main_frames_committed, 1u);
+  EXPECT_GT(stats.drawn_frames, 20u);
+  EXPECT_EQ(stats.dropped_frames, 0u);
+}
+
+TEST(SchedulerReplayTest, ReplayIsDeterministic) {
+  std::vector<SchedulerReplayFrame> frames =
+      CreateTrace(120, base::Milliseconds(12), base::Milliseconds(9));
+  for (size_t i = 0; i < frames.size(); i += 5) {
+    frames[i].main_thread_duration = base::Milliseconds(35);
+  }
+  SchedulerSettings settings;
+  settings.main_frame_before_activation_enabled = true;
+  SchedulerReplay replay(settings);
+  SchedulerReplayStats first = replay.Run(frames);
+  SchedulerReplayStats second = replay.Run(frames);
+  EXPECT_EQ(first.expected_frames, second.expected_frames);
+  EXPECT_EQ(first.dropped_frames, second.dropped_frames);
+  EXPECT_EQ(first.drawn_frames, second.drawn_frames);
+  EXPECT_EQ(first.main_frames_committed, second.main_frames_committed);
+  EXPECT_EQ(first.main_frames_aborted, second.main_frames_aborted);
+  EXPECT_EQ(first.latencies, second.latencies);
+}
+
+TEST(SchedulerReplayTest, StatsPercentiles) {
+  SchedulerReplayStats stats;
+  EXPECT_EQ(stats.LatencyPercentile(0.5), base::TimeDelta());
+  EXPECT_EQ(stats.MeanLatency(), base::TimeDelta());
+  EXPECT_EQ(stats.DroppedFramePercent(), 0.0);
+
+  for (int i = 1; i <= 20; ++i) {
+    stats.latencies.push_back(base::Milliseconds(i));
+  }
+  stats.expected_frames = 20;
+  stats.dropped_frames = 5;
+  EXPECT_EQ(stats.LatencyPercentile(0.0), base::Milliseconds(1));
+  EXPECT_EQ(stats.LatencyPercentile(0.5), base::Milliseconds(10));
+  EXPECT_EQ(stats.LatencyPercentile(0.95), base::Milliseconds(19));
+  EXPECT_EQ(stats.LatencyPercentile(1.0), base::Milliseconds(20));
+  EXPECT_EQ(stats.MeanLatency(), base::Microseconds(10500));
+  EXPECT_EQ(stats.DroppedFramePercent(), 25.0);
+}
+
+TEST(SchedulerReplayTest, ParseTrace) {
+  std::optional<std::vector<SchedulerReplayFrame>> frames =
+      SchedulerReplay::ParseTrace(R"({"frames": [
+        {"frame_time_us": 16667, "deadline_us": 30000, "interval_us": 16667,
+         "main_thread_us": 8000, "raster_us": 4000},
+        {"frame_time_us": 33334, "deadline_us": 46667, "interval_us": 16667,
+         "impl_update": true}
+      ]})");
+  ASSERT_TRUE(frames);
+  ASSERT_EQ(frames->size(), 2u);
+  EXPECT_EQ((*frames)[0].frame_time, base::TimeTicks() + kInterval);
+  EXPECT_EQ((*frames)[0].deadline,
+            base::TimeTicks() + base::Microseconds(30000));
+  EXPECT_EQ((*frames)[0].interval, kInterval);
+  EXPECT_TRUE((*frames)[0].has_main_frame_update);
+  EXPECT_EQ((*frames)[0].main_thread_duration, base::Milliseconds(8));
+  EXPECT_EQ((*frames)[0].raster_duration, base::Milliseconds(4));
+  EXPECT_FALSE((*frames)[0].has_impl_frame_update);
+  EXPECT_FALSE((*frames)[1].has_main_frame_update);
+  EXPECT_TRUE((*frames)[1].has_impl_frame_update);
+}
+
+TEST(SchedulerReplayTest, ParseTraceRejectsMalformedTraces) {
+  EXPECT_FALSE(SchedulerReplay::ParseTrace("not json"));
+  EXPECT_FALSE(SchedulerReplay::ParseTrace(R"({"no_frames": []})"));
+  EXPECT_FALSE(SchedulerReplay::ParseTrace(R"({"frames": [1]})"));
+  // Missing interval.
+  EXPECT_FALSE(SchedulerReplay::ParseTrace(
+      R"({"frames": [{"frame_time_us": 1, "deadline_us": 2}]})"));
+  // Deadline before the frame time.
+  EXPECT_FALSE(SchedulerReplay::ParseTrace(
+      R"({"frames": [{"frame_time_us": 5, "deadline_us": 2,
+                      "interval_us": 16667}]})"));
+  // Frame times going backwards.
+  EXPECT_FALSE(SchedulerReplay::ParseTrace(R"({"frames": [
+      {"frame_time_us": 5, "deadline_us": 6, "interval_us": 16667},
+      {"frame_time_us": 5, "deadline_us": 6, "interval_us": 16667}]})"));
+}
+
+}  // namespace
+}  // namespace cc
@@ -494,6 +494,8 @@ void LayerTreeImpl::GenerateCompositorFrame(
   out_frame.metadata.display_transform_hint = display_transform_hint_;
 
   FrameData frame_data(out_frame, out_hit_test_region_list.regions);
+  frame_data.current_frame_damage.reserve(damage_from_previous_frame_.size());
+  ReserveRenderPassDamage(render_pass->id.value(), frame_data);
   Draw(*root_, *render_pass, frame_data,
        /*parent_transform_to_root=*/gfx::Transform(),
        /*parent_transform_to_target=*/gfx::Transform(),
@@ -712,6 +714,7 @@ void LayerTreeImpl::Draw(Layer& layer,
   SimpleEnclosedRegion occlusion_in_new_pass;
   RenderPassDamageData parent_pass_damage = std::move(data.render_pass_damage);
   data.render_pass_damage.clear();
+  ReserveRenderPassDamage(new_pass->id.value(), data);
   {
     SimpleEnclosedRegion parent_pass_occlusion = data.occlusion_in_target;
     data.occlusion_in_target.Clear();
@@ -905,6 +908,14 @@ bool LayerTreeImpl::UpdateOcclusionRect(
   return true;
 }
 
+void LayerTreeImpl::ReserveRenderPassDamage(uint64_t render_pass_id,
+                                            FrameData& data) const {
+  auto itr = damage_from_previous_frame_.find(render_pass_id);
+  if (itr != damage_from_previous_frame_.end()) {
+    data.render_pass_damage.reserve(itr->second.size());
+  }
+}
+
 void LayerTreeImpl::ProcessDamageForRenderPass(
     viz::CompositorRenderPass& render_pass,
     FrameData& data) {
@@ -172,6 +172,10 @@ class COMPONENT_EXPORT(CC_SLIM) LayerTreeImpl : public LayerTree,
                            float opacity,
                            const gfx::RectF& visible_rectf_in_target,
                            gfx::RectF& visible_rect);
+  // Reserves `data.render_pass_damage` for as many layers as contributed to
+  // the render pass with `render_pass_id` in the previous frame, since the
+  // layer tree is usually unchanged between frames.
+  void ReserveRenderPassDamage(uint64_t render_pass_id, FrameData& data) const;
   // Compute and update `damage_rect` and `has_damage_from_contributing_content`
   // of `render_pass`. `data.render_pass_damage` should be the newly computed
   // damage data of the frame being produced. Damage data from previous frame is
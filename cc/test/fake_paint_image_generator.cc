@@ -40,7 +40,7 @@ FakePaintImageGenerator::FakePaintImageGenerator(
 FakePaintImageGenerator::~FakePaintImageGenerator() = default;
 
 sk_sp<SkData> FakePaintImageGenerator::GetEncodedData() const {
-  return SkData::MakeEmpty();
+  return encoded_data_ ? encoded_data_ : SkData::MakeEmpty();
 }
 
 bool FakePaintImageGenerator::GetPixels(SkPixmap dst_pixmap,
@@ -67,6 +67,37 @@ bool FakePaintImageGenerator::GetPixels(SkPixmap dst_pixmap,
   return true;
 }
 
+bool FakePaintImageGenerator::SupportsSubsetDecode() const {
+  return supports_subset_decode_;
+}
+
+bool FakePaintImageGenerator::GetPixelsForSubset(
+    SkPixmap dst_pixmap,
+    const SkIRect& subset,
+    size_t frame_index,
+    PaintImage::GeneratorClientId client_id,
+    uint32_t lazy_pixel_ref) {
+  if (!supports_subset_decode_) {
+    return PaintImageGenerator::GetPixelsForSubset(
+        dst_pixmap, subset, frame_index, client_id, lazy_pixel_ref);
+  }
+
+  // Decode the whole image to the side, and only copy |subset| out of it.
+  const SkImageInfo& dst_info = dst_pixmap.info();
+  std::vector<uint8_t> memory(dst_info.computeMinByteSize());
+  SkPixmap full_pixmap(dst_info, memory.data(), dst_info.minRowBytes());
+  if (!GetPixels(full_pixmap, frame_index, client_id, lazy_pixel_ref)) {
+    return false;
+  }
+  SkPixmap src_subset;
+  SkPixmap dst_subset;
+  CHECK(full_pixmap.extractSubset(&src_subset, subset));
+  CHECK(dst_pixmap.extractSubset(&dst_subset, subset));
+  CHECK(src_subset.readPixels(dst_subset));
+  decode_subsets_.push_back(subset);
+  return true;
+}
+
 bool FakePaintImageGenerator::QueryYUVA(
     const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
     SkYUVAPixmapInfo* yuva_pixmap_info) const {
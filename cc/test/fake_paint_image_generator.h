@@ -5,6 +5,7 @@
 #ifndef CC_TEST_FAKE_PAINT_IMAGE_GENERATOR_H_
 #define CC_TEST_FAKE_PAINT_IMAGE_GENERATOR_H_
 
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
@@ -39,6 +40,12 @@ class FakePaintImageGenerator : public PaintImageGenerator {
                  size_t frame_index,
                  PaintImage::GeneratorClientId client_id,
                  uint32_t lazy_pixel_ref) override;
+  bool SupportsSubsetDecode() const override;
+  bool GetPixelsForSubset(SkPixmap dst_pixmap,
+                          const SkIRect& subset,
+                          size_t frame_index,
+                          PaintImage::GeneratorClientId client_id,
+                          uint32_t lazy_pixel_ref) override;
   bool QueryYUVA(
       const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
       SkYUVAPixmapInfo* yuva_pixmap_info) const override;
@@ -56,12 +63,19 @@ class FakePaintImageGenerator : public PaintImageGenerator {
     CHECK(!is_yuv_);
     return decode_infos_;
   }
+  const std::vector<SkIRect>& decode_subsets() const {
+    return decode_subsets_;
+  }
   void reset_frames_decoded() { frames_decoded_count_.clear(); }
+  void SetSupportsSubsetDecode() { supports_subset_decode_ = true; }
   void SetExpectFallbackToRGB() { expect_fallback_to_rgb_ = true; }
   void SetImageHeaderMetadata(const ImageHeaderMetadata& image_metadata) {
     image_metadata_ = image_metadata;
   }
   SkPixmap& GetPixmap() { return image_pixmap_; }
+  void SetEncodedData(sk_sp<SkData> encoded_data) {
+    encoded_data_ = std::move(encoded_data);
+  }
 
  private:
   std::vector<uint8_t> image_backing_memory_;
@@ -69,6 +83,8 @@ class FakePaintImageGenerator : public PaintImageGenerator {
   base::flat_map<size_t, int> frames_decoded_count_;
   std::vector<SkISize> supported_sizes_;
   std::vector<SkImageInfo> decode_infos_;
+  std::vector<SkIRect> decode_subsets_;
+  bool supports_subset_decode_ = false;
   bool is_yuv_ = false;
   SkYUVAPixmapInfo yuva_pixmap_info_;
   // TODO(skbug.com/8564): After Skia supports rendering from software YUV
@@ -76,6 +92,7 @@ class FakePaintImageGenerator : public PaintImageGenerator {
   // fallback.
   bool expect_fallback_to_rgb_ = false;
   ImageHeaderMetadata image_metadata_;
+  sk_sp<SkData> encoded_data_;
 };
 
 }  // namespace cc
@@ -0,0 +1,437 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/test/scheduler_replay.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/json/json_reader.h"
+#include "base/location.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/test/test_mock_time_task_runner.h"
+#include "base/values.h"
+#include "cc/metrics/event_metrics.h"
+#include "cc/scheduler/begin_frame_tracker.h"
+#include "cc/scheduler/commit_earlyout_reason.h"
+#include "cc/scheduler/draw_result.h"
+#include "cc/scheduler/scheduler.h"
+#include "cc/test/fake_compositor_frame_reporting_controller.h"
+#include "cc/test/scheduler_test_common.h"
+#include "components/viz/common/frame_sinks/begin_frame_args.h"
+#include "components/viz/common/frame_sinks/begin_frame_source.h"
+
+namespace cc {
+
+namespace {
+
+// An update making its way through the pipeline.
+struct PipelineUpdate {
+  // Frame time of the BeginFrame the update started in. When updates are
+  // coalesced this is the earliest of them, so that latency isn't understated.
+  base::TimeTicks start_time;
+  base::TimeDelta main_thread_duration;
+  base::TimeDelta raster_duration;
+};
+
+// Merges |update| into |target|, keeping the earliest start time and the
+// durations of the latest update.
+void MergeUpdate(std::optional<PipelineUpdate>& target,
+                 const PipelineUpdate& update) {
+  if (!target) {
+    target = update;
+    return;
+  }
+  target->start_time = std::min(target->start_time, update.start_time);
+  target->main_thread_duration = update.main_thread_duration;
+  target->raster_duration = update.raster_duration;
+}
+
+std::optional<base::TimeDelta> FindMicroseconds(const base::Value::Dict& dict,
+                                                std::string_view key) {
+  std::optional<double> value = dict.FindDouble(key);
+  if (!value || *value < 0) {
+    return std::nullopt;
+  }
+  return base::Microseconds(*value);
+}
+
+}  // namespace
+
+SchedulerReplayStats::SchedulerReplayStats() = default;
+SchedulerReplayStats::SchedulerReplayStats(const SchedulerReplayStats&) =
+    default;
+SchedulerReplayStats::~SchedulerReplayStats() = default;
+SchedulerReplayStats& SchedulerReplayStats::operator=(
+    const SchedulerReplayStats&) = default;
+
+double SchedulerReplayStats::DroppedFramePercent() const {
+  if (!expected_frames) {
+    return 0.0;
+  }
+  return 100.0 * dropped_frames / expected_frames;
+}
+
+base::TimeDelta SchedulerReplayStats::LatencyPercentile(
+    double percentile) const {
+  if (latencies.empty()) {
+    return base::TimeDelta();
+  }
+  DCHECK(std::is_sorted(latencies.begin(), latencies.end()));
+  size_t rank = static_cast<size_t>(std::ceil(percentile * latencies.size()));
+  return latencies[std::clamp<size_t>(rank, 1u, latencies.size()) - 1];
+}
+
+base::TimeDelta SchedulerReplayStats::MeanLatency() const {
+  if (latencies.empty()) {
+    return base::TimeDelta();
+  }
+  base::TimeDelta sum;
+  for (base::TimeDelta latency : latencies) {
+    sum += latency;
+  }
+  return sum / latencies.size();
+}
+
+// Plays the part of the LayerTreeHostImpl and of the main thread for the
+// scheduler, and keeps track of which updates have been drawn.
+class SchedulerReplay::ReplayClient
+    : public SchedulerClient,
+      public viz::ExternalBeginFrameSourceClient {
+ public:
+  ReplayClient(SchedulerReplayStats* stats,
+               scoped_refptr<base::TestMockTimeTaskRunner> task_runner)
+      : stats_(stats), task_runner_(std::move(task_runner)) {}
+  ReplayClient(const ReplayClient&) = delete;
+  ~ReplayClient() override = default;
+
+  ReplayClient& operator=(const ReplayClient&) = delete;
+
+  void Init(TestScheduler* scheduler,
+            FakeCompositorTimingHistory* timing_history,
+            bool commit_to_active_tree) {
+    scheduler_ = scheduler;
+    timing_history_ = timing_history;
+    commit_to_active_tree_ = commit_to_active_tree;
+  }
+
+  // Called at the frame time of |frame|, before its BeginFrame is sent.
+  void WillReceiveFrame(const SchedulerReplayFrame& frame,
+                        base::TimeTicks frame_time) {
+    if (frame.has_main_frame_update) {
+      MergeUpdate(pending_main_update_,
+                  {frame_time, frame.main_thread_duration,
+                   frame.raster_duration});
+      scheduler_->SetNeedsBeginMainFrame();
+    }
+    // Compositor updates need a tree to be drawn into.
+    if (frame.has_impl_frame_update && has_active_tree_) {
+      if (!pending_impl_update_time_) {
+        pending_impl_update_time_ = frame_time;
+      }
+      scheduler_->SetNeedsRedraw();
+    }
+  }
+
+  // SchedulerClient implementation.
+  bool WillBeginImplFrame(const viz::BeginFrameArgs& args) override {
+    drew_in_impl_frame_ = false;
+    impl_frame_has_pending_update_ = HasPendingUpdate();
+    return true;
+  }
+  void ScheduledActionSendBeginMainFrame(
+      const viz::BeginFrameArgs& args) override {
+    if (!pending_main_update_) {
+      ++stats_->main_frames_aborted;
+      PostTask(base::BindOnce(&Scheduler::BeginMainFrameAborted,
+                              base::Unretained(scheduler_.get()),
+                              CommitEarlyOutReason::kFinishedNoUpdates));
+      return;
+    }
+    DCHECK(!main_thread_update_);
+    main_thread_update_ = std::move(pending_main_update_);
+    pending_main_update_.reset();
+    PostTask(base::BindOnce(&Scheduler::NotifyBeginMainFrameStarted,
+                            base::Unretained(scheduler_.get()),
+                            task_runner_->NowTicks()));
+    task_runner_->PostDelayedTask(
+        FROM_HERE,
+        base::BindOnce(&ReplayClient::DidFinishMainThreadWork,
+                       base::Unretained(this)),
+        main_thread_update_->main_thread_duration);
+  }
+  DrawResult ScheduledActionDrawIfPossible() override { return Draw(); }
+  DrawResult ScheduledActionDrawForced() override { return Draw(); }
+  void ScheduledActionCommit() override {
+    DCHECK(ready_to_commit_update_);
+    ++stats_->main_frames_committed;
+    PipelineUpdate update = *ready_to_commit_update_;
+    ready_to_commit_update_.reset();
+    // A pipelined main frame that finished early can commit next.
+    if (main_thread_work_done_) {
+      main_thread_work_done_ = false;
+      PostTask(base::BindOnce(&ReplayClient::DidFinishMainThreadWork,
+                              base::Unretained(this)));
+    }
+
+    // Estimates follow the last main frame, as they would with a real
+    // CompositorTimingHistory tracking a steady workload.
+    timing_history_->SetBeginMainFrameStartToReadyToCommitDurationEstimate(
+        update.main_thread_duration);
+    timing_history_->SetCommitToReadyToActivateDurationEstimate(
+        update.raster_duration);
+
+    if (commit_to_active_tree_) {
+      has_active_tree_ = true;
+      MergeUpdate(active_tree_update_, update);
+      task_runner_->PostDelayedTask(
+          FROM_HERE,
+          base::BindOnce(&Scheduler::NotifyReadyToDraw,
+                         base::Unretained(scheduler_.get())),
+          update.raster_duration);
+      return;
+    }
+    DCHECK(!pending_tree_update_);
+    pending_tree_update_ = update;
+    task_runner_->PostDelayedTask(
+        FROM_HERE,
+        base::BindOnce(&Scheduler::NotifyReadyToActivate,
+                       base::Unretained(scheduler_.get())),
+        update.raster_duration);
+  }
+  void ScheduledActionPostCommit() override {}
+  void ScheduledActionActivateSyncTree() override {
+    has_active_tree_ = true;
+    if (pending_tree_update_) {
+      // An undrawn active tree is superseded by the new one, so its update is
+      // only drawn as part of the new tree.
+      MergeUpdate(active_tree_update_, *pending_tree_update_);
+      pending_tree_update_.reset();
+    }
+    PostTask(base::BindOnce(&Scheduler::NotifyReadyToDraw,
+                            base::Unretained(scheduler_.get())));
+  }
+  void ScheduledActionBeginLayerTreeFrameSinkCreation() override {
+    PostTask(
+        base::BindOnce(&Scheduler::DidCreateAndInitializeLayerTreeFrameSink,
+                       base::Unretained(scheduler_.get())));
+  }
+  void ScheduledActionPrepareTiles() override {
+    scheduler_->WillPrepareTiles();
+    scheduler_->DidPrepareTiles();
+  }
+  void ScheduledActionInvalidateLayerTreeFrameSink(bool needs_redraw) override {
+    PostTask(base::BindOnce(&Scheduler::OnDrawForLayerTreeFrameSink,
+                            base::Unretained(scheduler_.get()),
+                            /*resourceless_software_draw=*/false,
+                            /*skip_draw=*/!needs_redraw));
+  }
+  void ScheduledActionPerformImplSideInvalidation() override {}
+  void DidFinishImplFrame(
+      const viz::BeginFrameArgs& last_activated_args) override {
+    if (!impl_frame_has_pending_update_) {
+      return;
+    }
+    ++stats_->expected_frames;
+    if (!drew_in_impl_frame_) {
+      ++stats_->dropped_frames;
+    }
+  }
+  void DidNotProduceFrame(const viz::BeginFrameAck& ack,
+                          FrameSkippedReason reason) override {}
+  void WillNotReceiveBeginFrame() override {}
+  void SendBeginMainFrameNotExpectedSoon() override {}
+  void ScheduledActionBeginMainFrameNotExpectedUntil(
+      base::TimeTicks time) override {}
+  void FrameIntervalUpdated(base::TimeDelta interval) override {}
+
+  // viz::ExternalBeginFrameSourceClient implementation.
+  void OnNeedsBeginFrames(bool needs_begin_frames) override {}
+
+ private:
+  bool HasPendingUpdate() const {
+    return pending_main_update_ || main_thread_update_ ||
+           ready_to_commit_update_ || pending_tree_update_ ||
+           active_tree_update_ || pending_impl_update_time_;
+  }
+
+  void PostTask(base::OnceClosure task) {
+    task_runner_->PostTask(FROM_HERE, std::move(task));
+  }
+
+  void DidFinishMainThreadWork() {
+    DCHECK(main_thread_update_);
+    // With main_frame_before_commit the main thread works on the next frame
+    // while the previous one waits to commit, but it can only be ready to
+    // commit once that commit happened.
+    if (ready_to_commit_update_) {
+      main_thread_work_done_ = true;
+      return;
+    }
+    ready_to_commit_update_ = std::move(main_thread_update_);
+    main_thread_update_.reset();
+    scheduler_->NotifyReadyToCommit(nullptr);
+  }
+
+  DrawResult Draw() {
+    const base::TimeTicks now = task_runner_->NowTicks();
+    ++stats_->drawn_frames;
+    drew_in_impl_frame_ = true;
+    if (active_tree_update_) {
+      stats_->latencies.push_back(now - active_tree_update_->start_time);
+      active_tree_update_.reset();
+    }
+    if (pending_impl_update_time_) {
+      stats_->latencies.push_back(now - *pending_impl_update_time_);
+      pending_impl_update_time_.reset();
+    }
+    scheduler_->DidSubmitCompositorFrame(next_frame_token_++, now,
+                                         EventMetricsSet(),
+                                         /*has_missing_content=*/false);
+    PostTask(base::BindOnce(&Scheduler::DidReceiveCompositorFrameAck,
+                            base::Unretained(scheduler_.get())));
+    return DrawResult::kSuccess;
+  }
+
+  const raw_ptr<SchedulerReplayStats> stats_;
+  const scoped_refptr<base::TestMockTimeTaskRunner> task_runner_;
+  raw_ptr<TestScheduler> scheduler_ = nullptr;
+  raw_ptr<FakeCompositorTimingHistory> timing_history_ = nullptr;
+  bool commit_to_active_tree_ = false;
+
+  // Updates in the order they move through the pipeline.
+  std::optional<PipelineUpdate> pending_main_update_;
+  std::optional<PipelineUpdate> main_thread_update_;
+  std::optional<PipelineUpdate> ready_to_commit_update_;
+  std::optional<PipelineUpdate> pending_tree_update_;
+  std::optional<PipelineUpdate> active_tree_update_;
+  std::optional<base::TimeTicks> pending_impl_update_time_;
+
+  bool main_thread_work_done_ = false;
+  bool has_active_tree_ = false;
+  bool drew_in_impl_frame_ = false;
+  bool impl_frame_has_pending_update_ = false;
+  uint32_t next_frame_token_ = 1u;
+};
+
+SchedulerReplay::SchedulerReplay(const SchedulerSettings& settings)
+    : settings_(settings) {}
+
+SchedulerReplay::~SchedulerReplay() = default;
+
+SchedulerReplayStats SchedulerReplay::Run(
+    const std::vector<SchedulerReplayFrame>& frames) {
+  SchedulerReplayStats stats;
+  if (frames.empty()) {
+    return stats;
+  }
+
+  auto task_runner = base::MakeRefCounted<base::TestMockTimeTaskRunner>(
+      base::TestMockTimeTaskRunner::Type::kStandalone);
+  ReplayClient client(&stats, task_runner);
+  viz::ExternalBeginFrameSource begin_frame_source(&client);
+  FakeCompositorFrameReportingController reporting_controller;
+  std::unique_ptr<FakeCompositorTimingHistory> timing_history =
+      FakeCompositorTimingHistory::Create(
+          settings_.using_synchronous_renderer_compositor);
+  FakeCompositorTimingHistory* timing_history_ptr = timing_history.get();
+  TestScheduler scheduler(task_runner->GetMockTickClock(), &client, settings_,
+                          /*layer_tree_host_id=*/0, task_runner.get(),
+                          std::move(timing_history), &reporting_controller);
+  client.Init(&scheduler, timing_history_ptr, settings_.commit_to_active_tree);
+  scheduler.SetBeginFrameSource(&begin_frame_source);
+  scheduler.SetVisible(true);
+  scheduler.SetCanDraw(true);
+  task_runner->RunUntilIdle();
+
+  // Recorded frame times are rebased so that the trace starts one interval
+  // after the mock clock's current time.
+  const base::TimeDelta offset = task_runner->NowTicks() +
+                                 frames.front().interval -
+                                 frames.front().frame_time;
+
+  // The tracker checks that the trace is well formed, i.e. that BeginFrames
+  // are valid and monotonically increasing.
+  BeginFrameTracker begin_frame_tracker(FROM_HERE);
+  uint64_t sequence_number = viz::BeginFrameArgs::kStartingFrameNumber;
+  for (const SchedulerReplayFrame& frame : frames) {
+    const base::TimeTicks frame_time = frame.frame_time + offset;
+    task_runner->FastForwardBy(frame_time - task_runner->NowTicks());
+
+    client.WillReceiveFrame(frame, frame_time);
+    viz::BeginFrameArgs args = viz::BeginFrameArgs::Create(
+        BEGINFRAME_FROM_HERE, viz::BeginFrameArgs::kManualSourceId,
+        sequence_number++, frame_time, frame.deadline + offset, frame.interval,
+        viz::BeginFrameArgs::NORMAL);
+    begin_frame_tracker.Start(args);
+    begin_frame_source.OnBeginFrame(args);
+    begin_frame_tracker.Finish();
+  }
+  // Let the last frame finish.
+  task_runner->FastForwardBy(frames.back().interval);
+
+  scheduler.Stop();
+  scheduler.SetBeginFrameSource(nullptr);
+  std::sort(stats.latencies.begin(), stats.latencies.end());
+  return stats;
+}
+
+// static
+std::optional<std::vector<SchedulerReplayFrame>> SchedulerReplay::ParseTrace(
+    std::string_view json) {
+  std::optional<base::Value::Dict> trace = base::JSONReader::ReadDict(json);
+  if (!trace) {
+    return std::nullopt;
+  }
+  const base::Value::List* frame_list = trace->FindList("frames");
+  if (!frame_list) {
+    return std::nullopt;
+  }
+
+  std::vector<SchedulerReplayFrame> frames;
+  frames.reserve(frame_list->size());
+  for (const base::Value& value : *frame_list) {
+    const base::Value::Dict* dict = value.GetIfDict();
+    if (!dict) {
+      return std::nullopt;
+    }
+    std::optional<base::TimeDelta> frame_time =
+        FindMicroseconds(*dict, "frame_time_us");
+    std::optional<base::TimeDelta> deadline =
+        FindMicroseconds(*dict, "deadline_us");
+    std::optional<base::TimeDelta> interval =
+        FindMicroseconds(*dict, "interval_us");
+    if (!frame_time || !deadline || !interval || *deadline < *frame_time ||
+        !interval->is_positive()) {
+      return std::nullopt;
+    }
+    if (!frames.empty() &&
+        base::TimeTicks() + *frame_time <= frames.back().frame_time) {
+      return std::nullopt;
+    }
+
+    SchedulerReplayFrame frame;
+    frame.frame_time = base::TimeTicks() + *frame_time;
+    frame.deadline = base::TimeTicks() + *deadline;
+    frame.interval = *interval;
+    if (std::optional<base::TimeDelta> main_thread_duration =
+            FindMicroseconds(*dict, "main_thread_us")) {
+      frame.has_main_frame_update = true;
+      frame.main_thread_duration = *main_thread_duration;
+    }
+    frame.raster_duration =
+        FindMicroseconds(*dict, "raster_us").value_or(base::TimeDelta());
+    frame.has_impl_frame_update =
+        dict->FindBool("impl_update").value_or(false);
+    frames.push_back(frame);
+  }
+  return frames;
+}
+
+}  // namespace cc
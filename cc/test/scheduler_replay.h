@@ -0,0 +1,100 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CC_TEST_SCHEDULER_REPLAY_H_
+#define CC_TEST_SCHEDULER_REPLAY_H_
+
+#include <stddef.h>
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "base/time/time.h"
+#include "cc/scheduler/scheduler_settings.h"
+
+namespace cc {
+
+// One BeginFrame of a recorded frame timing trace, along with the work the
+// main and compositor threads had for it.
+struct SchedulerReplayFrame {
+  // The frame time, deadline and interval of the BeginFrame sent by the
+  // display compositor. Frame times must be increasing.
+  base::TimeTicks frame_time;
+  base::TimeTicks deadline;
+  base::TimeDelta interval;
+
+  // Whether the main thread had an update that started in this frame, and how
+  // long it took from BeginMainFrame to ready to commit.
+  bool has_main_frame_update = false;
+  base::TimeDelta main_thread_duration;
+
+  // Time from commit to ready to activate, i.e. raster of the committed tree.
+  base::TimeDelta raster_duration;
+
+  // Whether the compositor thread had an update of its own in this frame, such
+  // as a compositor driven scroll or animation.
+  bool has_impl_frame_update = false;
+};
+
+struct SchedulerReplayStats {
+  SchedulerReplayStats();
+  SchedulerReplayStats(const SchedulerReplayStats&);
+  ~SchedulerReplayStats();
+
+  SchedulerReplayStats& operator=(const SchedulerReplayStats&);
+
+  double DroppedFramePercent() const;
+  // Percentile of |latencies|, e.g. 0.95 for the 95th percentile. Returns
+  // zero if there are no latencies.
+  base::TimeDelta LatencyPercentile(double percentile) const;
+  base::TimeDelta MeanLatency() const;
+
+  // BeginFrames received while an update was waiting to be drawn.
+  size_t expected_frames = 0;
+  // The subset of |expected_frames| during which nothing was drawn.
+  size_t dropped_frames = 0;
+  size_t drawn_frames = 0;
+  size_t main_frames_committed = 0;
+  size_t main_frames_aborted = 0;
+  // For every drawn update, the time from the frame time of the BeginFrame it
+  // started in to the draw. Sorted.
+  std::vector<base::TimeDelta> latencies;
+};
+
+// Replays frame timing traces against the real Scheduler and
+// SchedulerStateMachine, so that scheduling policies can be compared offline.
+// Time is mocked, the main thread, raster and compositor frame acks are
+// simulated from the durations in the trace, and the same trace and settings
+// always produce the same stats.
+class SchedulerReplay {
+ public:
+  explicit SchedulerReplay(const SchedulerSettings& settings);
+  SchedulerReplay(const SchedulerReplay&) = delete;
+  ~SchedulerReplay();
+
+  SchedulerReplay& operator=(const SchedulerReplay&) = delete;
+
+  // Builds a scheduler, replays |frames| through it and returns the stats. Can
+  // be called repeatedly, each call starts from scratch.
+  SchedulerReplayStats Run(const std::vector<SchedulerReplayFrame>& frames);
+
+  // Parses a trace of the form
+  //   {"frames": [{"frame_time_us": 16667, "deadline_us": 30000,
+  //                "interval_us": 16667, "main_thread_us": 8000,
+  //                "raster_us": 4000, "impl_update": false}, ...]}
+  // where a frame without "main_thread_us" has no main frame update. Times are
+  // in microseconds. Returns nullopt if the trace is malformed.
+  static std::optional<std::vector<SchedulerReplayFrame>> ParseTrace(
+      std::string_view json);
+
+ private:
+  class ReplayClient;
+
+  const SchedulerSettings settings_;
+};
+
+}  // namespace cc
+
+#endif  // CC_TEST_SCHEDULER_REPLAY_H_
@@ -4,6 +4,11 @@
 
 #include "chrome/browser/ash/app_list/search/ranking/sorting.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
 #include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "chrome/browser/ash/app_list/search/common/search_result_util.h"
@@ -47,6 +52,21 @@ void SortCategories(CategoriesList& categories) {
 void SortResults(
     std::vector<raw_ptr<ChromeSearchResult, VectorExperimental>>& results,
     const CategoriesList& categories) {
+  // Map each category to its display position once, rather than scanning
+  // |categories| on every comparison.
+  std::vector<std::pair<Category, size_t>> category_positions;
+  category_positions.reserve(categories.size());
+  for (size_t i = 0; i < categories.size(); ++i) {
+    category_positions.emplace_back(categories[i].category, i);
+  }
+  // If a category appears more than once, the first occurrence wins.
+  const base::flat_map<Category, size_t> category_order(
+      std::move(category_positions));
+  auto category_position = [&](Category category) {
+    auto it = category_order.find(category);
+    return it == category_order.end() ? categories.size() : it->second;
+  };
+
   std::sort(
       results.begin(), results.end(),
       [&](const ChromeSearchResult* a, const ChromeSearchResult* b) {
@@ -71,18 +91,16 @@ void SortResults(
           // Next, sort by categories, except for within best match.
           // |categories_| has been sorted above so the first category in
           // |categories_| should be ranked more highly.
-          for (const auto& category : categories) {
-            if (category.category == a->category()) {
-              return true;
-            }
-            if (category.category == b->category()) {
-              return false;
-            }
-          }
+          const size_t a_position = category_position(a->category());
+          const size_t b_position = category_position(b->category());
           // Any category associated with a result should also be present
           // in |categories_|.
-          NOTREACHED();
-          return false;
+          if (a_position == categories.size() &&
+              b_position == categories.size()) {
+            NOTREACHED();
+            return false;
+          }
+          return a_position < b_position;
         }
 
         if (a->scoring().burn_in_iteration() !=
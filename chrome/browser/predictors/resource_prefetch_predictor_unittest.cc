@@ -65,6 +65,15 @@ class FakeLoadingPredictorKeyValueTable
       data_.erase(key);
   }
   void DeleteAllData(sql::Database* db) override { data_.clear(); }
+  void UpdateAndDeleteData(
+      const std::vector<std::pair<std::string, T>>& entries_to_update,
+      const std::vector<std::string>& keys_to_delete,
+      sql::Database* db) override {
+    for (const auto& entry : entries_to_update)
+      data_[entry.first] = entry.second;
+    for (const auto& key : keys_to_delete)
+      data_.erase(key);
+  }
 
   std::map<std::string, T> data_;
 };
@@ -179,6 +179,15 @@ bool ChromeTracingDelegate::IsActionAllowed(
     return false;
   }
 
+  // Don't upload again if a trace was uploaded recently, so that a trigger
+  // firing repeatedly for the same issue doesn't keep uploading traces.
+  if (action == BackgroundScenarioAction::kUploadTrace &&
+      state.DidRecentlyUploadTrace()) {
+    tracing::RecordDisallowedMetric(
+        tracing::TracingFinalizationDisallowedReason::kTraceUploadedRecently);
+    return false;
+  }
+
   return true;
 }
 
@@ -202,8 +211,13 @@ bool ChromeTracingDelegate::OnBackgroundTracingIdle(
       BackgroundTracingStateManager::GetInstance();
   state.OnTracingStopped();
 
-  return IsActionAllowed(BackgroundScenarioAction::kUploadTrace,
-                         requires_anonymized_data);
+  if (!IsActionAllowed(BackgroundScenarioAction::kUploadTrace,
+                       requires_anonymized_data)) {
+    return false;
+  }
+
+  state.OnTraceUploaded();
+  return true;
 }
 
 bool ChromeTracingDelegate::ShouldSaveUnuploadedTrace() const {
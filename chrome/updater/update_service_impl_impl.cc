@@ -124,15 +124,29 @@ void GetComponents(
               [](const std::vector<std::string>& ids,
                  const std::vector<std::optional<update_client::CrxComponent>>&
                      unordered) {
-                // Re-order the vector to match the order of `ids`.
+                // Re-order the vector to match the order of `ids`. Index the
+                // components by app id first so that this stays linear in the
+                // number of apps; if an app id appears more than once, the
+                // first component wins.
+                std::vector<std::pair<std::string_view,
+                                      const update_client::CrxComponent*>>
+                    entries;
+                entries.reserve(unordered.size());
+                for (const auto& component : unordered) {
+                  if (component) {
+                    entries.emplace_back(component->app_id, &*component);
+                  }
+                }
+                const base::flat_map<std::string_view,
+                                     const update_client::CrxComponent*>
+                    components_by_id(std::move(entries));
                 std::vector<std::optional<update_client::CrxComponent>> ordered;
+                ordered.reserve(ids.size());
                 for (const auto& id : ids) {
-                  auto it = std::find_if(
-                      unordered.begin(), unordered.end(),
-                      [&id](std::optional<update_client::CrxComponent> v) {
-                        return v && v->app_id == id;
-                      });
-                  ordered.push_back(it != unordered.end() ? *it : std::nullopt);
+                  auto it = components_by_id.find(id);
+                  ordered.push_back(it != components_by_id.end()
+                                        ? std::make_optional(*it->second)
+                                        : std::nullopt);
                 }
                 return ordered;
               },
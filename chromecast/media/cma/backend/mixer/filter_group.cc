@@ -4,6 +4,8 @@
 
 #include "chromecast/media/cma/backend/mixer/filter_group.h"
 
+#include <stdint.h>
+
 #include <algorithm>
 
 #include "base/logging.h"
@@ -25,6 +27,24 @@ namespace media {
 
 namespace {
 
+bool IsVectorMathAligned(const float* data) {
+  return (reinterpret_cast<uintptr_t>(data) &
+          (::media::vector_math::kRequiredAlignment - 1)) == 0;
+}
+
+// Adds |len| samples of |src| to |dest|. Uses the runtime-selected SIMD
+// kernel from vector_math when both buffers meet its alignment requirement;
+// post-processor output buffers are not guaranteed to.
+void MixInto(const float* src, int len, float* dest) {
+  if (IsVectorMathAligned(src) && IsVectorMathAligned(dest)) {
+    ::media::vector_math::FMAC(src, 1.0f, len, dest);
+    return;
+  }
+  for (int i = 0; i < len; ++i) {
+    dest[i] += src[i];
+  }
+}
+
 bool ParseVolumeLimit(const base::Value::Dict* dict, float* min, float* max) {
   auto min_value = dict->FindDouble("min");
   auto max_value = dict->FindDouble("max");
@@ -230,19 +250,16 @@ float FilterGroup::MixAndFilter(
     if (input.group->last_volume() > 0.0f) {
       float* buffer = input.channel_mixer->Transform(
           input.group->GetOutputBuffer(), input_frames_per_write_);
-      for (int i = 0; i < input_frames_per_write_ * num_channels_; ++i) {
-        interleaved_[i] += buffer[i];
-      }
+      MixInto(buffer, input_frames_per_write_ * num_channels_,
+              interleaved_.data());
     }
   }
 
   // Mix direct inputs.
   for (MixerInput* input : active_inputs_) {
     if (input->has_render_output()) {
-      float* buffer = input->RenderedAudioBuffer();
-      for (int i = 0; i < input_frames_per_write_ * num_channels_; ++i) {
-        interleaved_[i] += buffer[i];
-      }
+      MixInto(input->RenderedAudioBuffer(),
+              input_frames_per_write_ * num_channels_, interleaved_.data());
     }
   }
 
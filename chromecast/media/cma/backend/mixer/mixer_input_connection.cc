@@ -47,6 +47,9 @@ constexpr base::TimeDelta kDefaultFillTime = base::Milliseconds(5);
 constexpr base::TimeDelta kDefaultFadeTime = base::Milliseconds(5);
 constexpr base::TimeDelta kInactivityTimeout = base::Seconds(5);
 constexpr int64_t kDefaultMaxTimestampError = 2000;
+// Maximum number of consumed buffers held for release on the IO thread; any
+// beyond this are released directly on the mixer thread.
+constexpr size_t kMaxConsumedBuffers = 64;
 // Max absolute value for timestamp errors, to avoid overflow/underflow.
 constexpr int64_t kTimestampErrorLimit = 1000000;
 
@@ -426,6 +429,9 @@ MixerInputConnection::MixerInputConnection(
   post_stream_underrun_task_ = base::BindRepeating(
       &MixerInputConnection::PostStreamUnderrun, weak_this_);
 
+  consumed_buffers_.reserve(kMaxConsumedBuffers);
+  io_consumed_buffers_.reserve(kMaxConsumedBuffers);
+
   CreateBufferPool(fill_size_);
   mixer_->AddInput(this);
 
@@ -801,6 +807,9 @@ void MixerInputConnection::WritePcm(scoped_refptr<net::IOBuffer> data) {
   bool queued;
   {
     base::AutoLock lock(lock_);
+    // Take the buffers consumed by the mixer thread without allocating; they
+    // are released below, outside of |lock_|.
+    consumed_buffers_.swap(io_consumed_buffers_);
     if (state_ == State::kUninitialized ||
         queued_frames_ >= max_queued_frames_) {
       if (pending_data_) {
@@ -818,6 +827,8 @@ void MixerInputConnection::WritePcm(scoped_refptr<net::IOBuffer> data) {
     }
   }
 
+  io_consumed_buffers_.clear();
+
   if (queued) {
     mixer_service::Generic message;
     auto* push_result = message.mutable_push_result();
@@ -1015,7 +1026,7 @@ void MixerInputConnection::DropAudio(int64_t frames_to_drop) {
 
     queued_frames_ -= first_buffer_frames;
     frames_to_drop -= first_buffer_frames;
-    queue_.pop_front();
+    PopFrontBuffer();
     current_buffer_offset_ = 0;
   }
 
@@ -1226,7 +1237,7 @@ int MixerInputConnection::FillTimestampedAudio(int num_frames,
       }
       if (frames_to_crop >= buffer_frames) {
         queued_frames_ -= buffer_frames;
-        queue_.pop_front();
+        PopFrontBuffer();
         current_buffer_offset_ = 0;
         if (after_silence) {
           continue;  // Continue to next buffer in the queue.
@@ -1264,6 +1275,16 @@ int MixerInputConnection::FillTimestampedAudio(int num_frames,
   return filled;
 }
 
+void MixerInputConnection::PopFrontBuffer() {
+  // Dropping the last reference returns the buffer to |buffer_pool_|, which
+  // takes the pool's lock; defer that to the IO thread when possible so the
+  // mixer thread doesn't contend with buffer allocation there.
+  if (consumed_buffers_.size() < consumed_buffers_.capacity()) {
+    consumed_buffers_.push_back(std::move(queue_.front()));
+  }
+  queue_.pop_front();
+}
+
 int MixerInputConnection::FillFromQueue(int num_frames,
                                         float* const* channels,
                                         int write_offset) {
@@ -1286,7 +1307,7 @@ int MixerInputConnection::FillFromQueue(int num_frames,
 
   current_buffer_offset_ += frames_to_copy;
   if (current_buffer_offset_ == buffer_frames) {
-    queue_.pop_front();
+    PopFrontBuffer();
     current_buffer_offset_ = 0;
   }
   return frames_to_copy;
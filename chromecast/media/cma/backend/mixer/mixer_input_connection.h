@@ -8,6 +8,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/containers/circular_deque.h"
 #include "base/functional/callback.h"
@@ -131,6 +132,9 @@ class MixerInputConnection : public mixer_service::MixerSocket::Delegate,
                            int64_t expected_playout_time,
                            float* const* channels,
                            bool after_silence) EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Removes the front buffer of |queue_| on the mixer thread, keeping it in
+  // |consumed_buffers_| so that it is released on the IO thread.
+  void PopFrontBuffer() EXCLUSIVE_LOCKS_REQUIRED(lock_);
   int FillFromQueue(int num_frames, float* const* channels, int write_offset)
       EXCLUSIVE_LOCKS_REQUIRED(lock_);
   void LogUnderrun(int num_frames, int filled) EXCLUSIVE_LOCKS_REQUIRED(lock_);
@@ -188,6 +192,7 @@ class MixerInputConnection : public mixer_service::MixerSocket::Delegate,
   base::OneShotTimer inactivity_timer_;
   bool connection_error_ = false;
   int buffer_pool_frames_ = 0;
+  std::vector<scoped_refptr<net::IOBuffer>> io_consumed_buffers_;
 
   base::Lock lock_;
   State state_ GUARDED_BY(lock_) = State::kUninitialized;
@@ -195,6 +200,11 @@ class MixerInputConnection : public mixer_service::MixerSocket::Delegate,
   bool mixer_error_ GUARDED_BY(lock_) = false;
   scoped_refptr<net::IOBuffer> pending_data_ GUARDED_BY(lock_);
   base::circular_deque<scoped_refptr<net::IOBuffer>> queue_ GUARDED_BY(lock_);
+  // Buffers consumed by the mixer thread, waiting to be released on the IO
+  // thread. Swapped with |io_consumed_buffers_| (both have a fixed reserved
+  // capacity) so that neither thread allocates while holding |lock_|.
+  std::vector<scoped_refptr<net::IOBuffer>> consumed_buffers_
+      GUARDED_BY(lock_);
   int queued_frames_ GUARDED_BY(lock_) = 0;
   RenderingDelay mixer_rendering_delay_ GUARDED_BY(lock_);
   RenderingDelay next_delay_ GUARDED_BY(lock_);
@@ -2480,6 +2480,7 @@ void CrosNetworkConfig::GetNetworkStateList(
       break;
   }
   std::vector<mojom::NetworkStatePropertiesPtr> result;
+  result.reserve(networks.size());
   for (const NetworkState* network : networks) {
     if (network->type() == shill::kTypeEthernetEap) {
       // EthernetEap is used by Shill to store EAP properties and does not
@@ -2500,6 +2501,7 @@ void CrosNetworkConfig::GetDeviceStateList(
   NetworkStateHandler::DeviceStateList devices;
   network_state_handler_->GetDeviceList(&devices);
   std::vector<mojom::DeviceStatePropertiesPtr> result;
+  result.reserve(devices.size());
   for (const DeviceState* device : devices) {
     mojom::DeviceStateType technology_state =
         GetMojoDeviceStateType(network_state_handler_->GetTechnologyState(
@@ -324,17 +324,18 @@ void AffiliationBackend::OnFetchSucceeded(
     }
   }
 
+  const GroupedFacets no_group;
   for (const AffiliatedFacets& affiliated_facets : result->affiliations) {
     AffiliatedFacetsWithUpdateTime affiliation;
     affiliation.facets = affiliated_facets;
     affiliation.last_update_time = clock_->Now();
     std::vector<AffiliatedFacetsWithUpdateTime> obsoleted_affiliations;
-    GroupedFacets group;
-    if (map_facet_to_group.count(affiliated_facets[0].uri.canonical_spec())) {
-      // Affiliations are subset of group. So |map_facet_to_group| must hold a
-      // vector to the whole group.
-      group = *map_facet_to_group[affiliated_facets[0].uri.canonical_spec()];
-    }
+    // Affiliations are subset of group. So |map_facet_to_group| must hold a
+    // pointer to the whole group, which is referenced rather than copied.
+    auto group_it =
+        map_facet_to_group.find(affiliated_facets[0].uri.canonical_spec());
+    const GroupedFacets& group =
+        group_it != map_facet_to_group.end() ? *group_it->second : no_group;
     cache_->StoreAndRemoveConflicting(affiliation, group,
                                       &obsoleted_affiliations);
 
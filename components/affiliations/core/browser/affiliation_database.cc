@@ -9,6 +9,7 @@
 #include <memory>
 
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_set.h"
@@ -449,7 +450,7 @@ void AffiliationDatabase::StoreAndRemoveConflicting(
     if (GetAffiliationsAndBrandingForFacetURI(facet.uri, &old_affiliation)) {
       if (!AreEquivalenceClassesEqual(old_affiliation.facets,
                                       affiliation.facets)) {
-        removed_affiliations->push_back(old_affiliation);
+        removed_affiliations->push_back(std::move(old_affiliation));
       }
       DeleteAffiliationsAndBrandingForFacetURI(facet.uri);
     }
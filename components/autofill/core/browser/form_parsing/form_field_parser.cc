@@ -134,6 +134,9 @@ void FormFieldParser::ParseFormFields(
     FieldCandidatesMap& field_candidates) {
   std::vector<raw_ptr<AutofillField, VectorExperimental>> processed_fields =
       RemoveCheckableFields(fields);
+  // Every pass below may add candidates for any field. Reserving up front
+  // avoids repeatedly growing the flat_map on forms with many fields.
+  field_candidates.reserve(field_candidates.size() + fields.size());
 
   // Email pass.
   ParseFormFieldsPass(EmailFieldParser::Parse, context, processed_fields,
@@ -561,6 +564,7 @@ FormFieldParser::RemoveCheckableFields(
     const std::vector<std::unique_ptr<AutofillField>>& fields) {
   // Set up a working copy of the fields to be processed.
   std::vector<raw_ptr<AutofillField, VectorExperimental>> processed_fields;
+  processed_fields.reserve(fields.size());
   for (const auto& field : fields) {
     // Ignore checkable fields as they interfere with parsers assuming context.
     // Eg., while parsing address, "Is PO box" checkbox after ADDRESS_LINE1
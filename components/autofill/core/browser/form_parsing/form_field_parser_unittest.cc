@@ -390,4 +390,25 @@ TEST_P(FormFieldParserTest, ParseStandaloneEmailSimilarToAddressName) {
   TestClassificationExpectations();
 }
 
+// Tests that RegexMatchesCache remembers results per (input, pattern) pair and
+// evicts the least recently used entry once it is full.
+TEST(RegexMatchesCacheTest, GetAndPut) {
+  RegexMatchesCache cache(/*capacity=*/2);
+  RegexMatchesCache::Key key1 = RegexMatchesCache::BuildKey(u"a", u"b");
+  RegexMatchesCache::Key key2 = RegexMatchesCache::BuildKey(u"a", u"c");
+  RegexMatchesCache::Key key3 = RegexMatchesCache::BuildKey(u"d", u"b");
+
+  EXPECT_EQ(cache.Get(key1), std::nullopt);
+  cache.Put(key1, true);
+  cache.Put(key2, false);
+  EXPECT_EQ(cache.Get(key1), true);
+  EXPECT_EQ(cache.Get(key2), false);
+
+  // `key1` is now the least recently used entry.
+  cache.Put(key3, true);
+  EXPECT_EQ(cache.Get(key1), std::nullopt);
+  EXPECT_EQ(cache.Get(key2), false);
+  EXPECT_EQ(cache.Get(key3), true);
+}
+
 }  // namespace autofill
@@ -261,13 +261,33 @@ TitledUrlIndex::TitledUrlNodeSet TitledUrlIndex::RetrieveNodesMatchingAllTerms(
     const std::vector<std::u16string>& terms,
     query_parser::MatchingAlgorithm matching_algorithm) const {
   DCHECK(!terms.empty());
-  TitledUrlNodeSet matches =
-      RetrieveNodesMatchingTerm(terms[0], matching_algorithm);
-  for (size_t i = 1; i < terms.size() && !matches.empty(); ++i) {
-    TitledUrlNodeSet term_matches =
-        RetrieveNodesMatchingTerm(terms[i], matching_algorithm);
+  std::vector<TitledUrlNodes> matches_per_term;
+  matches_per_term.reserve(terms.size());
+  for (const std::u16string& term : terms) {
+    TitledUrlNodes term_matches =
+        RetrieveNodesMatchingTerm(term, matching_algorithm);
+    if (term_matches.empty())
+      return {};
+    matches_per_term.push_back(std::move(term_matches));
+  }
+
+  // Start from the least frequent term, so that only its (smallest) list of
+  // nodes has to be sorted, and the other lists only need to be scanned. With
+  // many bookmarks, terms like 'https' match most nodes.
+  base::ranges::sort(
+      matches_per_term,
+      [](size_t first, size_t second) { return first < second; },
+      [](const auto& term_matches) { return term_matches.size(); });
+
+  TitledUrlNodeSet matches(std::move(matches_per_term[0]));
+  for (size_t i = 1; i < matches_per_term.size() && !matches.empty(); ++i) {
     // Compute intersection between the two sets.
-    base::EraseIf(matches, base::IsNotIn<TitledUrlNodeSet>(term_matches));
+    TitledUrlNodes matches_in_both;
+    for (const TitledUrlNode* node : matches_per_term[i]) {
+      if (matches.contains(node))
+        matches_in_both.push_back(node);
+    }
+    matches = TitledUrlNodeSet(std::move(matches_in_both));
   }
 
   return matches;
@@ -672,6 +672,31 @@ TEST_F(TitledUrlIndexTest, RetrieveNodesMatchingAllTerms) {
   };
 }
 
+TEST_F(TitledUrlIndexTest, RetrieveNodesMatchingAllTerms_CommonTermFirst) {
+  TitledUrlNode* node1 = AddNode("common rare", GURL("http://foo.com")).first;
+  TitledUrlNode* node2 =
+      AddNode("common rarest common", GURL("http://bar.com")).first;
+  AddNode("common", GURL("http://baz.com"));
+  AddNode("something else", GURL("http://qux.com"));
+
+  auto matches = index()->RetrieveNodesMatchingAllTerms(
+      {u"common", u"rare"}, query_parser::MatchingAlgorithm::DEFAULT);
+  EXPECT_EQ(matches.size(), 2u);
+  EXPECT_TRUE(matches.contains(node1));
+  EXPECT_TRUE(matches.contains(node2));
+
+  matches = index()->RetrieveNodesMatchingAllTerms(
+      {u"common", u"rarest", u"bar"}, query_parser::MatchingAlgorithm::DEFAULT);
+  EXPECT_EQ(matches.size(), 1u);
+  EXPECT_TRUE(matches.contains(node2));
+
+  EXPECT_TRUE(index()
+                  ->RetrieveNodesMatchingAllTerms(
+                      {u"common", u"missing"},
+                      query_parser::MatchingAlgorithm::DEFAULT)
+                  .empty());
+}
+
 TEST_F(TitledUrlIndexTest, RetrieveNodesMatchingAnyTerms_PathMatch) {
   ResetNodes();
   AddNode("term1 term2 other xyz ab", GURL("http://foo.com"));
@@ -6,8 +6,8 @@
 
 #include <math.h>
 
+#include <algorithm>
 #include <limits>
-#include <map>
 #include <utility>
 
 #include "base/bit_cast.h"
@@ -15,6 +15,7 @@
 #include "base/notreached.h"
 #include "base/numerics/checked_math.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_util.h"
 #include "components/cbor/constants.h"
 #include "components/cbor/float_conversions.h"
@@ -322,9 +323,9 @@ std::optional<Value> Reader::ReadStringContent(
     return std::nullopt;
   }
 
-  std::string cbor_string(bytes->begin(), bytes->end());
-  if (base::IsStringUTF8(cbor_string)) {
-    return Value(std::move(cbor_string));
+  // Validate before copying so that invalid input isn't copied twice.
+  if (base::IsStringUTF8(base::as_string_view(*bytes))) {
+    return Value(std::string(base::as_string_view(*bytes)));
   }
 
   if (config.allow_invalid_utf8) {
@@ -371,7 +372,12 @@ std::optional<Value> Reader::ReadMapContent(
     int max_nesting_level) {
   const uint64_t length = header.value;
 
-  std::map<Value, Value, Value::Less> cbor_map;
+  // Entries are kept sorted by key so that the map can be built from them
+  // directly, without re-sorting or cloning any key. Canonical input has its
+  // keys in order already, in which case every entry is appended.
+  Value::MapValue::container_type entries;
+  // Every entry takes at least two bytes, which bounds the untrusted length.
+  entries.reserve(std::min<uint64_t>(length, rest_.size() / 2));
   for (uint64_t i = 0; i < length; ++i) {
     std::optional<Value> key =
         DecodeCompleteDataItem(config, max_nesting_level - 1);
@@ -394,24 +400,26 @@ std::optional<Value> Reader::ReadMapContent(
         error_code_ = DecoderError::INCORRECT_MAP_KEY_TYPE;
         return std::nullopt;
     }
-    if (IsDuplicateKey(key.value(), cbor_map))
-      return std::nullopt;
 
-    if (!config.allow_and_canonicalize_out_of_order_keys &&
-        !IsKeyInOrder(key.value(), cbor_map)) {
-      return std::nullopt;
+    const Value::Less less;
+    auto position = base::ranges::lower_bound(
+        entries, key.value(), less,
+        &Value::MapValue::container_type::value_type::first);
+    if (position != entries.end()) {
+      if (!less(key.value(), position->first)) {
+        error_code_ = DecoderError::DUPLICATE_KEY;
+        return std::nullopt;
+      }
+      if (!config.allow_and_canonicalize_out_of_order_keys) {
+        error_code_ = DecoderError::OUT_OF_ORDER_KEY;
+        return std::nullopt;
+      }
     }
 
-    cbor_map.emplace(std::move(key.value()), std::move(value.value()));
+    entries.emplace(position, std::move(key.value()), std::move(value.value()));
   }
 
-  Value::MapValue map;
-  map.reserve(cbor_map.size());
-  // TODO(crbug.com/40205788): when Chromium switches to C++17, this code can be
-  // optimized using std::map::extract().
-  for (auto& it : cbor_map)
-    map.emplace_hint(map.end(), it.first.Clone(), std::move(it.second));
-  return Value(std::move(map));
+  return Value(Value::MapValue(base::sorted_unique, std::move(entries)));
 }
 
 std::optional<uint8_t> Reader::ReadByte() {
@@ -444,30 +452,6 @@ bool Reader::IsEncodingMinimal(uint8_t additional_bytes, uint64_t uint_data) {
   return true;
 }
 
-bool Reader::IsKeyInOrder(const Value& new_key,
-                          const std::map<Value, Value, Value::Less>& map) {
-  if (map.empty()) {
-    return true;
-  }
-
-  const auto& max_current_key = map.rbegin()->first;
-  const auto less = map.key_comp();
-  if (!less(max_current_key, new_key)) {
-    error_code_ = DecoderError::OUT_OF_ORDER_KEY;
-    return false;
-  }
-  return true;
-}
-
-bool Reader::IsDuplicateKey(const Value& new_key,
-                            const std::map<Value, Value, Value::Less>& map) {
-  if (map.find(new_key) == map.end()) {
-    return false;
-  }
-  error_code_ = DecoderError::DUPLICATE_KEY;
-  return true;
-}
-
 // static
 const char* Reader::ErrorCodeToString(DecoderError error) {
   switch (error) {
@@ -113,12 +113,12 @@ std::unique_ptr<Rule> OriginValueMap::GetRule(
     // Iterate the entries in until a match is found. Since the rules are
     // stored in the order of decreasing precedence, the most specific match
     // is found first.
+    const bool active_expiry = base::FeatureList::IsEnabled(
+        content_settings::features::kActiveContentSettingExpiry);
     for (const auto& entry : it->second) {
       if (entry.first.primary_pattern.Matches(primary_url) &&
           entry.first.secondary_pattern.Matches(secondary_url) &&
-          (base::FeatureList::IsEnabled(
-               content_settings::features::kActiveContentSettingExpiry) ||
-           !entry.second.metadata.IsExpired(clock_))) {
+          (active_expiry || !entry.second.metadata.IsExpired(clock_))) {
         result = &entry;
         break;
       }
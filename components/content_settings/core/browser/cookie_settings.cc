@@ -264,7 +264,7 @@ bool CookieSettings::HasAnyFrameRequestedStorageAccess(
   ContentSettingsForOneType settings =
       host_content_settings_map_->GetSettingsForOneType(
           ContentSettingsType::STORAGE_ACCESS);
-  for (ContentSettingPatternSource source : settings) {
+  for (const ContentSettingPatternSource& source : settings) {
     // Skip default exceptions.
     if (source.primary_pattern.MatchesAllHosts() ||
         source.secondary_pattern.MatchesAllHosts()) {
@@ -349,7 +349,7 @@ bool CookieSettings::IsThirdPartyCookiesAllowedScheme(
   const content_settings::ContentSettingsInfo* content_settings_info =
       content_settings::ContentSettingsRegistry::GetInstance()->Get(
           ContentSettingsType::COOKIES);
-  const std::vector<std::string> allowed_schemes =
+  const std::vector<std::string>& allowed_schemes =
       content_settings_info->third_party_cookie_allowed_secondary_schemes();
   return base::Contains(allowed_schemes, scheme);
 }
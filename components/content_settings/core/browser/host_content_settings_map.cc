@@ -1179,14 +1179,15 @@ base::Value HostContentSettingsMap::GetContentSettingValueAndPatterns(
     content_settings::RuleMetaData* metadata,
     base::Clock* clock) {
   if (rule_iterator) {
+    const bool active_expiry = base::FeatureList::IsEnabled(
+        content_settings::features::kActiveContentSettingExpiry);
     while (rule_iterator->HasNext()) {
       std::unique_ptr<content_settings::Rule> rule = rule_iterator->Next();
       // Refer to comment near the definition `kEagerExpiryBuffer` regarding
       // provisioning and CPU contention.
       if (rule->primary_pattern.Matches(primary_url) &&
           rule->secondary_pattern.Matches(secondary_url) &&
-          (base::FeatureList::IsEnabled(
-               content_settings::features::kActiveContentSettingExpiry) ||
+          (active_expiry ||
            (rule->metadata.expiration().is_null() ||
             (rule->metadata.expiration() > clock->Now())))) {
         return GetContentSettingValueAndPatterns(rule.get(), primary_pattern,
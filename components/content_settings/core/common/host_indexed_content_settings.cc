@@ -65,12 +65,13 @@ const RuleEntry* FindContentSetting(const GURL& primary_url,
                                     const GURL& secondary_url,
                                     const Rules& settings,
                                     base::Clock* clock) {
+  // Query the feature state once rather than for every matching entry.
+  const bool active_expiry = base::FeatureList::IsEnabled(
+      content_settings::features::kActiveContentSettingExpiry);
   const auto it = base::ranges::find_if(settings, [&](const auto& entry) {
     return entry.first.primary_pattern.Matches(primary_url) &&
            entry.first.secondary_pattern.Matches(secondary_url) &&
-           (base::FeatureList::IsEnabled(
-                content_settings::features::kActiveContentSettingExpiry) ||
-            !entry.second.metadata.IsExpired(clock));
+           (active_expiry || !entry.second.metadata.IsExpired(clock));
   });
   return it == settings.end() ? nullptr : &*it;
 }
@@ -12,6 +12,7 @@
 #include <optional>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "base/base64.h"
 #include "base/files/file.h"
@@ -72,15 +73,22 @@ uint32_t ReadAndHashLittleEndianUInt32(base::File* file,
   return buffer[3] << 24 | buffer[2] << 16 | buffer[1] << 8 | buffer[0];
 }
 
+// Size of the chunks the archive is read and hashed in. Archives can be
+// hundreds of megabytes (e.g. ML models), so use chunks large enough to keep
+// the number of reads and verifier updates low.
+constexpr int kArchiveChunkSize = 1 << 20;
+
 // Read to the end of the file, updating the hash and all verifiers.
 bool ReadHashAndVerifyArchive(base::File* file,
                               crypto::SecureHash* hash,
                               const VerifierCollection& verifiers) {
-  uint8_t buffer[1 << 12] = {};
-  size_t len = 0;
-  while ((len = ReadAndHashBuffer(buffer, std::size(buffer), file, hash)) > 0) {
+  std::vector<uint8_t> buffer(kArchiveChunkSize);
+  int len = 0;
+  while ((len = ReadAndHashBuffer(buffer.data(), kArchiveChunkSize, file,
+                                  hash)) > 0) {
     for (auto& verifier : verifiers)
-      verifier->VerifyUpdate(base::make_span(buffer, len));
+      verifier->VerifyUpdate(
+          base::make_span(buffer.data(), static_cast<size_t>(len)));
   }
   for (auto& verifier : verifiers) {
     if (!verifier->VerifyFinal())
@@ -4,6 +4,7 @@
 
 #include "components/discardable_memory/common/discardable_shared_memory_heap.h"
 
+#include <algorithm>
 #include <bit>
 #include <memory>
 #include <string>
@@ -241,24 +242,25 @@ std::unique_ptr<DiscardableSharedMemoryHeap::Span>
 DiscardableSharedMemoryHeap::SearchFreeLists(size_t blocks, size_t slack) {
   DCHECK(blocks);
 
-  size_t length = blocks;
-  size_t max_length = blocks + slack;
+  const size_t max_length = blocks + slack;
+  const size_t overflow_index = std::size(free_spans_) - 1;
 
-  // Search array of free lists for a suitable span.
-  while (length - 1 < std::size(free_spans_) - 1) {
-    const base::LinkedList<Span>& free_spans = free_spans_[length - 1];
-    if (!free_spans.empty()) {
+  // Search array of free lists for a suitable span, skipping empty lists.
+  if (blocks - 1 < overflow_index) {
+    const size_t last_index = std::min(max_length - 1, overflow_index - 1);
+    const size_t index = FindNonEmptyFreeList(blocks - 1, last_index);
+    if (index <= last_index) {
       // Return the most recently used span located in tail.
-      return Carve(free_spans.tail()->value(), blocks);
+      return Carve(free_spans_[index].tail()->value(), blocks);
     }
 
-    // Return early after surpassing |max_length|.
-    if (++length > max_length)
+    // Return early if |max_length| doesn't reach the overflow free list.
+    if (max_length - 1 < overflow_index)
       return nullptr;
   }
 
   const base::LinkedList<Span>& overflow_free_spans =
-      free_spans_[std::size(free_spans_) - 1];
+      free_spans_[overflow_index];
 
   // Search overflow free list for a suitable span. Starting with the most
   // recently used span located in tail and moving towards head.
@@ -379,15 +381,48 @@ void DiscardableSharedMemoryHeap::InsertIntoFreeList(
   size_t index = std::min(span->length_, std::size(free_spans_)) - 1;
 
   free_spans_[index].Append(span.release());
+  non_empty_free_lists_[index / kFreeListBitmapWordBits] |=
+      uint64_t{1} << (index % kFreeListBitmapWordBits);
 }
 
 std::unique_ptr<DiscardableSharedMemoryHeap::Span>
 DiscardableSharedMemoryHeap::RemoveFromFreeList(Span* span) {
   DCHECK(IsInFreeList(span));
   span->RemoveFromList();
+
+  // |length_| is never changed while a span is in a free list, so it still
+  // identifies the list the span was removed from.
+  size_t index = std::min(span->length_, std::size(free_spans_)) - 1;
+  if (free_spans_[index].empty()) {
+    non_empty_free_lists_[index / kFreeListBitmapWordBits] &=
+        ~(uint64_t{1} << (index % kFreeListBitmapWordBits));
+  }
   return base::WrapUnique(span);
 }
 
+size_t DiscardableSharedMemoryHeap::FindNonEmptyFreeList(size_t first,
+                                                         size_t last) const {
+  DCHECK_LE(first, last);
+  DCHECK_LT(last, std::size(free_spans_));
+
+  size_t word = first / kFreeListBitmapWordBits;
+  uint64_t bits = non_empty_free_lists_[word] &
+                  (~uint64_t{0} << (first % kFreeListBitmapWordBits));
+  const size_t last_word = last / kFreeListBitmapWordBits;
+  while (!bits) {
+    if (++word > last_word)
+      return last + 1;
+    bits = non_empty_free_lists_[word];
+  }
+
+  const size_t index =
+      word * kFreeListBitmapWordBits + std::countr_zero(bits);
+  if (index > last)
+    return last + 1;
+  DCHECK(!free_spans_[index].empty());
+  return index;
+}
+
 std::unique_ptr<DiscardableSharedMemoryHeap::Span>
 DiscardableSharedMemoryHeap::Carve(Span* span, size_t blocks) {
   std::unique_ptr<Span> serving = RemoveFromFreeList(span);
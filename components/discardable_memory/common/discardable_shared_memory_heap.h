@@ -182,6 +182,10 @@ class DISCARDABLE_MEMORY_EXPORT DiscardableSharedMemoryHeap {
 
   void InsertIntoFreeList(std::unique_ptr<Span> span);
   std::unique_ptr<Span> RemoveFromFreeList(Span* span);
+
+  // Returns the index of the first non-empty free list in [|first|, |last|],
+  // or |last| + 1 if all of those free lists are empty.
+  size_t FindNonEmptyFreeList(size_t first, size_t last) const;
   std::unique_ptr<Span> Carve(Span* span, size_t blocks);
   void RegisterSpan(Span* span);
   void UnregisterSpan(Span* span);
@@ -215,6 +219,12 @@ class DISCARDABLE_MEMORY_EXPORT DiscardableSharedMemoryHeap {
   // is a free list of runs that consist of k blocks. The 256th entry is a
   // free list of runs that have length >= 256 blocks.
   base::LinkedList<Span> free_spans_[256];
+
+  // Bitmap with one bit per entry of |free_spans_|, set when that free list
+  // is non-empty. Lets SearchFreeLists() skip runs of empty lists without
+  // touching them.
+  static constexpr size_t kFreeListBitmapWordBits = 64;
+  uint64_t non_empty_free_lists_[256 / kFreeListBitmapWordBits] = {};
 };
 
 }  // namespace discardable_memory
@@ -289,6 +289,46 @@ TEST(DiscardableSharedMemoryHeapTest, Slack) {
   heap.MergeIntoFreeLists(std::move(span));
 }
 
+TEST(DiscardableSharedMemoryHeapTest, SlackAcrossFreeListBitmapWords) {
+  size_t block_size = base::GetPageSize();
+  DiscardableSharedMemoryHeap heap;
+  int next_discardable_shared_memory_id = 0;
+
+  // Free spans of 130 and 300 blocks end up in free lists that are tracked by
+  // different words of the non-empty free list bitmap, and in the overflow
+  // free list respectively.
+  for (size_t blocks : {130u, 300u}) {
+    size_t memory_size = block_size * blocks;
+    std::unique_ptr<base::DiscardableSharedMemory> memory(
+        new base::DiscardableSharedMemory);
+    ASSERT_TRUE(memory->CreateAndMap(memory_size));
+    heap.MergeIntoFreeLists(heap.Grow(std::move(memory), memory_size,
+                                      next_discardable_shared_memory_id++,
+                                      base::BindOnce(NullTask)));
+  }
+
+  // No free span that is less or equal to 2 + 127.
+  EXPECT_FALSE(heap.SearchFreeLists(2, 127));
+
+  std::unique_ptr<DiscardableSharedMemoryHeap::Span> span =
+      heap.SearchFreeLists(2, 128);
+  ASSERT_TRUE(span);
+  EXPECT_EQ(2u, span->length());
+  heap.MergeIntoFreeLists(std::move(span));
+
+  // Requests that can't be served by the 130 block span fall through to the
+  // overflow free list.
+  span = heap.SearchFreeLists(200, 100);
+  ASSERT_TRUE(span);
+  EXPECT_EQ(200u, span->length());
+  heap.MergeIntoFreeLists(std::move(span));
+
+  // The 300 block span is available again after being merged back.
+  span = heap.SearchFreeLists(300, 0);
+  ASSERT_TRUE(span);
+  heap.MergeIntoFreeLists(std::move(span));
+}
+
 void OnDeleted(bool* deleted) {
   *deleted = true;
 }
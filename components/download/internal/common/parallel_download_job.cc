@@ -5,6 +5,8 @@
 #include "components/download/internal/common/parallel_download_job.h"
 
 #include <algorithm>
+#include <optional>
+#include <set>
 
 #include "base/functional/bind.h"
 #include "base/metrics/histogram_macros.h"
@@ -58,6 +60,7 @@ void ParallelDownloadJob::Cancel(bool user_cancel) {
     return;
   }
 
+  reslice_timer_.Stop();
   for (auto& worker : workers_)
     worker.second->Cancel(user_cancel);
 }
@@ -102,6 +105,10 @@ int ParallelDownloadJob::GetMinRemainingTimeInSeconds() const {
   return GetParallelRequestRemainingTimeConfig().InSeconds();
 }
 
+base::TimeDelta ParallelDownloadJob::GetReslicePeriod() const {
+  return GetParallelRequestReslicePeriodConfig();
+}
+
 void ParallelDownloadJob::CancelRequestWithOffset(int64_t offset) {
   if (initial_request_offset_ == offset) {
     DownloadJobImpl::Cancel(false);
@@ -202,6 +209,55 @@ void ParallelDownloadJob::BuildParallelRequests() {
   ForkSubRequests(slices_to_download);
 
   requests_sent_ = true;
+
+  const base::TimeDelta reslice_period = GetReslicePeriod();
+  if (reslice_period.is_positive()) {
+    reslice_timer_.Start(FROM_HERE, reslice_period, this,
+                         &ParallelDownloadJob::ResliceIfIdle);
+  }
+}
+
+void ParallelDownloadJob::ResliceIfIdle() {
+  DCHECK(requests_sent_);
+  if (is_canceled_ ||
+      download_item_->GetState() != DownloadItem::DownloadState::IN_PROGRESS) {
+    reslice_timer_.Stop();
+    return;
+  }
+  const int64_t total_bytes = download_item_->GetTotalBytes();
+  if (is_paused() || total_bytes <= 0)
+    return;
+
+  // Every range left to download is worked on by at most one stream, so the
+  // number of ranges bounds the number of busy requests.
+  const DownloadItem::ReceivedSlices& received_slices =
+      download_item_->GetReceivedSlices();
+  const size_t ranges_left = FindSlicesToDownload(received_slices).size();
+  if (ranges_left >= static_cast<size_t>(GetParallelRequestCount()))
+    return;
+
+  std::set<int64_t> pending_offsets;
+  for (const auto& worker : workers_)
+    pending_offsets.insert(worker.first);
+  std::optional<DownloadItem::ReceivedSlice> slice = FindSliceToSplit(
+      received_slices, total_bytes, pending_offsets, GetMinSliceSize());
+  if (!slice)
+    return;
+
+  // Only split if the half would take long enough to download at the measured
+  // per request throughput to make a new request worthwhile.
+  const int64_t bytes_per_second_per_request =
+      std::max(static_cast<int64_t>(1),
+               download_item_->CurrentSpeed() /
+                   static_cast<int64_t>(std::max<size_t>(ranges_left, 1)));
+  if (slice->received_bytes / bytes_per_second_per_request <=
+      GetMinRemainingTimeInSeconds()) {
+    return;
+  }
+
+  VLOG(kDownloadJobVerboseLevel)
+      << "Splitting remaining range, new request at offset " << slice->offset;
+  CreateRequest(slice->offset);
 }
 
 void ParallelDownloadJob::ForkSubRequests(
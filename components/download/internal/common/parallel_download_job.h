@@ -55,6 +55,7 @@ class COMPONENTS_DOWNLOAD_EXPORT ParallelDownloadJob
   virtual int GetParallelRequestCount() const;
   virtual int64_t GetMinSliceSize() const;
   virtual int GetMinRemainingTimeInSeconds() const;
+  virtual base::TimeDelta GetReslicePeriod() const;
 
   using WorkerMap =
       std::unordered_map<int64_t, std::unique_ptr<DownloadWorker>>;
@@ -84,6 +85,13 @@ class COMPONENTS_DOWNLOAD_EXPORT ParallelDownloadJob
   // The first slice represents the original request.
   void ForkSubRequests(const DownloadItem::ReceivedSlices& slices_to_download);
 
+  // Called periodically once parallel requests are sent. If fewer ranges are
+  // left to download than the allowed number of requests, i.e. a request has
+  // finished its slice, splits the largest remaining range and creates a
+  // request for its second half. The stream downloading the first half stops
+  // once it reaches the data written by the new request.
+  void ResliceIfIdle();
+
   // Create one range request, virtual for testing. Range request will start
   // from |offset| and will be half open.
   virtual void CreateRequest(int64_t offset);
@@ -105,6 +113,10 @@ class COMPONENTS_DOWNLOAD_EXPORT ParallelDownloadJob
   // Used to send parallel requests after a delay based on Finch config.
   base::OneShotTimer timer_;
 
+  // Used to periodically split the largest remaining range, see
+  // ResliceIfIdle().
+  base::RepeatingTimer reslice_timer_;
+
   // If we have sent parallel requests.
   bool requests_sent_;
 
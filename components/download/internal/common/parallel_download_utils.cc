@@ -4,6 +4,8 @@
 
 #include "components/download/internal/common/parallel_download_utils.h"
 
+#include <algorithm>
+
 #include "base/metrics/field_trial_params.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/time/time.h"
@@ -157,6 +159,36 @@ std::vector<DownloadItem::ReceivedSlice> FindSlicesForRemainingContent(
   return new_slices;
 }
 
+std::optional<DownloadItem::ReceivedSlice> FindSliceToSplit(
+    const DownloadItem::ReceivedSlices& received_slices,
+    int64_t total_bytes,
+    const std::set<int64_t>& pending_offsets,
+    int64_t min_slice_size) {
+  const bool last_slice_finished =
+      !received_slices.empty() && received_slices.back().finished;
+  std::optional<DownloadItem::ReceivedSlice> result;
+  int64_t largest_range = 0;
+  for (const auto& slice : FindSlicesToDownload(received_slices)) {
+    int64_t range = slice.received_bytes;
+    if (range == DownloadSaveInfo::kLengthFullContent) {
+      if (last_slice_finished || total_bytes <= slice.offset)
+        continue;
+      range = total_bytes - slice.offset;
+    }
+    auto pending = pending_offsets.upper_bound(slice.offset);
+    if (pending != pending_offsets.end() && *pending < slice.offset + range)
+      continue;
+    if (range <= largest_range)
+      continue;
+    largest_range = range;
+    const int64_t half = range / 2;
+    result.emplace(slice.offset + range - half, half);
+  }
+  if (!result || result->received_bytes < std::max<int64_t>(min_slice_size, 1))
+    return std::nullopt;
+  return result;
+}
+
 int64_t GetMinSliceSizeConfig() {
   std::string finch_value = base::GetFieldTrialParamValueByFeature(
       features::kParallelDownloading, kMinSliceSizeFinchKey);
@@ -192,6 +224,15 @@ base::TimeDelta GetParallelRequestRemainingTimeConfig() {
              : base::Seconds(kDefaultRemainingTimeInSeconds);
 }
 
+base::TimeDelta GetParallelRequestReslicePeriodConfig() {
+  std::string finch_value = base::GetFieldTrialParamValueByFeature(
+      features::kParallelDownloading, kParallelRequestReslicePeriodFinchKey);
+  int64_t time_ms = 0;
+  return base::StringToInt64(finch_value, &time_ms) && time_ms > 0
+             ? base::Milliseconds(time_ms)
+             : base::TimeDelta();
+}
+
 int64_t GetMaxContiguousDataBlockSizeFromBeginning(
     const DownloadItem::ReceivedSlices& slices) {
   auto iter = slices.begin();
@@ -5,6 +5,8 @@
 #ifndef COMPONENTS_DOWNLOAD_INTERNAL_COMMON_PARALLEL_DOWNLOAD_UTILS_H_
 #define COMPONENTS_DOWNLOAD_INTERNAL_COMMON_PARALLEL_DOWNLOAD_UTILS_H_
 
+#include <optional>
+#include <set>
 #include <vector>
 
 #include "components/download/public/common/download_export.h"
@@ -44,6 +46,18 @@ FindSlicesForRemainingContent(int64_t current_offset,
                               int request_count,
                               int64_t min_slice_size);
 
+// Finds the largest range left to download and returns the second half of it,
+// which a new request can take over from the stream working on the range.
+// |total_bytes| bounds the last, half open range and is ignored if it is not
+// known. Ranges that contain one of |pending_offsets| have already been split
+// by a request that hasn't written any data yet, and are skipped. Returns
+// std::nullopt if no half would be at least |min_slice_size| bytes.
+COMPONENTS_DOWNLOAD_EXPORT std::optional<DownloadItem::ReceivedSlice>
+FindSliceToSplit(const DownloadItem::ReceivedSlices& received_slices,
+                 int64_t total_bytes,
+                 const std::set<int64_t>& pending_offsets,
+                 int64_t min_slice_size);
+
 // Finch configuration utilities.
 //
 // Get the minimum slice size to use parallel download from finch configuration.
@@ -62,6 +76,11 @@ COMPONENTS_DOWNLOAD_EXPORT base::TimeDelta GetParallelRequestDelayConfig();
 COMPONENTS_DOWNLOAD_EXPORT base::TimeDelta
 GetParallelRequestRemainingTimeConfig();
 
+// Get the period to look for idle request capacity and split the largest
+// range left to download. Zero means re-slicing is disabled.
+COMPONENTS_DOWNLOAD_EXPORT base::TimeDelta
+GetParallelRequestReslicePeriodConfig();
+
 // Given an ordered array of slices, get the maximum size of a contiguous data
 // block that starts from offset 0. If the first slice doesn't start from offset
 // 0, return 0.
@@ -6,6 +6,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 
 #include "base/memory/raw_ptr.h"
 #include "base/strings/string_number_conversions.h"
@@ -313,6 +314,42 @@ TEST_F(ParallelDownloadUtilsTest, FindSlicesForRemainingContentMinSliceSize) {
   EXPECT_EQ(DownloadItem::ReceivedSlice(66, 0), slices[2]);
 }
 
+TEST_F(ParallelDownloadUtilsTest, FindSliceToSplit) {
+  // Nothing received yet, the whole content is one range.
+  DownloadItem::ReceivedSlices slices;
+  std::optional<DownloadItem::ReceivedSlice> slice =
+      FindSliceToSplit(slices, 100, {}, 10);
+  ASSERT_TRUE(slice);
+  EXPECT_EQ(DownloadItem::ReceivedSlice(50, 50), *slice);
+
+  // The largest range is split, and the stream working on it keeps the first
+  // half.
+  slices.emplace_back(0, 10);
+  slices.emplace_back(30, 10);
+  slice = FindSliceToSplit(slices, 100, {}, 10);
+  ASSERT_TRUE(slice);
+  EXPECT_EQ(DownloadItem::ReceivedSlice(70, 30), *slice);
+
+  // A range with a pending request inside is skipped.
+  slice = FindSliceToSplit(slices, 100, {0, 30, 70}, 10);
+  ASSERT_TRUE(slice);
+  EXPECT_EQ(DownloadItem::ReceivedSlice(20, 10), *slice);
+
+  // Halves smaller than the minimum slice size are not split.
+  slice = FindSliceToSplit(slices, 100, {0, 30, 70}, 11);
+  EXPECT_FALSE(slice);
+
+  // The last range is not split when the total size is unknown or the last
+  // slice is finished.
+  slices = {DownloadItem::ReceivedSlice(0, 10)};
+  EXPECT_FALSE(FindSliceToSplit(slices, 0, {}, 1));
+  slices = {DownloadItem::ReceivedSlice(0, 10),
+            DownloadItem::ReceivedSlice(50, 50, /*finished=*/true)};
+  slice = FindSliceToSplit(slices, 100, {}, 1);
+  ASSERT_TRUE(slice);
+  EXPECT_EQ(DownloadItem::ReceivedSlice(30, 20), *slice);
+}
+
 TEST_F(ParallelDownloadUtilsTest, GetMaxContiguousDataBlockSizeFromBeginning) {
   std::vector<DownloadItem::ReceivedSlice> slices;
   slices.emplace_back(500, 500);
@@ -29,6 +29,12 @@ constexpr char kParallelRequestDelayFinchKey[] = "parallel_request_delay";
 constexpr char kParallelRequestRemainingTimeFinchKey[] =
     "parallel_request_remaining_time";
 
+// Finch parameter key value for the period in milliseconds at which a parallel
+// download looks for idle request capacity and splits the largest range left
+// to download. Re-slicing is disabled if not set.
+constexpr char kParallelRequestReslicePeriodFinchKey[] =
+    "parallel_request_reslice_period";
+
 }  //  namespace download
 
 #endif  // COMPONENTS_DOWNLOAD_PUBLIC_COMMON_PARALLEL_DOWNLOAD_CONFIGS_H_
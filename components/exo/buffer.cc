@@ -74,6 +74,12 @@ const bool kDefaultYInvert = false;
 // GpuMemoryBufferHandle from it.
 const uint32_t kDefaultMappableSIUsage = gpu::SHARED_IMAGE_USAGE_DISPLAY_READ;
 
+// Maximum number of released copy destination textures kept for reuse. Clients
+// that re-attach a buffer before the compositor has returned the previous
+// texture need more than one, and keeping them avoids creating and destroying
+// a shared image on every commit.
+constexpr size_t kMaxReleasedTextures = 2;
+
 // Gets the color type of |format| for creating bitmap. If it returns
 // SkColorType::kUnknown_SkColorType, it means with this format, this buffer
 // contents should not be used to create bitmap.
@@ -773,9 +779,10 @@ bool Buffer::ProduceTransferableResource(
   if (contents_texture_ && contents_texture_->IsLost()) {
     contents_texture_.reset();
   }
-  if (texture_ && texture_->IsLost()) {
-    texture_.reset();
-  }
+  std::erase_if(released_textures_,
+                [](const std::unique_ptr<Texture>& texture) {
+                  return texture->IsLost();
+                });
 
   ui::ContextFactory* context_factory =
       aura::Env::GetInstance()->context_factory();
@@ -893,13 +900,18 @@ bool Buffer::ProduceTransferableResource(
     return true;
   }
 
-  // Create a mailbox texture that we copy the buffer contents to.
-  if (!texture_) {
-    texture_ =
+  // Reuse a released mailbox texture or create a new one that we copy the
+  // buffer contents to.
+  std::unique_ptr<Texture> texture_owner;
+  if (released_textures_.empty()) {
+    texture_owner =
         std::make_unique<Texture>(context_provider, GetSize(), color_space,
                                   resource->mailbox_holder.sync_token);
+  } else {
+    texture_owner = std::move(released_textures_.back());
+    released_textures_.pop_back();
   }
-  Texture* texture = texture_.get();
+  Texture* texture = texture_owner.get();
 
   // Copy the contents of |contents_texture| to |texture| and produce a
   // texture mailbox from the result in |texture|. The contents texture will
@@ -920,7 +932,7 @@ bool Buffer::ProduceTransferableResource(
       resource->id,
       base::BindOnce(&Buffer::Texture::Release, base::Unretained(texture),
                      base::BindOnce(&Buffer::ReleaseTexture, AsWeakPtr(),
-                                    std::move(texture_))));
+                                    std::move(texture_owner))));
   return true;
 }
 
@@ -995,7 +1007,9 @@ void Buffer::ReleaseTexture(std::unique_ptr<Texture> texture,
                             gfx::GpuFenceHandle release_fence) {
   // Buffer was composited - we should not receive a release fence.
   DCHECK(release_fence.is_null());
-  texture_ = std::move(texture);
+  if (released_textures_.size() < kMaxReleasedTextures) {
+    released_textures_.push_back(std::move(texture));
+  }
 }
 
 void Buffer::ReleaseContentsTexture(std::unique_ptr<Texture> texture,
@@ -6,6 +6,7 @@
 #define COMPONENTS_EXO_BUFFER_H_
 
 #include <memory>
+#include <vector>
 
 #include "base/cancelable_callback.h"
 #include "base/containers/flat_map.h"
@@ -233,9 +234,9 @@ class Buffer {
   // This keeps track of how many Surfaces the buffer is attached to.
   unsigned attach_count_ = 0;
 
-  // The last used texture. ProduceTransferableResource() will use this
-  // instead of creating a new texture when possible.
-  std::unique_ptr<Texture> texture_;
+  // Textures released by the compositor. ProduceTransferableResource() will
+  // use these instead of creating a new texture when possible.
+  std::vector<std::unique_ptr<Texture>> released_textures_;
 
   // The last used contents texture. ProduceTransferableResource() will use this
   // instead of creating a new texture when possible.
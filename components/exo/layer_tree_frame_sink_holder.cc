@@ -11,6 +11,8 @@
 #include "components/exo/surface_tree_host.h"
 #include "components/viz/common/frame_timing_details.h"
 #include "components/viz/common/hit_test/hit_test_region_list.h"
+#include "components/viz/common/quads/compositor_render_pass.h"
+#include "components/viz/common/quads/texture_draw_quad.h"
 #include "components/viz/common/resources/returned_resource.h"
 
 namespace exo {
@@ -23,6 +25,43 @@ namespace {
 // the system occasionally drops frames.
 constexpr int32_t kPauseBeginFrameThreshold = 5;
 
+// Adds the damage of `discarded_frame`, which never reached the remote side,
+// to `frame` so that the area it changed is redrawn. Falls back to full damage
+// if the frames' geometry doesn't match.
+void AccumulateDamageFromDiscardedFrame(
+    const viz::CompositorFrame& discarded_frame,
+    viz::CompositorFrame* frame) {
+  if (frame->render_pass_list.empty()) {
+    return;
+  }
+  viz::CompositorRenderPass& root_pass = *frame->render_pass_list.back();
+  if (discarded_frame.render_pass_list.size() != 1u ||
+      frame->render_pass_list.size() != 1u ||
+      discarded_frame.device_scale_factor() != frame->device_scale_factor() ||
+      discarded_frame.render_pass_list.back()->output_rect !=
+          root_pass.output_rect) {
+    root_pass.damage_rect = root_pass.output_rect;
+    return;
+  }
+
+  const viz::CompositorRenderPass& discarded_root_pass =
+      *discarded_frame.render_pass_list.back();
+  gfx::Rect damage = discarded_root_pass.damage_rect;
+  // Texture quads may carry their own damage, outside of the render pass
+  // damage; see Surface::AppendContentsToFrame().
+  for (const viz::DrawQuad* quad : discarded_root_pass.quad_list) {
+    if (quad->material != viz::DrawQuad::Material::kTextureContent) {
+      continue;
+    }
+    const auto* texture_quad = viz::TextureDrawQuad::MaterialCast(quad);
+    if (texture_quad->damage_rect.has_value()) {
+      damage.Union(texture_quad->damage_rect.value());
+    }
+  }
+  damage.Intersect(root_pass.output_rect);
+  root_pass.damage_rect.Union(damage);
+}
+
 }  // namespace
 
 BASE_FEATURE(kExoReactiveFrameSubmission,
@@ -82,7 +121,9 @@ void LayerTreeFrameSinkHolder::DeleteWhenLastResourceHasBeenReclaimed(
       holder->surface_tree_host_->GenerateNextFrameToken();
   frame.metadata.device_scale_factor =
       holder->frame_sink_->last_submitted_device_scale_factor();
-  auto pass = viz::CompositorRenderPass::Create();
+  // The frame has no quads, so don't reserve room for any.
+  auto pass = viz::CompositorRenderPass::Create(
+      /*shared_quad_state_list_size=*/1u, /*quad_list_size=*/1u);
   pass->SetNew(viz::CompositorRenderPassId{1},
                gfx::Rect(holder->frame_sink_->last_submitted_size_in_pixels()),
                gfx::Rect(holder->frame_sink_->last_submitted_size_in_pixels()),
@@ -114,6 +155,9 @@ void LayerTreeFrameSinkHolder::SubmitCompositorFrame(viz::CompositorFrame frame,
     return;
   }
 
+  if (cached_frame_) {
+    AccumulateDamageFromDiscardedFrame(*cached_frame_, &frame);
+  }
   DiscardCachedFrame(&frame);
 
   // Needs to be after DiscardCachedFrame(), because discarding a frame will
@@ -61,9 +61,9 @@ class LayerTreeFrameSinkHolder : public cc::LayerTreeFrameSinkClient,
   static void DeleteWhenLastResourceHasBeenReclaimed(
       std::unique_ptr<LayerTreeFrameSinkHolder> holder);
 
-  // If a frame is submitted "now" (meaning before returning to event loop)
-  // via SubmitCompositorFrame(), whether it needs full damage.
-  bool NeedsFullDamageForNextFrame() const { return cached_frame_.has_value(); }
+  // Submits `frame`, or caches it until the next BeginFrame. A frame that is
+  // still cached when a newer one arrives is discarded, and its damage is
+  // added to the newer frame.
   void SubmitCompositorFrame(viz::CompositorFrame frame,
                              bool submit_now = false);
   void SetLocalSurfaceId(const viz::LocalSurfaceId& local_surface_id);
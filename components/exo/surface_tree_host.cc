@@ -376,7 +376,7 @@ void SurfaceTreeHost::SubmitCompositorFrame() {
 
   root_surface_->AppendSurfaceHierarchyContentsToFrame(
       gfx::PointF(root_surface_origin_pixel_), /*to_parent_dp=*/gfx::PointF(),
-      layer_tree_frame_sink_holder_->NeedsFullDamageForNextFrame(),
+      /*needs_full_damage=*/false,
       layer_tree_frame_sink_holder_->resource_manager(),
       client_submits_surfaces_in_pixel_coordinates()
           ? std::nullopt
@@ -419,6 +419,11 @@ void SurfaceTreeHost::SubmitCompositorFrame() {
 
   frame.metadata.may_contain_video = root_surface_->ContainsVideo();
 
+  const viz::CompositorRenderPass& render_pass = *frame.render_pass_list.back();
+  last_shared_quad_state_count_ =
+      std::max<size_t>(render_pass.shared_quad_state_list.size(), 1u);
+  last_quad_count_ = std::max<size_t>(render_pass.quad_list.size(), 1u);
+
   layer_tree_frame_sink_holder_->SubmitCompositorFrame(std::move(frame));
 }
 
@@ -645,7 +650,8 @@ viz::CompositorFrame SurfaceTreeHost::PrepareToSubmitCompositorFrame() {
   frame.metadata.begin_frame_ack =
       viz::BeginFrameAck::CreateManualAckWithDamage();
   frame.metadata.frame_token = GenerateNextFrameToken();
-  frame.render_pass_list.push_back(viz::CompositorRenderPass::Create());
+  frame.render_pass_list.push_back(viz::CompositorRenderPass::Create(
+      last_shared_quad_state_count_, last_quad_count_));
   const std::unique_ptr<viz::CompositorRenderPass>& render_pass =
       frame.render_pass_list.back();
 
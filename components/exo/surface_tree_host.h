@@ -341,6 +341,13 @@ class SurfaceTreeHost : public SurfaceDelegate,
 
   std::set<gpu::SyncToken> prev_frame_verified_tokens_;
 
+  // The number of shared quad states and quads in the last submitted frame.
+  // The next frame's render pass reserves room for as many, since a surface
+  // tree's frames rarely change shape, rather than for the much larger
+  // CompositorRenderPass defaults.
+  size_t last_shared_quad_state_count_ = 1u;
+  size_t last_quad_count_ = 1u;
+
   bool bounds_is_dirty_ = true;
 
   base::WeakPtrFactory<SurfaceTreeHost> weak_ptr_factory_{this};
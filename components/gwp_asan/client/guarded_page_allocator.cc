@@ -369,12 +369,19 @@ bool GuardedPageAllocator::ReserveSlotAndMetadata(
     AllocatorState::SlotIdx* slot,
     AllocatorState::MetadataIdx* metadata_idx,
     const char* type) {
+  // Once OOM has been reported, failed reservations are no longer counted, so
+  // while every page is in use sampled allocations are rejected without
+  // contending on |lock_| with other threads.
+  if (all_pages_alloced_after_oom_.load(std::memory_order_relaxed))
+    return false;
+
   base::AutoLock lock(lock_);
   if (num_alloced_pages_ == max_alloced_pages_ ||
       !free_slots_->Allocate(slot, type)) {
     if (!oom_hit_) {
       if (++consecutive_oom_hits_ == kOutOfMemoryCount) {
         oom_hit_ = true;
+        UpdateAllPagesAllocedAfterOom();
         base::AutoUnlock unlock(lock_);
         std::move(oom_callback_).Run(total_allocations_);
       }
@@ -407,6 +414,7 @@ bool GuardedPageAllocator::ReserveSlotAndMetadata(
 
   num_alloced_pages_++;
   total_allocations_++;
+  UpdateAllPagesAllocedAfterOom();
   return true;
 }
 
@@ -422,6 +430,13 @@ void GuardedPageAllocator::FreeSlotAndMetadata(
 
   DCHECK_GT(num_alloced_pages_, 0U);
   num_alloced_pages_--;
+  UpdateAllPagesAllocedAfterOom();
+}
+
+void GuardedPageAllocator::UpdateAllPagesAllocedAfterOom() {
+  all_pages_alloced_after_oom_.store(
+      oom_hit_ && num_alloced_pages_ == max_alloced_pages_,
+      std::memory_order_relaxed);
 }
 
 void GuardedPageAllocator::RecordAllocationMetadata(
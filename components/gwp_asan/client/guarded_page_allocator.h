@@ -206,6 +206,9 @@ class GWP_ASAN_EXPORT GuardedPageAllocator {
   ALWAYS_INLINE void RecordDeallocationMetadata(
       AllocatorState::MetadataIdx metadata_idx);
 
+  // Updates |all_pages_alloced_after_oom_| from the state guarded by |lock_|.
+  void UpdateAllPagesAllocedAfterOom() EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
   // Allocator state shared with with the crash analyzer.
   AllocatorState state_;
 
@@ -236,6 +239,10 @@ class GWP_ASAN_EXPORT GuardedPageAllocator {
   bool oom_hit_ GUARDED_BY(lock_) = false;
   OutOfMemoryCallback oom_callback_;
 
+  // Mirrors |oom_hit_ && num_alloced_pages_ == max_alloced_pages_| so that
+  // reservations can be rejected without taking |lock_| in that state.
+  std::atomic<bool> all_pages_alloced_after_oom_{false};
+
   bool is_partition_alloc_ = false;
 
   friend class BaseGpaTest;
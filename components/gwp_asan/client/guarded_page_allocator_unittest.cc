@@ -164,14 +164,21 @@ TEST_P(GuardedPageAllocatorTest, AllocationAlignment) {
 }
 
 TEST_P(GuardedPageAllocatorTest, OutOfMemoryCallback) {
+  void* alloc = nullptr;
   for (size_t i = 0; i < kMaxMetadata; i++)
-    EXPECT_NE(gpa_.Allocate(1), nullptr);
+    EXPECT_NE(alloc = gpa_.Allocate(1), nullptr);
 
   for (size_t i = 0; i < GuardedPageAllocator::kOutOfMemoryCount - 1; i++)
     EXPECT_EQ(gpa_.Allocate(1), nullptr);
   EXPECT_FALSE(allocator_oom_);
   EXPECT_EQ(gpa_.Allocate(1), nullptr);
   EXPECT_TRUE(allocator_oom_);
+  EXPECT_EQ(gpa_.Allocate(1), nullptr);
+
+  // Allocations succeed again once a page has been freed.
+  gpa_.Deallocate(alloc);
+  EXPECT_NE(gpa_.Allocate(1), nullptr);
+  EXPECT_EQ(gpa_.Allocate(1), nullptr);
 }
 
 class GuardedPageAllocatorParamTest
@@ -35,7 +35,6 @@
 #include "components/heap_profiling/in_process/switches.h"
 #include "components/metrics/call_stacks/call_stack_profile_builder.h"
 #include "components/metrics/call_stacks/call_stack_profile_params.h"
-#include "components/services/heap_profiling/public/cpp/merge_samples.h"
 #include "components/version_info/channel.h"
 #include "third_party/abseil-cpp/absl/cleanup/cleanup.h"
 
@@ -469,10 +468,8 @@ void HeapProfilerController::RetrieveAndSendSnapshot(
     ProcessType process_type,
     base::TimeDelta time_since_profiler_creation,
     base::OnceCallback<void(bool)> on_snapshot_callback) {
-  using Sample = base::SamplingHeapProfiler::Sample;
-
-  // Always log the total sampled memory before returning. If `samples` is empty
-  // this will be logged as 0 MB.
+  // Always log the total sampled memory before returning. If there are no
+  // samples this will be logged as 0 MB.
   base::ClampedNumeric<uint64_t> total_sampled_bytes;
   absl::Cleanup log_total_sampled_memory = [&total_sampled_bytes,
                                             &process_type] {
@@ -483,18 +480,24 @@ void HeapProfilerController::RetrieveAndSendSnapshot(
         base::ClampDiv(total_sampled_bytes, kBytesPerMB));
   };
 
-  std::vector<Sample> samples =
-      base::SamplingHeapProfiler::Get()->GetSamples(0);
+  // The live samples are already aggregated by stack, so this doesn't copy
+  // them one by one.
+  const base::SamplingHeapProfiler::StackTotalsMap stack_totals =
+      base::SamplingHeapProfiler::Get()->GetLiveTotalsByStack();
+  size_t sample_count = 0;
+  for (const auto& [stack, totals] : stack_totals) {
+    sample_count += totals.samples;
+  }
   base::UmaHistogramCounts100000(
       ProcessHistogramName("HeapProfiling.InProcess.SamplesPerSnapshot",
                            process_type),
-      samples.size());
+      sample_count);
   // Also summarize over all process types.
   base::UmaHistogramCounts100000("HeapProfiling.InProcess.SamplesPerSnapshot",
-                                 samples.size());
+                                 sample_count);
   CHECK(!on_snapshot_callback.is_null());
   if (!base::FeatureList::IsEnabled(kHeapProfilerIncludeZero) &&
-      samples.empty()) {
+      stack_totals.empty()) {
     std::move(on_snapshot_callback).Run(false);
     return;
   }
@@ -507,19 +510,14 @@ void HeapProfilerController::RetrieveAndSendSnapshot(
       time_since_profiler_creation);
   metrics::CallStackProfileBuilder profile_builder(params);
 
-  SampleMap merged_samples = MergeSamples(samples);
-
   StackQualityMetricsRecorder quality_recorder(process_type, module_cache);
-  for (auto& pair : merged_samples) {
-    const Sample& sample = pair.first;
-    const SampleValue& value = pair.second;
-
-    const size_t stack_size = sample.stack.size();
+  for (const auto& [stack, totals] : stack_totals) {
+    const size_t stack_size = stack.size();
     std::vector<base::Frame> frames;
     frames.reserve(stack_size);
 
     quality_recorder.NewStack(stack_size);
-    for (const void* frame : sample.stack) {
+    for (const void* frame : stack) {
       const uintptr_t address = reinterpret_cast<const uintptr_t>(frame);
       const base::ModuleCache::Module* module =
           module_cache.GetModuleForAddress(address);
@@ -531,9 +529,9 @@ void HeapProfilerController::RetrieveAndSendSnapshot(
     // Heap "samples" represent allocation stacks aggregated over time so
     // do not have a meaningful timestamp.
     profile_builder.OnSampleCompleted(std::move(frames), base::TimeTicks(),
-                                      value.total, value.count);
+                                      totals.total, totals.count);
 
-    total_sampled_bytes += value.total;
+    total_sampled_bytes += totals.total;
   }
 
   profile_builder.OnProfileCompleted(base::TimeDelta(), base::TimeDelta());
@@ -22,6 +22,7 @@
 #include "base/numerics/safe_conversions.h"
 #include "base/ranges/algorithm.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/timer/elapsed_timer.h"
 #include "build/build_config.h"
 #include "components/favicon/core/favicon_database.h"
 #include "components/history/core/browser/features.h"
@@ -110,6 +111,12 @@ class AutoSubframeVisitsReader : public ExpiringVisitsReader {
 // Prevents us from doing too much work any given time.
 const int kNumExpirePerIteration = 32;
 
+// When an iteration finds more visits to expire than fit in one batch, e.g. on
+// a profile that hasn't been used for a long time, it keeps expiring batches
+// for up to this long. This lets large backlogs catch up without holding the
+// database sequence for long at a time.
+constexpr base::TimeDelta kExpirationIterationBudget = base::Milliseconds(20);
+
 // The number of seconds between checking for items that should be expired when
 // we think there might be more items to expire. This timeout is used when the
 // last expiration found at least kNumExpirePerIteration and we want to check
@@ -634,9 +641,17 @@ void ExpireHistoryBackend::DoExpireIteration() {
     return;
   }
 
+  base::ElapsedTimer timer;
   const ExpiringVisitsReader* reader = work_queue_.front();
-  bool more_to_expire = ExpireSomeOldHistory(
-      GetCurrentExpirationTime(), reader, kNumExpirePerIteration);
+  bool more_to_expire;
+  int num_batches = 0;
+  do {
+    more_to_expire = ExpireSomeOldHistory(GetCurrentExpirationTime(), reader,
+                                          kNumExpirePerIteration);
+    ++num_batches;
+  } while (more_to_expire && timer.Elapsed() < kExpirationIterationBudget);
+  UMA_HISTOGRAM_TIMES("History.ExpireIteration.Time", timer.Elapsed());
+  UMA_HISTOGRAM_COUNTS_100("History.ExpireIteration.Batches", num_batches);
 
   work_queue_.pop();
   if (more_to_expire) {
@@ -125,6 +125,7 @@ class ExpireHistoryBackend {
   FRIEND_TEST_ALL_PREFIXES(ExpireHistoryTest, DeleteFaviconsIfPossible);
   FRIEND_TEST_ALL_PREFIXES(ExpireHistoryTest, ExpireSomeOldHistory);
   FRIEND_TEST_ALL_PREFIXES(ExpireHistoryTest, ExpiringVisitsReader);
+  FRIEND_TEST_ALL_PREFIXES(ExpireHistoryTest, ExpireIterationRecordsMetrics);
   FRIEND_TEST_ALL_PREFIXES(ExpireHistoryTest, ExpireSomeOldHistoryWithSource);
   FRIEND_TEST_ALL_PREFIXES(ExpireHistoryTest,
                            ClearOldOnDemandFaviconsDoesNotDeleteStarred);
@@ -20,6 +20,7 @@
 #include "base/scoped_observation.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/current_thread.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "components/favicon/core/favicon_database.h"
@@ -1164,6 +1165,20 @@ TEST_F(ExpireHistoryTest, ExpireSomeOldHistory) {
               UnorderedElementsAre(2));
 }
 
+TEST_F(ExpireHistoryTest, ExpireIterationRecordsMetrics) {
+  URLID url_ids[3];
+  base::Time visit_times[4];
+  AddExampleData(url_ids, visit_times);
+
+  base::HistogramTester histogram_tester;
+  expirer_.StartExpiringOldStuff(base::Days(90));
+  expirer_.DoExpireIteration();
+
+  // There are fewer visits than fit in one batch.
+  histogram_tester.ExpectTotalCount("History.ExpireIteration.Time", 1);
+  histogram_tester.ExpectUniqueSample("History.ExpireIteration.Batches", 1, 1);
+}
+
 TEST_F(ExpireHistoryTest, ExpiringVisitsReader) {
   URLID url_ids[3];
   base::Time visit_times[4];
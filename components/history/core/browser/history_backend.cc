@@ -1493,16 +1493,30 @@ void HistoryBackend::AddPagesWithDetails(const URLRows& urls,
   if (!db_)
     return;
 
-  URLRows changed_urls;
-  for (auto i = urls.begin(); i != urls.end(); ++i) {
-    DCHECK(!i->last_visit().is_null());
+  // Imports can add hundreds of thousands of rows. Handle them in URL order, so
+  // that the lookups and inserts walk the `urls` index in order rather than
+  // jumping around it, and so that repeated URLs are only looked up once.
+  std::vector<const URLRow*> sorted_urls;
+  sorted_urls.reserve(urls.size());
+  for (const URLRow& url : urls) {
+    DCHECK(!url.last_visit().is_null());
 
     // As of M37, we no longer maintain an archived database, ignore old visits.
-    if (IsExpiredVisitTime(i->last_visit()))
-      continue;
+    if (!IsExpiredVisitTime(url.last_visit()))
+      sorted_urls.push_back(&url);
+  }
+  std::stable_sort(sorted_urls.begin(), sorted_urls.end(),
+                   [](const URLRow* a, const URLRow* b) {
+                     return a->url() < b->url();
+                   });
 
-    URLRow existing_url;
-    URLID url_id = db_->GetRowForURL(i->url(), &existing_url);
+  URLRows changed_urls;
+  const URLRow* previous_url = nullptr;
+  URLID url_id = 0;
+  for (const URLRow* i : sorted_urls) {
+    if (!previous_url || previous_url->url() != i->url())
+      url_id = db_->GetRowForURL(i->url(), nullptr);
+    previous_url = i;
     if (!url_id) {
       // Add the page if it doesn't exist.
       url_id = db_->AddURL(*i);
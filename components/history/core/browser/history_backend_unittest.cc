@@ -1317,6 +1317,39 @@ TEST_F(HistoryBackendTest, AddPagesWithDetails) {
   EXPECT_EQ(stored_row3.id(), it_row3->id());
 }
 
+TEST_F(HistoryBackendTest, AddPagesWithDetailsRepeatedURLs) {
+  ASSERT_TRUE(backend_.get());
+
+  // Import unsorted rows, with one URL repeated.
+  URLRow row1(GURL("https://www.google.com/"));
+  row1.set_visit_count(1);
+  row1.set_last_visit(base::Time::Now() - base::Hours(1));
+  URLRow row2(GURL("https://news.google.com/"));
+  row2.set_visit_count(1);
+  row2.set_last_visit(base::Time::Now());
+  URLRow row3(row1.url());
+  row3.set_visit_count(1);
+  row3.set_last_visit(base::Time::Now());
+
+  backend_->AddPagesWithDetails({row1, row2, row3}, SOURCE_BROWSED);
+
+  URLID url1_id = backend_->db_->GetRowForURL(row1.url(), nullptr);
+  URLID url2_id = backend_->db_->GetRowForURL(row2.url(), nullptr);
+  EXPECT_NE(0, url1_id);
+  EXPECT_NE(0, url2_id);
+
+  // Each row got a visit, and the repeated URL got a single row.
+  VisitVector visits;
+  backend_->db_->GetVisitsForURL(url1_id, &visits);
+  EXPECT_EQ(2U, visits.size());
+  visits.clear();
+  backend_->db_->GetVisitsForURL(url2_id, &visits);
+  EXPECT_EQ(1U, visits.size());
+
+  ASSERT_EQ(1, num_urls_modified_notifications());
+  EXPECT_EQ(2u, urls_modified_notifications()[0].size());
+}
+
 // This verifies that a notification is fired. In-depth testing of logic should
 // be done in HistoryTest.SetTitle.
 TEST_F(HistoryBackendTest, SetPageTitleFiresNotificationWithCorrectDetails) {
@@ -54,7 +54,9 @@ bool InMemoryDatabase::InitFromScratch() {
 }
 
 bool InMemoryDatabase::InitFromDisk(const base::FilePath& history_name) {
-  if (!InitDB())
+  SCOPED_UMA_HISTOGRAM_TIMER("History.InMemoryDBLoadTime");
+  // The indices are created after copying the data, see below.
+  if (!InitDB() || !DropKeywordSearchTermsIndices())
     return false;
 
   // Attach to the history database on disk.
@@ -109,9 +111,10 @@ bool InMemoryDatabase::InitFromDisk(const base::FilePath& history_name) {
     return false;
   }
 
-  // Index the table, this is faster than creating the index first and then
-  // inserting into it.
+  // Index the tables, this is faster than creating the indices first and then
+  // inserting into them.
   CreateMainURLIndex();
+  CreateKeywordSearchTermsIndices();
 
   // After this point, the database may be accessed from another sequence.
   db_.DetachFromSequence();
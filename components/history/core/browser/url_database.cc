@@ -503,6 +503,12 @@ bool URLDatabase::CreateKeywordSearchTermsIndices() {
   return true;
 }
 
+bool URLDatabase::DropKeywordSearchTermsIndices() {
+  return GetDB().Execute("DROP INDEX IF EXISTS keyword_search_terms_index1") &&
+         GetDB().Execute("DROP INDEX IF EXISTS keyword_search_terms_index2") &&
+         GetDB().Execute("DROP INDEX IF EXISTS keyword_search_terms_index3");
+}
+
 bool URLDatabase::DropKeywordSearchTermsTable() {
   // This will implicitly delete the indices over the table.
   return GetDB().Execute("DROP TABLE keyword_search_terms");
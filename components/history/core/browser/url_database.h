@@ -286,6 +286,10 @@ class URLDatabase {
   // Creates the indices used for keyword search terms.
   bool CreateKeywordSearchTermsIndices();
 
+  // Drops the indices used for keyword search terms, e.g. before inserting
+  // many rows, which is faster when the indices are created afterwards.
+  bool DropKeywordSearchTermsIndices();
+
   // Deletes the keyword search terms table.
   bool DropKeywordSearchTermsTable();
 
@@ -796,4 +796,28 @@ TEST_F(URLDatabaseTest, CreateTemporaryURLTableDropsExistingTable) {
   }
 }
 
+TEST_F(URLDatabaseTest, DropAndRecreateKeywordSearchTermsIndices) {
+  EXPECT_TRUE(GetDB().DoesIndexExist("keyword_search_terms_index1"));
+  EXPECT_TRUE(DropKeywordSearchTermsIndices());
+  EXPECT_FALSE(GetDB().DoesIndexExist("keyword_search_terms_index1"));
+  EXPECT_FALSE(GetDB().DoesIndexExist("keyword_search_terms_index2"));
+  EXPECT_FALSE(GetDB().DoesIndexExist("keyword_search_terms_index3"));
+
+  URLRow url_info(GURL("https://www.google.com/search"));
+  url_info.set_last_visit(Time::Now());
+  URLID url_id = AddURL(url_info);
+  ASSERT_NE(0, url_id);
+  ASSERT_TRUE(SetKeywordSearchTermsForURL(url_id, 100, u"visit"));
+
+  EXPECT_TRUE(CreateKeywordSearchTermsIndices());
+  EXPECT_TRUE(GetDB().DoesIndexExist("keyword_search_terms_index1"));
+  EXPECT_TRUE(GetDB().DoesIndexExist("keyword_search_terms_index2"));
+  EXPECT_TRUE(GetDB().DoesIndexExist("keyword_search_terms_index3"));
+
+  std::vector<KeywordSearchTermRow> rows;
+  ASSERT_TRUE(GetKeywordSearchTermRows(u"visit", &rows));
+  ASSERT_EQ(1u, rows.size());
+  EXPECT_EQ(url_id, rows[0].url_id);
+}
+
 }  // namespace history
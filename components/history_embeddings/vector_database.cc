@@ -57,11 +57,26 @@ void Embedding::Normalize() {
 }
 
 float Embedding::ScoreWith(const Embedding& other) const {
-  float score = 0.0f;
-  for (size_t i = 0; i < data_.size(); i++) {
-    score += data_[i] * other.data_[i];
+  // Independent accumulators break the loop-carried dependency on a single
+  // sum, which lets the compiler vectorize the loop.
+  const float* a = data_.data();
+  const float* b = other.data_.data();
+  const size_t size = data_.size();
+  float sum0 = 0.0f;
+  float sum1 = 0.0f;
+  float sum2 = 0.0f;
+  float sum3 = 0.0f;
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    sum0 += a[i] * b[i];
+    sum1 += a[i + 1] * b[i + 1];
+    sum2 += a[i + 2] * b[i + 2];
+    sum3 += a[i + 3] * b[i + 3];
   }
-  return score;
+  for (; i < size; i++) {
+    sum0 += a[i] * b[i];
+  }
+  return (sum0 + sum1) + (sum2 + sum3);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -117,10 +132,11 @@ std::vector<ScoredUrl> VectorDatabase::FindNearest(
   // Magnitudes are also assumed equal; they are provided normalized by design.
   CHECK_LT(std::abs(query.Magnitude() - kUnitLength), kEpsilon);
 
-  // TODO(orinj): Manage a heap for speed.
+  // Keeps the best `count` results seen so far, with the worst of them on top
+  // so that most items can be rejected without touching the heap.
   struct Compare {
     bool operator()(const ScoredUrl& a, const ScoredUrl& b) {
-      return a.score < b.score;
+      return a.score > b.score;
     }
   };
   std::priority_queue<ScoredUrl, std::vector<ScoredUrl>, Compare> q;
@@ -129,10 +145,10 @@ std::vector<ScoredUrl> VectorDatabase::FindNearest(
     if (is_search_halted.Run()) {
       break;
     }
-    while (q.size() > count) {
-      q.pop();
-    }
     const auto [score, score_index] = item->BestScoreWith(query);
+    if (q.size() == count && score <= q.top().score) {
+      continue;
+    }
     q.push(ScoredUrl{
         .url_id = item->url_id,
         .visit_id = item->visit_id,
@@ -140,12 +156,15 @@ std::vector<ScoredUrl> VectorDatabase::FindNearest(
         .score = score,
         .index = score_index,
     });
+    if (q.size() > count) {
+      q.pop();
+    }
   }
 
-  // Empty queue into vector and return result.
-  std::vector<ScoredUrl> nearest;
-  while (!q.empty()) {
-    nearest.push_back(q.top());
+  // Empty queue into vector, best result first.
+  std::vector<ScoredUrl> nearest(q.size());
+  for (auto it = nearest.rbegin(); it != nearest.rend(); ++it) {
+    *it = q.top();
     q.pop();
   }
   return nearest;
@@ -4,7 +4,9 @@
 
 #include "components/history_embeddings/vector_database.h"
 
+#include <algorithm>
 #include <atomic>
+#include <functional>
 #include <memory>
 
 #include "base/logging.h"
@@ -82,6 +84,31 @@ TEST(HistoryEmbeddingsVectorDatabaseTest, SearchCanBeHaltedEarly) {
   }
 }
 
+TEST(HistoryEmbeddingsVectorDatabaseTest, FindNearestReturnsBestFirst) {
+  VectorDatabaseInMemory database;
+  std::vector<Embedding> embeddings;
+  for (size_t i = 0; i < 10; i++) {
+    UrlEmbeddings url_embeddings(i + 1, i + 1, base::Time::Now());
+    url_embeddings.embeddings.push_back(RandomEmbedding());
+    embeddings.push_back(url_embeddings.embeddings[0]);
+    database.AddUrlEmbeddings(std::move(url_embeddings));
+  }
+  Embedding query = RandomEmbedding();
+
+  std::vector<float> scores;
+  for (const Embedding& embedding : embeddings) {
+    scores.push_back(query.ScoreWith(embedding));
+  }
+  std::sort(scores.begin(), scores.end(), std::greater<float>());
+
+  std::vector<ScoredUrl> scored_urls = database.FindNearest(
+      3, query, base::BindRepeating([]() { return false; }));
+  ASSERT_EQ(scored_urls.size(), 3u);
+  for (size_t i = 0; i < scored_urls.size(); i++) {
+    EXPECT_FLOAT_EQ(scored_urls[i].score, scores[i]);
+  }
+}
+
 // Note: Disabled by default so as to not burden the bots. Enable when needed.
 TEST(HistoryEmbeddingsVectorDatabaseTest, DISABLED_ManyVectorsAreFastEnough) {
   VectorDatabaseInMemory database;
@@ -6,6 +6,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/check.h"
@@ -36,10 +37,6 @@ namespace {
 // Covers 8MB block cache,
 const int kMaxApproxMemoryUseMB = 16;
 
-bool PrefixStopCallback(const std::string& prefix, const std::string& key) {
-  return base::StartsWith(key, prefix, base::CompareCase::SENSITIVE);
-}
-
 }  // namespace
 
 Enums::KeyIteratorAction LevelDB::ComputeIteratorAction(
@@ -240,9 +237,31 @@ bool LevelDB::LoadKeysAndEntriesWithFilter(
     std::map<std::string, std::string>* keys_entries,
     const leveldb::ReadOptions& options,
     const std::string& target_prefix) {
-  return LoadKeysAndEntriesWhile(
-      filter, keys_entries, options, target_prefix,
-      base::BindRepeating(&PrefixStopCallback, target_prefix));
+  return LoadKeysAndEntriesWithPrefix(target_prefix, filter, keys_entries,
+                                      options);
+}
+
+bool LevelDB::LoadKeysAndEntriesWithPrefix(
+    const std::string& target_prefix,
+    const KeyFilter& filter,
+    std::map<std::string, std::string>* keys_entries,
+    const leveldb::ReadOptions& options) {
+  DFAKE_SCOPED_LOCK(thread_checker_);
+  if (!db_)
+    return false;
+
+  const leveldb::Slice prefix(target_prefix);
+  std::unique_ptr<leveldb::Iterator> db_iterator(db_->NewIterator(options));
+  for (db_iterator->Seek(prefix);
+       db_iterator->Valid() && db_iterator->key().starts_with(prefix);
+       db_iterator->Next()) {
+    std::string key = db_iterator->key().ToString();
+    if (!filter.is_null() && !filter.Run(key))
+      continue;
+    keys_entries->emplace_hint(keys_entries->end(), std::move(key),
+                               db_iterator->value().ToString());
+  }
+  return true;
 }
 
 bool LevelDB::LoadKeysAndEntriesWhile(
@@ -289,16 +308,19 @@ bool LevelDB::LoadKeys(std::vector<std::string>* keys) {
 
 bool LevelDB::LoadKeys(const std::string& target_prefix,
                        std::vector<std::string>* keys) {
-  leveldb::ReadOptions options;
-  options.fill_cache = false;
-  std::map<std::string, std::string> keys_entries;
-  bool result = LoadKeysAndEntriesWithFilter(KeyFilter(), &keys_entries,
-                                             options, target_prefix);
-  if (!result)
+  DFAKE_SCOPED_LOCK(thread_checker_);
+  if (!db_)
     return false;
 
-  for (const auto& pair : keys_entries)
-    keys->push_back(pair.first);
+  leveldb::ReadOptions options;
+  options.fill_cache = false;
+  const leveldb::Slice prefix(target_prefix);
+  std::unique_ptr<leveldb::Iterator> db_iterator(db_->NewIterator(options));
+  for (db_iterator->Seek(prefix);
+       db_iterator->Valid() && db_iterator->key().starts_with(prefix);
+       db_iterator->Next()) {
+    keys->push_back(db_iterator->key().ToString());
+  }
   return true;
 }
 
@@ -115,7 +115,19 @@ class COMPONENT_EXPORT(LEVELDB_PROTO) LevelDB {
       const std::string& start_key,
       const KeyFilter& while_callback);
 
+  // Retrieves the keys and values that start with |target_prefix| and pass
+  // |filter|. Seeks straight to |target_prefix| and stops at the first key
+  // outside of it, so entries of other clients sharing the database are never
+  // visited.
+  virtual bool LoadKeysAndEntriesWithPrefix(
+      const std::string& target_prefix,
+      const KeyFilter& filter,
+      std::map<std::string, std::string>* keys_entries,
+      const leveldb::ReadOptions& options);
+
   virtual bool LoadKeys(std::vector<std::string>* keys);
+  // Retrieves the keys that start with |target_prefix|, without copying the
+  // values out of the database.
   virtual bool LoadKeys(const std::string& target_prefix,
                         std::vector<std::string>* keys);
 
@@ -10,4 +10,10 @@ BASE_FEATURE(kProtoDBSharedMigration,
              "ProtoDBSharedMigration",
              base::FEATURE_ENABLED_BY_DEFAULT);
 
+// Attaches a bloom filter to the tables of the shared database so that point
+// lookups can skip tables which cannot contain the key.
+BASE_FEATURE(kProtoDBSharedBloomFilter,
+             "ProtoDBSharedBloomFilter",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 }  // namespace leveldb_proto
@@ -13,6 +13,9 @@ namespace leveldb_proto {
 extern const COMPONENT_EXPORT(LEVELDB_PROTO) base::Feature
     kProtoDBSharedMigration;
 
+extern const COMPONENT_EXPORT(LEVELDB_PROTO) base::Feature
+    kProtoDBSharedBloomFilter;
+
 }  // namespace leveldb_proto
 
 #endif  // COMPONENTS_LEVELDB_PROTO_INTERNAL_LEVELDB_PROTO_FEATURE_LIST_H_
@@ -10,6 +10,7 @@
 #include "base/functional/callback_forward.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/task_traits.h"
+#include "base/time/time.h"
 #include "components/leveldb_proto/internal/leveldb_database.h"
 #include "components/leveldb_proto/internal/proto_leveldb_wrapper_metrics.h"
 #include "components/leveldb_proto/public/proto_database.h"
@@ -112,7 +113,12 @@ bool UpdateEntriesFromTaskRunner(
   DCHECK(entries_to_save);
   DCHECK(keys_to_remove);
   leveldb::Status status;
+  const base::TimeTicks start_time = base::TimeTicks::Now();
   bool success = database->Save(*entries_to_save, *keys_to_remove, &status);
+  ProtoLevelDBWrapperMetrics::RecordUpdateDuration(
+      client_id, base::TimeTicks::Now() - start_time);
+  ProtoLevelDBWrapperMetrics::RecordUpdateSize(
+      client_id, entries_to_save->size() + keys_to_remove->size());
   ProtoLevelDBWrapperMetrics::RecordUpdate(client_id, success, status);
   return success;
 }
@@ -125,8 +131,11 @@ bool UpdateEntriesWithRemoveFilterFromTaskRunner(
     const std::string& client_id) {
   DCHECK(entries_to_save);
   leveldb::Status status;
+  const base::TimeTicks start_time = base::TimeTicks::Now();
   bool success = database->UpdateWithRemoveFilter(
       *entries_to_save, delete_key_filter, target_prefix, &status);
+  ProtoLevelDBWrapperMetrics::RecordUpdateDuration(
+      client_id, base::TimeTicks::Now() - start_time);
   ProtoLevelDBWrapperMetrics::RecordUpdate(client_id, success, status);
   return success;
 }
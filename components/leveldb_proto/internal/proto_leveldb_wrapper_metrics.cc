@@ -5,6 +5,8 @@
 #include "components/leveldb_proto/internal/proto_leveldb_wrapper_metrics.h"
 
 #include "base/metrics/histogram.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/time/time.h"
 #include "third_party/leveldatabase/env_chromium.h"
 
 namespace leveldb_proto {
@@ -42,6 +44,31 @@ void ProtoLevelDBWrapperMetrics::RecordUpdate(const std::string& client,
     update_error_histogram_->Add(leveldb_env::GetLevelDBStatusUMAValue(status));
 }
 
+// static
+void ProtoLevelDBWrapperMetrics::RecordUpdateDuration(
+    const std::string& client,
+    base::TimeDelta duration) {
+  base::HistogramBase* update_duration_histogram =
+      base::Histogram::FactoryTimeGet(
+          std::string("ProtoDB.UpdateDuration.") + client,
+          base::Milliseconds(1), base::Seconds(10), 50,
+          base::Histogram::kUmaTargetedHistogramFlag);
+
+  if (update_duration_histogram)
+    update_duration_histogram->AddTime(duration);
+}
+
+// static
+void ProtoLevelDBWrapperMetrics::RecordUpdateSize(const std::string& client,
+                                                  size_t size) {
+  base::HistogramBase* update_size_histogram = base::Histogram::FactoryGet(
+      std::string("ProtoDB.UpdateSize.") + client, 1, 10000, 50,
+      base::Histogram::kUmaTargetedHistogramFlag);
+
+  if (update_size_histogram)
+    update_size_histogram->Add(base::saturated_cast<int>(size));
+}
+
 // static
 void ProtoLevelDBWrapperMetrics::RecordGet(const std::string& client,
                                            bool success,
@@ -5,8 +5,12 @@
 #ifndef COMPONENTS_LEVELDB_PROTO_INTERNAL_PROTO_LEVELDB_WRAPPER_METRICS_H_
 #define COMPONENTS_LEVELDB_PROTO_INTERNAL_PROTO_LEVELDB_WRAPPER_METRICS_H_
 
+#include <stddef.h>
+
 #include <string>
 
+#include "base/time/time.h"
+
 namespace leveldb {
 class Status;
 }  // namespace leveldb
@@ -26,6 +30,12 @@ class ProtoLevelDBWrapperMetrics {
   static void RecordUpdate(const std::string& client,
                            bool success,
                            const leveldb::Status& status);
+  // Records how long an update took on the database task runner and how many
+  // entries it saved or removed. Each update is a separate synced write, so
+  // small updates from a client are a sign of write amplification.
+  static void RecordUpdateDuration(const std::string& client,
+                                   base::TimeDelta duration);
+  static void RecordUpdateSize(const std::string& client, size_t size);
   static void RecordGet(const std::string& client,
                         bool success,
                         bool found,
@@ -7,12 +7,14 @@
 #include <memory>
 #include <utility>
 
+#include "base/feature_list.h"
 #include "base/functional/callback_helpers.h"
 #include "base/memory/ptr_util.h"
 #include "base/synchronization/lock.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/thread_pool.h"
 #include "components/leveldb_proto/internal/leveldb_database.h"
+#include "components/leveldb_proto/internal/leveldb_proto_feature_list.h"
 #include "components/leveldb_proto/internal/proto_database_selector.h"
 #include "components/leveldb_proto/internal/proto_leveldb_wrapper.h"
 #include "components/leveldb_proto/public/proto_database.h"
@@ -408,7 +410,10 @@ void SharedProtoDatabase::OnDestroySharedDatabase(bool success) {
 
 void SharedProtoDatabase::InitDatabase() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(on_task_runner_);
-  auto options = CreateSimpleOptions();
+  auto options =
+      base::FeatureList::IsEnabled(kProtoDBSharedBloomFilter)
+          ? CreateSimpleOptionsWithBloomFilter()
+          : CreateSimpleOptions();
   options.create_if_missing = create_if_missing_;
   db_wrapper_->SetMetricsId(kSharedProtoDatabaseUmaName);
   // |db_wrapper_| uses the same SequencedTaskRunner that Init is called on,
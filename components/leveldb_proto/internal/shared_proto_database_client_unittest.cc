@@ -4,8 +4,10 @@
 
 #include "components/leveldb_proto/internal/shared_proto_database_client.h"
 
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "base/debug/stack_trace.h"
 #include "base/files/scoped_temp_dir.h"
@@ -13,7 +15,9 @@
 #include "base/functional/callback_helpers.h"
 #include "base/logging.h"
 #include "base/strings/string_util.h"
+#include "base/test/bind.h"
 #include "base/test/task_environment.h"
+#include "components/leveldb_proto/internal/leveldb_database.h"
 #include "components/leveldb_proto/internal/proto_leveldb_wrapper.h"
 #include "components/leveldb_proto/internal/shared_proto_database.h"
 #include "components/leveldb_proto/public/proto_database.h"
@@ -389,6 +393,46 @@ TEST_F(SharedProtoDatabaseClientTest,
   ASSERT_TRUE(ContainsKeys(keys, key_list, ProtoDbType::TEST_DATABASE0));
 }
 
+TEST_F(SharedProtoDatabaseClientTest,
+       LoadKeysAndEntriesWithPrefix_OnlyVisitsClientEntries) {
+  auto status = Enums::InitStatus::kError;
+  auto client_a = GetClientAndWait(ProtoDbType::TEST_DATABASE0,
+                                   true /* create_if_missing */, &status);
+  ASSERT_EQ(status, Enums::InitStatus::kOK);
+  auto client_b = GetClientAndWait(ProtoDbType::TEST_DATABASE2,
+                                   true /* create_if_missing */, &status);
+  ASSERT_EQ(status, Enums::InitStatus::kOK);
+
+  KeyVector key_list = {"entry1", "entry2", "entry3"};
+  UpdateEntries(client_a.get(), key_list, leveldb_proto::KeyVector(), true);
+  UpdateEntries(client_b.get(), key_list, leveldb_proto::KeyVector(), true);
+
+  std::string b_prefix =
+      SharedProtoDatabaseClient::PrefixForDatabase(ProtoDbType::TEST_DATABASE2)
+          .value();
+  std::vector<std::string> visited;
+  std::map<std::string, std::string> keys_entries;
+  LevelDB* db = GetLevelDB();
+  ASSERT_TRUE(db->LoadKeysAndEntriesWithPrefix(
+      b_prefix,
+      base::BindLambdaForTesting([&](const std::string& key) {
+        visited.push_back(key);
+        return key != b_prefix + "entry2";
+      }),
+      &keys_entries, leveldb::ReadOptions()));
+
+  ASSERT_EQ(visited.size(), 3U);
+  ASSERT_TRUE(ContainsKeys(visited, key_list, ProtoDbType::TEST_DATABASE2));
+  ASSERT_EQ(keys_entries.size(), 2U);
+  EXPECT_EQ(keys_entries.count(b_prefix + "entry1"), 1U);
+  EXPECT_EQ(keys_entries.count(b_prefix + "entry3"), 1U);
+
+  KeyVector keys;
+  ASSERT_TRUE(db->LoadKeys(b_prefix, &keys));
+  ASSERT_EQ(keys.size(), 3U);
+  ASSERT_TRUE(ContainsKeys(keys, key_list, ProtoDbType::TEST_DATABASE2));
+}
+
 TEST_F(SharedProtoDatabaseClientTest,
        UpdateEntriesWithRemoveFilter_DeletesCorrectEntries) {
   auto status = Enums::InitStatus::kError;
@@ -5,11 +5,14 @@
 #include "components/leveldb_proto/public/proto_database.h"
 
 #include "base/system/sys_info.h"
+#include "third_party/leveldatabase/src/include/leveldb/filter_policy.h"
 
 namespace leveldb_proto {
 namespace {
 const size_t kDatabaseWriteBufferSizeBytes = 512 * 1024;
 const size_t kDatabaseWriteBufferSizeBytesForLowEndDevice = 128 * 1024;
+// ~1% false positive rate, as recommended by leveldb.
+const int kBloomFilterBitsPerKey = 10;
 }  // namespace
 
 leveldb_env::Options CreateSimpleOptions() {
@@ -25,4 +28,13 @@ leveldb_env::Options CreateSimpleOptions() {
   return options;
 }
 
+leveldb_env::Options CreateSimpleOptionsWithBloomFilter() {
+  // The policy must outlive every database opened with it.
+  static const leveldb::FilterPolicy* filter_policy =
+      leveldb::NewBloomFilterPolicy(kBloomFilterBitsPerKey);
+  leveldb_env::Options options = CreateSimpleOptions();
+  options.filter_policy = filter_policy;
+  return options;
+}
+
 }  // namespace leveldb_proto
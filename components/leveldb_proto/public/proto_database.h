@@ -243,6 +243,13 @@ class ProtoDatabase {
 // 2) max_open_files = 0
 leveldb_env::Options COMPONENT_EXPORT(LEVELDB_PROTO) CreateSimpleOptions();
 
+// Same as CreateSimpleOptions(), but also sets a bloom filter policy so that
+// each table carries a filter block. Point lookups (GetEntry) then skip tables
+// that cannot contain the key. Tables written without a filter are still read
+// correctly, so this can be turned on for an existing database.
+leveldb_env::Options COMPONENT_EXPORT(LEVELDB_PROTO)
+    CreateSimpleOptionsWithBloomFilter();
+
 }  // namespace leveldb_proto
 
 #endif  // COMPONENTS_LEVELDB_PROTO_PUBLIC_PROTO_DATABASE_H_
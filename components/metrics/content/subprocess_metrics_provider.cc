@@ -258,17 +258,10 @@ void SubprocessMetricsProvider::MergeHistogramDeltasFromAllocator(
     RefCountedAllocator* allocator) {
   DCHECK(allocator);
 
-  int histogram_count = 0;
-  base::PersistentHistogramAllocator* allocator_ptr = allocator->allocator();
-  base::PersistentHistogramAllocator::Iterator hist_iter(allocator_ptr);
-  while (true) {
-    std::unique_ptr<base::HistogramBase> histogram = hist_iter.GetNext();
-    if (!histogram) {
-      break;
-    }
-    allocator_ptr->MergeHistogramDeltaToStatisticsRecorder(histogram.get());
-    ++histogram_count;
-  }
+  // Only histograms that changed since the previous merge are visited, which
+  // matters when there are many subprocesses with mostly idle histograms.
+  size_t histogram_count =
+      allocator->allocator()->MergeChangedDeltasToStatisticsRecorder();
 
   DVLOG(1) << "Reported " << histogram_count << " histograms from subprocess #"
            << id;
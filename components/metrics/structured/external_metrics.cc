@@ -7,6 +7,7 @@
 #include <string_view>
 
 #include "base/containers/fixed_flat_set.h"
+#include "base/containers/span.h"
 #include "base/files/dir_reader_posix.h"
 #include "base/files/file.h"
 #include "base/files/file_util.h"
@@ -161,7 +162,8 @@ EventsProto ReadAndDeleteEvents(
 
   while (dir_reader.Next()) {
     base::FilePath path = directory.Append(dir_reader.name());
-    base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_OPEN_ALWAYS);
+    base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_OPEN_ALWAYS |
+                              base::File::FLAG_READ);
 
     // This will fail on '.' and '..' files.
     if (!file.IsValid()) {
@@ -183,24 +185,23 @@ EventsProto ReadAndDeleteEvents(
     ++file_counter;
 
     std::string proto_str;
-    int64_t file_size;
+    // Reuse the GetInfo() result and the open `file` so that each event file
+    // is only stat'ed and opened once.
+    const int64_t file_size = info.size;
     EventsProto proto;
 
-    // If an event is abnormally large, ignore it to prevent OOM.
-    bool fs_ok = base::GetFileSize(path, &file_size);
-
-    // If file size get is successful, log the file size.
-    if (fs_ok) {
-      LogEventFileSizeKB(static_cast<int>(file_size / 1024));
-    }
+    LogEventFileSizeKB(static_cast<int>(file_size / 1024));
 
-    if (!fs_ok || file_size > GetFileSizeByteLimit()) {
+    // If an event is abnormally large, ignore it to prevent OOM.
+    if (file_size > GetFileSizeByteLimit()) {
       base::DeleteFile(path);
       continue;
     }
 
-    bool read_ok = base::ReadFileToString(path, &proto_str) &&
-                   proto.ParseFromString(proto_str);
+    proto_str.resize(static_cast<size_t>(file_size));
+    bool read_ok =
+        file.ReadAndCheck(0, base::as_writable_byte_span(proto_str)) &&
+        proto.ParseFromString(proto_str);
     base::DeleteFile(path);
 
     // Process all events that were packed in the proto.
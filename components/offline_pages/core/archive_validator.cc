@@ -59,7 +59,9 @@ std::pair<int64_t, std::string> ArchiveValidator::GetSizeAndComputeDigest(
 
   ArchiveValidator archive_validator;
 
-  const int kMaxBufferSize = 1024;
+  // Archives are commonly several megabytes, so read in large chunks to keep
+  // the number of read() calls down.
+  const int kMaxBufferSize = 64 * 1024;
   std::vector<char> buffer(kMaxBufferSize);
   int64_t total_read = 0LL;
   int bytes_read;
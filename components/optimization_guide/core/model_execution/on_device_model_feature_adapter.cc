@@ -53,7 +53,7 @@ OnDeviceModelFeatureAdapter::ConstructInputString(
   if (!config_.has_input_config()) {
     return std::nullopt;
   }
-  const auto input_config = config_.input_config();
+  const auto& input_config = config_.input_config();
   if (input_config.request_base_name() != request.GetTypeName()) {
     return std::nullopt;
   }
@@ -67,7 +67,7 @@ std::optional<proto::Any> OnDeviceModelFeatureAdapter::ConstructOutputMetadata(
   if (!config_.has_output_config()) {
     return std::nullopt;
   }
-  auto output_config = config_.output_config();
+  const auto& output_config = config_.output_config();
 
   return SetProtoValue(output_config.proto_type(), output_config.proto_field(),
                        output);
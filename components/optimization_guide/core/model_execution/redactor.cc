@@ -5,10 +5,10 @@
 #include "components/optimization_guide/core/model_execution/redactor.h"
 
 #include <algorithm>
+#include <utility>
 
 #include "base/debug/dump_without_crashing.h"
 #include "base/memory/ptr_util.h"
-#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "components/optimization_guide/proto/redaction.pb.h"
 #include "third_party/re2/src/re2/re2.h"
@@ -23,7 +23,7 @@ Redactor::Rule::Rule(std::unique_ptr<re2::RE2> re,
                      size_t max_pattern_length)
     : re_(std::move(re)),
       behavior_(behavior),
-      replacement_string_(replacement_string),
+      replacement_string_(std::move(replacement_string)),
       matching_group_(matching_group),
       min_pattern_length_(min_pattern_length),
       max_pattern_length_(max_pattern_length) {}
@@ -106,11 +106,13 @@ RedactResult Redactor::Rule::Process(const std::string& input,
           input.find(match) == std::string::npos) {
         const size_t match_start_offset_in_output =
             match.data() - output_view.data();
-        new_output +=
-            base::StrCat({std::string_view(output).substr(
-                              last_match_start,
-                              match_start_offset_in_output - last_match_start),
-                          GetReplacementString(match)});
+        if (new_output.empty()) {
+          // Replacements are usually close in size to what they replace.
+          new_output.reserve(output.length());
+        }
+        new_output.append(output_view.substr(
+            last_match_start, match_start_offset_in_output - last_match_start));
+        AppendReplacementString(match, new_output);
         last_match_start = match_start_offset_in_output + match.length();
       }
     }
@@ -126,20 +128,21 @@ RedactResult Redactor::Rule::Process(const std::string& input,
     return RedactResult::kContinue;
   }
   if (last_match_start != output.length()) {
-    new_output += output.substr(last_match_start);
+    new_output.append(output_view.substr(last_match_start));
   }
   std::swap(output, new_output);
   return RedactResult::kContinue;
 }
 
-std::string Redactor::Rule::GetReplacementString(std::string_view match) const {
+void Redactor::Rule::AppendReplacementString(std::string_view match,
+                                             std::string& output) const {
   if (!replacement_string_.empty()) {
-    return replacement_string_;
+    output.append(replacement_string_);
+    return;
   }
-  std::string replacement(match.length() + 2, '#');
-  replacement[0] = '[';
-  replacement.back() = ']';
-  return replacement;
+  output.push_back('[');
+  output.append(match.length(), '#');
+  output.push_back(']');
 }
 
 bool Redactor::Rule::IsValidMatch(const std::string_view& match) const {
@@ -63,7 +63,9 @@ class Redactor final {
     // Returns true if a match should be considered valid.
     bool IsValidMatch(const std::string_view& match) const;
 
-    std::string GetReplacementString(std::string_view match) const;
+    // Appends the replacement for `match` to `output`.
+    void AppendReplacementString(std::string_view match,
+                                 std::string& output) const;
 
     std::unique_ptr<re2::RE2> re_;
     Behavior behavior_;
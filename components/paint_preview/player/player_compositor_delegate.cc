@@ -4,6 +4,7 @@
 
 #include "components/paint_preview/player/player_compositor_delegate.h"
 
+#include <iterator>
 #include <optional>
 #include <string>
 #include <utility>
@@ -245,7 +246,6 @@ int32_t PlayerCompositorDelegate::RequestBitmap(
     return request_id;
   }
 
-  bitmap_request_queue_.push(request_id);
   pending_bitmap_requests_.emplace(
       request_id,
       BitmapRequest(frame_guid, clip_rect, scale_factor,
@@ -267,9 +267,6 @@ bool PlayerCompositorDelegate::CancelBitmapRequest(int32_t request_id) {
 }
 
 void PlayerCompositorDelegate::CancelAllBitmapRequests() {
-  while (bitmap_request_queue_.size())
-    bitmap_request_queue_.pop();
-
   pending_bitmap_requests_.clear();
 }
 
@@ -554,14 +551,11 @@ void PlayerCompositorDelegate::ProcessBitmapRequestsFromQueue() {
   TRACE_EVENT0("paint_preview",
                "PlayerCompositorDelegate::ProcessBitmapRequestsFromQueue");
 
-  while (active_requests_ < max_requests_ && bitmap_request_queue_.size()) {
-    int request_id = bitmap_request_queue_.front();
-    bitmap_request_queue_.pop();
-
-    auto it = pending_bitmap_requests_.find(request_id);
-    if (it == pending_bitmap_requests_.end())
-      continue;
-
+  while (active_requests_ < max_requests_ &&
+         !pending_bitmap_requests_.empty()) {
+    // Serve the newest request first; when scrolling, older requests are for
+    // regions that are likely no longer visible.
+    auto it = std::prev(pending_bitmap_requests_.end());
     BitmapRequest& request = it->second;
     active_requests_++;
     // If the client disconnects mid request, just give up as we should be
@@ -5,11 +5,11 @@
 #ifndef COMPONENTS_PAINT_PREVIEW_PLAYER_PLAYER_COMPOSITOR_DELEGATE_H_
 #define COMPONENTS_PAINT_PREVIEW_PLAYER_PLAYER_COMPOSITOR_DELEGATE_H_
 
+#include <map>
 #include <optional>
 
 #include "base/cancelable_callback.h"
 #include "base/containers/flat_map.h"
-#include "base/containers/queue.h"
 #include "base/functional/callback.h"
 #include "base/memory/memory_pressure_listener.h"
 #include "base/memory/raw_ptr.h"
@@ -204,7 +204,9 @@ class PlayerCompositorDelegate {
 
   int active_requests_{0};
   int32_t next_request_id_{0};
-  base::queue<int32_t> bitmap_request_queue_;
+  // Requests that haven't been sent to the compositor yet, keyed by their
+  // increasing request ID. They are sent newest first, as the most recent
+  // requests are the ones for what the user is currently looking at.
   std::map<int32_t, BitmapRequest> pending_bitmap_requests_;
   gfx::Point root_frame_offsets_;
 
@@ -5,6 +5,7 @@
 #include "components/paint_preview/player/player_compositor_delegate.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
@@ -857,6 +858,50 @@ TEST_F(PlayerCompositorDelegateTest, RequestBitmapSuccessQueued) {
   env.RunUntilIdle();
 }
 
+TEST_F(PlayerCompositorDelegateTest, RequestBitmapQueuedNewestFirst) {
+  auto* service = GetBaseService();
+  auto file_manager = service->GetFileMixin()->GetFileManager();
+  auto key = file_manager->CreateKey(1U);
+  {
+    // This test skips setting up files as the fakes don't use them. In normal
+    // execution the files are required by the service or no bitmap will be
+    // created.
+    PlayerCompositorDelegateImpl player_compositor_delegate;
+    player_compositor_delegate.SetExpected(CompositorStatus::NO_CAPTURE, 0.0);
+    player_compositor_delegate.InitializeWithFakeServiceForTest(
+        service, GURL(), key, /*main_frame_mode=*/false, base::DoNothing(),
+        base::TimeDelta::Max(), kMaxParallelRequests,
+        CreateCompositorService());
+    env.RunUntilIdle();
+    EXPECT_TRUE(player_compositor_delegate.WasStatusChecked());
+
+    // Only one request is in flight at a time. Once it completes, the most
+    // recent of the queued requests should be sent next.
+    std::vector<int> completed;
+    auto on_bitmap = [](std::vector<int>* completed, int* request_id,
+                        mojom::PaintPreviewCompositor::BitmapStatus status,
+                        const SkBitmap& bitmap) {
+      EXPECT_EQ(mojom::PaintPreviewCompositor::BitmapStatus::kSuccess, status);
+      completed->push_back(*request_id);
+    };
+    int request_0 = 0;
+    int request_1 = 0;
+    int request_2 = 0;
+    request_0 = player_compositor_delegate.RequestBitmap(
+        base::UnguessableToken::Create(), gfx::Rect(10, 20, 30, 40), 1.0,
+        base::BindOnce(on_bitmap, &completed, &request_0));
+    request_1 = player_compositor_delegate.RequestBitmap(
+        base::UnguessableToken::Create(), gfx::Rect(10, 20, 30, 40), 1.0,
+        base::BindOnce(on_bitmap, &completed, &request_1));
+    request_2 = player_compositor_delegate.RequestBitmap(
+        base::UnguessableToken::Create(), gfx::Rect(10, 20, 30, 40), 1.0,
+        base::BindOnce(on_bitmap, &completed, &request_2));
+    env.FastForwardUntilNoTasksRemain();
+    EXPECT_EQ(completed, std::vector<int>({request_0, request_2, request_1}));
+  }
+  env.RunUntilIdle();
+}
+
 TEST_F(PlayerCompositorDelegateTest, RequestMainFrameBitmapSuccess) {
   auto* service = GetBaseService();
   auto file_manager = service->GetFileMixin()->GetFileManager();
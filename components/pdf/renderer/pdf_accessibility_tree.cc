@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "base/notreached.h"
 #include "base/ranges/algorithm.h"
 #include "base/strings/utf_string_conversion_utils.h"
+#include "base/strings/utf_string_conversions.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/time/time.h"
 #include "components/pdf/renderer/pdf_ax_action_target.h"
@@ -458,6 +460,7 @@ std::string GetTextRunCharsAsUTF8(
     const std::vector<chrome_pdf::AccessibilityCharInfo>& chars,
     int char_index) {
   std::string chars_utf8;
+  chars_utf8.reserve(text_run.len);
   for (uint32_t i = 0; i < text_run.len; ++i) {
     base::WriteUnicodeCharacter(
         static_cast<base_icu::UChar32>(chars[char_index + i].unicode_character),
@@ -707,7 +710,7 @@ class PdfAccessibilityTreeBuilder {
       ui::AXNodeData* root_node,
       blink::WebAXObject* container_obj,
       std::vector<std::unique_ptr<ui::AXNodeData>>* nodes,
-      std::map<int32_t, chrome_pdf::PageCharacterIndex>*
+      base::flat_map<int32_t, chrome_pdf::PageCharacterIndex>*
           node_id_to_page_char_index,
       std::map<int32_t, PdfAccessibilityTree::AnnotationInfo>*
           node_id_to_annotation_info
@@ -897,9 +900,9 @@ class PdfAccessibilityTreeBuilder {
   }
 
  private:
-  void AddWordStartsAndEnds(ui::AXNodeData* inline_text_box) {
-    std::u16string text = inline_text_box->GetString16Attribute(
-        ax::mojom::StringAttribute::kName);
+  void AddWordStartsAndEnds(ui::AXNodeData* inline_text_box,
+                            std::string_view name) {
+    std::u16string text = base::UTF8ToUTF16(name);
     base::i18n::BreakIterator iter(text, base::i18n::BreakIterator::BREAK_WORD);
     if (!iter.Init())
       return;
@@ -969,10 +972,10 @@ class PdfAccessibilityTreeBuilder {
         ax::mojom::Role::kInlineTextBox, ax::mojom::Restriction::kReadOnly);
     inline_text_box_node->SetNameFrom(ax::mojom::NameFrom::kContents);
 
-    std::string chars__utf8 =
+    std::string chars_utf8 =
         GetTextRunCharsAsUTF8(text_run, *chars_, page_char_index.char_index);
     inline_text_box_node->AddStringAttribute(ax::mojom::StringAttribute::kName,
-                                             chars__utf8);
+                                             chars_utf8);
     inline_text_box_node->AddIntAttribute(
         ax::mojom::IntAttribute::kTextDirection,
         static_cast<uint32_t>(text_run.direction));
@@ -1000,7 +1003,7 @@ class PdfAccessibilityTreeBuilder {
         GetTextRunCharOffsets(text_run, *chars_, page_char_index.char_index);
     inline_text_box_node->AddIntListAttribute(
         ax::mojom::IntListAttribute::kCharacterOffsets, char_offsets);
-    AddWordStartsAndEnds(inline_text_box_node);
+    AddWordStartsAndEnds(inline_text_box_node, chars_utf8);
     node_id_to_page_char_index_->emplace(inline_text_box_node->id,
                                          page_char_index);
     return inline_text_box_node;
@@ -1532,7 +1535,7 @@ class PdfAccessibilityTreeBuilder {
   raw_ptr<ui::AXNodeData> page_node_;
   raw_ptr<blink::WebAXObject> container_obj_;
   raw_ptr<std::vector<std::unique_ptr<ui::AXNodeData>>> nodes_;
-  raw_ptr<std::map<int32_t, chrome_pdf::PageCharacterIndex>>
+  raw_ptr<base::flat_map<int32_t, chrome_pdf::PageCharacterIndex>>
       node_id_to_page_char_index_;
   raw_ptr<std::map<int32_t, PdfAccessibilityTree::AnnotationInfo>>
       node_id_to_annotation_info_;
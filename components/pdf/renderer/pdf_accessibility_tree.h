@@ -10,6 +10,7 @@
 #include <optional>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "content/public/renderer/plugin_ax_tree_action_target_adapter.h"
@@ -399,8 +400,11 @@ class PdfAccessibilityTree : public ui::AXTreeSource<const ui::AXNode*,
   // Map from the id of each static text AXNode and inline text box
   // AXNode to the page index and index of the character within its
   // page. Used to find the node associated with the start or end of
-  // a selection and vice-versa.
-  std::map<int32_t, chrome_pdf::PageCharacterIndex> node_id_to_page_char_index_;
+  // a selection and vice-versa. There is an entry for every text node of the
+  // document, so a flat map is used; node IDs are generated in increasing
+  // order, which makes insertions appends.
+  base::flat_map<int32_t, chrome_pdf::PageCharacterIndex>
+      node_id_to_page_char_index_;
 
   // Map between AXNode id to annotation object. Used to find the annotation
   // object to which an action can be passed.
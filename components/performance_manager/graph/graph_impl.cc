@@ -457,6 +457,7 @@ void GraphImpl::AddNewNode(NodeBase* new_node) {
   // Add the node to the graph.
   auto it = nodes_.insert(new_node);
   DCHECK(it.second);  // Inserted successfully
+  nodes_by_type_[static_cast<size_t>(new_node->type())].insert(new_node);
 
   // Advance the node through its lifecycle until it is active in the graph. See
   // NodeBase and NodeState for full details of the lifecycle.
@@ -492,6 +493,8 @@ void GraphImpl::RemoveNode(NodeBase* node) {
   // Remove the node itself.
   size_t erased = nodes_.erase(node);
   DCHECK_EQ(1u, erased);
+  erased = nodes_by_type_[static_cast<size_t>(node->type())].erase(node);
+  DCHECK_EQ(1u, erased);
 }
 
 void GraphImpl::NotifyFrameNodeInitializing(const FrameNode* frame_node) {
@@ -686,11 +689,11 @@ void GraphImpl::UnregisterFrameNodeForId(RenderProcessHostId render_process_id,
 template <typename NodeType, typename ReturnNodeType>
 std::vector<ReturnNodeType> GraphImpl::GetAllNodesOfType() const {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  const auto type = NodeType::Type();
+  const NodeSet& nodes = nodes_by_type_[static_cast<size_t>(NodeType::Type())];
   std::vector<ReturnNodeType> ret;
-  for (NodeBase* node : nodes_) {
-    if (node->type() == type)
-      ret.push_back(NodeType::FromNodeBase(node));
+  ret.reserve(nodes.size());
+  for (NodeBase* node : nodes) {
+    ret.push_back(NodeType::FromNodeBase(node));
   }
   return ret;
 }
@@ -699,13 +702,11 @@ template <typename NodeType, typename VisitedNodeType>
 bool GraphImpl::VisitAllNodesOfType(
     base::FunctionRef<bool(VisitedNodeType)> visitor) const {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  const auto type = NodeType::Type();
-  for (NodeBase* node : nodes_) {
-    if (node->type() == type) {
-      VisitedNodeType visited_node = NodeType::FromNodeBase(node);
-      if (!visitor(visited_node)) {
-        return false;
-      }
+  for (NodeBase* node :
+       nodes_by_type_[static_cast<size_t>(NodeType::Type())]) {
+    VisitedNodeType visited_node = NodeType::FromNodeBase(node);
+    if (!visitor(visited_node)) {
+      return false;
     }
   }
   return true;
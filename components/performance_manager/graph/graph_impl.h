@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include <array>
 #include <map>
 #include <memory>
 #include <unordered_set>
@@ -18,6 +19,7 @@
 #include "base/process/process_handle.h"
 #include "base/sequence_checker.h"
 #include "components/performance_manager/graph/initializing_frame_node_observer.h"
+#include "components/performance_manager/graph/node_type.h"
 #include "components/performance_manager/owned_objects.h"
 #include "components/performance_manager/public/graph/graph.h"
 #include "components/performance_manager/public/graph/graph_registered.h"
@@ -255,6 +257,11 @@ class GraphImpl : public Graph {
   std::unique_ptr<SystemNodeImpl> system_node_
       GUARDED_BY_CONTEXT(sequence_checker_);
   NodeSet nodes_ GUARDED_BY_CONTEXT(sequence_checker_);
+  // The same nodes as |nodes_|, indexed by NodeTypeEnum. This lets
+  // GetAllNodesOfType() and VisitAllNodesOfType() skip nodes of other types;
+  // frame nodes vastly outnumber page and process nodes in tab-heavy sessions.
+  std::array<NodeSet, static_cast<size_t>(NodeTypeEnum::kWorker) + 1>
+      nodes_by_type_ GUARDED_BY_CONTEXT(sequence_checker_);
   ProcessByPidMap processes_by_pid_ GUARDED_BY_CONTEXT(sequence_checker_);
   FrameById frames_by_id_ GUARDED_BY_CONTEXT(sequence_checker_);
   raw_ptr<ukm::UkmRecorder> ukm_recorder_
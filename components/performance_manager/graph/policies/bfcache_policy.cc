@@ -63,6 +63,17 @@ int BackgroundCacheSizeOnCriticalPressure() {
   return background_cache_size_on_critical_pressure.Get();
 }
 
+// The delay after which the BFCache of a hidden page is limited to the
+// backgrounded tab's cache size on moderate memory pressure, without waiting
+// for memory pressure. The negative value disables this.
+int DelayToTrimBackgroundPageInSeconds() {
+  static constexpr base::FeatureParam<int>
+      delay_to_trim_background_page_in_seconds{
+          &features::kBFCachePerformanceManagerPolicy,
+          "delay_to_trim_background_page_in_seconds", -1};
+  return delay_to_trim_background_page_in_seconds.Get();
+}
+
 bool PageMightHaveFramesInBFCache(const PageNode* page_node) {
   // TODO(crbug.com/1211368): Use PageState when that actually works.
   auto main_frame_nodes = page_node->GetMainFrameNodes();
@@ -126,14 +137,37 @@ void BFCachePolicy::MaybeFlushBFCache(
 void BFCachePolicy::OnPassedToGraph(Graph* graph) {
   DCHECK(graph->HasOnlySystemNode());
   graph_ = graph;
+  graph_->AddPageNodeObserver(this);
   graph_->AddSystemNodeObserver(this);
 }
 
 void BFCachePolicy::OnTakenFromGraph(Graph* graph) {
+  background_page_timers_.clear();
   graph_->RemoveSystemNodeObserver(this);
+  graph_->RemovePageNodeObserver(this);
   graph_ = nullptr;
 }
 
+void BFCachePolicy::OnBeforePageNodeRemoved(const PageNode* page_node) {
+  background_page_timers_.erase(page_node);
+}
+
+void BFCachePolicy::OnIsVisibleChanged(const PageNode* page_node) {
+  if (page_node->IsVisible()) {
+    background_page_timers_.erase(page_node);
+    return;
+  }
+  const int delay_in_seconds = DelayToTrimBackgroundPageInSeconds();
+  if (delay_in_seconds < 0) {
+    return;
+  }
+  // Unretained is safe because the timer is owned by this object.
+  background_page_timers_[page_node].Start(
+      FROM_HERE, base::Seconds(delay_in_seconds),
+      base::BindOnce(&BFCachePolicy::OnBackgroundPageTimerFired,
+                     base::Unretained(this), page_node));
+}
+
 void BFCachePolicy::OnMemoryPressure(MemoryPressureLevel new_level) {
   // This shouldn't happen but add the check anyway in case the API changes.
   if (new_level == MemoryPressureLevel::MEMORY_PRESSURE_LEVEL_NONE) {
@@ -149,4 +183,15 @@ void BFCachePolicy::OnMemoryPressure(MemoryPressureLevel new_level) {
   }
 }
 
+void BFCachePolicy::OnBackgroundPageTimerFired(const PageNode* page_node) {
+  if (!page_node->IsVisible() &&
+      page_node->GetPageState() == PageNode::PageState::kActive &&
+      PageMightHaveFramesInBFCache(page_node)) {
+    MaybeFlushBFCache(page_node,
+                      MemoryPressureLevel::MEMORY_PRESSURE_LEVEL_MODERATE);
+  }
+  // Deleting the timer from within its task is safe.
+  background_page_timers_.erase(page_node);
+}
+
 }  // namespace performance_manager::policies
@@ -5,17 +5,23 @@
 #ifndef COMPONENTS_PERFORMANCE_MANAGER_GRAPH_POLICIES_BFCACHE_POLICY_H_
 #define COMPONENTS_PERFORMANCE_MANAGER_GRAPH_POLICIES_BFCACHE_POLICY_H_
 
+#include <map>
+
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
 #include "base/timer/timer.h"
 #include "components/performance_manager/public/graph/graph.h"
+#include "components/performance_manager/public/graph/page_node.h"
 #include "components/performance_manager/public/graph/system_node.h"
 
 namespace performance_manager::policies {
 
 // Policies that automatically flush the BFCache of pages when the system is
-// under memory pressure.
+// under memory pressure. Optionally, the BFCache of pages that stay hidden for
+// a while is also trimmed ahead of any memory pressure signal, so that cached
+// pages are shed before whole tabs need to be discarded.
 class BFCachePolicy : public GraphOwned,
+                      public PageNode::ObserverDefaultImpl,
                       public SystemNode::ObserverDefaultImpl {
  public:
   BFCachePolicy() = default;
@@ -38,10 +44,20 @@ class BFCachePolicy : public GraphOwned,
   void OnPassedToGraph(Graph* graph) override;
   void OnTakenFromGraph(Graph* graph) override;
 
+  // PageNodeObserver:
+  void OnBeforePageNodeRemoved(const PageNode* page_node) override;
+  void OnIsVisibleChanged(const PageNode* page_node) override;
+
   // SystemNodeObserver:
   void OnMemoryPressure(MemoryPressureLevel new_level) override;
 
+  // Invoked when |page_node| has been hidden for the configured delay.
+  void OnBackgroundPageTimerFired(const PageNode* page_node);
+
   raw_ptr<Graph> graph_;
+
+  // Timers for hidden pages whose BFCache will be trimmed when they fire.
+  std::map<const PageNode*, base::OneShotTimer> background_page_timers_;
 };
 
 }  // namespace performance_manager::policies
@@ -5,10 +5,12 @@
 #include "components/performance_manager/graph/policies/bfcache_policy.h"
 
 #include "base/memory/raw_ptr.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/time/time.h"
 #include "components/performance_manager/graph/frame_node_impl.h"
 #include "components/performance_manager/graph/graph_impl.h"
 #include "components/performance_manager/graph/system_node_impl.h"
+#include "components/performance_manager/public/features.h"
 #include "components/performance_manager/test_support/graph_test_harness.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -35,7 +37,8 @@ using MockBFCachePolicy = ::testing::StrictMock<LenientMockBFCachePolicy>;
 
 class BFCachePolicyTest : public GraphTestHarness {
  public:
-  BFCachePolicyTest() = default;
+  BFCachePolicyTest()
+      : GraphTestHarness(base::test::TaskEnvironment::TimeSource::MOCK_TIME) {}
   ~BFCachePolicyTest() override = default;
   BFCachePolicyTest(const BFCachePolicyTest& other) = delete;
   BFCachePolicyTest& operator=(const BFCachePolicyTest&) = delete;
@@ -93,4 +96,40 @@ TEST_F(BFCachePolicyTest, BFCacheFlushedOnMemoryPressure) {
   ::testing::Mock::VerifyAndClearExpectations(policy_);
 }
 
+class BFCachePolicyBackgroundTrimTest : public BFCachePolicyTest {
+ public:
+  BFCachePolicyBackgroundTrimTest() {
+    scoped_feature_list_.InitAndEnableFeatureWithParameters(
+        features::kBFCachePerformanceManagerPolicy,
+        {{"delay_to_trim_background_page_in_seconds", "60"}});
+  }
+
+ private:
+  base::test::ScopedFeatureList scoped_feature_list_;
+};
+
+TEST_F(BFCachePolicyBackgroundTrimTest, BFCacheTrimmedAfterPageHidden) {
+  page_node_->SetIsVisible(true);
+  page_node_->SetLoadingState(PageNode::LoadingState::kLoadedBusy);
+  ::testing::Mock::VerifyAndClearExpectations(policy_);
+
+  // A page that becomes visible again before the delay isn't trimmed.
+  page_node_->SetIsVisible(false);
+  AdvanceClock(base::Seconds(30));
+  page_node_->SetIsVisible(true);
+  AdvanceClock(base::Seconds(60));
+  ::testing::Mock::VerifyAndClearExpectations(policy_);
+
+  page_node_->SetIsVisible(false);
+  AdvanceClock(base::Seconds(59));
+  ::testing::Mock::VerifyAndClearExpectations(policy_);
+
+  EXPECT_CALL(
+      *policy_,
+      MaybeFlushBFCache(page_node_.get(),
+                        MemoryPressureLevel::MEMORY_PRESSURE_LEVEL_MODERATE));
+  AdvanceClock(base::Seconds(1));
+  ::testing::Mock::VerifyAndClearExpectations(policy_);
+}
+
 }  // namespace performance_manager::policies
@@ -158,6 +158,7 @@ void CPUMeasurementMonitor::StopMonitoring() {
   graph_->RemoveProcessNodeObserver(this);
   graph_->RemoveWorkerNodeObserver(this);
   graph_ = nullptr;
+  last_full_update_time_ = base::TimeTicks();
 }
 
 bool CPUMeasurementMonitor::IsMonitoring() const {
@@ -347,6 +348,15 @@ void CPUMeasurementMonitor::UpdateAllCPUMeasurements() {
   // Must call StartMonitoring() before getting measurements.
   CHECK(graph_);
 
+  // Graph changes since the last poll already updated the affected processes
+  // through UpdateCPUMeasurements(), so `measurement_results_` is consistent.
+  const base::TimeTicks now = base::TimeTicks::Now();
+  if (!last_full_update_time_.is_null() &&
+      now - last_full_update_time_ < kMinTimeBetweenFullUpdates) {
+    return;
+  }
+  last_full_update_time_ = now;
+
   // Update CPU metrics, attributing the cumulative CPU of each process to its
   // frames and workers.
   std::map<ResourceContext, CPUTimeResult> measurement_deltas;
@@ -41,6 +41,12 @@ class CPUMeasurementMonitor
       public WorkerNode::ObserverDefaultImpl,
       public performance_manager::NodeDataDescriberDefaultImpl {
  public:
+  // UpdateAndGetCPUMeasurements() calls closer together than this reuse the
+  // previous poll of every process instead of measuring them all again. This
+  // lets several queries that fire together share one round of measurements.
+  static constexpr base::TimeDelta kMinTimeBetweenFullUpdates =
+      base::Seconds(1);
+
   CPUMeasurementMonitor();
   ~CPUMeasurementMonitor() override;
 
@@ -63,7 +69,8 @@ class CPUMeasurementMonitor
   // Updates the CPU measurements for each ProcessNode being tracked and returns
   // the estimated CPU usage of each frame and worker in those processes, and
   // all pages containing them. Each QueryResults object will contain a
-  // CPUTimeResult.
+  // CPUTimeResult. Processes are not polled again if the last update was less
+  // than kMinTimeBetweenFullUpdates ago.
   QueryResultMap UpdateAndGetCPUMeasurements();
 
   // FrameNode::Observer:
@@ -206,6 +213,10 @@ class CPUMeasurementMonitor
   // Graph being monitored. This will be only be set if StartMonitoring() was
   // called and StopMonitoring() was not.
   raw_ptr<Graph> graph_ GUARDED_BY_CONTEXT(sequence_checker_) = nullptr;
+
+  // Last time UpdateAllCPUMeasurements() polled every process, or null if it
+  // hasn't since StartMonitoring().
+  base::TimeTicks last_full_update_time_ GUARDED_BY_CONTEXT(sequence_checker_);
 };
 
 }  // namespace resource_attribution
@@ -231,6 +231,37 @@ class ResourceAttrCPUMonitorTest
   QueryResultMap current_measurements_;
 };
 
+// Tests that queries closer together than kMinTimeBetweenFullUpdates share
+// one poll of the processes.
+TEST_F(ResourceAttrCPUMonitorTest, RepeatedQueriesReuseMeasurements) {
+  SetProcessCPUUsage(mock_graph.process.get(), 0.6);
+  StartMonitoring();
+  task_env().FastForwardBy(kTimeBetweenMeasurements);
+  UpdateAndGetCPUMeasurements();
+
+  const ProcessContext& process_context =
+      mock_graph.process->GetResourceContext();
+  ASSERT_TRUE(base::Contains(current_measurements_, process_context));
+  const base::TimeDelta cumulative_cpu =
+      current_measurements_.at(process_context).cpu_time_result->cumulative_cpu;
+  EXPECT_GT(cumulative_cpu, base::TimeDelta());
+
+  task_env().FastForwardBy(
+      CPUMeasurementMonitor::kMinTimeBetweenFullUpdates / 2);
+  UpdateAndGetCPUMeasurements();
+  ASSERT_TRUE(base::Contains(current_measurements_, process_context));
+  EXPECT_EQ(
+      current_measurements_.at(process_context).cpu_time_result->cumulative_cpu,
+      cumulative_cpu);
+
+  task_env().FastForwardBy(CPUMeasurementMonitor::kMinTimeBetweenFullUpdates);
+  UpdateAndGetCPUMeasurements();
+  ASSERT_TRUE(base::Contains(current_measurements_, process_context));
+  EXPECT_GT(
+      current_measurements_.at(process_context).cpu_time_result->cumulative_cpu,
+      cumulative_cpu);
+}
+
 // Tests that renderers created at various points around CPU measurement
 // snapshots are handled correctly.
 TEST_F(ResourceAttrCPUMonitorTest, CreateTiming) {
@@ -117,7 +117,10 @@ std::unique_ptr<JsonPrefStore::ReadResult> ReadPrefsFromDisk(
   read_result->value = deserializer.Deserialize(&error_code, &error_msg);
   read_result->error =
       HandleReadErrors(read_result->value.get(), path, error_code, error_msg);
-  read_result->no_dir = !base::PathExists(path.DirName());
+  // The directory exists if the file could be read, which is the common case,
+  // so only check for it otherwise.
+  read_result->no_dir =
+      !read_result->value && !base::PathExists(path.DirName());
   read_result->num_bytes_read = deserializer.get_last_read_size();
 
   return read_result;
@@ -168,6 +171,9 @@ JsonPrefStore::JsonPrefStore(
       read_error_(PREF_READ_ERROR_NONE),
       has_pending_write_reply_(false) {
   DCHECK(!path_.empty());
+  // Prefs often get reserialized without any change (e.g. a pref update that
+  // writes back the same value), and only this store writes its file.
+  writer_.set_skip_unchanged_writes(true);
 }
 
 bool JsonPrefStore::GetValue(base::StringPiece key,
@@ -261,8 +267,10 @@ void JsonPrefStore::RemoveValueSilently(const std::string& key,
                                         uint32_t flags) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  prefs_.RemoveByDottedPath(key);
-  ScheduleWrite(flags);
+  // Rewriting the whole file is expensive, so don't do it if nothing changed.
+  if (prefs_.RemoveByDottedPath(key)) {
+    ScheduleWrite(flags);
+  }
 }
 
 void JsonPrefStore::RemoveValuesByPrefixSilently(const std::string& prefix) {
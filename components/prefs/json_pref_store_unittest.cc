@@ -646,6 +646,26 @@ TEST_P(JsonPrefStoreLossyWriteTest, LossyWriteBasic) {
             GetTestFileContents());
 }
 
+TEST_P(JsonPrefStoreLossyWriteTest, RemoveMissingValueSilently) {
+  scoped_refptr<JsonPrefStore> pref_store = CreatePrefStore();
+  ImportantFileWriter* file_writer = GetImportantFileWriter(pref_store.get());
+
+  // Removing a pref that isn't set doesn't rewrite the file.
+  pref_store->RemoveValueSilently("missing",
+                                  WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+  ASSERT_FALSE(file_writer->HasPendingWrite());
+  pref_store->RemoveValuesByPrefixSilently("missing");
+  ASSERT_FALSE(file_writer->HasPendingWrite());
+
+  pref_store->SetValueSilently("normal", base::Value("normal"),
+                               WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+  file_writer->DoScheduledWrite();
+  ASSERT_FALSE(file_writer->HasPendingWrite());
+  pref_store->RemoveValueSilently("normal",
+                                  WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+  ASSERT_TRUE(file_writer->HasPendingWrite());
+}
+
 TEST_P(JsonPrefStoreLossyWriteTest, LossyWriteMixedLossyFirst) {
   scoped_refptr<JsonPrefStore> pref_store = CreatePrefStore();
   ImportantFileWriter* file_writer = GetImportantFileWriter(pref_store.get());
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <memory>
 #include <ostream>
+#include <utility>
 
 #include "base/check.h"
 #include "base/compiler_specific.h"
@@ -94,11 +95,19 @@ class QueryNodeWord : public QueryNode {
   std::u16string word_;
   bool literal_;
   const MatchingAlgorithm matching_algorithm_;
+  // Whether |word_| is long enough for prefix search. Computed once since
+  // Matches() is called for every word of every candidate title and URL.
+  const bool long_enough_for_prefix_search_;
 };
 
 QueryNodeWord::QueryNodeWord(const std::u16string& word,
                              MatchingAlgorithm matching_algorithm)
-    : word_(word), literal_(false), matching_algorithm_(matching_algorithm) {}
+    : word_(word),
+      literal_(false),
+      matching_algorithm_(matching_algorithm),
+      long_enough_for_prefix_search_(
+          QueryParser::IsWordLongEnoughForPrefixSearch(word_,
+                                                       matching_algorithm_)) {}
 
 QueryNodeWord::~QueryNodeWord() {}
 
@@ -106,8 +115,7 @@ int QueryNodeWord::AppendToSQLiteQuery(std::u16string* query) const {
   query->append(word_);
 
   // Use prefix search if we're not literal and long enough.
-  if (!literal_ &&
-      QueryParser::IsWordLongEnoughForPrefixSearch(word_, matching_algorithm_))
+  if (!literal_ && long_enough_for_prefix_search_)
     *query += L'*';
   return 1;
 }
@@ -117,8 +125,7 @@ bool QueryNodeWord::IsWord() const {
 }
 
 bool QueryNodeWord::Matches(const std::u16string& word, bool exact) const {
-  if (exact ||
-      !QueryParser::IsWordLongEnoughForPrefixSearch(word_, matching_algorithm_))
+  if (exact || !long_enough_for_prefix_search_)
     return word == word_;
   return word.size() >= word_.size() &&
          (word_.compare(0, word_.size(), word, 0, word_.size()) == 0);
@@ -476,9 +483,9 @@ void QueryParser::ExtractQueryWords(const std::u16string& text,
       std::u16string word = iter.GetString();
       if (!word.empty()) {
         words->push_back(QueryWord());
-        words->back().word = word;
+        words->back().word = std::move(word);
         words->back().position = iter.prev();
-     }
+      }
     }
   }
 }
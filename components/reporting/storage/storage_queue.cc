@@ -636,33 +636,25 @@ Status StorageQueue::WriteHeaderAndBlock(
   }
   active_write_reservation_size_ -= total_size;
 
-  auto write_status = file->Append(header.SerializeToString());
+  // Assemble header, data and padding into one block, so that it is written
+  // with a single append instead of one per part.
+  std::string block;
+  block.reserve(total_size);
+  block.append(header.SerializeToString());
+  block.append(data);
+  if (total_size > block.size()) {
+    // Fill in with random bytes.
+    const size_t pad_size = total_size - block.size();
+    char junk_bytes[FRAME_SIZE];
+    crypto::RandBytes(junk_bytes, pad_size);
+    block.append(&junk_bytes[0], pad_size);
+  }
+  auto write_status = file->Append(block);
   if (!write_status.has_value()) {
     return Status(error::RESOURCE_EXHAUSTED,
                   base::StrCat({"Cannot write file=", file->name(),
                                 " status=", write_status.error().ToString()}));
   }
-  if (data.size() > 0) {
-    write_status = file->Append(data);
-    if (!write_status.has_value()) {
-      return Status(
-          error::RESOURCE_EXHAUSTED,
-          base::StrCat({"Cannot write file=", file->name(),
-                        " status=", write_status.error().ToString()}));
-    }
-  }
-  if (total_size > RecordHeader::kSize + data.size()) {
-    // Fill in with random bytes.
-    const size_t pad_size = total_size - (RecordHeader::kSize + data.size());
-    char junk_bytes[FRAME_SIZE];
-    crypto::RandBytes(junk_bytes, pad_size);
-    write_status = file->Append(std::string_view(&junk_bytes[0], pad_size));
-    if (!write_status.has_value()) {
-      return Status(error::RESOURCE_EXHAUSTED,
-                    base::StrCat({"Cannot pad file=", file->name(), " status=",
-                                  write_status.error().ToString()}));
-    }
-  }
   return Status::StatusOK();
 }
 
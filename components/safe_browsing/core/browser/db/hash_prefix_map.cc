@@ -53,9 +53,14 @@ size_t GetOffsetIndex(HashPrefixesView prefix, size_t size) {
 }
 
 // Gets the size of the offset map based on the experiment configuration.
+// By default there is an offset for every 256 bytes of prefixes, so that after
+// the in-memory offset lookup the binary search only touches a few adjacent
+// cache lines of the mapped file, instead of probing (and possibly faulting
+// in) pages across the whole file. The largest stores get the maximum of
+// 65535 offsets, about 256KB.
 size_t GetOffsetMapSize(size_t file_size) {
   static const base::FeatureParam<int> kBytesPerOffsetParam{
-      &kMmapSafeBrowsingDatabase, "store-bytes-per-offset", 0};
+      &kMmapSafeBrowsingDatabase, "store-bytes-per-offset", 256};
   size_t bytes_per_offset = kBytesPerOffsetParam.Get();
   if (!bytes_per_offset)
     return 0;
@@ -404,6 +404,30 @@ TEST_F(HashPrefixMapTest, MigratesFileOffsets) {
   EXPECT_THAT(new_hash_file.offsets(), ElementsAre(0, 4, 8, 12));
 }
 
+TEST_F(HashPrefixMapTest, UsesOffsetMapByDefault) {
+  MmapHashPrefixMap map(GetBasePath());
+  map.Reserve(4, 1024);
+  std::vector<std::string> hashes;
+  for (int i = 0; i < 256; i++) {
+    hashes.push_back(StringWithLeadingBytes(i));
+    map.Append(4, hashes.back());
+  }
+
+  V4StoreFileFormat file_format;
+  EXPECT_TRUE(map.WriteToDisk(&file_format));
+  EXPECT_EQ(map.IsValid(), APPLY_UPDATE_SUCCESS);
+
+  EXPECT_EQ(file_format.hash_files().size(), 1);
+  const auto& hash_file = file_format.hash_files(0);
+  EXPECT_THAT(hash_file.offsets(), ElementsAre(0, 64, 128, 192));
+
+  for (const auto& hash : hashes) {
+    EXPECT_EQ(map.GetMatchingHashPrefix(hash), hash);
+    EXPECT_EQ(map.GetMatchingHashPrefix(StringWithLeadingBytes(hash[0], 1u)),
+              "");
+  }
+}
+
 TEST_F(HashPrefixMapTest, NoOffsetMap) {
   base::test::ScopedFeatureList feature_list;
   feature_list.InitAndEnableFeatureWithParameters(
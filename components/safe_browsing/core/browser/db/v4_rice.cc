@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <algorithm>
+#include <bit>
 #include <vector>
 
 #include "base/check_op.h"
@@ -182,14 +183,32 @@ V4DecodeResult V4RiceDecoder::GetNextValue(uint32_t* value) {
 
   V4DecodeResult result;
   uint32_t q = 0;
-  uint32_t bit;
-  do {
-    result = GetNextBits(1, &bit);
-    if (result != DECODE_SUCCESS) {
-      return result;
+  // The quotient is unary coded: a run of 1 bits terminated by a 0 bit. Count
+  // the run a word at a time instead of reading it bit by bit.
+  while (true) {
+    if (current_word_bit_index_ == kMaxBitIndex) {
+      result = GetNextWord(&current_word_);
+      if (result != DECODE_SUCCESS) {
+        return result;
+      }
+    }
+
+    // The bits of |current_word_| above the unread ones are 0, so the run
+    // can't extend past them.
+    unsigned int num_bits_left_in_current_word =
+        kMaxBitIndex - current_word_bit_index_;
+    unsigned int num_ones = std::countr_one(current_word_);
+    bool found_terminator = num_ones < num_bits_left_in_current_word;
+    unsigned int num_consumed_bits = found_terminator ? num_ones + 1 : num_ones;
+    q += num_ones;
+    current_word_bit_index_ += num_consumed_bits;
+    current_word_ = num_consumed_bits < kMaxBitIndex
+                        ? current_word_ >> num_consumed_bits
+                        : 0;
+    if (found_terminator) {
+      break;
     }
-    q += bit;
-  } while (bit);
+  }
   uint32_t r = 0;
   result = GetNextBits(rice_parameter_, &r);
   if (result != DECODE_SUCCESS) {
@@ -153,6 +153,17 @@ TEST_F(V4RiceTest, TestDecoderGetNextValueWithInterestingValues) {
   }
 }
 
+TEST_F(V4RiceTest, TestDecoderGetNextValueWithLongQuotient) {
+  // A quotient of 40, which spans two words, followed by a remainder of 1.
+  VerifyRiceDecoding(
+      RiceDecodingTestInfo(2, {161}, "\xff\xff\xff\xff\xff\x02"));
+
+  // A quotient that doesn't end before the data does.
+  uint32_t word;
+  V4RiceDecoder decoder(2, 1, "\xff\xff\xff\xff");
+  EXPECT_EQ(DECODE_RAN_OUT_OF_BITS_FAILURE, decoder.GetNextValue(&word));
+}
+
 #if defined(NDEBUG) && !defined(DCHECK_ALWAYS_ON)
 // This test hits a NOTREACHED so it is a release mode only test.
 TEST_F(V4RiceTest, TestDecoderIntegersWithNoData) {
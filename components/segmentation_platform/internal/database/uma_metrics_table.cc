@@ -56,6 +56,14 @@ bool UmaMetricsTable::InitTable() {
                     "uma_metrics(metric_hash)")) {
     return false;
   }
+  // Covers AggregateMetric(): seeks to a single metric of a profile and walks
+  // its samples in time order without touching the table.
+  if (!db_->Execute(
+          "CREATE INDEX IF NOT EXISTS uma_metric_window_index ON "
+          "uma_metrics(metric_hash,type,profile_id,event_timestamp,"
+          "metric_value)")) {
+    return false;
+  }
 
   return true;
 }
@@ -84,6 +92,62 @@ bool UmaMetricsTable::AddUmaMetric(const std::string& profile_id,
   return statement.Run();
 }
 
+std::optional<int64_t> UmaMetricsTable::AggregateMetric(
+    const std::string& profile_id,
+    proto::SignalType type,
+    uint64_t name_hash,
+    base::Time start_time,
+    base::Time end_time,
+    Aggregation aggregation) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  static constexpr char kCountQuery[] =
+      // clang-format off
+      "SELECT COUNT(*) FROM uma_metrics "
+          "WHERE metric_hash=? AND type=? AND profile_id=? "
+          "AND event_timestamp BETWEEN ? AND ?";
+  // clang-format on
+  static constexpr char kSumQuery[] =
+      // clang-format off
+      "SELECT COALESCE(SUM(metric_value),0) FROM uma_metrics "
+          "WHERE metric_hash=? AND type=? AND profile_id=? "
+          "AND event_timestamp BETWEEN ? AND ?";
+  // clang-format on
+  static constexpr char kLatestQuery[] =
+      // clang-format off
+      "SELECT metric_value FROM uma_metrics "
+          "WHERE metric_hash=? AND type=? AND profile_id=? "
+          "AND event_timestamp BETWEEN ? AND ? "
+          "ORDER BY event_timestamp DESC,id DESC LIMIT 1";
+  // clang-format on
+
+  sql::Statement statement;
+  switch (aggregation) {
+    case Aggregation::kCount:
+      statement.Assign(db_->GetCachedStatement(SQL_FROM_HERE, kCountQuery));
+      break;
+    case Aggregation::kSum:
+      statement.Assign(db_->GetCachedStatement(SQL_FROM_HERE, kSumQuery));
+      break;
+    case Aggregation::kLatest:
+      statement.Assign(db_->GetCachedStatement(SQL_FROM_HERE, kLatestQuery));
+      break;
+  }
+  statement.BindString(0, base::StringPrintf("%" PRIX64, name_hash));
+  statement.BindInt64(1, type);
+  statement.BindString(2, profile_id);
+  statement.BindTime(3, start_time);
+  statement.BindTime(4, end_time);
+
+  if (statement.Step()) {
+    return statement.ColumnInt64(0);
+  }
+  if (!statement.Succeeded()) {
+    return std::nullopt;
+  }
+  // Only reached for kLatest when there are no samples in the window.
+  return 0;
+}
+
 bool UmaMetricsTable::DeleteEventsBeforeTimestamp(base::Time time) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   static constexpr char kDeleteoldEntries[] =
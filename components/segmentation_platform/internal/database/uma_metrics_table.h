@@ -5,6 +5,8 @@
 #ifndef COMPONENTS_SEGMENTATION_PLATFORM_INTERNAL_DATABASE_UMA_METRICS_TABLE_H_
 #define COMPONENTS_SEGMENTATION_PLATFORM_INTERNAL_DATABASE_UMA_METRICS_TABLE_H_
 
+#include <cstdint>
+#include <optional>
 #include <string>
 
 #include "base/sequence_checker.h"
@@ -19,6 +21,16 @@ class UmaMetricsTable {
  public:
   static constexpr char kTableName[] = "uma_metrics";
 
+  // Aggregations over `metric_value` that can be computed in the database.
+  enum class Aggregation {
+    // Number of samples.
+    kCount,
+    // Sum of the sample values.
+    kSum,
+    // Value of the most recent sample.
+    kLatest,
+  };
+
   explicit UmaMetricsTable(sql::Database* db);
   ~UmaMetricsTable();
 
@@ -31,6 +43,18 @@ class UmaMetricsTable {
   // Adds the given row to the metrics table.
   bool AddUmaMetric(const std::string& profile_id, const UmaMetricEntry& row);
 
+  // Aggregates the samples of the metric identified by `type` and `name_hash`
+  // that were recorded for `profile_id` in [`start_time`, `end_time`]. The
+  // samples are read from a covering index, so only the matching window is
+  // visited and no table rows are loaded. Returns 0 when there are no samples,
+  // and nullopt on database errors.
+  std::optional<int64_t> AggregateMetric(const std::string& profile_id,
+                                         proto::SignalType type,
+                                         uint64_t name_hash,
+                                         base::Time start_time,
+                                         base::Time end_time,
+                                         Aggregation aggregation);
+
   // Delete all metrics older than the provided `time`;
   bool DeleteEventsBeforeTimestamp(base::Time time);
 
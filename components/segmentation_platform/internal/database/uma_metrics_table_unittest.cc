@@ -66,6 +66,7 @@ TEST_F(UmaMetricsTableTest, CreateTable) {
   EXPECT_TRUE(db().DoesIndexExist("uma_type_index"));
   EXPECT_TRUE(db().DoesIndexExist("uma_profile_id_index"));
   EXPECT_TRUE(db().DoesIndexExist("uma_metric_hash_index"));
+  EXPECT_TRUE(db().DoesIndexExist("uma_metric_window_index"));
 
   // Creating table again should be noop.
   ASSERT_TRUE(metrics_table().InitTable());
@@ -223,4 +224,69 @@ TEST_F(UmaMetricsTableTest, MatchHashesTest) {
   test_util::ExpectUmaRowIsEqual(row4, result4[1]);
 }
 
+TEST_F(UmaMetricsTableTest, AggregateMetric) {
+  using Aggregation = UmaMetricsTable::Aggregation;
+  const base::Time kTimestamp1 = base::Time::Now();
+  const base::Time kTimestamp2 = kTimestamp1 + base::Seconds(1);
+  const base::Time kTimestamp3 = kTimestamp1 + base::Seconds(2);
+  const uint64_t kHash = 0x9CEA8CBC362AB242;
+  const auto kType = proto::SignalType::HISTOGRAM_VALUE;
+  ASSERT_TRUE(metrics_table().InitTable());
+
+  // No samples.
+  EXPECT_EQ(0, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp3,
+                                               Aggregation::kCount));
+  EXPECT_EQ(0, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp3,
+                                               Aggregation::kSum));
+  EXPECT_EQ(0, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp3,
+                                               Aggregation::kLatest));
+
+  UmaMetricEntry row1 = GetSampleMetricsRow();
+  row1.name_hash = kHash;
+  row1.time = kTimestamp1;
+  row1.value = 1;
+  EXPECT_TRUE(metrics_table().AddUmaMetric(kProfileId, row1));
+  UmaMetricEntry row2 = row1;
+  row2.time = kTimestamp3;
+  row2.value = 4;
+  EXPECT_TRUE(metrics_table().AddUmaMetric(kProfileId, row2));
+  UmaMetricEntry row3 = row1;
+  row3.time = kTimestamp2;
+  row3.value = 2;
+  EXPECT_TRUE(metrics_table().AddUmaMetric(kProfileId, row3));
+
+  // Samples from other profiles, types and metrics are not included.
+  EXPECT_TRUE(metrics_table().AddUmaMetric(kProfileIdOther, row1));
+  UmaMetricEntry other_type = row1;
+  other_type.type = proto::SignalType::HISTOGRAM_ENUM;
+  EXPECT_TRUE(metrics_table().AddUmaMetric(kProfileId, other_type));
+  UmaMetricEntry other_hash = row1;
+  other_hash.name_hash = 1;
+  EXPECT_TRUE(metrics_table().AddUmaMetric(kProfileId, other_hash));
+
+  EXPECT_EQ(3, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp3,
+                                               Aggregation::kCount));
+  EXPECT_EQ(7, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp3,
+                                               Aggregation::kSum));
+  EXPECT_EQ(4, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp3,
+                                               Aggregation::kLatest));
+
+  // The window bounds are inclusive.
+  EXPECT_EQ(2, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp2,
+                                               Aggregation::kCount));
+  EXPECT_EQ(3, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp2,
+                                               Aggregation::kSum));
+  EXPECT_EQ(2, metrics_table().AggregateMetric(kProfileId, kType, kHash,
+                                               kTimestamp1, kTimestamp2,
+                                               Aggregation::kLatest));
+}
+
 }  // namespace segmentation_platform
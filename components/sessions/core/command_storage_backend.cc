@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include <algorithm>
 #include <limits>
+#include <string>
 #include <utility>
 
 #include "base/feature_list.h"
@@ -16,12 +17,14 @@
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/time/default_clock.h"
+#include "base/timer/elapsed_timer.h"
 #include "build/build_config.h"
 #include "components/sessions/core/session_constants.h"
 #include "components/sessions/core/session_service_commands.h"
@@ -600,8 +603,17 @@ CommandStorageBackend::ReadLastSessionCommands() {
     VLOG(1) << "CommandStorageBackend::ReadLastSessionCommands, reading "
                "commands from: "
             << last_session_info_->path;
-    return ReadCommandsFromFile(last_session_info_->path,
-                                initial_decryption_key_);
+    const base::ElapsedTimer timer;
+    ReadCommandsResult result = ReadCommandsFromFile(last_session_info_->path,
+                                                     initial_decryption_key_);
+    base::UmaHistogramTimes("Session.CommandStorage.ReadLastSessionTime",
+                            timer.Elapsed());
+    int64_t file_size = 0;
+    if (base::GetFileSize(last_session_info_->path, &file_size)) {
+      base::UmaHistogramMemoryKB("Session.CommandStorage.LastSessionFileSize",
+                                 static_cast<int>(file_size / 1024));
+    }
+    return result;
   }
   return {};
 }
@@ -653,15 +665,23 @@ bool CommandStorageBackend::AppendCommandsToFile(
     return false;
   }
 
+  std::string buffer;
   for (auto& command : commands) {
     if (IsEncrypted()) {
-      if (!AppendEncryptedCommandToFile(file, *(command.get())))
+      if (!SerializeEncryptedCommand(*command, &buffer)) {
         return false;
-    } else if (!AppendCommandToFile(file, *(command.get()))) {
-      return false;
+      }
+    } else {
+      SerializeCommand(*command, &buffer);
     }
     commands_written_++;
   }
+  if (!buffer.empty() &&
+      file->WriteAtCurrentPos(buffer.data(), buffer.size()) !=
+          static_cast<int>(buffer.size())) {
+    DVLOG(1) << "error writing";
+    return false;
+  }
   if (base::FeatureList::IsEnabled(kFlushAfterAppending)) {
     file->Flush();
   }
@@ -766,37 +786,25 @@ std::unique_ptr<base::File> CommandStorageBackend::OpenAndWriteHeader(
   return file;
 }
 
-bool CommandStorageBackend::AppendCommandToFile(
-    base::File* file,
-    const sessions::SessionCommand& command) {
+void CommandStorageBackend::SerializeCommand(
+    const sessions::SessionCommand& command,
+    std::string* buffer) {
   const size_type total_size = command.GetSerializedSize();
-  if (file->WriteAtCurrentPos(reinterpret_cast<const char*>(&total_size),
-                              sizeof(total_size)) != sizeof(total_size)) {
-    DVLOG(1) << "error writing";
-    return false;
-  }
-  id_type command_id = command.id();
-  if (file->WriteAtCurrentPos(reinterpret_cast<char*>(&command_id),
-                              sizeof(command_id)) != sizeof(command_id)) {
-    DVLOG(1) << "error writing";
-    return false;
-  }
-
+  buffer->append(reinterpret_cast<const char*>(&total_size),
+                 sizeof(total_size));
+  const id_type command_id = command.id();
+  buffer->append(reinterpret_cast<const char*>(&command_id),
+                 sizeof(command_id));
   const size_type content_size = total_size - sizeof(id_type);
   if (content_size == 0)
-    return true;
-
-  if (file->WriteAtCurrentPos(reinterpret_cast<const char*>(command.contents()),
-                              content_size) != content_size) {
-    DVLOG(1) << "error writing";
-    return false;
-  }
-  return true;
+    return;
+  buffer->append(reinterpret_cast<const char*>(command.contents()),
+                 content_size);
 }
 
-bool CommandStorageBackend::AppendEncryptedCommandToFile(
-    base::File* file,
-    const sessions::SessionCommand& command) {
+bool CommandStorageBackend::SerializeEncryptedCommand(
+    const sessions::SessionCommand& command,
+    std::string* buffer) {
   // This means the nonce overflowed and we're reusing a nonce. This class
   // should never write enough commands to trigger this, so assume we should
   // stop.
@@ -828,18 +836,9 @@ bool CommandStorageBackend::AppendEncryptedCommandToFile(
   const size_type command_and_id_size =
       static_cast<size_type>(cipher_text.size());
 
-  int wrote = file->WriteAtCurrentPos(
-      reinterpret_cast<const char*>(&command_and_id_size),
-      sizeof(command_and_id_size));
-  if (wrote != sizeof(command_and_id_size)) {
-    DVLOG(1) << "error writing";
-    return false;
-  }
-  wrote = file->WriteAtCurrentPos(cipher_text.c_str(), cipher_text.size());
-  if (wrote != static_cast<int>(cipher_text.size())) {
-    DVLOG(1) << "error writing";
-    return false;
-  }
+  buffer->append(reinterpret_cast<const char*>(&command_and_id_size),
+                 sizeof(command_and_id_size));
+  buffer->append(cipher_text);
   return true;
 }
 
@@ -10,6 +10,7 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "base/files/file_path.h"
@@ -203,20 +204,21 @@ class SESSIONS_EXPORT CommandStorageBackend
   std::unique_ptr<base::File> OpenAndWriteHeader(
       const base::FilePath& path) const;
 
-  // Appends the specified commands to the specified file.
+  // Appends the specified commands to the specified file. The commands are
+  // serialized into a single buffer, which is written with one call.
   bool AppendCommandsToFile(
       base::File* file,
       const std::vector<std::unique_ptr<sessions::SessionCommand>>& commands);
 
-  // Writes |command| to |file|. Returns true on success.
-  bool AppendCommandToFile(base::File* file,
-                           const sessions::SessionCommand& command);
+  // Appends the serialized form of |command| to |buffer|.
+  void SerializeCommand(const sessions::SessionCommand& command,
+                        std::string* buffer);
 
-  // Encrypts |command| and writes it to |file|. Returns true on success.
+  // Encrypts |command| and appends it to |buffer|. Returns true on success.
   // The contents of the command and id are encrypted together. This is
   // preceded by the length of the command.
-  bool AppendEncryptedCommandToFile(base::File* file,
-                                    const sessions::SessionCommand& command);
+  bool SerializeEncryptedCommand(const sessions::SessionCommand& command,
+                                 std::string* buffer);
 
   // Returns true if commands are encrypted.
   bool IsEncrypted() const { return !crypto_key_.empty(); }
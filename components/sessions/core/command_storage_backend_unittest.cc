@@ -18,6 +18,7 @@
 #include "base/run_loop.h"
 #include "base/strings/string_util.h"
 #include "base/test/bind.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/simple_test_clock.h"
 #include "base/test/task_environment.h"
 #include "base/time/time.h"
@@ -196,6 +197,24 @@ TEST_F(CommandStorageBackendTest, SimpleReadWriteEncrypted) {
   EXPECT_TRUE(commands.empty());
 }
 
+TEST_F(CommandStorageBackendTest, ReadLastSessionRecordsMetrics) {
+  scoped_refptr<CommandStorageBackend> backend = CreateBackend();
+  struct TestData data = {1, "a"};
+  SessionCommands commands;
+  commands.push_back(CreateCommandFromData(data));
+  backend->AppendCommands(std::move(commands), true, base::DoNothing());
+
+  base::HistogramTester histogram_tester;
+  backend = nullptr;
+  backend = CreateBackend();
+  commands = backend->ReadLastSessionCommands().commands;
+  ASSERT_EQ(1U, commands.size());
+  histogram_tester.ExpectTotalCount(
+      "Session.CommandStorage.ReadLastSessionTime", 1);
+  histogram_tester.ExpectTotalCount(
+      "Session.CommandStorage.LastSessionFileSize", 1);
+}
+
 TEST_F(CommandStorageBackendTest, RandomDataEncrypted) {
   struct TestData data[] = {
       {1, "a"},
@@ -6,6 +6,8 @@
 
 #include <stddef.h>
 
+#include <algorithm>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -115,6 +117,25 @@ enum TypeMask {
 
 void SerializedNavigationEntry::WriteToPickle(int max_size,
                                               base::Pickle* pickle) const {
+  const std::string encoded_page_state =
+      SerializedNavigationDriver::Get()->GetSanitizedPageStateForPickle(this);
+
+  // Reserve room for the variable-length fields up front; the page state in
+  // particular can be large, and growing the pickle field by field would
+  // reallocate and copy it several times.
+  size_t estimated_size = virtual_url_.spec().size() +
+                          title_.size() * sizeof(char16_t) +
+                          encoded_page_state.size() +
+                          referrer_url_.spec().size() +
+                          original_request_url_.spec().size();
+  for (const auto& entry : extended_info_map_) {
+    estimated_size += entry.first.size() + entry.second.size();
+  }
+  constexpr size_t kFixedFieldsAndStringOverheadSize = 128;
+  pickle->Reserve(std::min(estimated_size, static_cast<size_t>(max_size)) +
+                  kFixedFieldsAndStringOverheadSize +
+                  8 * extended_info_map_.size());
+
   pickle->WriteInt(index_);
 
   int bytes_written = 0;
@@ -124,8 +145,6 @@ void SerializedNavigationEntry::WriteToPickle(int max_size,
 
   WriteString16ToPickle(pickle, &bytes_written, max_size, title_);
 
-  const std::string encoded_page_state =
-      SerializedNavigationDriver::Get()->GetSanitizedPageStateForPickle(this);
   WriteStringToPickle(pickle, &bytes_written, max_size, encoded_page_state);
 
   pickle->WriteInt(transition_type_);
@@ -172,10 +191,12 @@ void SerializedNavigationEntry::WriteToPickle(int max_size,
 
 bool SerializedNavigationEntry::ReadFromPickle(base::PickleIterator* iterator) {
   *this = SerializedNavigationEntry();
-  std::string virtual_url_spec;
+  // URL specs are read as views into the pickle, since GURL makes its own
+  // canonicalized copy anyway.
+  std::string_view virtual_url_spec;
   int transition_type_int = 0;
   if (!iterator->ReadInt(&index_) ||
-      !iterator->ReadString(&virtual_url_spec) ||
+      !iterator->ReadStringPiece(&virtual_url_spec) ||
       !iterator->ReadString16(&title_) ||
       !iterator->ReadString(&encoded_page_state_) ||
       !iterator->ReadInt(&transition_type_int))
@@ -197,9 +218,9 @@ bool SerializedNavigationEntry::ReadFromPickle(base::PickleIterator* iterator) {
     has_post_data_ = type_mask & HAS_POST_DATA;
     // the "referrer" property was added after type_mask to the written
     // stream. As such, we don't fail if it can't be read.
-    std::string referrer_spec;
-    if (!iterator->ReadString(&referrer_spec))
-      referrer_spec = std::string();
+    std::string_view referrer_spec;
+    if (!iterator->ReadStringPiece(&referrer_spec))
+      referrer_spec = std::string_view();
     referrer_url_ = GURL(referrer_spec);
 
     // Note: due to crbug.com/450589 the initial referrer policy is incorrect,
@@ -209,9 +230,9 @@ bool SerializedNavigationEntry::ReadFromPickle(base::PickleIterator* iterator) {
     std::ignore = iterator->ReadInt(&ignored_referrer_policy);
 
     // If the original URL can't be found, leave it empty.
-    std::string original_request_url_spec;
-    if (!iterator->ReadString(&original_request_url_spec))
-      original_request_url_spec = std::string();
+    std::string_view original_request_url_spec;
+    if (!iterator->ReadStringPiece(&original_request_url_spec))
+      original_request_url_spec = std::string_view();
     original_request_url_ = GURL(original_request_url_spec);
 
     // Default to not overriding the user agent if we don't have info.
@@ -30,6 +30,9 @@ namespace {
   // 24 is the observed limits for OSX system checker.
   const size_t kMaxSuggestLen = 24;
 
+  // Maximum number of words whose spelling result is remembered.
+  const size_t kCheckedWordsCacheSize = 1000;
+
   static_assert(kMaxCheckedLen <= size_t(MAXWORDLEN),
                 "MaxCheckedLen too long");
   static_assert(kMaxSuggestLen <= kMaxCheckedLen,
@@ -38,7 +41,8 @@ namespace {
 
 HunspellEngine::HunspellEngine(
     service_manager::LocalInterfaceProvider* embedder_provider)
-    : hunspell_enabled_(false),
+    : checked_words_(kCheckedWordsCacheSize),
+      hunspell_enabled_(false),
       initialized_(false),
       dictionary_requested_(false),
       embedder_provider_(embedder_provider) {
@@ -52,6 +56,7 @@ void HunspellEngine::Init(base::File file) {
   initialized_ = true;
   hunspell_.reset();
   bdict_file_.reset();
+  checked_words_.Clear();
   file_ = std::move(file);
   hunspell_enabled_ = file_.IsValid();
   // Delay the actual initialization of hunspell until it is needed.
@@ -76,16 +81,23 @@ bool HunspellEngine::CheckSpelling(const std::u16string& word_to_check,
   // offer suggestions on them, either, there's no point in flagging them to
   // the user.
   bool word_correct = true;
+
+  // If |hunspell_| is NULL here, an error has occurred, but it's better
+  // to check rather than crash.
+  if (!hunspell_)
+    return word_correct;
+
+  auto it = checked_words_.Get(word_to_check);
+  if (it != checked_words_.end())
+    return it->second;
+
   std::string word_to_check_utf8(base::UTF16ToUTF8(word_to_check));
 
   // Limit the size of checked words.
   if (word_to_check_utf8.length() <= kMaxCheckedLen) {
-    // If |hunspell_| is NULL here, an error has occurred, but it's better
-    // to check rather than crash.
-    if (hunspell_) {
-      // |hunspell_->spell| returns 0 if the word is misspelled.
-      word_correct = (hunspell_->spell(word_to_check_utf8) != 0);
-    }
+    // |hunspell_->spell| returns 0 if the word is misspelled.
+    word_correct = (hunspell_->spell(word_to_check_utf8) != 0);
+    checked_words_.Put(word_to_check, word_correct);
   }
 
   return word_correct;
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/strings/utf_string_conversions.h"
 #include "components/spellcheck/common/spellcheck_common.h"
@@ -48,6 +49,11 @@ class HunspellEngine : public SpellingEngine {
   // The hunspell dictionary in use.
   std::unique_ptr<Hunspell> hunspell_;
 
+  // Results of recent |hunspell_| lookups. Editing re-checks the words around
+  // the caret over and over, and a hunspell lookup is much more expensive than
+  // a hash lookup. Cleared whenever the dictionary changes.
+  base::HashingLRUCache<std::u16string, bool> checked_words_;
+
   base::File file_;
 
   // This flag is true if hunspell is enabled.
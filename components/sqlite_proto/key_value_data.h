@@ -239,17 +239,17 @@ void KeyValueData<T, Compare>::FlushDataToDisk() {
   if (deferred_updates_.empty())
     return;
 
+  // Write all the deferred operations in a single transaction, rather than
+  // committing one transaction per key.
+  std::vector<std::pair<std::string, T>> entries_to_update;
   std::vector<std::string> keys_to_delete;
   for (const auto& entry : deferred_updates_) {
     const std::string& key = entry.first;
     switch (entry.second) {
       case DeferredOperation::kUpdate: {
         auto it = data_cache_->find(key);
-        if (it != data_cache_->end()) {
-          manager_->ScheduleDBTask(
-              FROM_HERE, base::BindOnce(&KeyValueTable<T>::UpdateData,
-                                        backend_table_, key, it->second));
-        }
+        if (it != data_cache_->end())
+          entries_to_update.emplace_back(key, it->second);
         break;
       }
       case DeferredOperation::kDelete:
@@ -257,11 +257,10 @@ void KeyValueData<T, Compare>::FlushDataToDisk() {
     }
   }
 
-  if (!keys_to_delete.empty()) {
-    manager_->ScheduleDBTask(
-        FROM_HERE, base::BindOnce(&KeyValueTable<T>::DeleteData, backend_table_,
-                                  keys_to_delete));
-  }
+  manager_->ScheduleDBTask(
+      FROM_HERE,
+      base::BindOnce(&KeyValueTable<T>::UpdateAndDeleteData, backend_table_,
+                     std::move(entries_to_update), std::move(keys_to_delete)));
 
   deferred_updates_.clear();
 }
@@ -7,10 +7,12 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
 #include "sql/statement.h"
+#include "sql/transaction.h"
 
 namespace google {
 namespace protobuf {
@@ -70,6 +72,12 @@ class KeyValueTable {
   virtual void DeleteData(const std::vector<std::string>& keys,
                           sql::Database* db);
   virtual void DeleteAllData(sql::Database* db);
+  // Writes |entries_to_update| and deletes |keys_to_delete| in a single
+  // transaction, reusing one prepared statement for each kind of operation.
+  virtual void UpdateAndDeleteData(
+      const std::vector<std::pair<std::string, T>>& entries_to_update,
+      const std::vector<std::string>& keys_to_delete,
+      sql::Database* db);
 
   base::WeakPtr<KeyValueTable<T>> AsWeakPtr() {
     return weak_ptr_factory_.GetWeakPtr();
@@ -125,6 +133,31 @@ void KeyValueTable<T>::DeleteAllData(sql::Database* db) {
   deleter.Run();
 }
 
+template <typename T>
+void KeyValueTable<T>::UpdateAndDeleteData(
+    const std::vector<std::pair<std::string, T>>& entries_to_update,
+    const std::vector<std::string>& keys_to_delete,
+    sql::Database* db) {
+  sql::Transaction transaction(db);
+  if (!transaction.Begin())
+    return;
+
+  if (!entries_to_update.empty()) {
+    sql::Statement inserter(db->GetUniqueStatement(
+        ::sqlite_proto::internal::GetReplaceSql(table_name_).c_str()));
+    for (const auto& entry : entries_to_update) {
+      ::sqlite_proto::internal::BindDataToStatement(entry.first, entry.second,
+                                                    &inserter);
+      inserter.Run();
+      inserter.Reset(true);
+    }
+  }
+  if (!keys_to_delete.empty())
+    DeleteData(keys_to_delete, db);
+
+  transaction.Commit();
+}
+
 }  // namespace sqlite_proto
 
 #endif  // COMPONENTS_SQLITE_PROTO_KEY_VALUE_TABLE_H_
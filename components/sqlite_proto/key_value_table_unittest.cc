@@ -128,6 +128,27 @@ TEST_F(KeyValueTableTest, DeleteAll) {
   EXPECT_TRUE(my_data.empty());
 }
 
+TEST_F(KeyValueTableTest, UpdateAndDelete) {
+  TestProto element;
+  element.set_value(1);
+  table_.UpdateData("a", element, &db_);
+  table_.UpdateData("b", element, &db_);
+
+  TestProto superseding_element;
+  superseding_element.set_value(2);
+  TestProto new_element;
+  new_element.set_value(3);
+  table_.UpdateAndDeleteData(
+      {{"a", superseding_element}, {"c", new_element}},
+      std::vector<std::string>{"b"}, &db_);
+
+  std::map<std::string, TestProto> my_data;
+  table_.GetAllData(&my_data, &db_);
+  EXPECT_THAT(my_data,
+              UnorderedElementsAre(Pair("a", EqualsProto(superseding_element)),
+                                   Pair("c", EqualsProto(new_element))));
+}
+
 // Storing an element with a default proto value (zero byte size) should work;
 // this can be useful since a default value can have different semantics from a
 // missing value.
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/check_op.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/trace_event/trace_event.h"
 #include "components/subresource_filter/core/common/first_party_origin.h"
 #include "components/subresource_filter/core/common/memory_mapped_ruleset.h"
@@ -18,13 +19,22 @@
 
 namespace subresource_filter {
 
+namespace {
+
+// Large enough for the subresources a typical document loads repeatedly, while
+// keeping the per-document overhead small.
+constexpr size_t kLoadPolicyCacheSize = 128;
+
+}  // namespace
+
 DocumentSubresourceFilter::DocumentSubresourceFilter(
     url::Origin document_origin,
     mojom::ActivationState activation_state,
     scoped_refptr<const MemoryMappedRuleset> ruleset)
     : activation_state_(activation_state),
       ruleset_(std::move(ruleset)),
-      ruleset_matcher_(ruleset_->data()) {
+      ruleset_matcher_(ruleset_->data()),
+      load_policy_cache_(kLoadPolicyCacheSize) {
   DCHECK_NE(activation_state_.activation_level,
             mojom::ActivationLevel::kDisabled);
   if (!activation_state_.filtering_disabled_for_document) {
@@ -33,7 +43,22 @@ DocumentSubresourceFilter::DocumentSubresourceFilter(
   }
 }
 
-DocumentSubresourceFilter::~DocumentSubresourceFilter() = default;
+DocumentSubresourceFilter::~DocumentSubresourceFilter() {
+  if (load_policy_cache_lookups_) {
+    UMA_HISTOGRAM_PERCENTAGE(
+        "SubresourceFilter.DocumentLoad.LoadPolicyCache.HitRate",
+        100 * load_policy_cache_hits_ / load_policy_cache_lookups_);
+  }
+}
+
+void DocumentSubresourceFilter::set_activation_state(
+    const mojom::ActivationState& state) {
+  if (state.generic_blocking_rules_disabled !=
+      activation_state_.generic_blocking_rules_disabled) {
+    load_policy_cache_.Clear();
+  }
+  activation_state_ = state;
+}
 
 LoadPolicy DocumentSubresourceFilter::GetLoadPolicy(
     const GURL& subresource_url,
@@ -68,9 +93,19 @@ LoadPolicy DocumentSubresourceFilter::GetLoadPolicy(
 
   ++statistics_.num_loads_evaluated;
   DCHECK(document_origin_);
-  LoadPolicy result = ruleset_matcher_.GetLoadPolicyForResourceLoad(
-      subresource_url, *document_origin_, subresource_type,
-      activation_state_.generic_blocking_rules_disabled);
+  LoadPolicy result;
+  ++load_policy_cache_lookups_;
+  LoadPolicyCacheKey key(subresource_url.spec(), subresource_type);
+  auto it = load_policy_cache_.Get(key);
+  if (it != load_policy_cache_.end()) {
+    ++load_policy_cache_hits_;
+    result = it->second;
+  } else {
+    result = ruleset_matcher_.GetLoadPolicyForResourceLoad(
+        subresource_url, *document_origin_, subresource_type,
+        activation_state_.generic_blocking_rules_disabled);
+    load_policy_cache_.Put(std::move(key), result);
+  }
   DCHECK_NE(LoadPolicy::WOULD_DISALLOW, result);
   if (result == LoadPolicy::DISALLOW) {
     ++statistics_.num_loads_matching_rules;
@@ -8,7 +8,10 @@
 #include <stddef.h>
 
 #include <memory>
+#include <string>
+#include <utility>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/ref_counted.h"
 #include "components/subresource_filter/core/common/indexed_ruleset.h"
 #include "components/subresource_filter/core/common/load_policy.h"
@@ -68,11 +71,13 @@ class DocumentSubresourceFilter {
 
   // Called if the DocumentSubresourceFilter needs to change how it filters
   // subresources.
-  void set_activation_state(const mojom::ActivationState& state) {
-    activation_state_ = state;
-  }
+  void set_activation_state(const mojom::ActivationState& state);
 
  private:
+  // Identifies a subresource load by the spec of its URL and its type.
+  using LoadPolicyCacheKey =
+      std::pair<std::string, url_pattern_index::proto::ElementType>;
+
   mojom::ActivationState activation_state_;
   const scoped_refptr<const MemoryMappedRuleset> ruleset_;
   const IndexedRulesetMatcher ruleset_matcher_;
@@ -81,6 +86,15 @@ class DocumentSubresourceFilter {
   std::unique_ptr<FirstPartyOrigin> document_origin_;
 
   mojom::DocumentLoadStatistics statistics_;
+
+  // The results of |ruleset_matcher_| for recently evaluated loads. Documents
+  // often load the same subresource many times (e.g. tracking pixels, sprites),
+  // and the result only depends on the load and on the state above: the
+  // ruleset doesn't change for the lifetime of the filter, and the cache is
+  // cleared when the activation state changes.
+  base::LRUCache<LoadPolicyCacheKey, LoadPolicy> load_policy_cache_;
+  int load_policy_cache_lookups_ = 0;
+  int load_policy_cache_hits_ = 0;
 };
 
 }  // namespace subresource_filter
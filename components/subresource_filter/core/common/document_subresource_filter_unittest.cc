@@ -7,6 +7,7 @@
 #include <string_view>
 
 #include "base/files/file.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "components/subresource_filter/core/common/memory_mapped_ruleset.h"
 #include "components/subresource_filter/core/common/test_ruleset_creator.h"
 #include "components/subresource_filter/core/common/test_ruleset_utils.h"
@@ -154,6 +155,41 @@ TEST_F(DocumentSubresourceFilterTest, Enabled) {
   test_impl(false /* measure_performance */);
 }
 
+TEST_F(DocumentSubresourceFilterTest, RepeatedLoadsUseCachedPolicy) {
+  base::HistogramTester histogram_tester;
+  {
+    mojom::ActivationState activation_state;
+    activation_state.activation_level = kEnabled;
+    DocumentSubresourceFilter filter(url::Origin(), activation_state,
+                                     ruleset());
+
+    // The first load of each URL and type is a miss, the rest are hits.
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ(LoadPolicy::DISALLOW,
+                filter.GetLoadPolicy(GURL(kTestAlphaURL), kImageType));
+      EXPECT_EQ(LoadPolicy::ALLOW,
+                filter.GetLoadPolicy(GURL(kTestBetaURL), kImageType));
+    }
+    EXPECT_EQ(LoadPolicy::DISALLOW,
+              filter.GetLoadPolicy(GURL(kTestAlphaURL), kSubdocumentType));
+
+    // Cached policies still follow the activation level.
+    activation_state.activation_level = kDryRun;
+    filter.set_activation_state(activation_state);
+    EXPECT_EQ(LoadPolicy::WOULD_DISALLOW,
+              filter.GetLoadPolicy(GURL(kTestAlphaURL), kImageType));
+
+    const auto& statistics = filter.statistics();
+    EXPECT_EQ(8, statistics.num_loads_total);
+    EXPECT_EQ(8, statistics.num_loads_evaluated);
+    EXPECT_EQ(5, statistics.num_loads_matching_rules);
+    EXPECT_EQ(4, statistics.num_loads_disallowed);
+  }
+  // 5 hits out of 8 lookups.
+  histogram_tester.ExpectUniqueSample(
+      "SubresourceFilter.DocumentLoad.LoadPolicyCache.HitRate", 62, 1);
+}
+
 TEST_F(DocumentSubresourceFilterTest, MatchingRuleEnabled) {
   mojom::ActivationState activation_state;
   activation_state.activation_level = kEnabled;
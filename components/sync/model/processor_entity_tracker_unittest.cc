@@ -6,6 +6,7 @@
 
 #include <utility>
 
+#include "base/strings/string_number_conversions.h"
 #include "base/test/scoped_feature_list.h"
 #include "components/sync/base/features.h"
 #include "components/sync/model/metadata_batch.h"
@@ -171,6 +172,32 @@ TEST_F(ProcessorEntityTrackerTest, ShouldLoadFromMetadata) {
   EXPECT_THAT(all_entities, UnorderedElementsAre(entity, tombstone_entity));
 }
 
+TEST_F(ProcessorEntityTrackerTest,
+       ShouldLoadFromMetadataWithDifferentKeyAndTagHashOrder) {
+  // Storage keys and client tag hashes are sorted in opposite orders.
+  EntityMetadataMap metadata_map;
+  for (int i = 0; i < 10; ++i) {
+    const std::string storage_key = "key" + base::NumberToString(i);
+    metadata_map.emplace(
+        storage_key,
+        GenerateMetadata(storage_key, ClientTagHash::FromHashed(
+                                          "hash" + base::NumberToString(9 - i))));
+  }
+  ProcessorEntityTracker entity_tracker(GenerateModelTypeState(),
+                                        std::move(metadata_map));
+
+  EXPECT_EQ(10u, entity_tracker.size());
+  EXPECT_TRUE(entity_tracker.AllStorageKeysPopulated());
+  for (int i = 0; i < 10; ++i) {
+    const ProcessorEntity* entity = entity_tracker.GetEntityForStorageKey(
+        "key" + base::NumberToString(i));
+    ASSERT_THAT(entity, NotNull());
+    EXPECT_EQ(entity, entity_tracker.GetEntityForTagHash(
+                          ClientTagHash::FromHashed(
+                              "hash" + base::NumberToString(9 - i))));
+  }
+}
+
 TEST_F(ProcessorEntityTrackerTest, ShouldAddNewLocalEntity) {
   std::unique_ptr<EntityData> entity_data = std::make_unique<EntityData>(
       GenerateEntityData(kStorageKey1, kClientTagHash1));
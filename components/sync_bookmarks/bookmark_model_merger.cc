@@ -1010,13 +1010,15 @@ size_t BookmarkModelMerger::FindMatchingChildBySemanticsStartingAt(
   if (remote_type == sync_pb::BookmarkSpecifics::URL) {
     remote_url = GURL(remote_entity.specifics.bookmark().url());
   }
+  // Check semantics first: most candidates are rejected by the cheap type and
+  // URL comparisons, which avoids hashing every sibling's UUID.
   const auto it = std::find_if(
       children.cbegin() + starting_child_index, children.cend(),
       [this, &remote_canonicalized_title, &remote_url,
        remote_type](const auto& child) {
-        return !FindMatchingRemoteNodeByUuid(child.get()) &&
-               NodeSemanticsMatch(child.get(), remote_canonicalized_title,
-                                  remote_url, remote_type);
+        return NodeSemanticsMatch(child.get(), remote_canonicalized_title,
+                                  remote_url, remote_type) &&
+               !FindMatchingRemoteNodeByUuid(child.get());
       });
   return (it == children.cend()) ? kInvalidIndex : (it - children.cbegin());
 }
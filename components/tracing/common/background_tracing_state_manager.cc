@@ -20,6 +20,7 @@ namespace {
 constexpr char kTracingStateKey[] = "state";
 constexpr char kTracingEnabledScenariosKey[] = "enabled_scenarios";
 constexpr char kTracingPrivacyFilterKey[] = "privacy_filter";
+constexpr char kTracingLastUploadTimeKey[] = "last_upload_time";
 
 BackgroundTracingStateManager* g_background_tracing_state_manager = nullptr;
 
@@ -86,6 +87,12 @@ void BackgroundTracingStateManager::Initialize() {
     privacy_filter_enabled_ = *privacy_filter_enabled;
   }
 
+  std::optional<base::Time> last_upload_time =
+      base::ValueToTime(dict.Find(kTracingLastUploadTimeKey));
+  if (last_upload_time && *last_upload_time <= base::Time::Now()) {
+    last_upload_time_ = *last_upload_time;
+  }
+
   // Save state to update the current session state, replacing the previous
   // session state.
   SaveState();
@@ -106,6 +113,9 @@ void BackgroundTracingStateManager::SaveState() {
     dict.Set(kTracingEnabledScenariosKey, std::move(scenarios));
   }
   dict.Set(kTracingPrivacyFilterKey, privacy_filter_enabled_);
+  if (!last_upload_time_.is_null()) {
+    dict.Set(kTracingLastUploadTimeKey, base::TimeToValue(last_upload_time_));
+  }
 
   local_state_->SetDict(kBackgroundTracingSessionState, std::move(dict));
   local_state_->CommitPendingWrite();
@@ -150,6 +160,20 @@ void BackgroundTracingStateManager::OnTracingStopped() {
   SetState(BackgroundTracingState::FINALIZATION_STARTED);
 }
 
+bool BackgroundTracingStateManager::DidRecentlyUploadTrace() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (last_upload_time_.is_null()) {
+    return false;
+  }
+  return base::Time::Now() - last_upload_time_ < kMinTimeUntilNextUpload;
+}
+
+void BackgroundTracingStateManager::OnTraceUploaded() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  last_upload_time_ = base::Time::Now();
+  SaveState();
+}
+
 void BackgroundTracingStateManager::UpdateEnabledScenarios(
     std::vector<std::string> enabled_scenarios) {
   enabled_scenarios_ = std::move(enabled_scenarios);
@@ -178,6 +202,7 @@ void BackgroundTracingStateManager::SetState(BackgroundTracingState new_state) {
 void BackgroundTracingStateManager::ResetForTesting() {
   state_ = BackgroundTracingState::NOT_ACTIVATED;
   last_session_end_state_ = BackgroundTracingState::NOT_ACTIVATED;
+  last_upload_time_ = base::Time();
   enabled_scenarios_ = {};
   privacy_filter_enabled_ = true;
   Initialize();
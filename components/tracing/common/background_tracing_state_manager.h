@@ -51,6 +51,17 @@ class TRACING_EXPORT BackgroundTracingStateManager {
   void OnTracingStarted();
   void OnTracingStopped();
 
+  // True if a trace was uploaded less than |kMinTimeUntilNextUpload| ago.
+  // Triggered scenarios can fire repeatedly for the same intermittent jank, so
+  // uploads are rate limited across sessions.
+  bool DidRecentlyUploadTrace() const;
+
+  // The embedder should call this method every time a trace is allowed to be
+  // uploaded so that the upload time is saved in prefs.
+  void OnTraceUploaded();
+
+  static constexpr base::TimeDelta kMinTimeUntilNextUpload = base::Days(7);
+
   // Saves user-controlled prefs related to tracing.
   // `enabled_scenario_hashes` is a list of hashes uniquely identifying scenario
   // configs.
@@ -83,6 +94,7 @@ class TRACING_EXPORT BackgroundTracingStateManager {
 
   BackgroundTracingState last_session_end_state_ =
       BackgroundTracingState::NOT_ACTIVATED;
+  base::Time last_upload_time_;
 
   SEQUENCE_CHECKER(sequence_checker_);
 };
@@ -49,8 +49,9 @@ class BackgroundTracingStateManagerTest : public testing::Test {
         pref_service_.get());
   }
 
- private:
-  content::BrowserTaskEnvironment task_environment_;
+ protected:
+  content::BrowserTaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   std::unique_ptr<TestingPrefServiceSimple> pref_service_;
   std::unique_ptr<tracing::BackgroundTracingStateManager> state_manager_;
 };
@@ -149,4 +150,22 @@ TEST_F(BackgroundTracingStateManagerTest, UpdateEnabledScenarios) {
                 .enabled_scenarios());
 }
 
+TEST_F(BackgroundTracingStateManagerTest, DidRecentlyUploadTrace) {
+  auto& state = tracing::BackgroundTracingStateManager::GetInstance();
+  EXPECT_FALSE(state.DidRecentlyUploadTrace());
+
+  state.OnTraceUploaded();
+  EXPECT_TRUE(state.DidRecentlyUploadTrace());
+
+  // The upload time persists across sessions.
+  ResetStateManager();
+  EXPECT_TRUE(tracing::BackgroundTracingStateManager::GetInstance()
+                  .DidRecentlyUploadTrace());
+
+  task_environment_.FastForwardBy(
+      tracing::BackgroundTracingStateManager::kMinTimeUntilNextUpload);
+  EXPECT_FALSE(tracing::BackgroundTracingStateManager::GetInstance()
+                   .DidRecentlyUploadTrace());
+}
+
 }  // namespace tracing
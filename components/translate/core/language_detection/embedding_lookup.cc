@@ -117,6 +117,15 @@ void GetEmbedding(const TfLiteTensor* input,
       input_embedding_size, is_quantized, num_precision_bits);
   int num_embeddings = 0;
   std::vector<float> final_embedding(output_embedding_size, 0.0);
+  // The quantization parameters are the same for every token, so compute them
+  // once.
+  const int compression_factor = is_quantized ? 32 / num_precision_bits : 1;
+  const uint32 mask = is_quantized ? (1L << num_precision_bits) - 1 : 0;
+  const translate::QuantizationParams quant_params =
+      is_quantized
+          ? translate::GetQuantizationParams(min_val, max_val,
+                                             num_precision_bits)
+          : translate::QuantizationParams();
   for (int token_idx = 0; token_idx < num_tokens; token_idx++) {
     const int32 token = tflite::GetTensorData<int32>(input)[token_idx];
     if (token == 0) {
@@ -125,11 +134,6 @@ void GetEmbedding(const TfLiteTensor* input,
     if (is_quantized) {
       // The embedding table contains the packed quantized representation of the
       // embedding table.
-      const int compression_factor = 32 / num_precision_bits;
-      const uint32 mask = (1L << num_precision_bits) - 1;
-      const translate::QuantizationParams quant_params =
-          translate::GetQuantizationParams(min_val, max_val,
-                                           num_precision_bits);
       for (int embed_idx = 0; embed_idx < input_embedding_size; embed_idx++) {
         // Extract the packed embedding at the given index.
         uint32 packed_embedding = tflite::GetTensorData<uint32>(
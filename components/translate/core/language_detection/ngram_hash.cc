@@ -126,8 +126,8 @@ std::vector<int> GetIntVector(TypedVector typed_vec) {
 
 void GetNGramHashIndices(NGramHashParams* params, int32_t* data) {
   const int max_unicode_length = params->GetNumTokens();
-  const auto ngram_lengths = params->GetNGramLengths();
-  const auto vocab_sizes = params->GetVocabSizes();
+  const auto& ngram_lengths = params->GetNGramLengths();
+  const auto& vocab_sizes = params->GetVocabSizes();
   const auto& tokenized_output = params->GetTokenizedOutput();
   const auto seed = params->GetSeed();
   // Compute for each ngram.
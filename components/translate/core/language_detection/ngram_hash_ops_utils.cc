@@ -32,12 +32,11 @@ TokenizedOutput Tokenize(const char* input_str,
   output.tokens.emplace_back(std::make_pair(token_start, strlen(kPrefix)));
   token_start += strlen(kPrefix);
   Rune token;
-  for (size_t i = 0; i < len && output.tokens.size() + 1 < max_tokens;) {
-    if (input_str == nullptr)
-      break;
-    if (strlen(input_str) == 0)
-      break;
-
+  // Check for an empty input once, rather than calling strlen() on the whole
+  // input for every token.
+  const bool has_input = input_str != nullptr && input_str[0] != '\0';
+  for (size_t i = 0;
+       has_input && i < len && output.tokens.size() + 1 < max_tokens;) {
     // Use the standard UTF-8 library to find the next token.
     size_t bytes_read = charntorune(&token, input_str + i, len - i);
     // Stop processing, if we can't read any more tokens, or we have reached
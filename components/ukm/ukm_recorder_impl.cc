@@ -101,6 +101,7 @@ void StoreEntryProto(const mojom::UkmEntry& in, Entry* out) {
 
   out->set_source_id(in.source_id);
   out->set_event_hash(in.event_hash);
+  out->mutable_metrics()->Reserve(in.metrics.size());
   for (const auto& metric : in.metrics) {
     Entry::Metric* proto_metric = out->add_metrics();
     proto_metric->set_metric_hash(metric.first);
@@ -390,19 +391,25 @@ void UkmRecorderImpl::StoreRecordingsInReport(Report* report) {
   DVLOG(DebuggingLogLevel::Rare) << "StoreRecordingsInReport starts";
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  // Set of source ids seen by entries in recordings_.
-  std::set<SourceId> source_ids_seen;
+  // Source ids seen by entries in recordings_. Heavy sessions can have many
+  // thousands of entries referring to few sources, so collect the ids first and
+  // sort/deduplicate them once instead of inserting into a tree per entry.
+  std::vector<SourceId> seen_ids;
+  seen_ids.reserve(recordings_.entries.size() +
+                   recordings_.web_features.size());
+  report->mutable_entries()->Reserve(recordings_.entries.size());
   for (const auto& entry : recordings_.entries) {
     Entry* proto_entry = report->add_entries();
     StoreEntryProto(*entry, proto_entry);
-    source_ids_seen.insert(entry->source_id);
+    seen_ids.push_back(entry->source_id);
   }
 
   for (const auto& [source_id, features_set] : recordings_.web_features) {
     HighLevelWebFeatures* features = report->add_web_features();
     StoreWebFeaturesProto(source_id, features_set, features);
-    source_ids_seen.insert(source_id);
+    seen_ids.push_back(source_id);
   }
+  base::flat_set<SourceId> source_ids_seen(std::move(seen_ids));
 
   // Number of sources excluded from this report because no entries referred to
   // them.
@@ -571,19 +578,14 @@ void UkmRecorderImpl::StoreRecordingsInReport(Report* report) {
       << num_serialized_entries << "]";
 }
 
-int UkmRecorderImpl::PruneData(std::set<SourceId>& source_ids_seen) {
+int UkmRecorderImpl::PruneData(base::flat_set<SourceId>& source_ids_seen) {
   // Modify the set source_ids_seen by removing sources that aren't in
   // recordings_. We do this here as there is a few places for
   // recordings_.sources to be modified. The resulting set will be currently
   // existing sources that were seen in this report.
-  auto it = source_ids_seen.begin();
-  while (it != source_ids_seen.end()) {
-    if (!base::Contains(recordings_.sources, *it)) {
-      it = source_ids_seen.erase(it);
-    } else {
-      it++;
-    }
-  }
+  base::EraseIf(source_ids_seen, [this](SourceId source_id) {
+    return !base::Contains(recordings_.sources, source_id);
+  });
 
   std::set<SourceId> all_sources;
   for (const auto& kv : recordings_.sources) {
@@ -178,7 +178,7 @@ class COMPONENT_EXPORT(UKM_RECORDER) UkmRecorderImpl : public UkmRecorder {
   // in seconds from the moment the newest truncated source was created to the
   // moment it was discarded from memory, if pruning happened  due to number
   // of sources exceeding the max threshold.
-  int PruneData(std::set<SourceId>& source_ids_seen);
+  int PruneData(base::flat_set<SourceId>& source_ids_seen);
 
   // Deletes Sources, Events and Web Features with these source_ids.
   void PurgeDataBySourceIds(const std::unordered_set<SourceId>& source_ids);
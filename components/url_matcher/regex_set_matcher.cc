@@ -19,6 +19,14 @@ using base::MatcherStringPattern;
 
 namespace url_matcher {
 
+namespace {
+
+// When the prefilter leaves at most this many candidate regexes for a text,
+// they are matched one by one, which is cheaper than a pass of the RE2::Set.
+constexpr size_t kMaxCandidatesToMatchSeparately = 8;
+
+}  // namespace
+
 RegexSetMatcher::RegexSetMatcher() = default;
 RegexSetMatcher::~RegexSetMatcher() = default;
 
@@ -52,8 +60,20 @@ bool RegexSetMatcher::Match(const std::string& text,
   // match case-sensitively.
   std::vector<RE2ID> atoms(FindSubstringMatches(base::ToLowerASCII(text)));
 
+  std::vector<RE2ID> candidates;
+  filtered_re2_->AllPotentials(atoms, &candidates);
+  // Most texts don't contain the literals required by any of the regexes.
+  if (candidates.empty())
+    return false;
+
   std::vector<RE2ID> re2_ids;
-  filtered_re2_->AllMatches(text, atoms, &re2_ids);
+  if (candidates.size() <= kMaxCandidatesToMatchSeparately ||
+      !MatchRegexSet(text, &re2_ids)) {
+    for (RE2ID candidate : candidates) {
+      if (RE2::PartialMatch(text, filtered_re2_->GetRE2(candidate)))
+        re2_ids.push_back(candidate);
+    }
+  }
 
   for (size_t i = 0; i < re2_ids.size(); ++i) {
     MatcherStringPattern::ID id = re2_id_map_[re2_ids[i]];
@@ -73,12 +93,33 @@ std::vector<RegexSetMatcher::RE2ID> RegexSetMatcher::FindSubstringMatches(
   return std::vector<RE2ID>(atoms_set.begin(), atoms_set.end());
 }
 
+bool RegexSetMatcher::MatchRegexSet(const std::string& text,
+                                    std::vector<RE2ID>* re2_ids) const {
+  if (!regex_set_)
+    return false;
+  RE2::Set::ErrorInfo error_info;
+  if (!regex_set_->Match(text, re2_ids, &error_info) &&
+      error_info.kind != RE2::Set::kNoError) {
+    // The DFA ran out of memory, which can happen for huge sets of complex
+    // regexes.
+    re2_ids->clear();
+    return false;
+  }
+  return true;
+}
+
 void RegexSetMatcher::RebuildMatcher() {
   re2_id_map_.clear();
   filtered_re2_ = std::make_unique<re2::FilteredRE2>();
+  regex_set_.reset();
   if (regexes_.empty())
     return;
 
+  if (regexes_.size() > kMaxCandidatesToMatchSeparately) {
+    regex_set_ =
+        std::make_unique<RE2::Set>(RE2::DefaultOptions, RE2::UNANCHORED);
+  }
+
   for (auto it = regexes_.begin(); it != regexes_.end(); ++it) {
     RE2ID re2_id;
     RE2::ErrorCode error =
@@ -86,6 +127,10 @@ void RegexSetMatcher::RebuildMatcher() {
     if (error == RE2::NoError) {
       DCHECK_EQ(static_cast<RE2ID>(re2_id_map_.size()), re2_id);
       re2_id_map_.push_back(it->first);
+      if (regex_set_ &&
+          regex_set_->Add(it->second->pattern(), nullptr) != re2_id) {
+        regex_set_.reset();
+      }
     } else {
       // Unparseable regexes should have been rejected already in
       // URLMatcherFactory::CreateURLMatchesCondition.
@@ -94,6 +139,9 @@ void RegexSetMatcher::RebuildMatcher() {
     }
   }
 
+  if (regex_set_ && !regex_set_->Compile())
+    regex_set_.reset();
+
   std::vector<std::string> strings_to_match;
   filtered_re2_->Compile(&strings_to_match);
 
@@ -14,6 +14,7 @@
 #include "base/substring_set_matcher/matcher_string_pattern.h"
 #include "base/substring_set_matcher/substring_set_matcher.h"
 #include "components/url_matcher/url_matcher_export.h"
+#include "third_party/re2/src/re2/set.h"
 
 namespace re2 {
 class FilteredRE2;
@@ -25,6 +26,9 @@ namespace url_matcher {
 // using FilteredRE2 to reduce the number of regexes that must be matched
 // by pre-filtering with substring matching. See:
 // http://swtch.com/~rsc/regexp/regexp3.html#analysis
+// When the prefilter leaves many candidates, e.g. for policies with thousands
+// of regexes, they are all matched in a single pass of an RE2::Set instead of
+// one by one.
 class URL_MATCHER_EXPORT RegexSetMatcher {
  public:
   RegexSetMatcher();
@@ -58,6 +62,11 @@ class URL_MATCHER_EXPORT RegexSetMatcher {
   // match the |text|.
   std::vector<RE2ID> FindSubstringMatches(const std::string& text) const;
 
+  // Appends the RE2IDs of all regexes that match |text| to |re2_ids|, using
+  // |regex_set_|. Returns false if |regex_set_| couldn't be used.
+  bool MatchRegexSet(const std::string& text,
+                     std::vector<RE2ID>* re2_ids) const;
+
   // Rebuild FilteredRE2 from scratch. Needs to be called whenever
   // our set of regexes changes.
   // TODO(yoz): investigate if it could be done incrementally;
@@ -72,6 +81,11 @@ class URL_MATCHER_EXPORT RegexSetMatcher {
 
   std::unique_ptr<re2::FilteredRE2> filtered_re2_;
   std::unique_ptr<base::SubstringSetMatcher> substring_matcher_;
+
+  // All the regexes of |filtered_re2_|, with the same RE2IDs. Null if there
+  // are too few regexes for it to be useful. RE2 builds the DFA lazily, as
+  // texts are matched.
+  std::unique_ptr<RE2::Set> regex_set_;
 };
 
 }  // namespace url_matcher
@@ -4,9 +4,13 @@
 
 #include "components/url_matcher/regex_set_matcher.h"
 
+#include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "base/containers/contains.h"
+#include "base/strings/string_number_conversions.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "url/gurl.h"
 
@@ -62,4 +66,39 @@ TEST(RegexSetMatcherTest, CaseSensitivity) {
   EXPECT_TRUE(base::Contains(result2, 57));
 }
 
+TEST(RegexSetMatcherTest, ManyCandidates) {
+  // Enough regexes without literals that every text gets more candidates than
+  // are matched one by one.
+  std::vector<std::unique_ptr<MatcherStringPattern>> patterns;
+  for (int i = 0; i < 20; ++i) {
+    patterns.push_back(std::make_unique<MatcherStringPattern>(
+        "^https?://[a-z]{" + base::NumberToString(i) + "}\\.", i));
+  }
+  patterns.push_back(std::make_unique<MatcherStringPattern>("exam+ple", 100));
+  std::vector<const MatcherStringPattern*> regexes;
+  for (const auto& pattern : patterns)
+    regexes.push_back(pattern.get());
+  RegexSetMatcher matcher;
+  matcher.AddPatterns(regexes);
+
+  std::set<MatcherStringPattern::ID> result1;
+  EXPECT_TRUE(matcher.Match("https://example.com/", &result1));
+  EXPECT_EQ(2U, result1.size());
+  EXPECT_TRUE(base::Contains(result1, 7));
+  EXPECT_TRUE(base::Contains(result1, 100));
+
+  std::set<MatcherStringPattern::ID> result2;
+  EXPECT_FALSE(matcher.Match("ftp://sample.com/", &result2));
+  EXPECT_EQ(0U, result2.size());
+
+  // Rebuilding with few regexes still matches all of them.
+  matcher.ClearPatterns();
+  matcher.AddPatterns({patterns[3].get(), patterns[20].get()});
+  std::set<MatcherStringPattern::ID> result3;
+  EXPECT_TRUE(matcher.Match("http://abc.exammmple/", &result3));
+  EXPECT_EQ(2U, result3.size());
+  EXPECT_TRUE(base::Contains(result3, 3));
+  EXPECT_TRUE(base::Contains(result3, 100));
+}
+
 }  // namespace url_matcher
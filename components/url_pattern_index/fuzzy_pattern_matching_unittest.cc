@@ -86,6 +86,11 @@ TEST(SubresourceFilterFuzzyPatternMatchingTest, FindFuzzy) {
       {"a/a/a/a", "^a^a^a", {1}},
       {"a/a/a/a", "^a^a?a", std::vector<size_t>()},
       {"a/a/a/a", "?a?a?a", std::vector<size_t>()},
+
+      {"a//b^", "^^", {1}},
+      {"x/ab/ab^ab", "^ab^", {1, 4}},
+      {"//ab/ab", "^^ab", {0}},
+      {"ab/ab/abc", "ab^abc", {3}},
   };
 
   for (const auto& test_case : kTestCases) {
@@ -101,8 +101,11 @@ void ChildProcessFieldTrialSyncer::OnFieldTrialGroupFinalized(
     const base::FieldTrial& trial,
     const std::string& group_name) {
   // It is not necessary to notify the browser if this is invoked from
-  // SetFieldTrialGroupFromBrowser().
-  if (!in_set_field_trial_group_from_browser) {
+  // SetFieldTrialGroupFromBrowser(), or if the browser has already marked the
+  // trial as active in the shared field trial memory (it then notifies this
+  // process itself).
+  if (!in_set_field_trial_group_from_browser &&
+      !base::FieldTrialList::IsTrialActiveInParentProcess(trial)) {
     activated_callback_.Run(trial.trial_name());
   }
 }
@@ -319,11 +319,19 @@ bool ShouldAddStudy(const ProcessedStudy& processed_study,
   }
 
   if (study.has_filter()) {
+    // Checks that only compare enums, booleans or integers come first, as
+    // most studies in a seed are rejected by them. String-based checks such as
+    // version and locale comparisons are only done for the remaining studies.
     if (!CheckStudyChannel(study.filter(), client_state.channel)) {
       DVLOG(1) << "Filtered out study " << study.name() << " due to channel.";
       return false;
     }
 
+    if (!CheckStudyPlatform(study.filter(), client_state.platform)) {
+      DVLOG(1) << "Filtered out study " << study.name() << " due to platform.";
+      return false;
+    }
+
     if (!CheckStudyFormFactor(study.filter(), client_state.form_factor)) {
       DVLOG(1) << "Filtered out study " << study.name() <<
                   " due to form factor.";
@@ -337,18 +345,17 @@ bool ShouldAddStudy(const ProcessedStudy& processed_study,
       return false;
     }
 
-    if (!CheckStudyLocale(study.filter(), client_state.locale)) {
-      DVLOG(1) << "Filtered out study " << study.name() << " due to locale.";
-      return false;
-    }
-
-    if (!CheckStudyPlatform(study.filter(), client_state.platform)) {
-      DVLOG(1) << "Filtered out study " << study.name() << " due to platform.";
+    if (!CheckStudyLowEndDevice(study.filter(),
+                                client_state.is_low_end_device)) {
+      DVLOG(1) << "Filtered out study " << study.name()
+               << " due to is_low_end_device.";
       return false;
     }
 
-    if (!CheckStudyVersion(study.filter(), client_state.version)) {
-      DVLOG(1) << "Filtered out study " << study.name() << " due to version.";
+    if (!CheckStudyPolicyRestriction(study.filter(),
+                                     client_state.policy_restriction)) {
+      DVLOG(1) << "Filtered out study " << study.name()
+               << " due to policy restriction.";
       return false;
     }
 
@@ -363,23 +370,19 @@ bool ShouldAddStudy(const ProcessedStudy& processed_study,
       return false;
     }
 
-    if (!CheckStudyHardwareClass(study.filter(), client_state.hardware_class)) {
-      DVLOG(1) << "Filtered out study " << study.name() <<
-                  " due to hardware_class.";
+    if (!CheckStudyLocale(study.filter(), client_state.locale)) {
+      DVLOG(1) << "Filtered out study " << study.name() << " due to locale.";
       return false;
     }
 
-    if (!CheckStudyLowEndDevice(study.filter(),
-                                client_state.is_low_end_device)) {
-      DVLOG(1) << "Filtered out study " << study.name()
-               << " due to is_low_end_device.";
+    if (!CheckStudyVersion(study.filter(), client_state.version)) {
+      DVLOG(1) << "Filtered out study " << study.name() << " due to version.";
       return false;
     }
 
-    if (!CheckStudyPolicyRestriction(study.filter(),
-                                     client_state.policy_restriction)) {
-      DVLOG(1) << "Filtered out study " << study.name()
-               << " due to policy restriction.";
+    if (!CheckStudyHardwareClass(study.filter(), client_state.hardware_class)) {
+      DVLOG(1) << "Filtered out study " << study.name() <<
+                  " due to hardware_class.";
       return false;
     }
 
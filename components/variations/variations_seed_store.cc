@@ -184,7 +184,10 @@ bool VariationsSeedStore::LoadSeed(VariationsSeed* seed,
                                    std::string* seed_data,
                                    std::string* base64_seed_signature) {
   LoadSeedResult result =
-      LoadSeedImpl(SeedType::LATEST, seed, seed_data, base64_seed_signature);
+      MaybeTakeImportedSeed(seed, seed_data, base64_seed_signature)
+          ? LoadSeedResult::kSuccess
+          : LoadSeedImpl(SeedType::LATEST, seed, seed_data,
+                         base64_seed_signature);
   RecordLoadSeedResult(result);
   if (result != LoadSeedResult::kSuccess)
     return false;
@@ -231,10 +234,22 @@ void VariationsSeedStore::StoreSeedData(
     }
   }
 
+  // Any store replaces the latest seed that |imported_seed_| refers to.
+  imported_seed_.reset();
+
   if (require_synchronous) {
     SeedProcessingResult result =
         ProcessSeedData(signature_verification_enabled_, std::move(seed_data));
+    const bool will_store = result.result == StoreSeedResult::kSuccess &&
+                            result.validate_result == StoreSeedResult::kSuccess;
+    ImportedSeed imported_seed;
+    if (will_store) {
+      imported_seed.seed_bytes = std::move(result.seed_bytes);
+      imported_seed.validated = result.validated;
+    }
     OnSeedDataProcessed(std::move(done_callback), std::move(result));
+    if (will_store)
+      imported_seed_ = std::move(imported_seed);
   } else {
     base::ThreadPool::PostTaskAndReplyWithResult(
         FROM_HERE, {base::TaskPriority::BEST_EFFORT},
@@ -431,6 +446,10 @@ VariationsSeedStore::SeedProcessingResult::operator=(
 // seed is cleared, there's no reason to retain them as they may be incorrect
 // for the next safe seed.
 void VariationsSeedStore::ClearPrefs(SeedType seed_type) {
+  // The latest seed may be an alias to the safe seed, so clearing either
+  // invalidates |imported_seed_|.
+  imported_seed_.reset();
+
   if (seed_type == SeedType::LATEST) {
     local_state_->ClearPref(prefs::kVariationsCompressedSeed);
     local_state_->ClearPref(prefs::kVariationsLastFetchTime);
@@ -560,6 +579,34 @@ LoadSeedResult VariationsSeedStore::LoadSeedImpl(
   return result;
 }
 
+bool VariationsSeedStore::MaybeTakeImportedSeed(
+    VariationsSeed* seed,
+    std::string* seed_data,
+    std::string* base64_seed_signature) {
+  if (!imported_seed_)
+    return false;
+
+  ImportedSeed imported_seed = std::move(*imported_seed_);
+  imported_seed_.reset();
+
+  // Only reuse the seed if prefs still hold exactly what was validated.
+  std::string stored_seed =
+      local_state_->GetString(prefs::kVariationsCompressedSeed);
+  if (stored_seed == kIdenticalToSafeSeedSentinel)
+    stored_seed = safe_seed_store_->GetCompressedSeed();
+  if (stored_seed != imported_seed.validated.base64_seed_data ||
+      local_state_->GetString(prefs::kVariationsSeedSignature) !=
+          imported_seed.validated.base64_seed_signature) {
+    return false;
+  }
+
+  seed->Swap(&imported_seed.validated.parsed);
+  *seed_data = std::move(imported_seed.seed_bytes);
+  *base64_seed_signature =
+      std::move(imported_seed.validated.base64_seed_signature);
+  return true;
+}
+
 LoadSeedResult VariationsSeedStore::ReadSeedData(SeedType seed_type,
                                                  std::string* seed_data) {
   std::string base64_seed_data;
@@ -788,9 +835,11 @@ VariationsSeedStore::SeedProcessingResult VariationsSeedStore::ProcessSeedData(
       &validated);
   // Important, this must come after the above call as `data` can point to a
   // member of `seed_data` which is being moved.
+  std::string seed_bytes = *data;
   SeedProcessingResult result(std::move(seed_data), StoreSeedResult::kSuccess);
   result.validate_result = validate_result;
   result.validated = std::move(validated);
+  result.seed_bytes = std::move(seed_bytes);
   return result;
 }
 
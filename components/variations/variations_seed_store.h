@@ -245,6 +245,8 @@ class COMPONENT_EXPORT(VARIATIONS) VariationsSeedStore {
     // The below are only set if `result` is StoreSeedResult::kSuccess.
     ValidatedSeed validated;
     StoreSeedResult validate_result;
+    // The uncompressed seed bytes that `validated` was parsed from.
+    std::string seed_bytes;
 
     SeedProcessingResult(SeedData seed_data, StoreSeedResult result);
     ~SeedProcessingResult();
@@ -367,6 +369,22 @@ class COMPONENT_EXPORT(VARIATIONS) VariationsSeedStore {
   // Whether this may read or write to Java "first run" SharedPreferences.
   const bool use_first_run_prefs_;
 
+  // The latest seed as validated by the most recent synchronous store (i.e.
+  // the initial seed import), kept so that the LoadSeed() that follows during
+  // the same startup doesn't decode, verify and parse that seed a second time.
+  // Reset once consumed or when the stored latest seed changes.
+  struct ImportedSeed {
+    std::string seed_bytes;
+    ValidatedSeed validated;
+  };
+  std::optional<ImportedSeed> imported_seed_;
+
+  // Returns true and fills the out-params from |imported_seed_| if it still
+  // matches the latest seed in prefs.
+  bool MaybeTakeImportedSeed(VariationsSeed* seed,
+                             std::string* seed_data,
+                             std::string* base64_seed_signature);
+
 #if BUILDFLAG(IS_CHROMEOS_ASH)
   // Gets the combined server and client state used for early boot variations
   // platform disaster recovery.
@@ -308,6 +308,44 @@ TEST(VariationsSeedStoreTest, LoadSeed_ValidSeed) {
   EXPECT_EQ(base64_seed, prefs.GetString(prefs::kVariationsCompressedSeed));
 }
 
+#if BUILDFLAG(IS_ANDROID) || BUILDFLAG(IS_IOS)
+// Verifies that the seed imported at construction is handed to the following
+// LoadSeed() call, and not reused once the stored seed has changed.
+TEST(VariationsSeedStoreTest, LoadSeed_ImportedInitialSeed) {
+  const VariationsSeed seed = CreateTestSeed();
+  auto MakeInitialSeed = [&seed]() {
+    auto initial_seed = std::make_unique<SeedResponse>();
+    initial_seed->data = SerializeSeed(seed);
+    initial_seed->signature = "a test signature, ignored.";
+    initial_seed->date = base::Time::Now();
+    initial_seed->is_gzip_compressed = false;
+    return initial_seed;
+  };
+
+  TestingPrefServiceSimple prefs;
+  VariationsSeedStore::RegisterPrefs(prefs.registry());
+  {
+    TestVariationsSeedStore seed_store(&prefs, MakeInitialSeed());
+    VariationsSeed loaded_seed;
+    std::string loaded_seed_data;
+    std::string loaded_base64_seed_signature;
+    EXPECT_TRUE(seed_store.LoadSeed(&loaded_seed, &loaded_seed_data,
+                                    &loaded_base64_seed_signature));
+    EXPECT_EQ(SerializeSeed(seed), SerializeSeed(loaded_seed));
+    EXPECT_EQ(SerializeSeed(seed), loaded_seed_data);
+    EXPECT_EQ("a test signature, ignored.", loaded_base64_seed_signature);
+  }
+
+  TestVariationsSeedStore seed_store(&prefs, MakeInitialSeed());
+  prefs.SetString(prefs::kVariationsCompressedSeed, "this should fail");
+  VariationsSeed loaded_seed;
+  std::string loaded_seed_data;
+  std::string loaded_base64_seed_signature;
+  EXPECT_FALSE(seed_store.LoadSeed(&loaded_seed, &loaded_seed_data,
+                                   &loaded_base64_seed_signature));
+}
+#endif  // BUILDFLAG(IS_ANDROID) || BUILDFLAG(IS_IOS)
+
 TEST(VariationsSeedStoreTest, LoadSeed_InvalidSeed) {
   TestingPrefServiceSimple prefs;
   VariationsSeedStore::RegisterPrefs(prefs.registry());
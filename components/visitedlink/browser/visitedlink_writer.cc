@@ -983,12 +983,21 @@ void VisitedLinkWriter::ResizeTable(int32_t new_size) {
     Fingerprint* old_hash_table =
         GetHashTableFromMapping(old_hash_table_mapping);
     // Now we have two tables, our local copy which is the old one, and the new
-    // one loaded into this object where we need to copy the data.
+    // one loaded into this object where we need to copy the data. The old
+    // fingerprints are unique, so they're inserted at the end of their probe
+    // sequences directly, without the duplicate check and the per-fingerprint
+    // metrics of AddFingerprint(), which add up for large tables.
     for (int32_t i = 0; i < old_table_length; i++) {
       Fingerprint cur = old_hash_table[i];
-      if (cur)
-        AddFingerprint(cur, false);
+      if (!cur)
+        continue;
+      Hash cur_hash = HashFingerprint(cur);
+      while (FingerprintAt(cur_hash) != null_fingerprint_)
+        cur_hash = IncrementHash(cur_hash);
+      hash_table_[cur_hash] = cur;
+      used_items_++;
     }
+    DCHECK_LT(used_items_, table_length_);
   }
 
   // Send an update notification to all child processes so they read the new
@@ -20,6 +20,7 @@
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/time/time.h"
 #include "base/timer/mock_timer.h"
 #include "components/visitedlink/browser/partitioned_visitedlink_writer.h"
@@ -437,11 +438,15 @@ TEST_F(VisitedLinkTest, Resizing) {
   int32_t used_count = writer_->GetUsedCount();
   ASSERT_EQ(used_count, 0);
 
+  base::HistogramTester histogram_tester;
   for (int i = 0; i < kTestCount; i++) {
     writer_->AddURL(TestURL(i));
     used_count = writer_->GetUsedCount();
     ASSERT_EQ(i + 1, used_count);
   }
+  // Rehashing the table doesn't count as adding fingerprints.
+  histogram_tester.ExpectTotalCount("History.VisitedLinks.TryToAddFingerprint",
+                                    kTestCount);
 
   // Verify that the table got resized sufficiently.
   int32_t table_size;
@@ -7,7 +7,6 @@
 #include <algorithm>
 
 #include "base/check_op.h"
-#include "base/containers/contains.h"
 #include "base/functional/bind.h"
 #include "base/location.h"
 #include "base/memory/memory_pressure_listener.h"
@@ -51,17 +50,23 @@ void FrameEvictionManager::AddFrame(FrameEvictionManagerClient* frame,
 }
 
 void FrameEvictionManager::RemoveFrame(FrameEvictionManagerClient* frame) {
+  // A frame is tracked in at most one of the two containers, so there is no
+  // need to walk `unlocked_frames_` once it has been found locked.
   auto locked_iter = locked_frames_.find(frame);
-  if (locked_iter != locked_frames_.end())
+  if (locked_iter != locked_frames_.end()) {
     locked_frames_.erase(locked_iter);
-  unlocked_frames_.remove_if([&](const auto& p) { return p.first == frame; });
+    return;
+  }
+  auto unlocked_iter = FindUnlockedFrame(frame);
+  if (unlocked_iter != unlocked_frames_.end())
+    unlocked_frames_.erase(unlocked_iter);
 }
 
 void FrameEvictionManager::LockFrame(FrameEvictionManagerClient* frame) {
-  if (base::Contains(unlocked_frames_, frame,
-                     [](const auto& p) { return p.first; })) {
+  auto unlocked_iter = FindUnlockedFrame(frame);
+  if (unlocked_iter != unlocked_frames_.end()) {
     DCHECK(locked_frames_.find(frame) == locked_frames_.end());
-    unlocked_frames_.remove_if([&](const auto& p) { return p.first == frame; });
+    unlocked_frames_.erase(unlocked_iter);
     locked_frames_[frame] = 1;
   } else {
     DCHECK(locked_frames_.find(frame) != locked_frames_.end());
@@ -70,11 +75,11 @@ void FrameEvictionManager::LockFrame(FrameEvictionManagerClient* frame) {
 }
 
 void FrameEvictionManager::UnlockFrame(FrameEvictionManagerClient* frame) {
-  DCHECK(locked_frames_.find(frame) != locked_frames_.end());
-  size_t locked_count = locked_frames_[frame];
-  DCHECK(locked_count);
-  if (locked_count > 1) {
-    locked_frames_[frame]--;
+  auto locked_iter = locked_frames_.find(frame);
+  DCHECK(locked_iter != locked_frames_.end());
+  DCHECK(locked_iter->second);
+  if (locked_iter != locked_frames_.end() && locked_iter->second > 1) {
+    locked_iter->second--;
   } else {
     RemoveFrame(frame);
     RegisterUnlockedFrame(frame);
@@ -82,6 +87,12 @@ void FrameEvictionManager::UnlockFrame(FrameEvictionManagerClient* frame) {
   }
 }
 
+FrameEvictionManager::UnlockedFrameList::iterator
+FrameEvictionManager::FindUnlockedFrame(FrameEvictionManagerClient* frame) {
+  return std::find_if(unlocked_frames_.begin(), unlocked_frames_.end(),
+                      [frame](const auto& p) { return p.first == frame; });
+}
+
 void FrameEvictionManager::StartFrameCullingTimer() {
   // Unretained: `idle_frames_culling_timer_` is a member of `this`, doesn't
   // outlive it, and cancels the task in its destructor.
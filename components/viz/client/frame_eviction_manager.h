@@ -112,6 +112,16 @@ class VIZ_CLIENT_EXPORT FrameEvictionManager
 
   void RegisterUnlockedFrame(FrameEvictionManagerClient* frame);
 
+  // {FrameEvictionManagerClient, Last Unlock() time}, ordered with the most
+  // recent first.
+  using UnlockedFrameList =
+      std::list<std::pair<FrameEvictionManagerClient*, base::TimeTicks>>;
+
+  // Returns the entry for `frame` in `unlocked_frames_`, or end() if it is not
+  // currently unlocked.
+  UnlockedFrameList::iterator FindUnlockedFrame(
+      FrameEvictionManagerClient* frame);
+
   // Inject mock versions for testing.
   void SetOverridesForTesting(
       scoped_refptr<base::SingleThreadTaskRunner> task_runner,
@@ -125,10 +135,7 @@ class VIZ_CLIENT_EXPORT FrameEvictionManager
   std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 
   std::map<FrameEvictionManagerClient*, size_t> locked_frames_;
-  // {FrameEvictionManagerClient, Last Unlock() time}, ordered with the most
-  // recent first.
-  std::list<std::pair<FrameEvictionManagerClient*, base::TimeTicks>>
-      unlocked_frames_;
+  UnlockedFrameList unlocked_frames_;
   size_t max_number_of_saved_frames_;
 
   // Counter of the outstanding pauses.
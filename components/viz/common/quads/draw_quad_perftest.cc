@@ -24,6 +24,7 @@ static const int kTimeCheckInterval = 10;
 
 constexpr char kMetricPrefixDrawQuad[] = "DrawQuad.";
 constexpr char kMetricIterateResourcesRunsPerS[] = "iterate_resources";
+constexpr char kMetricDeepCopyRunsPerS[] = "deep_copy";
 
 ResourceId NextId(ResourceId id) {
   return ResourceId(id.GetUnsafeValue() + 1);
@@ -32,6 +33,7 @@ ResourceId NextId(ResourceId id) {
 perf_test::PerfResultReporter SetUpDrawQuadReporter(const std::string& story) {
   perf_test::PerfResultReporter reporter(kMetricPrefixDrawQuad, story);
   reporter.RegisterImportantMetric(kMetricIterateResourcesRunsPerS, "runs/s");
+  reporter.RegisterImportantMetric(kMetricDeepCopyRunsPerS, "runs/s");
   return reporter;
 }
 
@@ -114,6 +116,25 @@ class DrawQuadPerfTest : public testing::Test {
     CleanUpRenderPass();
   }
 
+  // Measures copying a whole render pass, which is what a frame transport has
+  // to do for every quad and shared quad state of a submitted frame.
+  void RunDeepCopyTest(const std::string& story, int quad_count) {
+    CreateRenderPass();
+    std::vector<DrawQuad*> quads;
+    GenerateTextureDrawQuads(quad_count, &quads);
+
+    timer_.Reset();
+    do {
+      std::unique_ptr<CompositorRenderPass> copy = render_pass_->DeepCopy();
+      ASSERT_EQ(render_pass_->quad_list.size(), copy->quad_list.size());
+      timer_.NextLap();
+    } while (!timer_.HasTimeLimitExpired());
+
+    auto reporter = SetUpDrawQuadReporter(story);
+    reporter.AddResult(kMetricDeepCopyRunsPerS, timer_.LapsPerSecond());
+    CleanUpRenderPass();
+  }
+
  private:
   std::unique_ptr<CompositorRenderPass> render_pass_;
   raw_ptr<SharedQuadState> shared_state_;
@@ -126,5 +147,11 @@ TEST_F(DrawQuadPerfTest, IterateResources) {
   RunIterateResourceTest("500_quads", 500);
 }
 
+TEST_F(DrawQuadPerfTest, DeepCopy) {
+  RunDeepCopyTest("100_quads", 100);
+  RunDeepCopyTest("1000_quads", 1000);
+  RunDeepCopyTest("5000_quads", 5000);
+}
+
 }  // namespace
 }  // namespace viz
@@ -30,6 +30,7 @@
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/size.h"
 #include "ui/gfx/geometry/vector2d_f.h"
 
 // The visual debugger runtime can be completely disabled/enabled at compile
@@ -316,6 +317,8 @@ class VIZ_SERVICE_EXPORT VizDebugger {
 // compiled to empty statements but do eat some parameters to prevent used
 // variable warnings.
 
+#define VIZ_DEBUGGER_TRACING_CATEGORY "viz.visual_debugger"
+
 namespace viz {
 class VIZ_SERVICE_EXPORT VizDebugger {
  public:
@@ -340,9 +343,17 @@ class VIZ_SERVICE_EXPORT VizDebugger {
     uint8_t color_a;
   };
 
+  // Without the remote debugger, completed frames are only recorded to the
+  // visual debugger trace category. This costs a category check per frame
+  // unless that category is being traced.
   inline void CompleteFrame(uint64_t counter,
                             const gfx::Size& window_pix,
-                            base::TimeTicks time_ticks) {}
+                            base::TimeTicks time_ticks) {
+    TRACE_EVENT_INSTANT2(
+        TRACE_DISABLED_BY_DEFAULT(VIZ_DEBUGGER_TRACING_CATEGORY),
+        "VizDebugger::CompleteFrame", TRACE_EVENT_SCOPE_THREAD, "counter",
+        counter, "window_pix", window_pix.ToString());
+  }
 
   static inline bool IsEnabled() { return false; }
   VizDebugger(const VizDebugger&) = delete;
@@ -356,7 +367,6 @@ DrawRectToTraceValue(const gfx::Vector2dF& pos,
 
 }  // namespace viz
 
-#define VIZ_DEBUGGER_TRACING_CATEGORY "viz.visual_debugger"
 #define DBG_OPT_RED 0
 
 #define DBG_OPT_GREEN 0
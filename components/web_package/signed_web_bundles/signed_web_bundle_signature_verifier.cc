@@ -4,6 +4,7 @@
 
 #include "components/web_package/signed_web_bundles/signed_web_bundle_signature_verifier.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -105,19 +106,23 @@ SignedWebBundleSignatureVerifier::CalculateHashOfUnsignedWebBundle(
 
   // Calculate the hash of the Signed Web Bundle excluding its integrity block.
   // The file might be too big to read it into memory all at once, which is why
-  // it is read in chunks of size `web_bundle_chunk_size`.
+  // it is read in chunks of size `web_bundle_chunk_size`. A single buffer is
+  // reused for all chunks; it is only as large as needed if the whole bundle
+  // fits into one chunk.
+  std::vector<uint8_t> buffer(base::checked_cast<size_t>(std::clamp<int64_t>(
+      file_length - integrity_block_size, 0, web_bundle_chunk_size)));
   for (int64_t offset = integrity_block_size; offset < file_length;) {
-    std::vector<uint8_t> data(
-        // The size of the last chunk (`file_length - offset`) might be smaller
-        // than `web_bundle_chunk_size`. Make sure to only reserve as much
-        // memory as is really needed.
-        std::min(web_bundle_chunk_size, file_length - offset));
+    // The size of the last chunk (`file_length - offset`) might be smaller
+    // than `web_bundle_chunk_size`.
+    base::span<uint8_t> data = base::span(buffer).first(
+        base::checked_cast<size_t>(std::min(web_bundle_chunk_size,
+                                            file_length - offset)));
     std::optional<size_t> bytes_read = file.Read(offset, data);
     if (!bytes_read) {
       return base::unexpected(
           base::File::ErrorToString(file.GetLastFileError()));
     }
-    data.resize(*bytes_read);
+    data = data.first(*bytes_read);
     secure_hash->Update(data.data(), data.size());
 
     if (!base::CheckAdd(offset, *bytes_read).AssignIfValid(&offset)) {
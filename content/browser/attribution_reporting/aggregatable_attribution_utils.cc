@@ -4,6 +4,7 @@
 
 #include "content/browser/attribution_reporting/aggregatable_attribution_utils.h"
 
+#include <algorithm>
 #include <iterator>
 #include <optional>
 #include <utility>
@@ -94,6 +95,7 @@ CreateAggregatableHistogram(
                                    aggregatable_value.filters())) {
       const attribution_reporting::AggregatableValues::Values& values =
           aggregatable_value.values();
+      contributions.reserve(std::min(buckets.size(), values.size()));
       for (const auto& [key_id, key] : buckets) {
         auto value = values.find(key_id);
         if (value == values.end()) {
@@ -6,6 +6,7 @@
 
 #include <list>
 #include <optional>
+#include <set>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -15,6 +16,7 @@
 #include "base/containers/contains.h"
 #include "base/containers/enum_set.h"
 #include "base/functional/bind.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
 #include "base/metrics/field_trial_params.h"
 #include "base/rand_util.h"
@@ -124,6 +126,14 @@ const base::FeatureParam<ChildProcessImportance>::Option
 const base::FeatureParam<ChildProcessImportance> kChildProcessImportanceParam{
     &features::kBackForwardCache, "process_binding_strength",
     ChildProcessImportance::MODERATE, &child_process_importance_options};
+
+// When enabled, backgrounded renderer processes holding a page that enters the
+// back/forward cache are asked to release memory they can recreate (decoded
+// images, discardable memory, GC'd heaps), so that cached pages cost less
+// while they wait to be restored.
+BASE_FEATURE(kBackForwardCacheMemoryCompaction,
+             "BackForwardCacheMemoryCompaction",
+             base::FEATURE_DISABLED_BY_DEFAULT);
 #endif
 
 WebSchedulerTrackedFeatures SupportedFeaturesImpl() {
@@ -359,6 +369,20 @@ bool HasForegroundedProcess(BackForwardCacheImpl::Entry& entry) {
   return false;
 }
 
+#if BUILDFLAG(IS_ANDROID)
+// Asks `process` to release the memory it can recreate, if it's backgrounded.
+// Foregrounded processes are left alone, as they may also be showing a page
+// that would have to redo the work.
+void MaybeCompactCachedPageProcess(RenderProcessHostImpl* process) {
+  if (!base::FeatureList::IsEnabled(kBackForwardCacheMemoryCompaction) ||
+      !process->IsProcessBackgrounded()) {
+    return;
+  }
+  process->NotifyMemoryPressureToRenderer(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+}
+#endif
+
 // Returns true if all of the RenderViewHosts in this Entry have received the
 // acknowledgement from renderer.
 bool AllRenderViewHostsReceivedAckFromRenderer(
@@ -567,6 +591,9 @@ void BackForwardCacheImpl::Entry::WriteIntoTrace(
 void BackForwardCacheImpl::RenderProcessBackgroundedChanged(
     RenderProcessHostImpl* host) {
   EnforceCacheSizeLimit();
+#if BUILDFLAG(IS_ANDROID)
+  MaybeCompactCachedPageProcess(host);
+#endif
 }
 
 BackForwardCacheTestDelegate::BackForwardCacheTestDelegate() {
@@ -1233,6 +1260,20 @@ void BackForwardCacheImpl::StoreEntry(
   entries_.push_front(std::move(entry));
   AddProcessesForEntry(*entries_.front());
   EnforceCacheSizeLimit();
+
+#if BUILDFLAG(IS_ANDROID)
+  // The processes of a page stored after a cross-site navigation are usually
+  // still foregrounded here. When the processes are observed (see
+  // AddProcessesForEntry()), those are compacted from
+  // RenderProcessBackgroundedChanged() once they get backgrounded.
+  std::set<RenderProcessHostImpl*> processes;
+  for (const auto& rvh : entries_.front()->render_view_hosts()) {
+    processes.insert(static_cast<RenderProcessHostImpl*>(rvh->GetProcess()));
+  }
+  for (RenderProcessHostImpl* process : processes) {
+    MaybeCompactCachedPageProcess(process);
+  }
+#endif
 }
 
 void BackForwardCacheImpl::EnforceCacheSizeLimit() {
@@ -62,10 +62,18 @@ void BatchedProxyIPCSender::CreateAllProxies() {
 
   root_proxy_host_->GetAssociatedRemoteFrame()->CreateRemoteChildren(
       std::move(create_remote_children_params_));
+  create_remote_children_params_.clear();
 
   for (const auto& proxy_host : proxy_hosts_) {
     proxy_host->SetRenderFrameProxyCreated(true);
   }
+
+  // The params that `proxy_to_child_params_` points to were sent with the IPC
+  // above, and none of the proxies is pending anymore. Release the per-frame
+  // bookkeeping instead of holding it, with dangling pointers, for as long as
+  // this sender lives.
+  proxy_to_child_params_.clear();
+  proxy_hosts_.clear();
 }
 
 bool BatchedProxyIPCSender::IsProxyCreationPending(GlobalRoutingID global_id) {
@@ -76,7 +76,8 @@ class CONTENT_EXPORT BatchedProxyIPCSender {
           remote_frame_interfaces,
       GlobalRoutingID parent_global_id);
 
-  // Makes 1 IPC to the renderer to create all child frame proxies.
+  // Makes 1 IPC to the renderer to create all child frame proxies. After this,
+  // no proxy creation is pending.
   void CreateAllProxies();
 
   // Checks if this `BatchedProxyIPCSender` will create a proxy for the
@@ -38,12 +38,8 @@ namespace {
 
 bool CheckSecurityForAccessingCodeCacheData(
     const GURL& resource_url,
-    int render_process_id,
+    const ProcessLock& process_lock,
     CodeCacheHostImpl::Operation operation) {
-  ProcessLock process_lock =
-      ChildProcessSecurityPolicyImpl::GetInstance()->GetProcessLock(
-          render_process_id);
-
   // Code caching is only allowed for http(s) and chrome/chrome-untrusted
   // scripts. Furthermore, there is no way for http(s) pages to load chrome or
   // chrome-untrusted scripts, so any http(s) page attempting to store data
@@ -245,12 +241,13 @@ void CodeCacheHostImpl::DidGenerateCacheableMetadata(
     mojo_base::BigBuffer data) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  GeneratedCodeCache* code_cache = GetCodeCache(cache_type);
+  const ProcessLock process_lock = GetProcessLock();
+  GeneratedCodeCache* code_cache = GetCodeCache(cache_type, process_lock);
   if (!code_cache)
     return;
 
   std::optional<GURL> secondary_key =
-      GetSecondaryKeyForCodeCache(url, render_process_id_, Operation::kWrite);
+      GetSecondaryKeyForCodeCache(url, process_lock, Operation::kWrite);
   if (!secondary_key) {
     return;
   }
@@ -263,14 +260,15 @@ void CodeCacheHostImpl::FetchCachedCode(blink::mojom::CodeCacheType cache_type,
                                         const GURL& url,
                                         FetchCachedCodeCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  GeneratedCodeCache* code_cache = GetCodeCache(cache_type);
+  const ProcessLock process_lock = GetProcessLock();
+  GeneratedCodeCache* code_cache = GetCodeCache(cache_type, process_lock);
   if (!code_cache) {
     std::move(callback).Run(base::Time(), std::vector<uint8_t>());
     return;
   }
 
   std::optional<GURL> secondary_key =
-      GetSecondaryKeyForCodeCache(url, render_process_id_, Operation::kRead);
+      GetSecondaryKeyForCodeCache(url, process_lock, Operation::kRead);
   if (!secondary_key) {
     std::move(callback).Run(base::Time(), std::vector<uint8_t>());
     return;
@@ -287,12 +285,13 @@ void CodeCacheHostImpl::ClearCodeCacheEntry(
     blink::mojom::CodeCacheType cache_type,
     const GURL& url) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  GeneratedCodeCache* code_cache = GetCodeCache(cache_type);
+  const ProcessLock process_lock = GetProcessLock();
+  GeneratedCodeCache* code_cache = GetCodeCache(cache_type, process_lock);
   if (!code_cache)
     return;
 
   std::optional<GURL> secondary_key =
-      GetSecondaryKeyForCodeCache(url, render_process_id_, Operation::kRead);
+      GetSecondaryKeyForCodeCache(url, process_lock, Operation::kRead);
   if (!secondary_key) {
     return;
   }
@@ -315,16 +314,18 @@ void CodeCacheHostImpl::DidGenerateCacheableMetadataInCacheStorage(
                      mojo::GetBadMessageCallback()));
 }
 
+ProcessLock CodeCacheHostImpl::GetProcessLock() const {
+  return ChildProcessSecurityPolicyImpl::GetInstance()->GetProcessLock(
+      render_process_id_);
+}
+
 GeneratedCodeCache* CodeCacheHostImpl::GetCodeCache(
-    blink::mojom::CodeCacheType cache_type) {
+    blink::mojom::CodeCacheType cache_type,
+    const ProcessLock& process_lock) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   if (!generated_code_cache_context_)
     return nullptr;
 
-  ProcessLock process_lock =
-      ChildProcessSecurityPolicyImpl::GetInstance()->GetProcessLock(
-          render_process_id_);
-
   // To minimize the chance of any cache bug resulting in privilege escalation
   // from an ordinary web page to trusted WebUI, we use a completely separate
   // GeneratedCodeCache instance for WebUI pages.
@@ -378,13 +379,13 @@ void CodeCacheHostImpl::OnReceiveCachedCode(
 // Case 4. std::nullopt otherwise.
 std::optional<GURL> CodeCacheHostImpl::GetSecondaryKeyForCodeCache(
     const GURL& resource_url,
-    int render_process_id,
+    const ProcessLock& process_lock,
     CodeCacheHostImpl::Operation operation) {
   if (use_empty_secondary_key_for_testing_) {
     return GURL();
   }
   // Case 0: check for invalid schemes.
-  if (!CheckSecurityForAccessingCodeCacheData(resource_url, render_process_id,
+  if (!CheckSecurityForAccessingCodeCacheData(resource_url, process_lock,
                                               operation)) {
     return std::nullopt;
   }
@@ -392,10 +393,6 @@ std::optional<GURL> CodeCacheHostImpl::GetSecondaryKeyForCodeCache(
     return std::nullopt;
   }
 
-  ProcessLock process_lock =
-      ChildProcessSecurityPolicyImpl::GetInstance()->GetProcessLock(
-          render_process_id);
-
   // Case 1: If process is not locked to a site, it is safe to just use the
   // |resource_url| of the requested resource as the key. Return an empty GURL
   // as the second key.
@@ -26,6 +26,7 @@ namespace content {
 
 class GeneratedCodeCache;
 class GeneratedCodeCacheContext;
+class ProcessLock;
 
 // The implementation of a CodeCacheHost, which stores and retrieves resource
 // metadata, either bytecode or native code, generated by a renderer process.
@@ -123,7 +124,13 @@ class CONTENT_EXPORT CodeCacheHostImpl : public blink::mojom::CodeCacheHost {
       const std::string& cache_storage_cache_name) override;
 
   // Helpers.
-  GeneratedCodeCache* GetCodeCache(blink::mojom::CodeCacheType cache_type);
+  //
+  // Each request looks up the renderer's ProcessLock once with
+  // GetProcessLock() and passes it to the others, rather than having each of
+  // them look it up again.
+  ProcessLock GetProcessLock() const;
+  GeneratedCodeCache* GetCodeCache(blink::mojom::CodeCacheType cache_type,
+                                   const ProcessLock& process_lock);
   void OnReceiveCachedCode(blink::mojom::CodeCacheType cache_type,
                            base::TimeTicks start_time,
                            FetchCachedCodeCallback callback,
@@ -132,7 +139,7 @@ class CONTENT_EXPORT CodeCacheHostImpl : public blink::mojom::CodeCacheHost {
 
   std::optional<GURL> GetSecondaryKeyForCodeCache(
       const GURL& resource_url,
-      int render_process_id,
+      const ProcessLock& process_lock,
       CodeCacheHostImpl::Operation operation);
 
   // Our render process host ID, used to bind to the correct render process.
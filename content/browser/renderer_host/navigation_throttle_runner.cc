@@ -4,7 +4,10 @@
 
 #include "content/browser/renderer_host/navigation_throttle_runner.h"
 
+#include <string>
+
 #include "base/feature_list.h"
+#include "base/metrics/histogram.h"
 #include "base/metrics/histogram_functions.h"
 #include "base/metrics/metrics_hashes.h"
 #include "base/strings/strcat.h"
@@ -98,23 +101,16 @@ const char* GetEventNameForHistogram(NavigationThrottleRunner::Event event) {
   return "";
 }
 
-void RecordHistogram(NavigationThrottleRunner::Event event,
-                     base::Time start,
-                     const std::string& metric_type) {
-  base::TimeDelta delta = base::Time::Now() - start;
-  base::UmaHistogramTimes(base::StrCat({"Navigation.Throttle", metric_type, ".",
-                                        GetEventNameForHistogram(event)}),
-                          delta);
+std::string GetHistogramName(NavigationThrottleRunner::Event event,
+                             const std::string& metric_type) {
+  return base::StrCat({"Navigation.Throttle", metric_type, ".",
+                       GetEventNameForHistogram(event)});
 }
 
 void RecordDeferTimeHistogram(NavigationThrottleRunner::Event event,
                               base::Time start) {
-  RecordHistogram(event, start, "DeferTime");
-}
-
-void RecordExecutionTimeHistogram(NavigationThrottleRunner::Event event,
-                                  base::Time start) {
-  RecordHistogram(event, start, "ExecutionTime");
+  base::UmaHistogramTimes(GetHistogramName(event, "DeferTime"),
+                          base::Time::Now() - start);
 }
 
 }  // namespace
@@ -321,6 +317,14 @@ void NavigationThrottleRunner::ProcessInternal() {
   // events need to be able to use the navigation id safely in such a case.
   int64_t local_navigation_id = navigation_id_;
 
+  // Every throttle records its execution time to the same histogram, so only
+  // look it up once. This matches the histogram UmaHistogramTimes() would use.
+  base::HistogramBase* execution_time_histogram =
+      base::Histogram::FactoryTimeGet(
+          GetHistogramName(current_event_, "ExecutionTime"),
+          base::Milliseconds(1), base::Seconds(10), 50,
+          base::HistogramBase::kUmaTargetedHistogramFlag);
+
   for (size_t i = next_index_; i < throttles_.size(); ++i) {
     TRACE_EVENT0("navigation",
                  "NavigationThrottleRunner::ProcessInternal.loop");
@@ -338,7 +342,8 @@ void NavigationThrottleRunner::ProcessInternal() {
                                       "result", "deleted");
       return;
     }
-    RecordExecutionTimeHistogram(current_event_, start);
+    execution_time_histogram->AddTimeMillisecondsGranularity(
+        base::Time::Now() - start);
     TRACE_EVENT_NESTABLE_ASYNC_END1("navigation", GetEventName(current_event_),
                                     local_navigation_id, "result",
                                     result.action());
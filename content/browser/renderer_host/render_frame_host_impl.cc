@@ -8256,6 +8256,8 @@ void RenderFrameHostImpl::GetAssociatedInterface(
   }
 
   mojo::ScopedInterfaceEndpointHandle handle = receiver.PassHandle();
+  if (TryBindContentAssociatedInterface(name, &handle))
+    return;
   if (associated_registry_->TryBindInterface(name, &handle))
     return;
 }
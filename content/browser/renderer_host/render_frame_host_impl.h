@@ -1541,6 +1541,13 @@ class CONTENT_EXPORT RenderFrameHostImpl
       const char* interface_name,
       BackForwardCacheImpl::MessageHandlingPolicyWhenCached policy);
 
+  // Binds `handle` to this frame's implementation of the associated interface
+  // `name` if it is one that content provides. Returns false if it isn't, or
+  // if this frame doesn't provide it, e.g. LocalMainFrameHost in a subframe.
+  bool TryBindContentAssociatedInterface(
+      const std::string& name,
+      mojo::ScopedInterfaceEndpointHandle* handle);
+
   // Sets up the Mojo connection between this instance and its associated render
   // frame.
   void SetUpMojoConnection();
@@ -5,13 +5,16 @@
 #include "content/browser/renderer_host/render_frame_host_impl.h"
 
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/feature_list.h"
-#include "base/functional/bind.h"
+#include "base/containers/flat_map.h"
 #include "base/memory/raw_ptr.h"
 #include "base/metrics/histogram_functions.h"
 #include "base/metrics/metrics_hashes.h"
+#include "base/no_destructor.h"
 #include "base/task/single_thread_task_runner.h"
 #include "content/browser/accessibility/render_accessibility_host.h"
 #include "content/browser/attribution_reporting/attribution_host.h"
@@ -177,174 +180,206 @@ RenderFrameHostImpl::CreateMessageFilterForAssociatedReceiverInternal(
   return filter_chain;
 }
 
+bool RenderFrameHostImpl::TryBindContentAssociatedInterface(
+    const std::string& name,
+    mojo::ScopedInterfaceEndpointHandle* handle) {
+  // Returns false, leaving `handle` untouched, if `impl` doesn't provide the
+  // interface.
+  using Binder = bool (*)(RenderFrameHostImpl* impl,
+                          mojo::ScopedInterfaceEndpointHandle* handle);
+  using BinderMap = base::flat_map<std::string_view, Binder>;
+
+  // Shared by all frames, so that frame creation doesn't allocate a binder per
+  // interface.
+  static const base::NoDestructor<BinderMap> kBinders(BinderMap{
+      {mojom::FrameHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->frame_host_associated_receiver_.Bind(
+             mojo::PendingAssociatedReceiver<mojom::FrameHost>(
+                 std::move(*handle)));
+         impl->frame_host_associated_receiver_.SetFilter(
+             impl->CreateMessageFilterForAssociatedReceiver(
+                 mojom::FrameHost::Name_));
+         return true;
+       }},
+      {blink::mojom::BackForwardCacheControllerHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->back_forward_cache_controller_host_associated_receiver_.Bind(
+             mojo::PendingAssociatedReceiver<
+                 blink::mojom::BackForwardCacheControllerHost>(
+                 std::move(*handle)));
+         impl->back_forward_cache_controller_host_associated_receiver_
+             .SetFilter(impl->CreateMessageFilterForAssociatedReceiverInternal(
+                 blink::mojom::BackForwardCacheControllerHost::Name_,
+                 BackForwardCacheImpl::kMessagePolicyNone));
+         return true;
+       }},
+      {blink::mojom::LocalFrameHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->local_frame_host_receiver_.Bind(
+             mojo::PendingAssociatedReceiver<blink::mojom::LocalFrameHost>(
+                 std::move(*handle)));
+         impl->local_frame_host_receiver_.SetFilter(
+             impl->CreateMessageFilterForAssociatedReceiver(
+                 blink::mojom::LocalFrameHost::Name_));
+         return true;
+       }},
+      {blink::mojom::SharedStorageDocumentService::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         if (!base::FeatureList::IsEnabled(
+                 blink::features::kSharedStorageAPI)) {
+           return false;
+         }
+         if (SharedStorageDocumentServiceImpl::GetForCurrentDocument(impl)) {
+           // The renderer somehow requested two shared storage worklets
+           // associated with the same document. This could indicate a
+           // compromised renderer, so let's terminate it.
+           mojo::ReportBadMessage(
+               "Attempted to request two shared storage worklets associated "
+               "with the same document.");
+           return true;
+         }
+
+         SharedStorageDocumentServiceImpl::GetOrCreateForCurrentDocument(impl)
+             ->Bind(mojo::PendingAssociatedReceiver<
+                    blink::mojom::SharedStorageDocumentService>(
+                 std::move(*handle)));
+         return true;
+       }},
+      {blink::mojom::LocalMainFrameHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         if (!impl->is_main_frame()) {
+           return false;
+         }
+         impl->local_main_frame_host_receiver_.Bind(
+             mojo::PendingAssociatedReceiver<blink::mojom::LocalMainFrameHost>(
+                 std::move(*handle)));
+         impl->local_main_frame_host_receiver_.SetFilter(
+             impl->CreateMessageFilterForAssociatedReceiver(
+                 blink::mojom::LocalMainFrameHost::Name_));
+         return true;
+       }},
+      {blink::mojom::ManifestUrlChangeObserver::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         if (!impl->is_main_frame()) {
+           return false;
+         }
+         ManifestManagerHost::GetOrCreateForPage(impl->GetPage())
+             ->BindObserver(mojo::PendingAssociatedReceiver<
+                            blink::mojom::ManifestUrlChangeObserver>(
+                 std::move(*handle)));
+         return true;
+       }},
+      // TODO(crbug.com/1395830): Avoid binding the DomAutomationControllerHost
+      // interface outside of tests.
+      {mojom::DomAutomationControllerHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->BindDomOperationControllerHostReceiver(
+             mojo::PendingAssociatedReceiver<
+                 mojom::DomAutomationControllerHost>(std::move(*handle)));
+         return true;
+       }},
+#if BUILDFLAG(ENABLE_PPAPI)
+      {mojom::PepperHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->GetPpapiSupport().Bind(
+             mojo::PendingAssociatedReceiver<mojom::PepperHost>(
+                 std::move(*handle)));
+         return true;
+       }},
+#endif
+      {media::mojom::MediaPlayerHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->delegate()->CreateMediaPlayerHostForRenderFrameHost(
+             impl, mojo::PendingAssociatedReceiver<
+                       media::mojom::MediaPlayerHost>(std::move(*handle)));
+         return true;
+       }},
+      {blink::mojom::DisplayCutoutHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->delegate()->BindDisplayCutoutHost(
+             impl, mojo::PendingAssociatedReceiver<
+                       blink::mojom::DisplayCutoutHost>(std::move(*handle)));
+         return true;
+       }},
+      {blink::mojom::AttributionHost::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         AttributionHost::BindReceiver(
+             mojo::PendingAssociatedReceiver<blink::mojom::AttributionHost>(
+                 std::move(*handle)),
+             impl);
+         return true;
+       }},
+      {device::mojom::ScreenOrientation::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->delegate()->BindScreenOrientation(
+             impl, mojo::PendingAssociatedReceiver<
+                       device::mojom::ScreenOrientation>(std::move(*handle)));
+         return true;
+       }},
+      {blink::mojom::BroadcastChannelProvider::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         impl->CreateBroadcastChannelProvider(
+             mojo::PendingAssociatedReceiver<
+                 blink::mojom::BroadcastChannelProvider>(std::move(*handle)));
+         return true;
+       }},
+      {blink::mojom::BlobURLStore::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         if (!base::FeatureList::IsEnabled(
+                 net::features::kSupportPartitionedBlobUrl)) {
+           return false;
+         }
+         impl->BindBlobUrlStoreAssociatedReceiver(
+             mojo::PendingAssociatedReceiver<blink::mojom::BlobURLStore>(
+                 std::move(*handle)));
+         return true;
+       }},
+      {blink::mojom::FileBackedBlobFactory::Name_,
+       [](RenderFrameHostImpl* impl,
+          mojo::ScopedInterfaceEndpointHandle* handle) {
+         if (!base::FeatureList::IsEnabled(
+                 blink::features::kEnableFileBackedBlobFactory)) {
+           return false;
+         }
+         impl->BindFileBackedBlobFactory(
+             mojo::PendingAssociatedReceiver<
+                 blink::mojom::FileBackedBlobFactory>(std::move(*handle)));
+         return true;
+       }},
+  });
+
+  auto it = kBinders->find(name);
+  return it != kBinders->end() && it->second(this, handle);
+}
+
 void RenderFrameHostImpl::SetUpMojoConnection() {
   CHECK(!associated_registry_);
 
+  // Content's own associated interfaces are bound by
+  // TryBindContentAssociatedInterface(). Only the embedder's are registered
+  // per frame.
   associated_registry_ = std::make_unique<blink::AssociatedInterfaceRegistry>();
 
-  auto bind_frame_host_receiver =
-      [](RenderFrameHostImpl* impl,
-         mojo::PendingAssociatedReceiver<mojom::FrameHost> receiver) {
-        impl->frame_host_associated_receiver_.Bind(std::move(receiver));
-        impl->frame_host_associated_receiver_.SetFilter(
-            impl->CreateMessageFilterForAssociatedReceiver(
-                mojom::FrameHost::Name_));
-      };
-  associated_registry_->AddInterface<mojom::FrameHost>(
-      base::BindRepeating(bind_frame_host_receiver, base::Unretained(this)));
-
-  associated_registry_->AddInterface<
-      blink::mojom::BackForwardCacheControllerHost>(base::BindRepeating(
-      [](RenderFrameHostImpl* impl,
-         mojo::PendingAssociatedReceiver<
-             blink::mojom::BackForwardCacheControllerHost> receiver) {
-        impl->back_forward_cache_controller_host_associated_receiver_.Bind(
-            std::move(receiver));
-        impl->back_forward_cache_controller_host_associated_receiver_.SetFilter(
-            impl->CreateMessageFilterForAssociatedReceiverInternal(
-                blink::mojom::BackForwardCacheControllerHost::Name_,
-                BackForwardCacheImpl::kMessagePolicyNone));
-      },
-      base::Unretained(this)));
-
-  associated_registry_->AddInterface<blink::mojom::LocalFrameHost>(
-      base::BindRepeating(
-          [](RenderFrameHostImpl* impl,
-             mojo::PendingAssociatedReceiver<blink::mojom::LocalFrameHost>
-                 receiver) {
-            impl->local_frame_host_receiver_.Bind(std::move(receiver));
-            impl->local_frame_host_receiver_.SetFilter(
-                impl->CreateMessageFilterForAssociatedReceiver(
-                    blink::mojom::LocalFrameHost::Name_));
-          },
-          base::Unretained(this)));
-
-  if (base::FeatureList::IsEnabled(blink::features::kSharedStorageAPI)) {
-    associated_registry_->AddInterface<
-        blink::mojom::SharedStorageDocumentService>(base::BindRepeating(
-        [](RenderFrameHostImpl* impl,
-           mojo::PendingAssociatedReceiver<
-               blink::mojom::SharedStorageDocumentService> receiver) {
-          if (SharedStorageDocumentServiceImpl::GetForCurrentDocument(impl)) {
-            // The renderer somehow requested two shared storage worklets
-            // associated with the same document. This could indicate a
-            // compromised renderer, so let's terminate it.
-            mojo::ReportBadMessage(
-                "Attempted to request two shared storage worklets associated "
-                "with the same document.");
-            return;
-          }
-
-          SharedStorageDocumentServiceImpl::GetOrCreateForCurrentDocument(impl)
-              ->Bind(std::move(receiver));
-        },
-        base::Unretained(this)));
-  }
-
-  if (is_main_frame()) {
-    associated_registry_->AddInterface<blink::mojom::LocalMainFrameHost>(
-        base::BindRepeating(
-            [](RenderFrameHostImpl* impl,
-               mojo::PendingAssociatedReceiver<blink::mojom::LocalMainFrameHost>
-                   receiver) {
-              impl->local_main_frame_host_receiver_.Bind(std::move(receiver));
-              impl->local_main_frame_host_receiver_.SetFilter(
-                  impl->CreateMessageFilterForAssociatedReceiver(
-                      blink::mojom::LocalMainFrameHost::Name_));
-            },
-            base::Unretained(this)));
-
-    associated_registry_->AddInterface<blink::mojom::ManifestUrlChangeObserver>(
-        base::BindRepeating(
-            [](RenderFrameHostImpl* impl,
-               mojo::PendingAssociatedReceiver<
-                   blink::mojom::ManifestUrlChangeObserver> receiver) {
-              ManifestManagerHost::GetOrCreateForPage(impl->GetPage())
-                  ->BindObserver(std::move(receiver));
-            },
-            base::Unretained(this)));
-  }
-
-  // TODO(crbug.com/1395830): Avoid binding the DomAutomationControllerHost
-  // interface outside of tests.
-  associated_registry_->AddInterface<mojom::DomAutomationControllerHost>(
-      base::BindRepeating(
-          [](RenderFrameHostImpl* impl,
-             mojo::PendingAssociatedReceiver<mojom::DomAutomationControllerHost>
-                 receiver) {
-            impl->BindDomOperationControllerHostReceiver(std::move(receiver));
-          },
-          base::Unretained(this)));
-
   file_system_manager_.reset(new FileSystemManagerImpl(
       GetProcess()->GetID(),
       GetProcess()->GetStoragePartition()->GetFileSystemContext(),
       ChromeBlobStorageContext::GetFor(GetProcess()->GetBrowserContext())));
 
-#if BUILDFLAG(ENABLE_PPAPI)
-  associated_registry_->AddInterface<mojom::PepperHost>(base::BindRepeating(
-      [](RenderFrameHostImpl* impl,
-         mojo::PendingAssociatedReceiver<mojom::PepperHost> receiver) {
-        impl->GetPpapiSupport().Bind(std::move(receiver));
-      },
-      base::Unretained(this)));
-#endif
-
-  associated_registry_->AddInterface<media::mojom::MediaPlayerHost>(
-      base::BindRepeating(
-          [](RenderFrameHostImpl* impl,
-             mojo::PendingAssociatedReceiver<media::mojom::MediaPlayerHost>
-                 receiver) {
-            impl->delegate()->CreateMediaPlayerHostForRenderFrameHost(
-                impl, std::move(receiver));
-          },
-          base::Unretained(this)));
-
-  associated_registry_->AddInterface<blink::mojom::DisplayCutoutHost>(
-      base::BindRepeating(
-          [](RenderFrameHostImpl* impl,
-             mojo::PendingAssociatedReceiver<blink::mojom::DisplayCutoutHost>
-                 receiver) {
-            impl->delegate()->BindDisplayCutoutHost(impl, std::move(receiver));
-          },
-          base::Unretained(this)));
-
-  associated_registry_->AddInterface<blink::mojom::AttributionHost>(
-      base::BindRepeating(
-          [](RenderFrameHostImpl* impl,
-             mojo::PendingAssociatedReceiver<blink::mojom::AttributionHost>
-                 receiver) {
-            AttributionHost::BindReceiver(std::move(receiver), impl);
-          },
-          base::Unretained(this)));
-
-  associated_registry_->AddInterface<device::mojom::ScreenOrientation>(
-      base::BindRepeating(
-          [](RenderFrameHostImpl* impl,
-             mojo::PendingAssociatedReceiver<device::mojom::ScreenOrientation>
-                 receiver) {
-            impl->delegate()->BindScreenOrientation(impl, std::move(receiver));
-          },
-          base::Unretained(this)));
-
-  associated_registry_->AddInterface<blink::mojom::BroadcastChannelProvider>(
-      base::BindRepeating(&RenderFrameHostImpl::CreateBroadcastChannelProvider,
-                          base::Unretained(this)));
-
-  if (base::FeatureList::IsEnabled(net::features::kSupportPartitionedBlobUrl)) {
-    associated_registry_->AddInterface<blink::mojom::BlobURLStore>(
-        base::BindRepeating(
-            &RenderFrameHostImpl::BindBlobUrlStoreAssociatedReceiver,
-            base::Unretained(this)));
-  }
-
-  if (base::FeatureList::IsEnabled(
-          blink::features::kEnableFileBackedBlobFactory)) {
-    associated_registry_->AddInterface<blink::mojom::FileBackedBlobFactory>(
-        base::BindRepeating(&RenderFrameHostImpl::BindFileBackedBlobFactory,
-                            base::Unretained(this)));
-  }
-
   // Allow embedders to register their binders.
   GetContentClient()
       ->browser()
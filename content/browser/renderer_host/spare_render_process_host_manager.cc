@@ -112,6 +112,19 @@ RenderProcessHost*
 SpareRenderProcessHostManager::MaybeTakeSpareRenderProcessHost(
     BrowserContext* browser_context,
     SiteInstanceImpl* site_instance) {
+  using SpareProcessMaybeTakeAction =
+      RenderProcessHostImpl::SpareProcessMaybeTakeAction;
+
+  // Without a spare there is nothing to take or discard, so skip the embedder
+  // and StoragePartition queries below. This is the common case when several
+  // processes are launched in a row, e.g. during session restore.
+  if (!spare_render_process_host_) {
+    UMA_HISTOGRAM_ENUMERATION(
+        "BrowserRenderProcessHost.SpareProcessMaybeTakeAction",
+        SpareProcessMaybeTakeAction::kNoSparePresent);
+    return nullptr;
+  }
+
   // Give embedder a chance to disable using a spare RenderProcessHost for
   // certain SiteInstances.  Some navigations, such as to NTP or extensions,
   // require passing command-line flags to the renderer process at process
@@ -158,14 +171,9 @@ SpareRenderProcessHostManager::MaybeTakeSpareRenderProcessHost(
       browser_context->GetStoragePartition(site_instance);
 
   // Log UMA metrics.
-  using SpareProcessMaybeTakeAction =
-      RenderProcessHostImpl::SpareProcessMaybeTakeAction;
   SpareProcessMaybeTakeAction action =
       SpareProcessMaybeTakeAction::kNoSparePresent;
-  if (!spare_render_process_host_) {
-    action = SpareProcessMaybeTakeAction::kNoSparePresent;
-  } else if (browser_context !=
-             spare_render_process_host_->GetBrowserContext()) {
+  if (browser_context != spare_render_process_host_->GetBrowserContext()) {
     action = SpareProcessMaybeTakeAction::kMismatchedBrowserContext;
   } else if (!spare_render_process_host_->InSameStoragePartition(
                  site_storage)) {
@@ -184,8 +192,7 @@ SpareRenderProcessHostManager::MaybeTakeSpareRenderProcessHost(
 
   // Decide whether to take or drop the spare process.
   RenderProcessHost* returned_process = nullptr;
-  if (spare_render_process_host_ &&
-      browser_context == spare_render_process_host_->GetBrowserContext() &&
+  if (browser_context == spare_render_process_host_->GetBrowserContext() &&
       spare_render_process_host_->InSameStoragePartition(site_storage) &&
       !site_instance->IsGuest() && embedder_allows_spare_usage &&
       site_instance_allows_spare_usage && !hosts_pdf_content) {
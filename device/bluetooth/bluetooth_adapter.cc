@@ -684,6 +684,9 @@ void BluetoothAdapter::DeleteDeviceForTesting(const std::string& address) {
 }
 
 void BluetoothAdapter::RemoveTimedOutDevices() {
+  // Sample the clock once; in dense environments there can be thousands of
+  // devices to check.
+  const base::Time now = base::Time::NowFromSystemTime();
   for (auto it = devices_.begin(); it != devices_.end();) {
     BluetoothDevice* device = it->second.get();
     if (device->IsPaired() || device->IsConnected() ||
@@ -694,8 +697,7 @@ void BluetoothAdapter::RemoveTimedOutDevices() {
 
     base::Time last_update_time = device->GetLastUpdateTime();
 
-    bool device_expired =
-        (base::Time::NowFromSystemTime() - last_update_time) > timeoutSec;
+    bool device_expired = (now - last_update_time) > timeoutSec;
     DVLOG(3) << "device: " << device->GetAddress()
              << ", last_update: " << last_update_time
              << ", exp: " << device_expired;
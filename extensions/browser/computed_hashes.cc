@@ -4,6 +4,7 @@
 
 #include "extensions/browser/computed_hashes.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <utility>
@@ -285,6 +286,8 @@ std::vector<std::string> ComputedHashes::GetHashesForContent(
     size_t block_size) {
   size_t offset = 0;
   std::vector<std::string> hashes;
+  hashes.reserve(
+      std::max<size_t>(1u, (contents.size() + block_size - 1) / block_size));
   // Even when the contents is empty, we want to output at least one hash
   // block (the hash of the empty string).
   do {
@@ -295,10 +298,8 @@ std::vector<std::string> ComputedHashes::GetHashesForContent(
         crypto::SecureHash::Create(crypto::SecureHash::SHA256));
     hash->Update(block_start, bytes_to_read);
 
-    std::string buffer;
-    buffer.resize(crypto::kSHA256Length);
+    std::string& buffer = hashes.emplace_back(crypto::kSHA256Length, '\0');
     hash->Finish(std::data(buffer), buffer.size());
-    hashes.push_back(std::move(buffer));
 
     // If |contents| is empty, then we want to just exit here.
     if (bytes_to_read == 0)
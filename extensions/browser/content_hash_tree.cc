@@ -29,6 +29,8 @@ std::string ComputeTreeHashRoot(const std::vector<std::string>& leaf_hashes,
   std::vector<std::string> parent_nodes;
 
   while (current->size() > 1) {
+    parent_nodes.reserve((current->size() + branch_factor - 1) /
+                         branch_factor);
     // Iterate over the current level of hashes, computing the hash of up to
     // |branch_factor| elements to form the hash of each parent node.
     auto i = current->cbegin();
@@ -40,8 +42,9 @@ std::string ComputeTreeHashRoot(const std::vector<std::string>& leaf_hashes,
         hash->Update(i->data(), i->size());
         ++i;
       }
-      parent_nodes.push_back(std::string(crypto::kSHA256Length, 0));
-      hash->Finish(std::data(parent_nodes.back()), crypto::kSHA256Length);
+      std::string& parent =
+          parent_nodes.emplace_back(crypto::kSHA256Length, '\0');
+      hash->Finish(std::data(parent), crypto::kSHA256Length);
     }
     current_nodes.swap(parent_nodes);
     parent_nodes.clear();
@@ -20,6 +20,11 @@ class DeferredStartRenderHost {
   // DO NOT CALL THIS unless you're implementing an ExtensionHostQueue.
   // Called by the ExtensionHostQueue to create the renderer frame tree.
   virtual void CreateRendererNow() = 0;
+
+  // Returns true if this host should be started ahead of hosts that don't,
+  // for example because the extension it belongs to was installed by policy.
+  // Hosts that return the same value are started in the order they're queued.
+  virtual bool ShouldStartBeforeOtherHosts() const { return false; }
 };
 
 }  // namespace extensions
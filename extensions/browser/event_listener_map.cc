@@ -269,14 +269,15 @@ bool EventListenerMap::HasProcessListenerForEvent(
     int worker_thread_id,
     const ExtensionId& extension_id,
     const std::string& event_name) const {
-  for (const auto& it : listeners_) {
-    for (const auto& listener : it.second) {
-      if (listener->process() == process &&
-          listener->extension_id() == extension_id &&
-          listener->worker_thread_id() == worker_thread_id &&
-          listener->event_name() == event_name) {
-        return true;
-      }
+  auto it = listeners_.find(event_name);
+  if (it == listeners_.end())
+    return false;
+
+  for (const auto& listener : it->second) {
+    if (listener->process() == process &&
+        listener->extension_id() == extension_id &&
+        listener->worker_thread_id() == worker_thread_id) {
+      return true;
     }
   }
   return false;
@@ -356,8 +357,13 @@ std::set<const EventListener*> EventListenerMap::GetEventListeners(
       interested_listeners.insert(listener);
     }
   } else {
-    for (const auto& listener : listeners_[event.event_name])
-      interested_listeners.insert(listener.get());
+    // Use find() rather than operator[] so that dispatching an event nobody
+    // listens to doesn't insert an empty list into |listeners_|.
+    auto it = listeners_.find(event.event_name);
+    if (it != listeners_.end()) {
+      for (const auto& listener : it->second)
+        interested_listeners.insert(listener.get());
+    }
   }
 
   return interested_listeners;
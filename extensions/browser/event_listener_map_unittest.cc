@@ -570,6 +570,13 @@ TEST_F(EventListenerMapTest, CorruptedExtensionPrefsShouldntCrash) {
   ASSERT_EQ(0u, targets.size());
 }
 
+TEST_F(EventListenerMapTest, GetListenersForUnknownEventDoesNotAddEntry) {
+  std::unique_ptr<Event> event(
+      CreateEvent(kEvent1Name, GURL("http://www.google.com")));
+  EXPECT_TRUE(listeners_->GetEventListeners(*event).empty());
+  EXPECT_TRUE(listeners_->listeners().empty());
+}
+
 INSTANTIATE_TEST_SUITE_P(NonServiceWorker,
                          EventListenerMapWithContextTest,
                          testing::Values(false));
@@ -37,6 +37,7 @@
 #include "extensions/common/extension.h"
 #include "extensions/common/extension_urls.h"
 #include "extensions/common/feature_switch.h"
+#include "extensions/common/manifest.h"
 #include "extensions/common/manifest_handlers/background_info.h"
 #include "third_party/blink/public/mojom/window_features/window_features.mojom.h"
 #include "ui/base/l10n/l10n_util.h"
@@ -235,6 +236,12 @@ void ExtensionHost::CreateRendererNow() {
   }
 }
 
+bool ExtensionHost::ShouldStartBeforeOtherHosts() const {
+  // Policy-installed extensions are often required for the browser to be
+  // usable in managed environments, so start them ahead of the rest.
+  return Manifest::IsPolicyLocation(extension_->location());
+}
+
 void ExtensionHost::Close() {
   // Some ways of closing the host may be asynchronous, which would allow the
   // contents to call Close() multiple times. If we've already called the
@@ -220,6 +220,7 @@ class ExtensionHost : public DeferredStartRenderHost,
 
   // DeferredStartRenderHost:
   void CreateRendererNow() override;
+  bool ShouldStartBeforeOtherHosts() const override;
 
   // Message handlers.
   void OnIncrementLazyKeepaliveCount();
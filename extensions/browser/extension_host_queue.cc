@@ -25,7 +25,16 @@ ExtensionHostQueue& ExtensionHostQueue::GetInstance() {
 }
 
 void ExtensionHostQueue::Add(DeferredStartRenderHost* host) {
-  queue_.push_back(host);
+  if (host->ShouldStartBeforeOtherHosts()) {
+    // Queue behind any other prioritized hosts, but ahead of the rest.
+    auto it = base::ranges::find_if_not(
+        queue_, [](const DeferredStartRenderHost* queued_host) {
+          return queued_host->ShouldStartBeforeOtherHosts();
+        });
+    queue_.insert(it, host);
+  } else {
+    queue_.push_back(host);
+  }
   PostTask();
 }
 
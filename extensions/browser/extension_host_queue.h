@@ -15,9 +15,10 @@ namespace extensions {
 class DeferredStartRenderHost;
 
 // A queue of ExtensionHosts waiting for initialization. This initializes
-// DeferredStartRenderHosts in the order they're Add()ed, with simple rate
-// limiting logic that re-posts each task to the UI thread, to avoid clogging it
-// for a long period of time.
+// DeferredStartRenderHosts in the order they're Add()ed, except that hosts
+// which ShouldStartBeforeOtherHosts() are moved ahead of those that don't. It
+// uses simple rate limiting logic that re-posts each task to the UI thread, to
+// avoid clogging it for a long period of time.
 class ExtensionHostQueue {
  public:
   ExtensionHostQueue();
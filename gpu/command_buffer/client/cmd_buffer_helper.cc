@@ -170,6 +170,15 @@ bool CommandBufferHelper::WaitForGetOffsetInRange(int32_t start, int32_t end) {
   return !context_lost_;
 }
 
+bool CommandBufferHelper::WaitForAvailableSpaceInRange(int32_t start,
+                                                       int32_t end) {
+  base::TimeTicks wait_start = base::TimeTicks::Now();
+  bool result = WaitForGetOffsetInRange(start, end);
+  ++num_waits_for_available_entries_;
+  time_waiting_for_available_entries_ += base::TimeTicks::Now() - wait_start;
+  return result;
+}
+
 void CommandBufferHelper::Flush() {
   TRACE_EVENT0("gpu", "CommandBufferHelper::Flush");
   // Wrap put_ before flush.
@@ -307,7 +316,7 @@ void CommandBufferHelper::WaitForAvailableEntries(int32_t count) {
     if (curr_get > put_ || curr_get == 0) {
       TRACE_EVENT0("gpu", "CommandBufferHelper::WaitForAvailableEntries");
       FlushLazy();
-      if (!WaitForGetOffsetInRange(1, put_))
+      if (!WaitForAvailableSpaceInRange(1, put_))
         return;
       curr_get = cached_get_offset_;
       DCHECK_LE(curr_get, put_);
@@ -340,9 +349,10 @@ void CommandBufferHelper::WaitForAvailableEntries(int32_t count) {
     if (immediate_entry_count_ < count) {
       // Buffer is full.  Need to wait for entries.
       TRACE_EVENT0("gpu", "CommandBufferHelper::WaitForAvailableEntries1");
-      if (!WaitForGetOffsetInRange((put_ + count + 1) % total_entry_count_,
-                                   put_))
+      if (!WaitForAvailableSpaceInRange(
+              (put_ + count + 1) % total_entry_count_, put_)) {
         return;
+      }
       CalcImmediateEntries(count);
       if (immediate_entry_count_ < count) {
         // Tell the underlying command buffer to signal a lost context to higher
@@ -286,6 +286,15 @@ class GPU_EXPORT CommandBufferHelper {
 
   bool usable() const { return usable_; }
 
+  // The number of times, and the total time, the helper had to block for the
+  // service to free up space in the ring buffer.
+  uint32_t num_waits_for_available_entries() const {
+    return num_waits_for_available_entries_;
+  }
+  base::TimeDelta time_waiting_for_available_entries() const {
+    return time_waiting_for_available_entries_;
+  }
+
   bool OnMemoryDump(const base::trace_event::MemoryDumpArgs& args,
                     base::trace_event::ProcessMemoryDump* pmd);
 
@@ -300,6 +309,10 @@ class GPU_EXPORT CommandBufferHelper {
   // false if there was an error.
   bool WaitForGetOffsetInRange(int32_t start, int32_t end);
 
+  // Same as WaitForGetOffsetInRange(), for when the helper is waiting for free
+  // space. Records the wait.
+  bool WaitForAvailableSpaceInRange(int32_t start, int32_t end);
+
 #if defined(CMD_HELPER_PERIODIC_FLUSH_CHECK)
   // Calls Flush if automatic flush conditions are met.
   void PeriodicFlushCheck();
@@ -345,6 +358,9 @@ class GPU_EXPORT CommandBufferHelper {
 
   base::TimeTicks last_flush_time_;
 
+  uint32_t num_waits_for_available_entries_ = 0;
+  base::TimeDelta time_waiting_for_available_entries_;
+
   // Incremented every time the helper flushes the command buffer.
   // Can be used to track when prior commands have been flushed.
   uint32_t flush_generation_ = 0;
@@ -487,6 +487,16 @@ TEST_F(CommandBufferHelperTest, TestCommandWrappingFullAtEnd) {
   TestCommandWrappingFull(2, kTotalNumCommandEntries / 2);
 }
 
+// Checks that waiting for the service to free up space is recorded.
+TEST_F(CommandBufferHelperTest, TestWaitsForAvailableEntriesAreRecorded) {
+  EXPECT_EQ(0u, helper_->num_waits_for_available_entries());
+  EXPECT_TRUE(helper_->time_waiting_for_available_entries().is_zero());
+
+  // Over filling the buffer while flushes are locked has to wait for space.
+  TestCommandWrappingFull(2, 0);
+  EXPECT_LT(0u, helper_->num_waits_for_available_entries());
+}
+
 // Checks that asking for available entries work, and that the parser
 // effectively won't use that space.
 TEST_F(CommandBufferHelperTest, TestAvailableEntries) {
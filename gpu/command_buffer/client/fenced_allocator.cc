@@ -50,6 +50,31 @@ FencedAllocator::~FencedAllocator() {
 // optimizing what to wait for, just looks inside the block in order (first-fit
 // as well).
 FencedAllocator::Offset FencedAllocator::Alloc(uint32_t size) {
+  // Try first to allocate in a free block.
+  Offset offset = AllocWithoutWaiting(size);
+  if (offset != kInvalidOffset || size == 0) {
+    return offset;
+  }
+
+  uint32_t aligned_size = 0;
+  if (!RoundUp(size).AssignIfValid(&aligned_size)) {
+    return kInvalidOffset;
+  }
+
+  // No free block is available. Look for blocks pending tokens, and wait for
+  // them to be re-usable.
+  for (uint32_t i = 0; i < blocks_.size(); ++i) {
+    if (blocks_[i].state != FREE_PENDING_TOKEN)
+      continue;
+    i = WaitForTokenAndFreeBlock(i);
+    if (blocks_[i].size >= aligned_size)
+      return AllocInBlock(i, aligned_size);
+  }
+  return kInvalidOffset;
+}
+
+// Looks for a FREE block that is big enough, first-fit.
+FencedAllocator::Offset FencedAllocator::AllocWithoutWaiting(uint32_t size) {
   // size of 0 is not allowed because it would be inconsistent to only sometimes
   // have it succeed. Example: Alloc(SizeOfBuffer), Alloc(0).
   if (size == 0)  {
@@ -62,23 +87,12 @@ FencedAllocator::Offset FencedAllocator::Alloc(uint32_t size) {
     return kInvalidOffset;
   }
 
-  // Try first to allocate in a free block.
   for (uint32_t i = 0; i < blocks_.size(); ++i) {
     Block &block = blocks_[i];
     if (block.state == FREE && block.size >= aligned_size) {
       return AllocInBlock(i, aligned_size);
     }
   }
-
-  // No free block is available. Look for blocks pending tokens, and wait for
-  // them to be re-usable.
-  for (uint32_t i = 0; i < blocks_.size(); ++i) {
-    if (blocks_[i].state != FREE_PENDING_TOKEN)
-      continue;
-    i = WaitForTokenAndFreeBlock(i);
-    if (blocks_[i].size >= aligned_size)
-      return AllocInBlock(i, aligned_size);
-  }
   return kInvalidOffset;
 }
 
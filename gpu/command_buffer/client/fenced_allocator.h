@@ -65,6 +65,11 @@ class GPU_EXPORT FencedAllocator {
   //   memory.
   Offset Alloc(uint32_t size);
 
+  // Like Alloc(), but only uses blocks that are free now: it returns
+  // kInvalidOffset rather than waiting for blocks freed pending a token. This
+  // is cheaper than checking GetLargestFreeSize() before calling Alloc().
+  Offset AllocWithoutWaiting(uint32_t size);
+
   // Frees a block of memory.
   //
   // Parameters:
@@ -181,6 +186,12 @@ class FencedAllocatorWrapper {
     return GetPointer(offset);
   }
 
+  // Like Alloc(), but returns nullptr rather than waiting for memory that was
+  // freed pending a token.
+  void* AllocWithoutWaiting(uint32_t size) {
+    return GetPointer(allocator_.AllocWithoutWaiting(size));
+  }
+
   // Allocates a block of memory. If the buffer is out of directly available
   // memory, this function may wait until memory that was freed "pending a
   // token" can be re-used.
@@ -201,6 +201,50 @@ TEST_F(FencedAllocatorTest, TestFreePendingToken) {
   }
 }
 
+// Checks that AllocWithoutWaiting doesn't wait for pending tokens.
+TEST_F(FencedAllocatorTest, TestAllocWithoutWaiting) {
+  const unsigned int kSize = 16;
+  const unsigned int kAllocCount = kBufferSize / kSize;
+  CHECK_EQ(kAllocCount * kSize, kBufferSize);
+
+  EXPECT_EQ(FencedAllocator::kInvalidOffset,
+            allocator_->AllocWithoutWaiting(0));
+
+  // Allocate several buffers to fill in the memory.
+  FencedAllocator::Offset offsets[kAllocCount];
+  for (unsigned int i = 0; i < kAllocCount; ++i) {
+    offsets[i] = allocator_->AllocWithoutWaiting(kSize);
+    EXPECT_NE(FencedAllocator::kInvalidOffset, offsets[i]);
+    EXPECT_TRUE(allocator_->CheckConsistency());
+  }
+
+  // Free one allocation pending a token, which hasn't passed yet.
+  int32_t token = helper_.get()->InsertToken();
+  allocator_->FreePendingToken(offsets[0], token);
+  EXPECT_GT(token, GetToken());
+
+  // The pending block can't be used without waiting for the token.
+  EXPECT_EQ(FencedAllocator::kInvalidOffset,
+            allocator_->AllocWithoutWaiting(kSize));
+  EXPECT_GT(token, GetToken());
+
+  offsets[0] = allocator_->Alloc(kSize);
+  EXPECT_NE(FencedAllocator::kInvalidOffset, offsets[0]);
+  EXPECT_LE(token, GetToken());
+
+  // A freed block can be used right away.
+  allocator_->Free(offsets[1]);
+  offsets[1] = allocator_->AllocWithoutWaiting(kSize);
+  EXPECT_NE(FencedAllocator::kInvalidOffset, offsets[1]);
+  EXPECT_TRUE(allocator_->CheckConsistency());
+
+  // Free up everything.
+  for (unsigned int i = 0; i < kAllocCount; ++i) {
+    allocator_->Free(offsets[i]);
+    EXPECT_TRUE(allocator_->CheckConsistency());
+  }
+}
+
 // Checks the free-pending-token mechanism using FreeUnused
 TEST_F(FencedAllocatorTest, FreeUnused) {
   EXPECT_TRUE(allocator_->CheckConsistency());
@@ -67,13 +67,14 @@ void* MappedMemoryManager::Alloc(unsigned int size,
   DCHECK(shm_offset);
   if (size <= allocated_memory_) {
     size_t total_bytes_in_use = 0;
-    // See if any of the chunks can satisfy this request.
+    // See if any of the chunks can satisfy this request. Trying the
+    // allocation directly walks each chunk's blocks once, rather than once
+    // more to find the largest free block first.
     for (auto& chunk : chunks_) {
       chunk->FreeUnused();
       total_bytes_in_use += chunk->bytes_in_use();
-      if (chunk->GetLargestFreeSizeWithoutWaiting() >= size) {
-        void* mem = chunk->Alloc(size);
-        DCHECK(mem);
+      void* mem = chunk->AllocWithoutWaiting(size);
+      if (mem) {
         *shm_id = chunk->shm_id();
         *shm_offset = chunk->GetOffset(mem);
         return mem;
@@ -66,6 +66,12 @@ class GPU_EXPORT MemoryChunk {
   //   memory.
   void* Alloc(uint32_t size) { return allocator_.Alloc(size); }
 
+  // Allocates a block of memory only if one is available without waiting.
+  // Returns nullptr otherwise.
+  void* AllocWithoutWaiting(uint32_t size) {
+    return allocator_.AllocWithoutWaiting(size);
+  }
+
   // Gets the offset to a memory block given the base memory and the address.
   // It translates nullptr to FencedAllocator::kInvalidOffset.
   uint32_t GetOffset(void* pointer) { return allocator_.GetOffset(pointer); }
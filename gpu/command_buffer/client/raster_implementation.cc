@@ -1498,15 +1498,17 @@ void RasterImplementation::RasterCHROMIUM(const cc::DisplayItemList* list,
                                   &transfer_cache_serialize_helper,
                                   &font_manager_, max_op_size_hint);
 
-  cc::PaintOpBufferSerializer serializer(
-      PaintOpSerializer::Serialize, &op_serializer,
-      cc::PaintOp::SerializeOptions(
-          &stashing_image_provider, &transfer_cache_serialize_helper,
-          GetOrCreatePaintCache(), font_manager_.strike_server(),
-          raster_properties_->color_space, &skottie_serialization_history_,
-          raster_properties_->can_use_lcd_text,
-          capabilities().context_supports_distance_field_text,
-          capabilities().max_texture_size));
+  cc::PaintOp::SerializeOptions options(
+      &stashing_image_provider, &transfer_cache_serialize_helper,
+      GetOrCreatePaintCache(), font_manager_.strike_server(),
+      raster_properties_->color_space, &skottie_serialization_history_,
+      raster_properties_->can_use_lcd_text,
+      capabilities().context_supports_distance_field_text,
+      capabilities().max_texture_size);
+  // PaintOpSerializer finalizes or aborts the paint cache entries of every op.
+  options.use_paint_cache_for_flags = true;
+  cc::PaintOpBufferSerializer serializer(PaintOpSerializer::Serialize,
+                                         &op_serializer, options);
   serializer.Serialize(list->paint_op_buffer_, &temp_raster_offsets_, preamble);
   // TODO(piman): raise error if !serializer.valid()?
   op_serializer.SendSerializedData();
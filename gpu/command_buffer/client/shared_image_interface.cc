@@ -30,6 +30,18 @@ SharedImageInterface::SharedImageInterface()
     : holder_(base::MakeRefCounted<SharedImageInterfaceHolder>(this)) {}
 SharedImageInterface::~SharedImageInterface() = default;
 
+std::vector<scoped_refptr<ClientSharedImage>>
+SharedImageInterface::CreateSharedImages(
+    base::span<const SharedImageInfo> si_infos,
+    gpu::SurfaceHandle surface_handle) {
+  std::vector<scoped_refptr<ClientSharedImage>> shared_images;
+  shared_images.reserve(si_infos.size());
+  for (const SharedImageInfo& si_info : si_infos) {
+    shared_images.push_back(CreateSharedImage(si_info, surface_handle));
+  }
+  return shared_images;
+}
+
 scoped_refptr<ClientSharedImage> SharedImageInterface::CreateSharedImage(
     const SharedImageInfo& si_info,
     gpu::SurfaceHandle surface_handle,
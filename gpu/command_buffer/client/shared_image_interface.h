@@ -5,6 +5,8 @@
 #ifndef GPU_COMMAND_BUFFER_CLIENT_SHARED_IMAGE_INTERFACE_H_
 #define GPU_COMMAND_BUFFER_CLIENT_SHARED_IMAGE_INTERFACE_H_
 
+#include <vector>
+
 #include "base/compiler_specific.h"
 #include "base/containers/span.h"
 #include "base/memory/raw_ptr.h"
@@ -126,6 +128,15 @@ class GPU_EXPORT SharedImageInterface
       const SharedImageInfo& si_info,
       gpu::SurfaceHandle surface_handle) = 0;
 
+  // Same behavior as calling the above for each of |si_infos|, in order.
+  // Implementations may create the images together, e.g. in a single task and
+  // with a single sync token, which is cheaper for callers that allocate many
+  // images at once such as tile pools. The returned images are in the same
+  // order as |si_infos|.
+  virtual std::vector<scoped_refptr<ClientSharedImage>> CreateSharedImages(
+      base::span<const SharedImageInfo> si_infos,
+      gpu::SurfaceHandle surface_handle);
+
   // Same behavior as the above, except that this version takes |pixel_data|
   // which is used to populate the SharedImage.  |pixel_data| should have the
   // same format which would be passed to glTexImage2D to populate a similarly
@@ -120,15 +120,17 @@ void GrShaderCache::PopulateCache(const std::string& key,
     return;
   }
 
-  EnforceLimits(data.size());
-
   // If we already have this in the cache, skia may have stored it before it
   // was loaded off the disk cache. Its better to keep the latest version
-  // generated version than overwriting it here.
+  // generated version than overwriting it here. Check this before making room
+  // for the entry, so that a full cache doesn't evict its other entries for a
+  // shader it already has.
   if (store_.Get(cache_key) != store_.end()) {
     return;
   }
 
+  EnforceLimits(data.size());
+
   CacheData cache_data(MakeData(data));
   auto it = AddToCache(cache_key, std::move(cache_data));
 
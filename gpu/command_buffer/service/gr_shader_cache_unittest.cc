@@ -184,6 +184,37 @@ TEST_F(GrShaderCacheTest, PopulateFromDiskAfterStoring) {
   EXPECT_EQ(disk_cache_.size(), 1u);
 }
 
+TEST_F(GrShaderCacheTest, PopulateExistingEntryDoesNotEvict) {
+  int32_t regular_client_id = 3;
+  cache_.CacheClientIdOnDisk(regular_client_id);
+
+  auto key = SkData::MakeWithCopy(kShaderKey, strlen(kShaderKey));
+  auto second_key = SkData::MakeWithCString("key2");
+  auto shader = SkData::MakeUninitialized(kCacheLimit / 2);
+  {
+    GrShaderCache::ScopedCacheUse cache_use(&cache_, regular_client_id);
+    cache_.store(*key, *shader);
+    cache_.store(*second_key, *shader);
+  }
+  EXPECT_EQ(cache_.num_cache_entries(), 2u);
+  EXPECT_EQ(cache_.curr_size_bytes_for_testing(), kCacheLimit);
+
+  // The cache is full, but the disk copy of an entry it already has doesn't
+  // need any room.
+  std::string key_str(static_cast<const char*>(second_key->data()),
+                      second_key->size());
+  std::string shader_str(static_cast<const char*>(shader->data()),
+                         shader->size());
+  cache_.PopulateCache(base::Base64Encode(key_str), shader_str);
+  EXPECT_EQ(cache_.num_cache_entries(), 2u);
+  EXPECT_EQ(cache_.curr_size_bytes_for_testing(), kCacheLimit);
+  {
+    GrShaderCache::ScopedCacheUse cache_use(&cache_, regular_client_id);
+    EXPECT_NE(cache_.load(*key), nullptr);
+    EXPECT_NE(cache_.load(*second_key), nullptr);
+  }
+}
+
 // This test creates GrShaderCache::ScopedCacheUse object from 2 different
 // thread which exists together. In a non thread safe GrShaderCache, this will
 // hit DCHECKS in ScopedCacheUse::ScopedCacheUse() since the current_client_id
@@ -651,12 +651,11 @@ void Scheduler::TryScheduleSequence(Sequence* sequence) {
     // Rebuild scheduling queue if priority changed for a scheduled sequence.
     DCHECK(thread_state.running);
     DCHECK(sequence->IsRunnable());
-    per_thread_state_map_[task_runner].rebuild_scheduling_queue = true;
+    thread_state.rebuild_scheduling_queue = true;
   } else if (!sequence->scheduled() && sequence->IsRunnable()) {
     // Insert into scheduling queue if sequence isn't already scheduled.
     SchedulingState scheduling_state = sequence->SetScheduled();
-    auto& scheduling_queue =
-        per_thread_state_map_[task_runner].scheduling_queue;
+    auto& scheduling_queue = thread_state.scheduling_queue;
     scheduling_queue.push_back(scheduling_state);
     std::push_heap(scheduling_queue.begin(), scheduling_queue.end(),
                    &SchedulingState::Comparator);
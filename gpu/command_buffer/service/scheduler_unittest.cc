@@ -11,6 +11,7 @@
 #include "base/task/single_thread_task_runner.h"
 #include "base/test/task_environment.h"
 #include "base/test/test_simple_task_runner.h"
+#include "base/threading/thread.h"
 #include "base/time/time.h"
 #include "gpu/command_buffer/service/sync_point_manager.h"
 #include "gpu/config/gpu_finch_features.h"
@@ -529,6 +530,53 @@ TEST_F(SchedulerTest, ReleaseSequenceShouldYield) {
   scheduler()->DestroySequence(sequence_id2);
 }
 
+TEST_F(SchedulerTest, SequencesOnDifferentThreadsWaitOnEachOther) {
+  base::Thread worker_thread("GpuSchedulerWorker");
+  ASSERT_TRUE(worker_thread.Start());
+
+  // Each sequence runs on the thread it was created for, and a wait on a sync
+  // token released by a sequence on another thread is still honored.
+  SequenceId worker_sequence_id = scheduler()->CreateSequence(
+      SchedulingPriority::kNormal, worker_thread.task_runner());
+  CommandBufferNamespace namespace_id = CommandBufferNamespace::GPU_IO;
+  CommandBufferId command_buffer_id = CommandBufferId::FromUnsafeValue(1);
+  scoped_refptr<SyncPointClientState> release_state =
+      sync_point_manager()->CreateSyncPointClientState(
+          namespace_id, command_buffer_id, worker_sequence_id);
+
+  uint64_t release = 1;
+  SyncToken sync_token(namespace_id, command_buffer_id, release);
+  SequenceId main_sequence_id = scheduler()->CreateSequence(
+      SchedulingPriority::kHigh,
+      base::SingleThreadTaskRunner::GetCurrentDefault());
+  bool main_ran = false;
+  scheduler()->ScheduleTask(Scheduler::Task(
+      main_sequence_id, GetClosure([&] {
+        EXPECT_TRUE(task_environment_.GetMainThreadTaskRunner()
+                        ->BelongsToCurrentThread());
+        EXPECT_TRUE(sync_point_manager()->IsSyncTokenReleased(sync_token));
+        main_ran = true;
+        run_loop_.Quit();
+      }),
+      {sync_token}));
+
+  scheduler()->ScheduleTask(Scheduler::Task(
+      worker_sequence_id, GetClosure([&] {
+        EXPECT_TRUE(worker_thread.task_runner()->BelongsToCurrentThread());
+        EXPECT_FALSE(main_ran);
+        release_state->ReleaseFenceSync(release);
+      }),
+      std::vector<SyncToken>()));
+
+  run_loop_.Run();
+  EXPECT_TRUE(main_ran);
+
+  worker_thread.Stop();
+  release_state->Destroy();
+  scheduler()->DestroySequence(worker_sequence_id);
+  scheduler()->DestroySequence(main_sequence_id);
+}
+
 TEST_F(SchedulerTest, ReentrantEnableSequenceShouldNotDeadlock) {
   SequenceId sequence_id1 =
       scheduler()->CreateSequenceForTesting(SchedulingPriority::kHigh);
@@ -257,6 +257,68 @@ void SharedImageInterfaceInProcess::CreateSharedImageOnGpuThread(
   sync_point_client_state_->ReleaseFenceSync(sync_token.release_count());
 }
 
+std::vector<scoped_refptr<ClientSharedImage>>
+SharedImageInterfaceInProcess::CreateSharedImages(
+    base::span<const SharedImageInfo> si_infos,
+    gpu::SurfaceHandle surface_handle) {
+  std::vector<Mailbox> mailboxes;
+  mailboxes.reserve(si_infos.size());
+  for (const SharedImageInfo& si_info : si_infos) {
+    DCHECK(gpu::IsValidClientUsage(si_info.meta.usage));
+    mailboxes.push_back(Mailbox::GenerateForSharedImage());
+  }
+  {
+    base::AutoLock lock(lock_);
+    // All the images are created by one task, which releases one fence sync
+    // once they all exist. See CreateSharedImage() above.
+    ScheduleGpuTask(
+        base::BindOnce(
+            &SharedImageInterfaceInProcess::CreateSharedImagesOnGpuThread,
+            base::Unretained(this), mailboxes,
+            std::vector<SharedImageInfo>(si_infos.begin(), si_infos.end()),
+            surface_handle, MakeSyncToken(next_fence_sync_release_++)),
+        {});
+  }
+
+  SyncToken sync_token = GenUnverifiedSyncToken();
+  std::vector<scoped_refptr<ClientSharedImage>> shared_images;
+  shared_images.reserve(si_infos.size());
+  for (size_t i = 0; i < si_infos.size(); ++i) {
+    shared_images.push_back(base::MakeRefCounted<ClientSharedImage>(
+        mailboxes[i], si_infos[i].meta, sync_token, holder_,
+        gfx::EMPTY_BUFFER));
+  }
+  return shared_images;
+}
+
+void SharedImageInterfaceInProcess::CreateSharedImagesOnGpuThread(
+    std::vector<Mailbox> mailboxes,
+    std::vector<SharedImageInfo> si_infos,
+    gpu::SurfaceHandle surface_handle,
+    const SyncToken& sync_token) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(gpu_sequence_checker_);
+  DCHECK_EQ(mailboxes.size(), si_infos.size());
+  if (!LazyCreateSharedImageFactory())
+    return;
+
+  if (!MakeContextCurrent())
+    return;
+
+  DCHECK(shared_image_factory_);
+  for (size_t i = 0; i < mailboxes.size(); ++i) {
+    const SharedImageInfo& si_info = si_infos[i];
+    if (!shared_image_factory_->CreateSharedImage(
+            mailboxes[i], si_info.meta.format, si_info.meta.size,
+            si_info.meta.color_space, si_info.meta.surface_origin,
+            si_info.meta.alpha_type, surface_handle, si_info.meta.usage,
+            std::string(si_info.debug_label))) {
+      context_state_->MarkContextLost();
+      return;
+    }
+  }
+  sync_point_client_state_->ReleaseFenceSync(sync_token.release_count());
+}
+
 scoped_refptr<ClientSharedImage>
 SharedImageInterfaceInProcess::CreateSharedImage(
     const SharedImageInfo& si_info,
@@ -69,6 +69,9 @@ class GPU_GLES2_EXPORT SharedImageInterfaceInProcess
   scoped_refptr<ClientSharedImage> CreateSharedImage(
       const SharedImageInfo& si_info,
       gpu::SurfaceHandle surface_handle) override;
+  std::vector<scoped_refptr<ClientSharedImage>> CreateSharedImages(
+      base::span<const SharedImageInfo> si_infos,
+      gpu::SurfaceHandle surface_handle) override;
   scoped_refptr<ClientSharedImage> CreateSharedImage(
       const SharedImageInfo& si_info,
       base::span<const uint8_t> pixel_data) override;
@@ -166,6 +169,10 @@ class GPU_GLES2_EXPORT SharedImageInterfaceInProcess
                                     SharedImageInfo si_info,
                                     gpu::SurfaceHandle surface_handle,
                                     const SyncToken& sync_token);
+  void CreateSharedImagesOnGpuThread(std::vector<Mailbox> mailboxes,
+                                     std::vector<SharedImageInfo> si_infos,
+                                     gpu::SurfaceHandle surface_handle,
+                                     const SyncToken& sync_token);
   void CreateSharedImageWithDataOnGpuThread(const Mailbox& mailbox,
                                             SharedImageInfo si_info,
                                             const SyncToken& sync_token,
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "media/gpu/macros.h"
 #include "media/gpu/vaapi/va_surface.h"
 #include "media/gpu/vaapi/vaapi_utils.h"
@@ -59,6 +60,53 @@ VaapiImageDecodeStatus VaapiImageDecoder::Decode(
   return VaapiImageDecodeStatus::kSuccess;
 }
 
+bool VaapiImageDecoder::MaybeCreateContextAndSurface(
+    unsigned int va_rt_format,
+    const gfx::Size& coded_size,
+    const std::optional<gfx::Size>& visible_size) {
+  DCHECK(vaapi_wrapper_);
+  DCHECK(!scoped_va_context_and_surface_ ||
+         scoped_va_context_and_surface_->IsValid());
+  if (scoped_va_context_and_surface_ &&
+      visible_size.value_or(coded_size) ==
+          scoped_va_context_and_surface_->size() &&
+      va_rt_format == scoped_va_context_and_surface_->format()) {
+    // No need to allocate a new surface. We can re-use the current one.
+    return true;
+  }
+
+  // Destroys the VAContext along with the surface, if any.
+  scoped_va_context_and_surface_.reset();
+
+  std::vector<std::unique_ptr<ScopedVASurface>> scoped_va_surfaces;
+  const bool reuse_va_context =
+      vaapi_wrapper_->HasContext() && va_context_size_ == coded_size;
+  if (reuse_va_context) {
+    scoped_va_surfaces = vaapi_wrapper_->CreateScopedVASurfaces(
+        va_rt_format, coded_size, {VaapiWrapper::SurfaceUsageHint::kGeneric},
+        1u, visible_size, /*va_fourcc=*/std::nullopt);
+  } else {
+    if (vaapi_wrapper_->HasContext())
+      vaapi_wrapper_->DestroyContext();
+    scoped_va_surfaces = vaapi_wrapper_->CreateContextAndScopedVASurfaces(
+        va_rt_format, coded_size, {VaapiWrapper::SurfaceUsageHint::kGeneric},
+        1u, visible_size);
+    va_context_size_ = coded_size;
+  }
+  if (scoped_va_surfaces.empty()) {
+    VLOGF(1) << "Failed to create a ScopedVASurface";
+    if (vaapi_wrapper_->HasContext())
+      vaapi_wrapper_->DestroyContext();
+    return false;
+  }
+  base::UmaHistogramBoolean("Media.VaapiImageDecoder.ReusedVAContext",
+                            reuse_va_context);
+
+  scoped_va_context_and_surface_.reset(scoped_va_surfaces[0].release());
+  DCHECK(scoped_va_context_and_surface_->IsValid());
+  return true;
+}
+
 const ScopedVASurface* VaapiImageDecoder::GetScopedVASurface() const {
   return scoped_va_context_and_surface_.get();
 }
@@ -97,9 +145,11 @@ VaapiImageDecoder::ExportAsNativePixmapDmaBuf(VaapiImageDecodeStatus* status) {
   // doesn't attempt to use the same ScopedVASurface. Otherwise, it could
   // overwrite the result of the current decode before it's used by the caller.
   // This ScopedVASurface will self-clean at the end of this scope, but the
-  // underlying buffer should stay alive because of the exported FDs.
-  ScopedVAContextAndSurface temp_scoped_va_surface =
-      std::move(scoped_va_context_and_surface_);
+  // underlying buffer should stay alive because of the exported FDs. The
+  // VAContext is left alive so that MaybeCreateContextAndSurface() can reuse
+  // it for the next image.
+  std::unique_ptr<ScopedVASurface> temp_scoped_va_surface(
+      scoped_va_context_and_surface_.release());
 
   if (!temp_scoped_va_surface) {
     DVLOGF(1) << "No decoded image available";
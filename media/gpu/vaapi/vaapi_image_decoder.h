@@ -9,12 +9,14 @@
 #include <va/va.h>
 
 #include <memory>
+#include <optional>
 
 #include "base/containers/span.h"
 #include "base/functional/callback_forward.h"
 #include "base/memory/scoped_refptr.h"
 #include "gpu/config/gpu_info.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
+#include "ui/gfx/geometry/size.h"
 
 namespace gfx {
 class NativePixmapDmaBuf;
@@ -101,6 +103,17 @@ class VaapiImageDecoder {
  protected:
   explicit VaapiImageDecoder(VAProfile va_profile);
 
+  // Makes |scoped_va_context_and_surface_| hold a surface of |va_rt_format|
+  // and |coded_size|, whose reported size is |visible_size| if supplied or
+  // |coded_size| otherwise. The current surface is kept if it already matches.
+  // Otherwise, the VAContext left behind by ExportAsNativePixmapDmaBuf() is
+  // reused if it was created for the same |coded_size|, so that decoding a
+  // sequence of same-sized images only allocates a new surface for each one.
+  bool MaybeCreateContextAndSurface(
+      unsigned int va_rt_format,
+      const gfx::Size& coded_size,
+      const std::optional<gfx::Size>& visible_size);
+
   ScopedVAContextAndSurface scoped_va_context_and_surface_;
 
   scoped_refptr<VaapiWrapper> vaapi_wrapper_;
@@ -115,6 +128,9 @@ class VaapiImageDecoder {
 
   // The VA profile used for the current image decoder.
   const VAProfile va_profile_;
+
+  // Size the current VAContext of |vaapi_wrapper_| was created for, if any.
+  gfx::Size va_context_size_;
 };
 
 }  // namespace media
@@ -306,32 +306,12 @@ std::unique_ptr<ScopedVAImage> VaapiJpegDecoder::GetImage(
 bool VaapiJpegDecoder::MaybeCreateSurface(unsigned int picture_va_rt_format,
                                           const gfx::Size& new_coded_size,
                                           const gfx::Size& new_visible_size) {
-  DCHECK(!scoped_va_context_and_surface_ ||
-         scoped_va_context_and_surface_->IsValid());
-  if (scoped_va_context_and_surface_ &&
-      new_visible_size == scoped_va_context_and_surface_->size() &&
-      picture_va_rt_format == scoped_va_context_and_surface_->format()) {
-    // No need to allocate a new surface. We can re-use the current one.
-    return true;
-  }
-
-  scoped_va_context_and_surface_.reset();
-
   // We'll request a surface of |new_coded_size| from the VAAPI, but we will
   // keep track of the |new_visible_size| inside the ScopedVASurface so that
   // when we create a VAImage or export the surface as a NativePixmapDmaBuf, we
   // can report the size that clients should be using to read the contents.
-  auto scoped_va_surfaces = vaapi_wrapper_->CreateContextAndScopedVASurfaces(
-      picture_va_rt_format, new_coded_size,
-      {VaapiWrapper::SurfaceUsageHint::kGeneric}, 1u, new_visible_size);
-  if (scoped_va_surfaces.empty()) {
-    VLOGF(1) << "CreateContextAndScopedVASurface() failed";
-    return false;
-  }
-
-  scoped_va_context_and_surface_.reset(scoped_va_surfaces[0].release());
-  DCHECK(scoped_va_context_and_surface_->IsValid());
-  return true;
+  return MaybeCreateContextAndSurface(picture_va_rt_format, new_coded_size,
+                                      new_visible_size);
 }
 
 bool VaapiJpegDecoder::SubmitBuffers(const JpegParseResult& parse_result) {
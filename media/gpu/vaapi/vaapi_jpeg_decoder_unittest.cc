@@ -562,6 +562,18 @@ TEST_P(VaapiJpegDecoderWithDmaBufsTest, DecodeSucceeds) {
 
   EXPECT_TRUE(vaapi_test_utils::CompareImages(*sw_decoded_jpeg, *decoded_image,
                                               kMinSsim));
+
+  // Decoding the same image again reuses the VAContext left behind by the
+  // export and must produce a new, exportable surface.
+  EXPECT_EQ(VaapiImageDecodeStatus::kSuccess, Decoder()->Decode(encoded_image));
+  ASSERT_TRUE(Decoder()->GetScopedVASurface());
+  EXPECT_EQ(va_surface_visible_size, Decoder()->GetScopedVASurface()->size());
+  std::unique_ptr<NativePixmapAndSizeInfo> second_exported_pixmap =
+      Decoder()->ExportAsNativePixmapDmaBuf(&export_status);
+  EXPECT_EQ(VaapiImageDecodeStatus::kSuccess, export_status);
+  ASSERT_TRUE(second_exported_pixmap);
+  EXPECT_EQ(va_surface_visible_size,
+            second_exported_pixmap->pixmap->GetBufferSize());
 }
 
 // Make sure that JPEGs whose size is below the supported size range are
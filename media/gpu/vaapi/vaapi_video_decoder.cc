@@ -159,6 +159,7 @@ VaapiVideoDecoder::~VaapiVideoDecoder() {
   if (vaapi_wrapper_) {
     vaapi_wrapper_->DestroyContext();
     allocated_va_surfaces_.clear();
+    allocated_va_surfaces_format_ = std::nullopt;
 
     DCHECK(vaapi_wrapper_->HasOneRef());
     vaapi_wrapper_ = nullptr;
@@ -199,6 +200,7 @@ void VaapiVideoDecoder::Initialize(const VideoDecoderConfig& config,
     // To clear |allocated_va_surfaces_|, we have to first DestroyContext().
     vaapi_wrapper_->DestroyContext();
     allocated_va_surfaces_.clear();
+    allocated_va_surfaces_format_ = std::nullopt;
 
     DCHECK(vaapi_wrapper_->HasOneRef());
     vaapi_wrapper_ = nullptr;
@@ -447,6 +449,7 @@ void VaapiVideoDecoder::HandleDecodeTask() {
           CHECK(!!vaapi_wrapper_);
           CHECK(!vaapi_wrapper_->HasContext());
           allocated_va_surfaces_.clear();
+          allocated_va_surfaces_format_ = std::nullopt;
           const gfx::Size decoder_pic_size = decoder_->GetPicSize();
           if (decoder_pic_size.IsEmpty()) {
             SetErrorState("|decoder_| returned an empty picture size");
@@ -666,10 +669,25 @@ void VaapiVideoDecoder::ApplyResolutionChangeWithScreenSizes(
   // resolution change, so we can safely DestroyContext() here; that, in turn,
   // allows for clearing the |allocated_va_surfaces_|.
   vaapi_wrapper_->DestroyContext();
-  allocated_va_surfaces_.clear();
 
   const gfx::Rect decoder_visible_rect = decoder_->GetVisibleRect();
   const gfx::Size decoder_pic_size = decoder_->GetPicSize();
+
+  // VAContexts are created without a list of render targets, so the imported
+  // surfaces survive a context re-creation. If the frame pool is going to be
+  // re-initialized with the same layout it keeps its frames, hence keep their
+  // VASurfaces too instead of re-importing every frame after e.g. a
+  // mid-stream config change that doesn't alter the picture geometry.
+  const bool can_reuse_va_surfaces =
+      profile_ == decoder_->GetProfile() &&
+      allocated_va_surfaces_format_ == *format &&
+      allocated_va_surfaces_pic_size_ == decoder_pic_size &&
+      allocated_va_surfaces_visible_rect_ == decoder_visible_rect;
+  if (!can_reuse_va_surfaces) {
+    allocated_va_surfaces_.clear();
+    allocated_va_surfaces_format_ = std::nullopt;
+  }
+
   if (decoder_pic_size.IsEmpty()) {
     SetErrorState("|decoder_| returned an empty picture size");
     return;
@@ -826,6 +844,10 @@ void VaapiVideoDecoder::ApplyResolutionChangeWithScreenSizes(
       /*need_aux_frame_pool=*/true, std::move(allocator));
 
   if (!status_or_layout.has_value()) {
+    // The frame pool may have dropped its frames, so don't keep their
+    // VASurfaces around.
+    allocated_va_surfaces_.clear();
+    allocated_va_surfaces_format_ = std::nullopt;
     if (status_or_layout == CroStatus::Codes::kResetRequired) {
       DVLOGF(2) << "The frame pool initialization is aborted";
       SetState(State::kExpectingReset);
@@ -836,6 +858,10 @@ void VaapiVideoDecoder::ApplyResolutionChangeWithScreenSizes(
     return;
   }
 
+  allocated_va_surfaces_format_ = *format;
+  allocated_va_surfaces_pic_size_ = decoder_pic_size;
+  allocated_va_surfaces_visible_rect_ = decoder_visible_rect;
+
   DCHECK(current_decode_task_);
   // Retry the current decode task.
   SetState(State::kDecoding);
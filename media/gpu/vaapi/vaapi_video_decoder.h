@@ -241,6 +241,13 @@ class VaapiVideoDecoder : public VideoDecoderMixin,
   // TODO(crbug.com/1040291): remove this keep-alive when using SharedImages.
   base::small_map<std::map<gfx::GpuMemoryBufferId, scoped_refptr<VASurface>>>
       allocated_va_surfaces_;
+  // Pixel format and geometry of the frame pool the |allocated_va_surfaces_|
+  // were created for, used to keep them across a resolution change that
+  // doesn't alter any of these. |allocated_va_surfaces_format_| is unset when
+  // the surfaces can't be reused.
+  std::optional<VideoPixelFormat> allocated_va_surfaces_format_;
+  gfx::Size allocated_va_surfaces_pic_size_;
+  gfx::Rect allocated_va_surfaces_visible_rect_;
 
   // We need to use a CdmContextRef so that we destruct
   // |cdm_event_cb_registration_| before the CDM is destructed. The CDM has
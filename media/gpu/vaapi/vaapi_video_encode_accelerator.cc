@@ -22,6 +22,7 @@
 #include "base/memory/ptr_util.h"
 #include "base/memory/shared_memory_mapping.h"
 #include "base/memory/unsafe_shared_memory_region.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/numerics/safe_conversions.h"
 #include "base/strings/strcat.h"
 #include "base/strings/stringprintf.h"
@@ -31,6 +32,7 @@
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
 #include "base/trace_event/memory_dump_manager.h"
+#include "base/time/time.h"
 #include "base/trace_event/trace_event.h"
 #include "build/build_config.h"
 #include "media/base/format_utils.h"
@@ -919,6 +921,7 @@ void VaapiVideoEncodeAccelerator::EncodePendingInputs() {
       jobs.emplace_back(std::move(job));
     }
 
+    const base::TimeTicks encode_start_time = base::TimeTicks::Now();
     for (auto& job : jobs) {
       TRACE_EVENT_NESTABLE_ASYNC_BEGIN0("media,gpu", "PlatformEncoding.Encode",
                                         TRACE_ID_LOCAL(&job));
@@ -945,6 +948,13 @@ void VaapiVideoEncodeAccelerator::EncodePendingInputs() {
 
       pending_encode_results_.push(std::move(result));
     }
+    // The delegate has synced on the output of every layer of |input_frame|
+    // at this point, so this covers submission plus hardware encode time.
+    base::UmaHistogramCustomMicrosecondsTimes(
+        base::StrCat({"Media.VaapiVideoEncodeAccelerator.EncodeLatency.",
+                      GetCodecName(output_codec_)}),
+        base::TimeTicks::Now() - encode_start_time, base::Microseconds(100),
+        base::Milliseconds(500), 50);
 
     // Invalidates |input_frame| here; it notifies a client |input_frame.frame|
     // can be reused for the future encoding.
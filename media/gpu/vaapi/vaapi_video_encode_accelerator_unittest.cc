@@ -12,6 +12,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/run_loop.h"
 #include "base/test/gmock_callback_support.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/task_environment.h"
 #include "build/chromeos_buildflags.h"
 #include "media/base/media_util.h"
@@ -753,9 +754,14 @@ TEST_P(VaapiVideoEncodeAcceleratorTest, EncodeVP9WithSingleSpatialLayer) {
   config.spatial_layers.push_back(spatial_layer);
   SetDefaultMocksBehavior(config);
 
+  base::HistogramTester histogram_tester;
   InitializeSequenceForVP9(config);
   EncodeSequenceForVP9SingleSpatialLayer(spatial_layer.num_of_temporal_layers >
                                          1u);
+  EXPECT_FALSE(
+      histogram_tester
+          .GetAllSamples("Media.VaapiVideoEncodeAccelerator.EncodeLatency.vp9")
+          .empty());
 }
 
 // This test verifies VP9 multiple spaital layers encoding in native input mode.
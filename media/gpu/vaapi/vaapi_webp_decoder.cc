@@ -98,25 +98,11 @@ VaapiImageDecodeStatus VaapiWebPDecoder::AllocateVASurfaceAndSubmitVABuffers(
   const gfx::Size new_visible_size(
       base::strict_cast<int>(parse_result->width),
       base::strict_cast<int>(parse_result->height));
-  DCHECK(!scoped_va_context_and_surface_ ||
-         scoped_va_context_and_surface_->IsValid());
   DCHECK(!scoped_va_context_and_surface_ ||
          (scoped_va_context_and_surface_->format() == kWebPVARtFormat));
-  if (!scoped_va_context_and_surface_ ||
-      new_visible_size != scoped_va_context_and_surface_->size()) {
-    scoped_va_context_and_surface_.reset();
-    auto scoped_va_surfaces = vaapi_wrapper_->CreateContextAndScopedVASurfaces(
-        kWebPVARtFormat, new_visible_size,
-        {VaapiWrapper::SurfaceUsageHint::kGeneric}, 1u,
-        /*visible_size=*/std::nullopt);
-    if (scoped_va_surfaces.empty()) {
-      VLOGF(1) << "CreateContextAndScopedVASurface() failed";
-      return VaapiImageDecodeStatus::kSurfaceCreationFailed;
-    }
-
-    scoped_va_context_and_surface_ =
-        ScopedVAContextAndSurface(scoped_va_surfaces[0].release());
-    DCHECK(scoped_va_context_and_surface_->IsValid());
+  if (!MaybeCreateContextAndSurface(kWebPVARtFormat, new_visible_size,
+                                    /*visible_size=*/std::nullopt)) {
+    return VaapiImageDecodeStatus::kSurfaceCreationFailed;
   }
   DCHECK_NE(scoped_va_context_and_surface_->id(), VA_INVALID_SURFACE);
 
@@ -28,6 +28,8 @@ extern const base::FeatureParam<bool> kMojoLinuxChannelSharedMemEfdZeroOnWake;
 #endif  // BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS) ||
         // BUILDFLAG(IS_ANDROID)
 
+// When enabled, a POSIX channel whose socket has backed up flushes its queue
+// of outgoing messages with vectored writes instead of one write per message.
 COMPONENT_EXPORT(MOJO_CORE_EMBEDDER_FEATURES)
 BASE_DECLARE_FEATURE(kMojoPosixUseWritev);
 
@@ -205,8 +205,11 @@ void DataDecoder::ParseJson(const std::string& json,
 
   if (base::JSONReader::UsingRust()) {
 #if BUILDFLAG(BUILD_RUST_JSON_READER)
+    // Callers wait on the result (e.g. to show favicons or to process update
+    // manifests), so don't let the parse be deferred behind other work the
+    // way BEST_EFFORT tasks can be.
     base::ThreadPool::PostTaskAndReplyWithResult(
-        FROM_HERE, {base::TaskPriority::BEST_EFFORT},
+        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
         base::BindOnce(
             [](const std::string& json) {
               return base::JSONReader::ReadAndReturnValueWithError(
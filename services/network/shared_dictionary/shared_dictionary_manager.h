@@ -107,14 +107,22 @@ class COMPONENT_EXPORT(NETWORK_SERVICE) SharedDictionaryManager {
     return storages_;
   }
 
+  base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level()
+      const {
+    return memory_pressure_level_;
+  }
+
+  // Called when the memory pressure level changes. Subclasses that keep data
+  // in memory should release it when `level` is not
+  // MEMORY_PRESSURE_LEVEL_NONE.
+  virtual void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level);
+
  private:
   friend class cors::CorsURLLoaderSharedDictionaryTest;
 
   size_t GetStorageCountForTesting();
 
-  void OnMemoryPressure(
-      base::MemoryPressureListener::MemoryPressureLevel level);
-
   base::LRUCache<net::SharedDictionaryIsolationKey,
                  scoped_refptr<SharedDictionaryStorage>>
       cached_storages_;
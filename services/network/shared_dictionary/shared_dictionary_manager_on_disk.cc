@@ -16,12 +16,17 @@
 #include "net/base/net_errors.h"
 #include "net/disk_cache/disk_cache.h"
 #include "services/network/public/cpp/request_destination.h"
+#include "services/network/shared_dictionary/shared_dictionary.h"
 #include "services/network/shared_dictionary/shared_dictionary_storage_on_disk.h"
 #include "services/network/shared_dictionary/simple_url_pattern_matcher.h"
 
 namespace network {
 namespace {
 
+// The maximum total size of the dictionaries kept in memory after they have
+// been read from the disk cache.
+constexpr size_t kRecentlyUsedDictionariesMaxTotalSize = 10 * 1024 * 1024;
+
 std::optional<base::UnguessableToken> DeserializeToUnguessableToken(
     const std::string& token_string) {
   std::optional<base::Token> token = base::Token::FromString(token_string);
@@ -484,7 +489,9 @@ SharedDictionaryManagerOnDisk::SharedDictionaryManagerOnDisk(
                       /*background_task_runner=*/
                       base::ThreadPool::CreateSequencedTaskRunner(
                           {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
-                           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})) {
+                           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
+      recently_used_dictionaries_(
+          decltype(recently_used_dictionaries_)::NO_AUTO_EVICT) {
   disk_cache_.Initialize(cache_directory_path,
 #if BUILDFLAG(IS_ANDROID)
                          app_status_listener_getter,
@@ -683,6 +690,37 @@ void SharedDictionaryManagerOnDisk::UpdateDictionaryLastUsedTime(
   CHECK(info.primary_key_in_database());
   metadata_store_.UpdateDictionaryLastUsedTime(*info.primary_key_in_database(),
                                                info.last_used_time());
+  // Mark the dictionary as the most recently used one if it is kept in memory.
+  recently_used_dictionaries_.Get(info.disk_cache_key_token());
+}
+
+void SharedDictionaryManagerOnDisk::KeepRecentlyUsedDictionary(
+    const base::UnguessableToken& disk_cache_key_token,
+    std::unique_ptr<SharedDictionary> dictionary) {
+  if (memory_pressure_level() !=
+          base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE ||
+      dictionary->size() > kRecentlyUsedDictionariesMaxTotalSize ||
+      recently_used_dictionaries_.Get(disk_cache_key_token) !=
+          recently_used_dictionaries_.end()) {
+    return;
+  }
+  recently_used_dictionaries_total_size_ += dictionary->size();
+  recently_used_dictionaries_.Put(disk_cache_key_token, std::move(dictionary));
+  while (recently_used_dictionaries_total_size_ >
+         kRecentlyUsedDictionariesMaxTotalSize) {
+    auto it = recently_used_dictionaries_.rbegin();
+    recently_used_dictionaries_total_size_ -= it->second->size();
+    recently_used_dictionaries_.Erase(it);
+  }
+}
+
+void SharedDictionaryManagerOnDisk::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  SharedDictionaryManager::OnMemoryPressure(level);
+  if (level != base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
+    recently_used_dictionaries_.Clear();
+    recently_used_dictionaries_total_size_ = 0;
+  }
 }
 
 void SharedDictionaryManagerOnDisk::ClearData(
@@ -736,6 +774,13 @@ void SharedDictionaryManagerOnDisk::OnDictionaryDeleted(
       disk_cache().DoomEntry(token.ToString(), base::DoNothing());
     }
   }
+  for (const base::UnguessableToken& token : disk_cache_key_tokens) {
+    auto it = recently_used_dictionaries_.Peek(token);
+    if (it != recently_used_dictionaries_.end()) {
+      recently_used_dictionaries_total_size_ -= it->second->size();
+      recently_used_dictionaries_.Erase(it);
+    }
+  }
   for (auto& it : storages()) {
     reinterpret_cast<SharedDictionaryStorageOnDisk*>(it.second.get())
         ->OnDictionaryDeleted(disk_cache_key_tokens);
@@ -5,10 +5,12 @@
 #ifndef SERVICES_NETWORK_SHARED_DICTIONARY_SHARED_DICTIONARY_MANAGER_ON_DISK_H_
 #define SERVICES_NETWORK_SHARED_DICTIONARY_SHARED_DICTIONARY_MANAGER_ON_DISK_H_
 
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
 
+#include "base/containers/lru_cache.h"
 #include "base/functional/callback.h"
 #include "base/memory/weak_ptr.h"
 #include "base/time/time.h"
@@ -36,6 +38,7 @@ namespace mojom {
 enum class RequestDestination : int32_t;
 }  // namespace mojom
 
+class SharedDictionary;
 class SharedDictionaryStorage;
 
 // A SharedDictionaryManager which persists dictionary information on disk.
@@ -100,6 +103,15 @@ class SharedDictionaryManagerOnDisk : public SharedDictionaryManager {
 
   void UpdateDictionaryLastUsedTime(net::SharedDictionaryInfo& info);
 
+  // Keeps `dictionary`, which has been read from the disk cache, in memory so
+  // that following requests using it don't need to wait for the disk cache.
+  // The least recently used dictionaries are released once their total size
+  // exceeds a fixed budget, and all of them are released under memory
+  // pressure.
+  void KeepRecentlyUsedDictionary(
+      const base::UnguessableToken& disk_cache_key_token,
+      std::unique_ptr<SharedDictionary> dictionary);
+
   // Posts a MismatchingEntryDeletionTask if this method is called for the first
   // time.
   void MaybePostMismatchingEntryDeletionTask();
@@ -153,6 +165,10 @@ class SharedDictionaryManagerOnDisk : public SharedDictionaryManager {
       net::SQLitePersistentSharedDictionaryStore::
           RegisterDictionaryResultOrError result);
 
+  // SharedDictionaryManager
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level) override;
+
   void PostSerializedTask(std::unique_ptr<SerializedTaskInfo> task_info);
   void OnFinishSerializedTask();
   void MaybeStartSerializedTask();
@@ -176,6 +192,12 @@ class SharedDictionaryManagerOnDisk : public SharedDictionaryManager {
   SharedDictionaryDiskCache disk_cache_;
   net::SQLitePersistentSharedDictionaryStore metadata_store_;
 
+  // Dictionaries recently read from `disk_cache_`, keyed by their disk cache
+  // key token, and the sum of their sizes.
+  base::LRUCache<base::UnguessableToken, std::unique_ptr<SharedDictionary>>
+      recently_used_dictionaries_;
+  size_t recently_used_dictionaries_total_size_ = 0;
+
   std::unique_ptr<SerializedTask> running_serialized_task_;
   std::deque<std::unique_ptr<SerializedTaskInfo>> pending_serialized_task_info_;
 
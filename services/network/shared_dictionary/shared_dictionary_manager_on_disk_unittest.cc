@@ -9,6 +9,7 @@
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/functional/callback.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
@@ -303,6 +304,61 @@ TEST_F(SharedDictionaryManagerOnDiskTest, ReusingRefCountedSharedDictionary) {
                         dict1->size()));
 }
 
+TEST_F(SharedDictionaryManagerOnDiskTest, KeepRecentlyUsedDictionary) {
+  std::unique_ptr<SharedDictionaryManager> manager =
+      CreateSharedDictionaryManager();
+  net::SharedDictionaryIsolationKey isolation_key(url::Origin::Create(kUrl),
+                                                  kSite);
+  scoped_refptr<SharedDictionaryStorage> storage =
+      manager->GetStorage(isolation_key);
+  ASSERT_TRUE(storage);
+
+  WriteDictionary(storage.get(), GURL("https://origin.test/dict"), "testfile*",
+                  kTestData1);
+
+  FlushCacheTasks();
+
+  {
+    std::unique_ptr<SharedDictionary> dict =
+        storage->GetDictionarySync(GURL("https://origin.test/testfile?1"),
+                                   mojom::RequestDestination::kEmpty);
+    ASSERT_TRUE(dict);
+    net::TestCompletionCallback read_callback;
+    EXPECT_EQ(net::OK,
+              read_callback.GetResult(dict->ReadAll(read_callback.callback())));
+  }
+
+  // The dictionary was kept in memory by the manager after being read, so
+  // ReadAll() must synchronously return OK even though no other request holds
+  // it.
+  {
+    std::unique_ptr<SharedDictionary> dict =
+        storage->GetDictionarySync(GURL("https://origin.test/testfile?2"),
+                                   mojom::RequestDestination::kEmpty);
+    ASSERT_TRUE(dict);
+    EXPECT_EQ(net::OK, dict->ReadAll(base::BindLambdaForTesting(
+                           [&](int rv) { NOTREACHED(); })));
+    EXPECT_EQ(kTestData1,
+              std::string(reinterpret_cast<const char*>(dict->data()->data()),
+                          dict->size()));
+  }
+
+  // Under memory pressure, the dictionary is released and must be read from
+  // the disk cache again.
+  base::MemoryPressureListener::SimulatePressureNotification(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+  task_environment_.RunUntilIdle();
+  {
+    std::unique_ptr<SharedDictionary> dict =
+        storage->GetDictionarySync(GURL("https://origin.test/testfile?3"),
+                                   mojom::RequestDestination::kEmpty);
+    ASSERT_TRUE(dict);
+    net::TestCompletionCallback read_callback;
+    EXPECT_EQ(net::ERR_IO_PENDING, dict->ReadAll(read_callback.callback()));
+    EXPECT_EQ(net::OK, read_callback.WaitForResult());
+  }
+}
+
 TEST_F(SharedDictionaryManagerOnDiskTest,
        MaybeCreateWriterAfterManagerDeleted) {
   std::unique_ptr<SharedDictionaryManager> manager =
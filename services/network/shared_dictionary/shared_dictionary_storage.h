@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <tuple>
 
 #include "base/component_export.h"
 #include "base/containers/contains.h"
@@ -110,7 +111,7 @@ DictionaryInfoType* GetMatchingDictionaryFromDictionaryInfoMap(
   DictionaryInfoType* matched_info = nullptr;
   for (auto& item : it->second) {
     DictionaryInfoType& info = item.second;
-    CHECK(std::make_tuple(info.match(), info.match_dest()) == item.first);
+    CHECK(std::tie(info.match(), info.match_dest()) == item.first);
     if (matched_info &&
         ((matched_info->match().size() > info.match().size()) ||
          (matched_info->match().size() == info.match().size() &&
@@ -17,6 +17,7 @@
 #include "base/trace_event/trace_event.h"
 #include "base/trace_event/trace_id_helper.h"
 #include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
 #include "services/network/public/cpp/request_destination.h"
 #include "services/network/shared_dictionary/shared_dictionary_manager_on_disk.h"
 #include "services/network/shared_dictionary/shared_dictionary_on_disk.h"
@@ -214,6 +215,18 @@ SharedDictionaryStorageOnDisk::GetDictionarySync(
           weak_factory_.GetWeakPtr(), info->disk_cache_key_token())));
   dictionaries_.emplace(info->disk_cache_key_token(),
                         ref_counted_shared_dictionary.get());
+  // Once the dictionary has been read, let the manager keep it in memory for
+  // following requests. The callback is owned by the dictionary, so it is safe
+  // to bind a raw pointer to it.
+  int rv = ref_counted_shared_dictionary->ReadAll(base::BindOnce(
+      &SharedDictionaryStorageOnDisk::OnRefCountedSharedDictionaryRead,
+      weak_factory_.GetWeakPtr(),
+      base::Unretained(ref_counted_shared_dictionary.get()),
+      info->disk_cache_key_token()));
+  if (rv != net::ERR_IO_PENDING) {
+    OnRefCountedSharedDictionaryRead(ref_counted_shared_dictionary.get(),
+                                     info->disk_cache_key_token(), rv);
+  }
   return std::make_unique<WrappedSharedDictionary>(
       std::move(ref_counted_shared_dictionary));
 }
@@ -310,6 +323,18 @@ void SharedDictionaryStorageOnDisk::OnDictionaryWritten(
       key, std::move(wrapped_info));
 }
 
+void SharedDictionaryStorageOnDisk::OnRefCountedSharedDictionaryRead(
+    RefCountedSharedDictionary* dictionary,
+    const base::UnguessableToken& disk_cache_key_token,
+    int result) {
+  if (result != net::OK || !manager_) {
+    return;
+  }
+  manager_->KeepRecentlyUsedDictionary(
+      disk_cache_key_token, std::make_unique<WrappedSharedDictionary>(
+                                base::WrapRefCounted(dictionary)));
+}
+
 void SharedDictionaryStorageOnDisk::OnRefCountedSharedDictionaryDeleted(
     const base::UnguessableToken& disk_cache_key_token) {
   dictionaries_.erase(disk_cache_key_token);
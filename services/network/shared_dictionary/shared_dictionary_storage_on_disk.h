@@ -104,6 +104,10 @@ class SharedDictionaryStorageOnDisk : public SharedDictionaryStorage {
       net::SQLitePersistentSharedDictionaryStore::DictionaryListOrError result);
   void OnDictionaryWritten(std::unique_ptr<SimpleUrlPatternMatcher> matcher,
                            net::SharedDictionaryInfo info);
+  void OnRefCountedSharedDictionaryRead(
+      RefCountedSharedDictionary* dictionary,
+      const base::UnguessableToken& disk_cache_key_token,
+      int result);
   void OnRefCountedSharedDictionaryDeleted(
       const base::UnguessableToken& disk_cache_key_token);
 
@@ -531,10 +531,15 @@ SimpleUrlPatternMatcher::SimpleUrlPatternMatcher(
       hash_(std::move(hash)) {}
 
 bool SimpleUrlPatternMatcher::Match(const GURL& url) const {
-  return protocol_.Match(url.scheme()) && username_.Match(url.username()) &&
-         password_.Match(url.password()) && hostname_.Match(url.host()) &&
-         port_.Match(url.port()) && pathname_.Match(url.path()) &&
-         search_.Match(url.query()) && hash_.Match(url.ref());
+  // Dictionaries are looked up among those registered by the request's origin,
+  // so the pathname is the component that usually decides the result. Check it
+  // first, and use the piece accessors so that no component string is copied.
+  return pathname_.Match(url.path_piece()) &&
+         protocol_.Match(url.scheme_piece()) &&
+         username_.Match(url.username_piece()) &&
+         password_.Match(url.password_piece()) &&
+         hostname_.Match(url.host_piece()) && port_.Match(url.port_piece()) &&
+         search_.Match(url.query_piece()) && hash_.Match(url.ref_piece());
 }
 
 SimpleUrlPatternMatcher::~SimpleUrlPatternMatcher() = default;
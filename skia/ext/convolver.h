@@ -102,6 +102,14 @@ class ConvolutionFilter1D {
                  const Fixed* filter_values,
                  int filter_length);
 
+  // Reserves storage for |filter_count| more filters holding a total of
+  // |filter_value_count| more scaling values, so that a sequence of
+  // AddFilter() calls doesn't repeatedly grow the underlying vectors.
+  void ReserveAdditional(int filter_count, int filter_value_count) {
+    filters_.reserve(filters_.size() + filter_count);
+    filter_values_.reserve(filter_values_.size() + filter_value_count);
+  }
+
   // Retrieves a filter for the given |value_offset|, a position in the output
   // image in the direction we're convolving. The offset and length of the
   // filter values are put into the corresponding out arguments (see AddFilter
@@ -220,6 +220,11 @@ void ResizeFilter::ComputeFilters(int src_size,
   absl::InlinedVector<float, 64> filter_values;
   absl::InlinedVector<int16_t, 64> fixed_filter_values;
 
+  // Each filter covers at most about 2 * src_support source pixels (fewer
+  // once clipped to the image), so reserve that much for every output pixel.
+  output->ReserveAdditional(dest_subset_size,
+                            dest_subset_size * (2 * CeilInt(src_support) + 2));
+
   // Loop over all pixels in the output range. We will generate one set of
   // filter values for each one. Those values will tell us how to blend the
   // source pixels to compute the destination pixel.
@@ -139,7 +139,22 @@ CounterStyle* CounterStyleMap::FindCounterStyleAcrossScopes(
   if (it != counter_styles_.end()) {
     return it->value.Get();
   }
-  return GetAncestorMap()->FindCounterStyleAcrossScopes(name);
+
+  // Memoize the lookup in the ancestor maps, which otherwise walks up the tree
+  // scopes for every list marker and counter.
+  StyleEngine& style_engine = owner_document_->GetStyleEngine();
+  if (resolved_styles_version_ != style_engine.CounterStylesVersion()) {
+    resolved_styles_.clear();
+    resolved_styles_version_ = style_engine.CounterStylesVersion();
+  }
+  auto resolved_it = resolved_styles_.find(name);
+  style_engine.CountCounterStyleLookup(resolved_it != resolved_styles_.end());
+  if (resolved_it != resolved_styles_.end()) {
+    return resolved_it->value.Get();
+  }
+  CounterStyle* result = GetAncestorMap()->FindCounterStyleAcrossScopes(name);
+  resolved_styles_.insert(name, result);
+  return result;
 }
 
 void CounterStyleMap::ResolveExtendsFor(CounterStyle& counter_style) {
@@ -353,6 +368,7 @@ void CounterStyleMap::ResolveAllReferences(
 }
 
 void CounterStyleMap::Dispose() {
+  resolved_styles_.clear();
   if (!counter_styles_.size()) {
     return;
   }
@@ -371,6 +387,7 @@ void CounterStyleMap::Trace(Visitor* visitor) const {
   visitor->Trace(owner_document_);
   visitor->Trace(tree_scope_);
   visitor->Trace(counter_styles_);
+  visitor->Trace(resolved_styles_);
 }
 
 }  // namespace blink
@@ -63,6 +63,13 @@ class CORE_EXPORT CounterStyleMap : public GarbageCollected<CounterStyleMap> {
 
   HeapHashMap<AtomicString, Member<CounterStyle>> counter_styles_;
 
+  // For user and author maps, the results of looking up names that are not in
+  // `counter_styles_` in the ancestor maps, including failed lookups. Valid as
+  // long as `resolved_styles_version_` matches
+  // StyleEngine::CounterStylesVersion().
+  mutable HeapHashMap<AtomicString, Member<CounterStyle>> resolved_styles_;
+  mutable uint64_t resolved_styles_version_ = 0;
+
   friend class CounterStyleMapTest;
 };
 
@@ -197,6 +197,37 @@ TEST_F(CounterStyleMapTest, UpdateReferencesInChildScope) {
   EXPECT_EQ("decimal", new_bar.GetExtendedStyle().GetName());
 }
 
+TEST_F(CounterStyleMapTest, FindAcrossScopesAfterParentScopeChanges) {
+  SetHtmlInnerHTML(R"HTML(
+    <style> @counter-style foo { symbols: 'X'; } </style>
+    <div id=host></div>
+  )HTML");
+  ShadowRoot& shadow = AttachShadowTo("host");
+  shadow.setInnerHTML("<style>@counter-style bar { symbols: 'Y'; }</style>");
+  UpdateAllLifecyclePhasesForTest();
+
+  const CounterStyleMap* shadow_map =
+      CounterStyleMap::GetAuthorCounterStyleMap(shadow);
+  const AtomicString foo_name("foo");
+  const CounterStyle& foo = GetCounterStyle(GetDocument(), "foo");
+  EXPECT_EQ(&foo, shadow_map->FindCounterStyleAcrossScopes(foo_name));
+  EXPECT_EQ(&foo, shadow_map->FindCounterStyleAcrossScopes(foo_name));
+
+  // The lookup in the shadow scope must not return the memoized 'foo' after
+  // it has been replaced in the parent scope.
+  GetDocument().QuerySelector(AtomicString("style"))->setTextContent(
+      "@counter-style foo { symbols: 'Z'; }");
+  UpdateAllLifecyclePhasesForTest();
+
+  const CounterStyle& new_foo = GetCounterStyle(GetDocument(), "foo");
+  EXPECT_NE(&foo, &new_foo);
+  EXPECT_EQ(&new_foo, shadow_map->FindCounterStyleAcrossScopes(foo_name));
+
+  GetDocument().QuerySelector(AtomicString("style"))->remove();
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_FALSE(shadow_map->FindCounterStyleAcrossScopes(foo_name));
+}
+
 TEST_F(CounterStyleMapTest, SpeakAsKeywords) {
   ScopedCSSAtRuleCounterStyleSpeakAsDescriptorForTest enabled(true);
 
@@ -131,6 +131,15 @@ CSSStyleSheet* CSSStyleSheet::CreateInline(Node& owner_node,
                                            const KURL& base_url,
                                            const TextPosition& start_position,
                                            const WTF::TextEncoding& encoding) {
+  auto* sheet = MakeGarbageCollected<StyleSheetContents>(
+      CreateInlineParserContext(owner_node, encoding), base_url.GetString());
+  return MakeGarbageCollected<CSSStyleSheet>(sheet, owner_node, true,
+                                             start_position);
+}
+
+CSSParserContext* CSSStyleSheet::CreateInlineParserContext(
+    Node& owner_node,
+    const WTF::TextEncoding& encoding) {
   Document& owner_node_document = owner_node.GetDocument();
   auto* parser_context = MakeGarbageCollected<CSSParserContext>(
       owner_node_document, owner_node_document.BaseURL(),
@@ -147,10 +156,7 @@ CSSStyleSheet* CSSStyleSheet::CreateInline(Node& owner_node,
   if (AdTracker::IsAdScriptExecutingInDocument(&owner_node.GetDocument())) {
     parser_context->SetIsAdRelated();
   }
-  auto* sheet = MakeGarbageCollected<StyleSheetContents>(parser_context,
-                                                         base_url.GetString());
-  return MakeGarbageCollected<CSSStyleSheet>(sheet, owner_node, true,
-                                             start_position);
+  return parser_context;
 }
 
 CSSStyleSheet::CSSStyleSheet(StyleSheetContents* contents,
@@ -43,6 +43,7 @@
 namespace blink {
 
 class CSSImportRule;
+class CSSParserContext;
 class CSSRule;
 class CSSRuleList;
 class CSSStyleSheet;
@@ -83,6 +84,11 @@ class CORE_EXPORT CSSStyleSheet final : public StyleSheet,
       StyleSheetContents*,
       Node& owner_node,
       const TextPosition& start_position = TextPosition::MinimumPosition());
+  // The parser context CreateInline() parses the contents of an inline sheet
+  // owned by `owner_node` with.
+  static CSSParserContext* CreateInlineParserContext(
+      Node& owner_node,
+      const WTF::TextEncoding& = WTF::TextEncoding());
 
   explicit CSSStyleSheet(StyleSheetContents*,
                          CSSImportRule* owner_rule = nullptr);
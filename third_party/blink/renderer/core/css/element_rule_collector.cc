@@ -30,6 +30,8 @@
 
 #include "third_party/blink/renderer/core/css/element_rule_collector.h"
 
+#include <array>
+
 #include "base/containers/span.h"
 #include "base/substring_set_matcher/substring_set_matcher.h"
 #include "base/trace_event/common/trace_event_common.h"
@@ -266,8 +268,27 @@ struct CumulativeRulePerfData {
   int fast_reject_count;
   int match_count;
   base::TimeDelta elapsed;
+  // `elapsed` and `match_attempts`, split by how the selector was matched.
+  std::array<base::TimeDelta,
+             static_cast<size_t>(SelectorMatchPath::kMaxValue) + 1>
+      elapsed_by_path;
+  std::array<int, static_cast<size_t>(SelectorMatchPath::kMaxValue) + 1>
+      match_attempts_by_path;
 };
 
+const char* SelectorMatchPathName(SelectorMatchPath match_path) {
+  switch (match_path) {
+    case SelectorMatchPath::kFastReject:
+      return "fast_reject";
+    case SelectorMatchPath::kCoveredByBucketing:
+      return "bucketing";
+    case SelectorMatchPath::kEasy:
+      return "easy";
+    case SelectorMatchPath::kFull:
+      return "full";
+  }
+}
+
 using SelectorStatisticsRuleMap =
     HashMap<CumulativeRulePerfKey, CumulativeRulePerfData>;
 SelectorStatisticsRuleMap& GetSelectorStatisticsRuleMap() {
@@ -287,22 +308,20 @@ void AggregateRulePerfData(
     CumulativeRulePerfKey key{
         rule->Selector().SelectorText(),
         IdentifiersFactory::IdForCSSStyleSheet(style_sheet)};
-    auto it = map.find(key);
-    if (it == map.end()) {
-      CumulativeRulePerfData data{
-          /*match_attempts*/ 1, (rule_stats.fast_reject) ? 1 : 0,
-          (rule_stats.did_match) ? 1 : 0, rule_stats.elapsed};
-      map.insert(key, data);
-    } else {
-      it->value.elapsed += rule_stats.elapsed;
-      it->value.match_attempts++;
-      if (rule_stats.fast_reject) {
-        it->value.fast_reject_count++;
-      }
-      if (rule_stats.did_match) {
-        it->value.match_count++;
-      }
+    // insert() leaves existing entries as they are.
+    CumulativeRulePerfData& data =
+        map.insert(key, CumulativeRulePerfData{}).stored_value->value;
+    data.elapsed += rule_stats.elapsed;
+    data.match_attempts++;
+    if (rule_stats.fast_reject) {
+      data.fast_reject_count++;
+    }
+    if (rule_stats.did_match) {
+      data.match_count++;
     }
+    const size_t path = static_cast<size_t>(rule_stats.match_path);
+    data.elapsed_by_path[path] += rule_stats.elapsed;
+    data.match_attempts_by_path[path]++;
   }
 }
 
@@ -483,6 +502,11 @@ bool ElementRuleCollector::CollectMatchingRulesForListInternal(
   Seeker<StyleScope> scope_seeker(rule_set->ScopeIntervals());
 
   unsigned fast_rejected = 0;
+  // Rules which have ancestor identifiers but passed the ancestor filter, and
+  // how many of those then matched. The difference bounds the false positives
+  // of the filter from above.
+  unsigned passed_fast_reject = 0;
+  unsigned matched_after_fast_reject = 0;
   unsigned matched = 0;
   SelectorStatisticsCollector selector_statistics_collector;
   if (perf_trace_enabled) {
@@ -495,15 +519,20 @@ bool ElementRuleCollector::CollectMatchingRulesForListInternal(
       selector_statistics_collector.EndCollectionForCurrentRule();
       selector_statistics_collector.BeginCollectionForRule(&rule_data);
     }
-    if (can_use_fast_reject_ &&
-        selector_filter_.FastRejectSelector(
-            rule_data.DescendantSelectorIdentifierHashes(
-                rule_set->BloomHashBacking()))) {
-      fast_rejected++;
-      if (perf_trace_enabled) {
-        selector_statistics_collector.SetWasFastRejected();
+    bool checked_by_fast_reject = false;
+    if (can_use_fast_reject_) {
+      const base::span<const unsigned> identifier_hashes =
+          rule_data.DescendantSelectorIdentifierHashes(
+              rule_set->BloomHashBacking());
+      if (selector_filter_.FastRejectSelector(identifier_hashes)) {
+        fast_rejected++;
+        if (perf_trace_enabled) {
+          selector_statistics_collector.SetWasFastRejected();
+        }
+        continue;
       }
-      continue;
+      checked_by_fast_reject = !identifier_hashes.empty();
+      passed_fast_reject += checked_by_fast_reject;
     }
 
     const auto& selector = rule_data.Selector();
@@ -525,6 +554,10 @@ bool ElementRuleCollector::CollectMatchingRulesForListInternal(
       // Just by seeing this rule, we know that its selector
       // matched, and that we don't get any flags or a match
       // against a pseudo-element. So we can skip the entire test.
+      if (perf_trace_enabled) {
+        selector_statistics_collector.SetMatchPath(
+            SelectorMatchPath::kCoveredByBucketing);
+      }
       if (pseudo_style_request_.pseudo_id != kPseudoIdNone) {
         continue;
       }
@@ -536,6 +569,9 @@ bool ElementRuleCollector::CollectMatchingRulesForListInternal(
 #endif
     } else if (context.vtt_originating_element == nullptr &&
                rule_data.SelectorIsEasy()) {
+      if (perf_trace_enabled) {
+        selector_statistics_collector.SetMatchPath(SelectorMatchPath::kEasy);
+      }
       if (pseudo_style_request_.pseudo_id != kPseudoIdNone) {
         continue;
       }
@@ -628,6 +664,7 @@ bool ElementRuleCollector::CollectMatchingRulesForListInternal(
     }
 
     matched++;
+    matched_after_fast_reject += checked_by_fast_reject;
     if (perf_trace_enabled) {
       selector_statistics_collector.SetDidMatch();
     }
@@ -646,6 +683,8 @@ bool ElementRuleCollector::CollectMatchingRulesForListInternal(
 
   StyleEngine& style_engine =
       context_.GetElement().GetDocument().GetStyleEngine();
+  style_engine.AddAncestorFilterCounts(
+      fast_rejected, passed_fast_reject - matched_after_fast_reject);
   if (!style_engine.Stats()) {
     return false;
   }
@@ -1269,6 +1308,23 @@ void ElementRuleCollector::DumpAndClearRulesPerfMap() {
             item_dict.Add("match_attempts", it.value.match_attempts);
             item_dict.Add("fast_reject_count", it.value.fast_reject_count);
             item_dict.Add("match_count", it.value.match_count);
+            {
+              perfetto::TracedDictionary paths_dict =
+                  item_dict.AddDictionary("match_paths");
+              for (size_t path = 0; path < it.value.elapsed_by_path.size();
+                   ++path) {
+                if (!it.value.match_attempts_by_path[path]) {
+                  continue;
+                }
+                perfetto::TracedDictionary path_dict =
+                    paths_dict.AddDictionary(perfetto::DynamicString(
+                        SelectorMatchPathName(
+                            static_cast<SelectorMatchPath>(path))));
+                path_dict.Add("elapsed (us)", it.value.elapsed_by_path[path]);
+                path_dict.Add("match_attempts",
+                              it.value.match_attempts_by_path[path]);
+              }
+            }
           }
         }
       });
@@ -989,6 +989,72 @@ void RuleSet::AddFilteredRulesFromOtherSet(
 #endif
 }
 
+RuleSet* RuleSet::CopyWithAppendedRules(
+    const HeapVector<Member<StyleRuleBase>>& rules,
+    const MediaQueryEvaluator& medium) const {
+  TRACE_EVENT0("blink", "RuleSet::CopyWithAppendedRules");
+  if (implicit_outer_layer_) {
+    // The layers would need to be deep-copied, since adding rules can add
+    // sublayers to them.
+    return nullptr;
+  }
+  DCHECK(layer_intervals_.empty());
+
+  RuleSet* rule_set = MakeGarbageCollected<RuleSet>();
+  if (!rule_set->id_rules_.AddAllRulesFromOtherMap(id_rules_) ||
+      !rule_set->class_rules_.AddAllRulesFromOtherMap(class_rules_) ||
+      !rule_set->attr_rules_.AddAllRulesFromOtherMap(attr_rules_) ||
+      !rule_set->tag_rules_.AddAllRulesFromOtherMap(tag_rules_) ||
+      !rule_set->ua_shadow_pseudo_element_rules_.AddAllRulesFromOtherMap(
+          ua_shadow_pseudo_element_rules_)) {
+    return nullptr;
+  }
+  // NOTE: attr_substring_matchers_ will be rebuilt in CompactRules().
+  rule_set->link_pseudo_class_rules_ = link_pseudo_class_rules_;
+  rule_set->cue_pseudo_rules_ = cue_pseudo_rules_;
+  rule_set->focus_pseudo_class_rules_ = focus_pseudo_class_rules_;
+  rule_set->focus_visible_pseudo_class_rules_ =
+      focus_visible_pseudo_class_rules_;
+  rule_set->universal_rules_ = universal_rules_;
+  rule_set->shadow_host_rules_ = shadow_host_rules_;
+  rule_set->part_pseudo_rules_ = part_pseudo_rules_;
+  rule_set->slotted_pseudo_element_rules_ = slotted_pseudo_element_rules_;
+  rule_set->selector_fragment_anchor_rules_ = selector_fragment_anchor_rules_;
+  rule_set->root_element_rules_ = root_element_rules_;
+  rule_set->features_.Merge(features_);
+  rule_set->page_rules_ = page_rules_;
+  rule_set->font_face_rules_ = font_face_rules_;
+  rule_set->font_palette_values_rules_ = font_palette_values_rules_;
+  rule_set->font_feature_values_rules_ = font_feature_values_rules_;
+  rule_set->view_transition_rules_ = view_transition_rules_;
+  rule_set->keyframes_rules_ = keyframes_rules_;
+  rule_set->property_rules_ = property_rules_;
+  rule_set->counter_style_rules_ = counter_style_rules_;
+  rule_set->position_try_rules_ = position_try_rules_;
+  rule_set->media_query_set_results_.AppendVector(media_query_set_results_);
+  rule_set->function_rules_ = function_rules_;
+  rule_set->has_bucket_for_style_attr_ = has_bucket_for_style_attr_;
+  rule_set->must_check_universal_bucket_for_shadow_host_ =
+      must_check_universal_bucket_for_shadow_host_;
+  rule_set->rule_count_ = rule_count_;
+  rule_set->container_query_intervals_.AppendVector(
+      container_query_intervals_);
+  rule_set->scope_intervals_.AppendVector(scope_intervals_);
+  // The RuleDatas refer to their Bloom filter hashes by position,
+  // so the backing must be copied verbatim.
+  rule_set->bloom_hash_backing_ = bloom_hash_backing_;
+#if DCHECK_IS_ON()
+  rule_set->all_rules_ = all_rules_;
+  rule_set->allow_unsorted_ = allow_unsorted_;
+#endif  // DCHECK_IS_ON()
+
+  rule_set->AddChildRules(rules, medium, kRuleHasNoSpecialState,
+                          nullptr /* container_query */,
+                          nullptr /* cascade_layer */, nullptr);
+  rule_set->need_compaction_ = true;
+  return rule_set;
+}
+
 void RuleSet::AddStyleRule(StyleRule* style_rule,
                            const MediaQueryEvaluator& medium,
                            AddRuleFlags add_rule_flags,
@@ -1172,6 +1238,36 @@ void RuleMap::AddFilteredRulesFromOtherSet(
   }
 }
 
+bool RuleMap::AddAllRulesFromOtherMap(const RuleMap& other) {
+  DCHECK(IsEmpty());
+  if (other.IsEmpty()) {
+    return true;
+  }
+  if (other.compacted) {
+    for (const auto& [key, extent] : other.buckets) {
+      for (const RuleData& rule_data : other.GetRulesFromExtent(extent)) {
+        if (!Add(key, rule_data)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  // See AddFilteredRulesFromOtherSet().
+  std::unique_ptr<const AtomicString*[]> keys(
+      new const AtomicString*[other.num_buckets]);
+  for (const auto& [key, src_extent] : other.buckets) {
+    keys[src_extent.bucket_number] = &key;
+  }
+  for (wtf_size_t i = 0; i < other.backing.size(); ++i) {
+    if (!Add(*keys[other.bucket_number_[i]], other.backing[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static wtf_size_t GetMinimumRulesetSizeForSubstringMatcher() {
   // It's not worth going through the Aho-Corasick matcher unless we can
   // reject a reasonable number of rules in one go. Practical ad-hoc testing
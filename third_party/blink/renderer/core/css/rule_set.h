@@ -265,6 +265,9 @@ class RuleMap {
       const HeapHashSet<Member<StyleRule>>& only_include,
       const RuleSet& old_rule_set,
       RuleSet& new_rule_set);
+  // Adds all the RuleDatas from the other map, in the same order, to this
+  // (empty) map. Returns false if any of them couldn't be added; see Add().
+  bool AddAllRulesFromOtherMap(const RuleMap& other);
   base::span<const RuleData> Find(const AtomicString& key) const {
     if (buckets.IsNull()) {
       return {};
@@ -382,6 +385,15 @@ class CORE_EXPORT RuleSet final : public GarbageCollected<RuleSet> {
                     CascadeLayer* cascade_layer = nullptr,
                     const StyleScope* style_scope = nullptr);
 
+  // Returns a new RuleSet with the same rules as this one, followed by the
+  // given rules, as if they had been appended to the end of the last sheet
+  // this RuleSet was built from. This is much cheaper than building the
+  // RuleSet from scratch, since the existing RuleDatas and features are
+  // copied instead of being recomputed from their selectors. Returns nullptr
+  // if this RuleSet can't be copied, in particular if it has cascade layers.
+  RuleSet* CopyWithAppendedRules(const HeapVector<Member<StyleRuleBase>>&,
+                                 const MediaQueryEvaluator&) const;
+
   // Adds RuleDatas (and only RuleDatas) from the other set, but only if they
   // correspond to rules in “only_include”. This is used when creating diff
   // rulesets for invalidation, and the resulting RuleSets are not usable
@@ -202,27 +202,80 @@ void CollectDescendantCompoundSelectorIdentifierHashes(
 }  // namespace
 
 void SelectorFilter::PushParentStackFrame(Element& parent) {
-  DCHECK(ancestor_identifier_filter_);
+  DCHECK(ancestor_identifier_filter_ || large_ancestor_identifier_filter_);
   parent_stack_.push_back(parent);
   // Mix tags, class names and ids into some sort of weird bouillabaisse.
   // The filter is used for fast rejection of child and descendant selectors.
-  CollectElementIdentifierHashes(parent, [this](unsigned hash) {
-    ancestor_identifier_filter_->Add(hash);
-  });
+  if (ancestor_identifier_filter_) {
+    CollectElementIdentifierHashes(parent, [this](unsigned hash) {
+      ancestor_identifier_filter_->Add(hash);
+      ++num_identifiers_;
+    });
+    if (UNLIKELY(num_identifiers_ > kMaxIdentifiersInSmallFilter)) {
+      ResizeIdentifierFilter(/*large=*/true);
+    }
+  } else {
+    CollectElementIdentifierHashes(parent, [this](unsigned hash) {
+      large_ancestor_identifier_filter_->Add(hash);
+      ++num_identifiers_;
+    });
+  }
 }
 
 void SelectorFilter::PopParentStackFrame() {
   DCHECK(!parent_stack_.empty());
-  DCHECK(ancestor_identifier_filter_);
-  CollectElementIdentifierHashes(*parent_stack_.back(), [this](unsigned hash) {
-    ancestor_identifier_filter_->Remove(hash);
-  });
+  DCHECK(ancestor_identifier_filter_ || large_ancestor_identifier_filter_);
+  if (ancestor_identifier_filter_) {
+    CollectElementIdentifierHashes(
+        *parent_stack_.back(), [this](unsigned hash) {
+          ancestor_identifier_filter_->Remove(hash);
+          --num_identifiers_;
+        });
+  } else {
+    CollectElementIdentifierHashes(
+        *parent_stack_.back(), [this](unsigned hash) {
+          large_ancestor_identifier_filter_->Remove(hash);
+          --num_identifiers_;
+        });
+  }
   parent_stack_.pop_back();
   if (parent_stack_.empty()) {
+    DCHECK_EQ(num_identifiers_, 0u);
 #if DCHECK_IS_ON()
-    DCHECK(ancestor_identifier_filter_->LikelyEmpty());
+    DCHECK(!ancestor_identifier_filter_ ||
+           ancestor_identifier_filter_->LikelyEmpty());
+    DCHECK(!large_ancestor_identifier_filter_ ||
+           large_ancestor_identifier_filter_->LikelyEmpty());
 #endif
     ancestor_identifier_filter_.reset();
+    large_ancestor_identifier_filter_.reset();
+  } else if (UNLIKELY(large_ancestor_identifier_filter_ &&
+                      num_identifiers_ < kMaxIdentifiersInSmallFilter / 2)) {
+    // Only go back once we are well below the limit, so that walking up and
+    // down around it doesn't rebuild the filter for every element.
+    ResizeIdentifierFilter(/*large=*/false);
+  }
+}
+
+void SelectorFilter::ResizeIdentifierFilter(bool large) {
+  if (large) {
+    ancestor_identifier_filter_.reset();
+    large_ancestor_identifier_filter_ =
+        std::make_unique<LargeIdentifierFilter>();
+  } else {
+    large_ancestor_identifier_filter_.reset();
+    ancestor_identifier_filter_ = std::make_unique<IdentifierFilter>();
+  }
+  // Counting filters can't be resized in place, so re-add the identifiers of
+  // every element on the stack.
+  for (const Element* element : parent_stack_) {
+    CollectElementIdentifierHashes(*element, [this, large](unsigned hash) {
+      if (large) {
+        large_ancestor_identifier_filter_->Add(hash);
+      } else {
+        ancestor_identifier_filter_->Add(hash);
+      }
+    });
   }
 }
 
@@ -242,11 +295,12 @@ void SelectorFilter::PushParent(Element& parent) {
   if (parent_stack_.empty()) {
     DCHECK_EQ(parent, parent.GetDocument().documentElement());
     DCHECK(!ancestor_identifier_filter_);
+    DCHECK(!large_ancestor_identifier_filter_);
     ancestor_identifier_filter_ = std::make_unique<IdentifierFilter>();
     PushParentStackFrame(parent);
     return;
   }
-  DCHECK(ancestor_identifier_filter_);
+  DCHECK(ancestor_identifier_filter_ || large_ancestor_identifier_filter_);
 #if DCHECK_IS_ON()
   if (parent_stack_.back() != FlatTreeTraversal::ParentElement(parent) &&
       parent_stack_.back() != parent.ParentOrShadowHostElement()) {
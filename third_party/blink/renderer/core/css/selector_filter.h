@@ -75,6 +75,13 @@ class StyleScope;
 // For practical web pages as of 2022, we've seen SelectorFilter discard 60-70%
 // of rules in early processing, which makes the 4 kB of RAM/cache it uses
 // worthwhile.
+//
+// Deep trees with many classes per element (common in component-heavy apps)
+// can put far more identifiers into the filter than the 4 kB table is sized
+// for, at which point nearly every lookup is a false positive. When the number
+// of identifiers in the filter grows past kMaxIdentifiersInSmallFilter, we
+// therefore rebuild it from the parent stack into a 16 kB table, and go back
+// to the small one once the stack has shrunk enough again.
 class CORE_EXPORT SelectorFilter {
   DISALLOW_NEW();
 
@@ -106,33 +113,69 @@ class CORE_EXPORT SelectorFilter {
 
   void Trace(Visitor*) const;
 
+  bool IsUsingLargeFilterForTesting() const {
+    return !!large_ancestor_identifier_filter_;
+  }
+
+  // With 300 identifiers in the filter, the small filter has a false positive
+  // rate of ~2% (and the large one ~0.1%).
+  static constexpr unsigned kMaxIdentifiersInSmallFilter = 300;
+
  private:
   void PushAncestors(const Node& node);
   void PushParentStackFrame(Element& parent);
   void PopParentStackFrame();
 
+  // Moves the contents of the parent stack into a filter of the other size.
+  void ResizeIdentifierFilter(bool large);
+
+  template <typename Filter>
+  static bool FastRejectSelector(
+      const Filter& filter,
+      const base::span<const unsigned> identifier_hashes);
+
   HeapVector<Member<Element>> parent_stack_;
 
   // With 100 unique strings in the filter, 2^12 slot table has false positive
   // rate of ~0.2%.
   using IdentifierFilter = CountingBloomFilter<12>;
+  using LargeIdentifierFilter = CountingBloomFilter<14>;
+
+  // At most one of these is non-null at a time, and only while the parent
+  // stack is non-empty.
   std::unique_ptr<IdentifierFilter> ancestor_identifier_filter_;
+  std::unique_ptr<LargeIdentifierFilter> large_ancestor_identifier_filter_;
+
+  // The number of identifier hashes added for the elements in the parent
+  // stack, including duplicates.
+  unsigned num_identifiers_ = 0;
 };
 
+template <typename Filter>
 inline bool SelectorFilter::FastRejectSelector(
-    const base::span<const unsigned> identifier_hashes) const {
-  if (!ancestor_identifier_filter_) {
-    DCHECK(parent_stack_.empty());
-    return false;
-  }
+    const Filter& filter,
+    const base::span<const unsigned> identifier_hashes) {
   for (unsigned hash : identifier_hashes) {
-    if (!ancestor_identifier_filter_->MayContain(hash)) {
+    if (!filter.MayContain(hash)) {
       return true;
     }
   }
   return false;
 }
 
+inline bool SelectorFilter::FastRejectSelector(
+    const base::span<const unsigned> identifier_hashes) const {
+  if (ancestor_identifier_filter_) {
+    return FastRejectSelector(*ancestor_identifier_filter_, identifier_hashes);
+  }
+  if (large_ancestor_identifier_filter_) {
+    return FastRejectSelector(*large_ancestor_identifier_filter_,
+                              identifier_hashes);
+  }
+  DCHECK(parent_stack_.empty());
+  return false;
+}
+
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_CORE_CSS_SELECTOR_FILTER_H_
@@ -8,8 +8,10 @@
 #include "third_party/blink/renderer/core/css/css_test_helpers.h"
 #include "third_party/blink/renderer/core/css/style_rule.h"
 #include "third_party/blink/renderer/core/css/style_scope.h"
+#include "third_party/blink/renderer/core/dom/element_traversal.h"
 #include "third_party/blink/renderer/core/testing/page_test_base.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 
 namespace blink {
 
@@ -39,6 +41,17 @@ Vector<unsigned> CollectIdentifierHashesFromInnerRule(Document& document,
   return result;
 }
 
+Vector<unsigned> CollectIdentifierHashesFromRule(Document& document,
+                                                 String rule_text) {
+  Vector<unsigned> result;
+  const auto* style_rule =
+      DynamicTo<StyleRule>(css_test_helpers::ParseRule(document, rule_text));
+  CHECK(style_rule);
+  SelectorFilter::CollectIdentifierHashes(*style_rule->FirstSelector(),
+                                          /*style_scope=*/nullptr, result);
+  return result;
+}
+
 }  // namespace
 
 TEST_F(SelectorFilterTest, CollectHashesScopeSubject) {
@@ -89,4 +102,64 @@ TEST_F(SelectorFilterTest, CollectHashesScopeImplied) {
   EXPECT_NE(0u, hashes[2]);  // .a
 }
 
+TEST_F(SelectorFilterTest, LargeFilterForDeepTrees) {
+  // 40 nested <div>s with ten classes each, which is more identifiers than
+  // the small filter holds.
+  constexpr int kDepth = 40;
+  StringBuilder html;
+  for (int i = 0; i < kDepth; ++i) {
+    html.Append("<div class='");
+    for (int j = 0; j < 10; ++j) {
+      html.AppendFormat("c%d_%d ", i, j);
+    }
+    html.Append("'>");
+  }
+  SetBodyInnerHTML(html.ToString());
+
+  Document& document = GetDocument();
+  Vector<unsigned> outer_hashes =
+      CollectIdentifierHashesFromRule(document, ".c0_0 .x {}");
+  Vector<unsigned> inner_hashes =
+      CollectIdentifierHashesFromRule(document, ".c39_0.c39_1.c39_2 .x {}");
+  Vector<unsigned> missing_hashes =
+      CollectIdentifierHashesFromRule(document, ".m0.m1.m2 .x {}");
+
+  SelectorFilter filter;
+  filter.PushParent(*document.documentElement());
+  filter.PushParent(*document.body());
+  HeapVector<Member<Element>> divs;
+  for (Element* div = ElementTraversal::FirstChild(*document.body()); div;
+       div = ElementTraversal::FirstChild(*div)) {
+    filter.PushParent(*div);
+    divs.push_back(div);
+    if (divs.size() == 20) {
+      EXPECT_FALSE(filter.IsUsingLargeFilterForTesting());
+    }
+  }
+  ASSERT_EQ(static_cast<wtf_size_t>(kDepth), divs.size());
+  EXPECT_TRUE(filter.IsUsingLargeFilterForTesting());
+  EXPECT_FALSE(filter.FastRejectSelector(outer_hashes));
+  EXPECT_FALSE(filter.FastRejectSelector(inner_hashes));
+  EXPECT_TRUE(filter.FastRejectSelector(missing_hashes));
+
+  // Going back up to a shallow ancestor switches back to the small filter,
+  // which no longer contains the identifiers of the popped elements.
+  while (divs.size() > 10) {
+    filter.PopParent(*divs.back());
+    divs.pop_back();
+  }
+  EXPECT_FALSE(filter.IsUsingLargeFilterForTesting());
+  EXPECT_FALSE(filter.FastRejectSelector(outer_hashes));
+  EXPECT_TRUE(filter.FastRejectSelector(inner_hashes));
+  EXPECT_TRUE(filter.FastRejectSelector(missing_hashes));
+
+  while (!divs.empty()) {
+    filter.PopParent(*divs.back());
+    divs.pop_back();
+  }
+  filter.PopParent(*document.body());
+  filter.PopParent(*document.documentElement());
+  EXPECT_TRUE(filter.ParentStackIsConsistent(nullptr));
+}
+
 }  // namespace blink
@@ -16,13 +16,15 @@ void SelectorStatisticsCollector::BeginCollectionForRule(const RuleData* rule) {
   rule_ = rule;
   fast_reject_ = false;
   did_match_ = false;
+  match_path_ = SelectorMatchPath::kFull;
   start_ = base::TimeTicks::Now();
 }
 
 void SelectorStatisticsCollector::EndCollectionForCurrentRule() {
   if (rule_) {
     base::TimeDelta elapsed = base::TimeTicks::Now() - start_;
-    per_rule_statistics_.emplace_back(rule_, fast_reject_, did_match_, elapsed);
+    per_rule_statistics_.emplace_back(rule_, fast_reject_, did_match_,
+                                      match_path_, elapsed);
   }
   rule_ = nullptr;
 }
@@ -12,14 +12,34 @@ namespace blink {
 
 class RuleData;
 
+// How ElementRuleCollector matched a rule's selector against an element, from
+// cheapest to most expensive.
+enum class SelectorMatchPath {
+  // Rejected by the ancestor bloom filter of SelectorFilter.
+  kFastReject,
+  // Known to match from the rule's bucket alone (see
+  // RuleData::IsEntirelyCoveredByBucketing()).
+  kCoveredByBucketing,
+  // Matched by EasySelectorChecker.
+  kEasy,
+  // Matched by the general SelectorChecker.
+  kFull,
+  kMaxValue = kFull,
+};
+
 struct RulePerfDataPerRequest {
-  RulePerfDataPerRequest(const RuleData* r, bool f, bool m, base::TimeDelta e)
-      : rule(r), fast_reject(f), did_match(m), elapsed(e) {}
+  RulePerfDataPerRequest(const RuleData* r,
+                         bool f,
+                         bool m,
+                         SelectorMatchPath p,
+                         base::TimeDelta e)
+      : rule(r), fast_reject(f), did_match(m), match_path(p), elapsed(e) {}
   // RuleData is Traceable but not owned here, so there's no need to Trace it
   // here. The RuleData is owned and traced by HeapVectors in RuleSet.
   const RuleData* const rule;
   bool fast_reject;
   bool did_match;
+  SelectorMatchPath match_path;
   base::TimeDelta elapsed;
 
   DISALLOW_NEW();
@@ -49,8 +69,14 @@ class SelectorStatisticsCollector {
   void BeginCollectionForRule(const RuleData* rule);
   void EndCollectionForCurrentRule();
 
-  void SetWasFastRejected() { fast_reject_ = true; }
+  void SetWasFastRejected() {
+    fast_reject_ = true;
+    match_path_ = SelectorMatchPath::kFastReject;
+  }
   void SetDidMatch() { did_match_ = true; }
+  // Rules that are neither fast rejected nor passed here are attributed to
+  // SelectorMatchPath::kFull.
+  void SetMatchPath(SelectorMatchPath match_path) { match_path_ = match_path; }
 
   const Vector<RulePerfDataPerRequest>& PerRuleStatistics() const {
     return per_rule_statistics_;
@@ -68,6 +94,7 @@ class SelectorStatisticsCollector {
   base::TimeTicks start_;
   bool fast_reject_{false};
   bool did_match_{false};
+  SelectorMatchPath match_path_{SelectorMatchPath::kFull};
 };
 
 }  // namespace blink
@@ -32,6 +32,7 @@
 #include "base/auto_reset.h"
 #include "base/containers/adapters.h"
 #include "base/hash/hash.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/ranges/algorithm.h"
 #include "third_party/blink/public/mojom/frame/color_scheme.mojom-blink.h"
 #include "third_party/blink/public/mojom/timing/resource_timing.mojom-blink.h"
@@ -53,6 +54,7 @@
 #include "third_party/blink/renderer/core/css/media_feature_overrides.h"
 #include "third_party/blink/renderer/core/css/media_values.h"
 #include "third_party/blink/renderer/core/css/out_of_flow_data.h"
+#include "third_party/blink/renderer/core/css/parser/css_parser_context.h"
 #include "third_party/blink/renderer/core/css/property_registration.h"
 #include "third_party/blink/renderer/core/css/property_registry.h"
 #include "third_party/blink/renderer/core/css/resolver/scoped_style_resolver.h"
@@ -80,6 +82,7 @@
 #include "third_party/blink/renderer/core/dom/processing_instruction.h"
 #include "third_party/blink/renderer/core/dom/scriptable_document_parser.h"
 #include "third_party/blink/renderer/core/dom/shadow_root.h"
+#include "third_party/blink/renderer/core/execution_context/execution_context.h"
 #include "third_party/blink/renderer/core/frame/frame_owner.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/core/frame/settings.h"
@@ -113,9 +116,12 @@
 #include "third_party/blink/renderer/platform/fonts/font_cache.h"
 #include "third_party/blink/renderer/platform/fonts/font_selector.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
 #include "third_party/blink/renderer/platform/instrumentation/histogram.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 #include "third_party/blink/renderer/platform/weborigin/security_origin.h"
+#include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
 #include "third_party/blink/renderer/platform/wtf/wtf_size_t.h"
 
@@ -687,6 +693,9 @@ void StyleEngine::UpdateCounterStyles() {
   }
   CounterStyleMap::MarkAllDirtyCounterStyles(GetDocument(),
                                              active_tree_scopes_);
+  // Dirty counter styles have been replaced, so memoized lookups may return
+  // stale ones.
+  InvalidateCounterStyleLookupCaches();
   CounterStyleMap::ResolveAllReferences(GetDocument(), active_tree_scopes_);
   counter_styles_need_update_ = false;
 }
@@ -1004,15 +1013,27 @@ CSSStyleSheet* StyleEngine::CreateSheet(
   if (result.is_new_entry || !contents ||
       !contents->IsCacheableForStyleElement()) {
     result.stored_value->value = nullptr;
-    style_sheet =
-        ParseSheet(element, text, start_position, render_blocking_behavior);
-    if (style_sheet->Contents()->IsCacheableForStyleElement()) {
-      result.stored_value->value = style_sheet->Contents();
+    AtomicString shared_key = SharedTextToSheetCacheKey(key);
+    contents = FindSharedSheet(element, shared_key);
+    if (contents) {
+      result.stored_value->value = contents;
+    } else {
+      style_sheet =
+          ParseSheet(element, text, start_position, render_blocking_behavior);
+      if (style_sheet->Contents()->IsCacheableForStyleElement()) {
+        result.stored_value->value = style_sheet->Contents();
+        if (!shared_key.IsNull() &&
+            !style_sheet->Contents()->HasMediaQueries()) {
+          GetSharedTextToSheetCache().Set(shared_key, style_sheet->Contents());
+        }
+      }
     }
-  } else {
+  }
+  if (!style_sheet) {
     DCHECK(contents);
     DCHECK(contents->IsCacheableForStyleElement());
-    DCHECK(contents->HasSingleOwnerDocument());
+    // Contents from the shared cache have other owner documents.
+    DCHECK(contents->HasSingleOwnerDocument() || !contents->HasMediaQueries());
     contents->SetIsUsedFromTextCache();
     style_sheet =
         CSSStyleSheet::CreateInline(contents, element, start_position);
@@ -1029,6 +1050,60 @@ CSSStyleSheet* StyleEngine::CreateSheet(
   return style_sheet;
 }
 
+AtomicString StyleEngine::SharedTextToSheetCacheKey(
+    const AtomicString& key) const {
+  // Sheets are only shared within an origin, so that a page can't make
+  // another origin's sheet parse to its own contents through a collision of
+  // the text digest.
+  const ExecutionContext* execution_context =
+      GetDocument().GetExecutionContext();
+  if (!execution_context) {
+    return g_null_atom;
+  }
+  const SecurityOrigin* origin = execution_context->GetSecurityOrigin();
+  if (!origin || origin->IsOpaque()) {
+    return g_null_atom;
+  }
+  StringBuilder shared_key;
+  shared_key.Append(origin->ToString());
+  shared_key.Append(' ');
+  shared_key.Append(key);
+  return shared_key.ToAtomicString();
+}
+
+StyleSheetContents* StyleEngine::FindSharedSheet(
+    Element& element,
+    const AtomicString& shared_key) const {
+  if (shared_key.IsNull()) {
+    return nullptr;
+  }
+  auto it = GetSharedTextToSheetCache().find(shared_key);
+  if (it == GetSharedTextToSheetCache().end()) {
+    return nullptr;
+  }
+  StyleSheetContents* contents = it->value.Get();
+  if (!contents || !contents->IsCacheableForStyleElement() ||
+      contents->HasMediaQueries()) {
+    return nullptr;
+  }
+  // The document, not just the origin, determines how the text parses (e.g.
+  // through its base URL or quirks mode), so the parser contexts must match
+  // for it to give the same contents.
+  if (*contents->ParserContext() !=
+      *CSSStyleSheet::CreateInlineParserContext(element,
+                                                GetDocument().Encoding())) {
+    return nullptr;
+  }
+  return contents;
+}
+
+StyleEngine::SharedTextToSheetCache& StyleEngine::GetSharedTextToSheetCache() {
+  DCHECK(IsMainThread());
+  DEFINE_STATIC_LOCAL(Persistent<SharedTextToSheetCache>, cache,
+                      (MakeGarbageCollected<SharedTextToSheetCache>()));
+  return *cache;
+}
+
 CSSStyleSheet* StyleEngine::ParseSheet(
     Element& element,
     const String& text,
@@ -1144,6 +1219,7 @@ void StyleEngine::MarkFontsNeedUpdate() {
 
 void StyleEngine::MarkCounterStylesNeedUpdate() {
   counter_styles_need_update_ = true;
+  InvalidateCounterStyleLookupCaches();
   if (LayoutView* layout_view = GetDocument().GetLayoutView()) {
     layout_view->SetNeedsMarkerOrCounterUpdate();
   }
@@ -1436,6 +1512,33 @@ class StyleEngine::PseudoHasInvalidationTraversalContext {
   bool for_element_affected_by_pseudo_in_has_{false};
 };
 
+namespace {
+
+// How a :has() invalidation walk visited an element. The rest of a walk only
+// depends on the element and on these, and a walk with a flag set does a
+// superset of the work of one without it.
+enum PseudoHasInvalidationVisitFlags : unsigned {
+  // Invalidated regardless of the AffectedByPseudoInHas flag.
+  kPseudoHasVisitForAllElements = 1 << 0,
+  // Continued to the parent after the previous siblings.
+  kPseudoHasVisitTraversingToParent = 1 << 1,
+  kPseudoHasVisitKinds = 1 << 2,
+};
+
+// Returns the set of visit kinds (as a bit per combination of the flags
+// above) which do at least the work of a visit with `visit_flags`.
+unsigned PseudoHasVisitsCovering(unsigned visit_flags) {
+  unsigned covering = 0;
+  for (unsigned kind = 0; kind < kPseudoHasVisitKinds; ++kind) {
+    if ((kind & visit_flags) == visit_flags) {
+      covering |= 1u << kind;
+    }
+  }
+  return covering;
+}
+
+}  // namespace
+
 void StyleEngine::InvalidateAncestorsOrSiblingsAffectedByHas(
     const PseudoHasInvalidationTraversalContext& traversal_context) {
   bool traverse_to_parent = traversal_context.TraverseToParentOfFirstElement();
@@ -1444,10 +1547,31 @@ void StyleEngine::InvalidateAncestorsOrSiblingsAffectedByHas(
   bool for_element_affected_by_pseudo_in_has =
       traversal_context.ForElementAffectedByPseudoInHas();
 
+  if (element) {
+    pseudo_has_invalidation_walk_count_++;
+  }
   while (element) {
     traverse_to_parent |= element->AncestorsOrAncestorSiblingsAffectedByHas();
     traverse_to_previous_sibling = element->GetSiblingsAffectedByHasFlags();
 
+    unsigned visit_flags = 0;
+    if (!for_element_affected_by_pseudo_in_has) {
+      visit_flags |= kPseudoHasVisitForAllElements;
+    }
+    if (traverse_to_parent) {
+      visit_flags |= kPseudoHasVisitTraversingToParent;
+    }
+    auto result =
+        pseudo_has_invalidation_visits_.insert(element, 1u << visit_flags);
+    if (!result.is_new_entry) {
+      unsigned& previous_visits = result.stored_value->value;
+      if (previous_visits & PseudoHasVisitsCovering(visit_flags)) {
+        pseudo_has_invalidation_coalesced_walk_count_++;
+        return;
+      }
+      previous_visits |= 1u << visit_flags;
+    }
+
     InvalidateElementAffectedByHas(*element,
                                    for_element_affected_by_pseudo_in_has);
 
@@ -2057,10 +2181,22 @@ void StyleEngine::ScheduleInvalidationsForHasPseudoAffectedByInsertion(
   }
 }
 
+void StyleEngine::ForgetPseudoHasInvalidationVisits(Element& removed_root) {
+  if (pseudo_has_invalidation_visits_.empty()) {
+    return;
+  }
+  for (Element& element :
+       ElementTraversal::InclusiveDescendantsOf(removed_root)) {
+    pseudo_has_invalidation_visits_.erase(&element);
+  }
+}
+
 void StyleEngine::ScheduleInvalidationsForHasPseudoAffectedByRemoval(
     Element* parent,
     Node* node_before_change,
     Element& removed_element) {
+  ForgetPseudoHasInvalidationVisits(removed_element);
+
   if (!parent) {
     return;
   }
@@ -2115,6 +2251,8 @@ void StyleEngine::ScheduleInvalidationsForHasPseudoAffectedByRemoval(
 
 void StyleEngine::ScheduleInvalidationsForHasPseudoWhenAllChildrenRemoved(
     Element& parent) {
+  ClearPseudoHasInvalidationVisits();
+
   if (ShouldSkipInvalidationFor(parent)) {
     return;
   }
@@ -3272,6 +3410,7 @@ void StyleEngine::RecalcStyleForContainer(Element& container,
                                           StyleRecalcChange change) {
   // The container node must not need recalc at this point.
   DCHECK(!StyleRecalcChange().ShouldRecalcStyleFor(container));
+  ClearPseudoHasInvalidationVisits();
 
 #if DCHECK_IS_ON()
   const ComputedStyle* old_element_style = container.GetComputedStyle();
@@ -3553,6 +3692,7 @@ StyleRulePositionTry* StyleEngine::GetPositionTryRule(
 void StyleEngine::RecalcStyle(StyleRecalcChange change,
                               const StyleRecalcContext& style_recalc_context) {
   DCHECK(GetDocument().documentElement());
+  ClearPseudoHasInvalidationVisits();
   ScriptForbiddenScope forbid_script;
   SkipStyleRecalcScope skip_scope(*this);
   CheckPseudoHasCacheScope check_pseudo_has_cache_scope(
@@ -3580,6 +3720,7 @@ void StyleEngine::RecalcPositionTryStyleForPseudoElement(
     PseudoElement& pseudo_element,
     const StyleRecalcChange style_recalc_change,
     const StyleRecalcContext& style_recalc_context) {
+  ClearPseudoHasInvalidationVisits();
   ScriptForbiddenScope forbid_script;
   SkipStyleRecalcScope skip_scope(*this);
   CheckPseudoHasCacheScope check_pseudo_has_cache_scope(
@@ -3712,11 +3853,40 @@ void StyleEngine::UpdateStyleAndLayoutTree() {
   if (GetDocument().documentElement()) {
     UpdateViewportSize();
     NthIndexCache nth_index_cache(GetDocument());
+    if (pseudo_has_invalidation_walk_count_) {
+      // How many of the :has() invalidation walks since the last update were
+      // cut short by earlier walks through the same elements.
+      base::UmaHistogramCounts100000("Blink.Style.HasInvalidation.Walks",
+                                     pseudo_has_invalidation_walk_count_);
+      base::UmaHistogramCounts100000(
+          "Blink.Style.HasInvalidation.CoalescedWalks",
+          pseudo_has_invalidation_coalesced_walk_count_);
+      pseudo_has_invalidation_walk_count_ = 0;
+      pseudo_has_invalidation_coalesced_walk_count_ = 0;
+    }
     if (NeedsStyleRecalc()) {
       TRACE_EVENT0("blink,blink_style", "Document::recalcStyle");
       SCOPED_BLINK_UMA_HISTOGRAM_TIMER_HIGHRES("Style.RecalcTime");
       Element* viewport_defining = GetDocument().ViewportDefiningElement();
+      const unsigned style_for_element_count = StyleForElementCount();
+      const unsigned ancestor_filter_rejected_count =
+          AncestorFilterRejectedCount();
+      const unsigned ancestor_filter_passed_not_matched_count =
+          AncestorFilterPassedNotMatchedCount();
       RecalcStyle();
+      // Together with Style.RecalcTime, tells how much of the time goes to
+      // large recalcs, such as theme switches, that restyle most of the page.
+      base::UmaHistogramCounts100000(
+          "Blink.Style.RecalcElementCount",
+          StyleForElementCount() - style_for_element_count);
+      // Tells how well SelectorFilter keeps rejecting rules on large pages.
+      base::UmaHistogramCounts10M(
+          "Blink.Style.AncestorFilter.RejectedRules",
+          AncestorFilterRejectedCount() - ancestor_filter_rejected_count);
+      base::UmaHistogramCounts10M(
+          "Blink.Style.AncestorFilter.PassedNotMatchedRules",
+          AncestorFilterPassedNotMatchedCount() -
+              ancestor_filter_passed_not_matched_count);
       if (viewport_defining != GetDocument().ViewportDefiningElement()) {
         ViewportDefiningElementDidChange();
       }
@@ -4190,6 +4360,19 @@ CounterStyleMap& StyleEngine::EnsureUserCounterStyleMap() {
   return *user_counter_style_map_;
 }
 
+void StyleEngine::InvalidateCounterStyleLookupCaches() {
+  ++counter_styles_version_;
+  if (!counter_style_lookups_) {
+    return;
+  }
+  base::UmaHistogramPercentage(
+      "Blink.Style.CounterStyleLookupCache.HitRate",
+      static_cast<int>(uint64_t{100} * counter_style_lookup_cache_hits_ /
+                       counter_style_lookups_));
+  counter_style_lookups_ = 0;
+  counter_style_lookup_cache_hits_ = 0;
+}
+
 const CounterStyle& StyleEngine::FindCounterStyleAcrossScopes(
     const AtomicString& name,
     const TreeScope* scope) const {
@@ -4239,6 +4422,7 @@ void StyleEngine::Trace(Visitor* visitor) const {
   visitor->Trace(layout_tree_rebuild_root_);
   visitor->Trace(font_selector_);
   visitor->Trace(text_to_sheet_cache_);
+  visitor->Trace(pseudo_has_invalidation_visits_);
   visitor->Trace(tracker_);
   visitor->Trace(text_tracks_);
   visitor->Trace(vtt_originating_element_);
@@ -533,6 +533,19 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   unsigned StyleForElementCount() const { return style_for_element_count_; }
   void IncStyleForElementCount() { style_for_element_count_++; }
 
+  // Rules rejected by the SelectorFilter ancestor filter, and rules which
+  // passed it but didn't match (an upper bound for its false positives).
+  unsigned AncestorFilterRejectedCount() const {
+    return ancestor_filter_rejected_count_;
+  }
+  unsigned AncestorFilterPassedNotMatchedCount() const {
+    return ancestor_filter_passed_not_matched_count_;
+  }
+  void AddAncestorFilterCounts(unsigned rejected, unsigned passed_not_matched) {
+    ancestor_filter_rejected_count_ += rejected;
+    ancestor_filter_passed_not_matched_count_ += passed_not_matched;
+  }
+
   StyleResolverStats* Stats() { return style_resolver_stats_.get(); }
   void SetStatsEnabled(bool);
 
@@ -586,6 +599,16 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   const CounterStyle& FindCounterStyleAcrossScopes(const AtomicString&,
                                                    const TreeScope*) const;
 
+  // CounterStyleMaps memoize the counter styles they find in ancestor maps.
+  // The memoized results are valid as long as this version doesn't change.
+  uint64_t CounterStylesVersion() const { return counter_styles_version_; }
+  void CountCounterStyleLookup(bool is_cache_hit) {
+    ++counter_style_lookups_;
+    if (is_cache_hit) {
+      ++counter_style_lookup_cache_hits_;
+    }
+  }
+
   const CascadeLayerMap* GetUserCascadeLayerMap() const {
     return user_cascade_layer_map_.Get();
   }
@@ -759,6 +782,17 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
                             WTF::TextPosition start_position,
                             RenderBlockingBehavior render_blocking_behavior);
 
+  // Inline sheets without media queries are also shared with the other
+  // documents of the same origin in this renderer, through a cache keyed by
+  // the origin and the text.
+  using SharedTextToSheetCache =
+      HeapHashMap<AtomicString, WeakMember<StyleSheetContents>>;
+  static SharedTextToSheetCache& GetSharedTextToSheetCache();
+  // Returns a null key if the sheets of this document can't be shared.
+  AtomicString SharedTextToSheetCacheKey(const AtomicString& key) const;
+  StyleSheetContents* FindSharedSheet(Element&,
+                                      const AtomicString& shared_key) const;
+
   const DocumentStyleSheetCollection& GetDocumentStyleSheetCollection() const {
     DCHECK(document_style_sheet_collection_);
     return *document_style_sheet_collection_;
@@ -830,6 +864,9 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   void AddViewTransitionRules(const ActiveStyleSheetVector& sheets);
 
   CounterStyleMap& EnsureUserCounterStyleMap();
+  // Invalidates the memoized counter style lookups, and reports the hit rate
+  // of the lookups made since the previous invalidation.
+  void InvalidateCounterStyleLookupCaches();
 
   void UpdateColorScheme();
   bool SupportsDarkColorScheme();
@@ -876,6 +913,13 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   inline void InvalidateChangedElementAffectedByLogicalCombinationsInHas(
       Element& changed_element,
       bool for_element_affected_by_pseudo_in_has);
+  // Forget the :has() invalidation walks through the elements of a removed
+  // subtree, which may be inserted elsewhere.
+  void ForgetPseudoHasInvalidationVisits(Element& removed_root);
+  // Called when style recalc may clear the invalidations of earlier walks.
+  void ClearPseudoHasInvalidationVisits() {
+    pseudo_has_invalidation_visits_.clear();
+  }
 
   // Initialization value for SkipStyleRecalcScope.
   bool AllowSkipStyleRecalcForScope() const;
@@ -980,8 +1024,20 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   HeapHashMap<AtomicString, WeakMember<StyleSheetContents>>
       text_to_sheet_cache_;
 
+  // The elements that :has() invalidation walks have visited since the last
+  // style recalc, with a bit for each way they were visited. Mutation bursts
+  // (e.g. re-rendering a list) start many walks through the same ancestors
+  // and siblings. A walk that reaches an element already visited the same way
+  // stops there, since the rest of it was already done and the resulting
+  // invalidations are still pending.
+  HeapHashMap<Member<Element>, unsigned> pseudo_has_invalidation_visits_;
+  unsigned pseudo_has_invalidation_walk_count_{0};
+  unsigned pseudo_has_invalidation_coalesced_walk_count_{0};
+
   std::unique_ptr<StyleResolverStats> style_resolver_stats_;
   unsigned style_for_element_count_{0};
+  unsigned ancestor_filter_rejected_count_{0};
+  unsigned ancestor_filter_passed_not_matched_count_{0};
 
   HeapVector<std::pair<StyleSheetKey, Member<CSSStyleSheet>>>
       injected_user_style_sheets_;
@@ -1002,6 +1058,9 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   FontPaletteValuesRuleMap font_palette_values_rule_map_;
 
   Member<CounterStyleMap> user_counter_style_map_;
+  uint64_t counter_styles_version_ = 0;
+  unsigned counter_style_lookups_ = 0;
+  unsigned counter_style_lookup_cache_hits_ = 0;
 
   Member<CascadeLayerMap> user_cascade_layer_map_;
 
@@ -8,6 +8,7 @@
 #include <limits>
 #include <memory>
 
+#include "base/test/metrics/histogram_tester.h"
 #include "build/build_config.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/public/common/css/forced_colors.h"
@@ -80,6 +81,7 @@
 #include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/testing_platform_support.h"
 #include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
+#include "third_party/blink/renderer/platform/weborigin/security_origin.h"
 #include "ui/base/ui_base_types.h"
 #include "ui/gfx/geometry/size_f.h"
 
@@ -842,6 +844,52 @@ TEST_F(StyleEngineTest, TextToSheetCache) {
   EXPECT_FALSE(sheet1->Contents()->IsUsedFromTextCache());
 }
 
+TEST_F(StyleEngineTest, TextToSheetCacheSharedAcrossDocuments) {
+  const KURL url("https://example.com/");
+  auto create_document = [&url, this](const KURL& origin_url) {
+    std::unique_ptr<DummyPageHolder> holder = DummyPageHolderWithHTML("");
+    holder->GetDocument().SetURL(url);
+    holder->GetFrame()
+        .DomWindow()
+        ->GetSecurityContext()
+        .SetSecurityOriginForTesting(SecurityOrigin::Create(origin_url));
+    return holder;
+  };
+  std::unique_ptr<DummyPageHolder> holder1 = create_document(url);
+  std::unique_ptr<DummyPageHolder> holder2 = create_document(url);
+  std::unique_ptr<DummyPageHolder> other_origin_holder =
+      create_document(KURL("https://other.example.com/"));
+
+  TextPosition min_pos = TextPosition::MinimumPosition();
+  auto create_sheet = [&min_pos](DummyPageHolder& holder, const String& text) {
+    Document& document = holder.GetDocument();
+    auto* element = MakeGarbageCollected<HTMLStyleElement>(document);
+    return document.GetStyleEngine().CreateSheet(
+        *element, text, min_pos, PendingSheetType::kNonBlocking,
+        RenderBlockingBehavior::kNonBlocking);
+  };
+
+  // Documents of the same origin share the contents, and thus the RuleSet.
+  String sheet_text("div { color: green }");
+  CSSStyleSheet* sheet1 = create_sheet(*holder1, sheet_text);
+  CSSStyleSheet* sheet2 = create_sheet(*holder2, sheet_text);
+  EXPECT_FALSE(sheet1->Contents()->IsUsedFromTextCache());
+  EXPECT_EQ(sheet1->Contents(), sheet2->Contents());
+  EXPECT_TRUE(sheet2->Contents()->IsUsedFromTextCache());
+
+  // Other origins don't.
+  CSSStyleSheet* other_origin_sheet =
+      create_sheet(*other_origin_holder, sheet_text);
+  EXPECT_NE(sheet1->Contents(), other_origin_sheet->Contents());
+
+  // Neither do sheets with media queries, whose RuleSets depend on the
+  // documents' media.
+  String media_sheet_text("@media (min-width: 100px) { div { color: red } }");
+  CSSStyleSheet* media_sheet1 = create_sheet(*holder1, media_sheet_text);
+  CSSStyleSheet* media_sheet2 = create_sheet(*holder2, media_sheet_text);
+  EXPECT_NE(media_sheet1->Contents(), media_sheet2->Contents());
+}
+
 TEST_F(StyleEngineTest, RuleSetInvalidationTypeSelectors) {
   GetDocument().body()->setInnerHTML(R"HTML(
     <div>
@@ -6061,6 +6109,47 @@ TEST_F(StyleEngineTest, HasPseudoClassInvalidationUniversalInArgument) {
   ASSERT_EQ(1U, element_count);
 }
 
+TEST_F(StyleEngineTest, HasPseudoClassInvalidationCoalescesInsertions) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>.a:has(.b) { background-color: lime; }</style>
+    <div id=div1 class='a'>
+      <div>
+        <div id=list></div>
+      </div>
+    </div>
+  )HTML");
+
+  UpdateAllLifecyclePhases();
+
+  // Only the first insertion walks up to .a. The walks for the later ones
+  // stop at #list, which the first walk already went through.
+  base::HistogramTester histogram_tester;
+  unsigned start_count = GetStyleEngine().StyleForElementCount();
+  Element* list = GetDocument().getElementById(AtomicString("list"));
+  for (int i = 0; i < 10; ++i) {
+    auto* item = MakeGarbageCollected<HTMLDivElement>(GetDocument());
+    item->setAttribute(html_names::kClassAttr, AtomicString("b"));
+    list->AppendChild(item);
+  }
+  UpdateAllLifecyclePhases();
+  unsigned element_count =
+      GetStyleEngine().StyleForElementCount() - start_count;
+  ASSERT_EQ(11U, element_count);
+  histogram_tester.ExpectUniqueSample("Blink.Style.HasInvalidation.Walks", 10,
+                                      1);
+  histogram_tester.ExpectUniqueSample(
+      "Blink.Style.HasInvalidation.CoalescedWalks", 9, 1);
+
+  // The walks after a style recalc aren't coalesced with the earlier ones.
+  start_count = GetStyleEngine().StyleForElementCount();
+  list->RemoveChild(list->firstElementChild());
+  UpdateAllLifecyclePhases();
+  element_count = GetStyleEngine().StyleForElementCount() - start_count;
+  ASSERT_EQ(1U, element_count);
+  histogram_tester.ExpectBucketCount(
+      "Blink.Style.HasInvalidation.CoalescedWalks", 0, 1);
+}
+
 TEST_F(StyleEngineTest,
        HasPseudoClassInvalidationInsertionRemovalWithPseudoInHas) {
   GetDocument().body()->setInnerHTML(R"HTML(
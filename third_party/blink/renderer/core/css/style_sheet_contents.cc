@@ -34,6 +34,7 @@
 #include "third_party/blink/renderer/core/inspector/inspector_trace_events.h"
 #include "third_party/blink/renderer/core/loader/resource/css_style_sheet_resource.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/instrumentation/histogram.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 #include "third_party/blink/renderer/platform/instrumentation/use_counter.h"
 
@@ -250,6 +251,7 @@ unsigned StyleSheetContents::RuleCount() const {
 }
 
 void StyleSheetContents::ClearRules() {
+  ClearAppendedRules();
   pre_import_layer_statement_rules_.clear();
   for (unsigned i = 0; i < import_rules_.size(); ++i) {
     DCHECK_EQ(import_rules_.at(i)->ParentStyleSheet(), this);
@@ -292,6 +294,7 @@ static wtf_size_t ReplaceRuleIfExistsInternal(const StyleRuleBase* old_rule,
 wtf_size_t StyleSheetContents::ReplaceRuleIfExists(StyleRuleBase* old_rule,
                                                    StyleRuleBase* new_rule,
                                                    wtf_size_t position_hint) {
+  ClearAppendedRules();
   if (rule_set_diff_) {
     rule_set_diff_->AddDiff(old_rule);
     rule_set_diff_->AddDiff(new_rule);
@@ -315,6 +318,17 @@ bool StyleSheetContents::WrapperInsertRule(StyleRuleBase* rule,
     rule_set_diff_->AddDiff(rule);
   }
 
+  // Only rules that end up last in child_rules_ can be added to a copy of
+  // the previous RuleSet; see ClearRuleSet().
+  if (has_unconfirmed_mutation_ && index == RuleCount() &&
+      !rule->IsImportRule() && !rule->IsNamespaceRule() &&
+      !rule->IsLayerStatementRule()) {
+    appended_rules_.push_back(rule);
+    has_unconfirmed_mutation_ = false;
+  } else {
+    ClearAppendedRules();
+  }
+
   // If the sheet starts with empty layer statements without any import or
   // namespace rules, we should be able to insert any rule before and between
   // the empty layer statements. To support this case, we move any existing
@@ -405,6 +419,7 @@ bool StyleSheetContents::WrapperInsertRule(StyleRuleBase* rule,
 bool StyleSheetContents::WrapperDeleteRule(unsigned index) {
   DCHECK(is_mutable_);
   SECURITY_DCHECK(index < RuleCount());
+  ClearAppendedRules();
 
   if (index < pre_import_layer_statement_rules_.size()) {
     if (rule_set_diff_) {
@@ -486,6 +501,9 @@ void StyleSheetContents::ParseAuthorStyleSheet(
     source_map_url_ = response.HttpHeaderField(http_names::kXSourceMap);
   }
 
+  // This runs on the main thread once the sheet has finished loading, and
+  // blocks rendering if the sheet does.
+  SCOPED_BLINK_UMA_HISTOGRAM_TIMER_HIGHRES("Style.ParseAuthorStyleSheetTime");
   const auto* context =
       MakeGarbageCollected<CSSParserContext>(ParserContext(), this);
   CSSParser::ParseSheet(context, this, sheet_text,
@@ -782,12 +800,20 @@ RuleSet& StyleSheetContents::EnsureRuleSet(const MediaQueryEvaluator& medium) {
     rule_set_diff_->NewRuleSetCleared();
   }
   if (!rule_set_) {
-    rule_set_ = MakeGarbageCollected<RuleSet>();
-    rule_set_->AddRulesFromSheet(this, medium);
+    if (rule_set_before_appends_ && !has_unconfirmed_mutation_ &&
+        !rule_set_before_appends_->DidMediaQueryResultsChange(medium)) {
+      rule_set_ = rule_set_before_appends_->CopyWithAppendedRules(
+          appended_rules_, medium);
+    }
+    if (!rule_set_) {
+      rule_set_ = MakeGarbageCollected<RuleSet>();
+      rule_set_->AddRulesFromSheet(this, medium);
+    }
     if (rule_set_diff_) {
       rule_set_diff_->NewRuleSetCreated(rule_set_);
     }
   }
+  ClearAppendedRules();
   return *rule_set_.Get();
 }
 
@@ -815,6 +841,20 @@ void StyleSheetContents::ClearRuleSet() {
     parent_sheet->ClearRuleSet();
   }
 
+  // Every mutation clears the RuleSet before making its change. Unless
+  // WrapperInsertRule() confirms that the change is an append before the
+  // next one, all rules need to be re-added in EnsureRuleSet(). Clearing
+  // for other reasons (e.g. imports loading) also goes unconfirmed.
+  if (rule_set_ && is_mutable_) {
+    rule_set_before_appends_ = rule_set_;
+    appended_rules_.clear();
+    has_unconfirmed_mutation_ = true;
+  } else if (has_unconfirmed_mutation_) {
+    ClearAppendedRules();
+  } else if (rule_set_before_appends_) {
+    has_unconfirmed_mutation_ = true;
+  }
+
   if (!rule_set_) {
     return;
   }
@@ -827,6 +867,12 @@ void StyleSheetContents::ClearRuleSet() {
   SetNeedsActiveStyleUpdateForClients(completed_clients_);
 }
 
+void StyleSheetContents::ClearAppendedRules() {
+  rule_set_before_appends_ = nullptr;
+  appended_rules_.clear();
+  has_unconfirmed_mutation_ = false;
+}
+
 static void RemoveFontFaceRules(HeapHashSet<WeakMember<CSSStyleSheet>>& clients,
                                 const StyleRuleFontFace* font_face_rule) {
   for (const auto& sheet : clients) {
@@ -856,6 +902,8 @@ void StyleSheetContents::Trace(Visitor* visitor) const {
   visitor->Trace(referenced_from_resource_);
   visitor->Trace(parser_context_);
   visitor->Trace(rule_set_diff_);
+  visitor->Trace(rule_set_before_appends_);
+  visitor->Trace(appended_rules_);
 }
 
 }  // namespace blink
@@ -251,6 +251,7 @@ class CORE_EXPORT StyleSheetContents final
  private:
   StyleSheetContents& operator=(const StyleSheetContents&) = delete;
   void NotifyRemoveFontFaceRule(const StyleRuleFontFace*);
+  void ClearAppendedRules();
 
   Document* ClientSingleOwnerDocument() const;
   Document* ClientAnyOwnerDocument() const;
@@ -288,6 +289,19 @@ class CORE_EXPORT StyleSheetContents final
   // diffs (see RuleSetDiff). Constructed by StartMutation().
   Member<RuleSetDiff> rule_set_diff_;
 
+  // If all mutations since the last RuleSet was created have appended rules
+  // to the end of the sheet, this is that RuleSet and appended_rules_ holds
+  // the appended rules, so that EnsureRuleSet() can extend a copy of it
+  // instead of re-adding every rule (see RuleSet::CopyWithAppendedRules()).
+  // This makes CSS-in-JS libraries that insertRule() one rule at a time
+  // much cheaper.
+  Member<RuleSet> rule_set_before_appends_;
+  HeapVector<Member<StyleRuleBase>> appended_rules_;
+  // Set by ClearRuleSet(), which is called at the start of every mutation,
+  // and reset when WrapperInsertRule() appends a rule. If it is still set
+  // when the next mutation starts, that mutation was not an append.
+  bool has_unconfirmed_mutation_ = false;
+
   String source_map_url_;
   RenderBlockingBehavior render_blocking_behavior_ =
       RenderBlockingBehavior::kUnset;
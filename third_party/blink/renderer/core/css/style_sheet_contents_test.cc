@@ -5,7 +5,9 @@
 #include "third_party/blink/renderer/core/css/style_sheet_contents.h"
 
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/css/media_query_evaluator.h"
 #include "third_party/blink/renderer/core/css/parser/css_parser.h"
+#include "third_party/blink/renderer/core/css/rule_set.h"
 #include "third_party/blink/renderer/core/execution_context/security_context.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 
@@ -78,4 +80,52 @@ TEST(StyleSheetContentsTest,
   EXPECT_FALSE(style_sheet->HasFailedOrCanceledSubresources());
 }
 
+TEST(StyleSheetContentsTest, AppendedRulesExtendPreviousRuleSet) {
+  auto* context = MakeGarbageCollected<CSSParserContext>(
+      kHTMLStandardMode, SecureContextMode::kInsecureContext);
+  MediaQueryEvaluator medium("screen");
+
+  auto* style_sheet = MakeGarbageCollected<StyleSheetContents>(context);
+  style_sheet->ParseString(".a { color: red } #b { color: red }");
+  RuleSet* rule_set = &style_sheet->EnsureRuleSet(medium);
+
+  // Mutate the sheet the way CSSStyleSheet::insertRule() does.
+  auto insert_rule = [&](const char* rule_text, unsigned index) {
+    style_sheet->StartMutation();
+    style_sheet->ClearRuleSet();
+    style_sheet->WrapperInsertRule(
+        CSSParser::ParseRule(context, style_sheet, CSSNestingType::kNone,
+                             /*parent_rule_for_nesting=*/nullptr, rule_text),
+        index);
+  };
+
+  insert_rule(".f .a { color: green }", 2);
+  insert_rule("@media screen { .d { color: green } }", 3);
+  RuleSet* appended_rule_set = &style_sheet->EnsureRuleSet(medium);
+  EXPECT_NE(rule_set, appended_rule_set);
+  appended_rule_set->CompactRulesIfNeeded();
+  EXPECT_EQ(4u, appended_rule_set->RuleCount());
+  ASSERT_EQ(2u, appended_rule_set->ClassRules(AtomicString("a")).size());
+  ASSERT_EQ(1u, appended_rule_set->IdRules(AtomicString("b")).size());
+  ASSERT_EQ(1u, appended_rule_set->ClassRules(AtomicString("d")).size());
+  EXPECT_EQ(0u, appended_rule_set->ClassRules(AtomicString("a"))[0]
+                    .GetPosition());
+  EXPECT_EQ(2u, appended_rule_set->ClassRules(AtomicString("a"))[1]
+                    .GetPosition());
+  EXPECT_EQ(3u, appended_rule_set->ClassRules(AtomicString("d"))[0]
+                    .GetPosition());
+
+  // Inserting anywhere else re-adds all the rules.
+  insert_rule(".e { color: green }", 0);
+  RuleSet* inserted_rule_set = &style_sheet->EnsureRuleSet(medium);
+  inserted_rule_set->CompactRulesIfNeeded();
+  EXPECT_EQ(5u, inserted_rule_set->RuleCount());
+  ASSERT_EQ(1u, inserted_rule_set->ClassRules(AtomicString("e")).size());
+  EXPECT_EQ(0u, inserted_rule_set->ClassRules(AtomicString("e"))[0]
+                    .GetPosition());
+  ASSERT_EQ(2u, inserted_rule_set->ClassRules(AtomicString("a")).size());
+  EXPECT_EQ(3u, inserted_rule_set->ClassRules(AtomicString("a"))[1]
+                    .GetPosition());
+}
+
 }  // namespace blink
@@ -347,6 +347,8 @@ const LayoutResult* BlockNode::Layout(
   const LayoutResult* layout_result = box_->CachedLayoutResult(
       constraint_space, break_token, early_break, column_spanner_path,
       &fragment_geometry, &cache_status);
+  box_->View()->CountLayoutCacheLookup(
+      constraint_space.CacheSlot(), cache_status == LayoutCacheStatus::kHit);
 
   if ((cache_status == LayoutCacheStatus::kHit ||
        cache_status == LayoutCacheStatus::kNeedsSimplifiedLayout) &&
@@ -28,6 +28,12 @@ namespace blink {
 // Some of the related design, motivation can be found in:
 // https://docs.google.com/document/d/1b0NYAD4S9BJIpHGa4JD2HLmW28f2rUh1jlqrgpU3zVU/
 //
+// Results are only reused for the exact same point. A result can't be reused
+// for a nearby point, even one inside the same box, without knowing that no
+// other content is painted above that box at the new point. That would need a
+// spatial index over the painted fragments (maintained by paint and
+// invalidated by paint invalidation), which this cache doesn't have.
+//
 
 // A cache size of 2 is used because it is relatively cheap to store;
 // and the ping-pong behaviour of some of the HitTestRequest flags during
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "base/test/metrics/histogram_tester.h"
 #include "third_party/blink/renderer/core/layout/block_break_token.h"
 #include "third_party/blink/renderer/core/layout/geometry/fragment_geometry.h"
 #include "third_party/blink/renderer/core/layout/layout_result.h"
@@ -2288,5 +2289,34 @@ TEST_F(LayoutResultCachingTest, MissGridIncorrectIntrinsicSize) {
   EXPECT_EQ(result, nullptr);
 }
 
+TEST_F(LayoutResultCachingTest, RecordsHitRateAfterLayout) {
+  SetBodyInnerHTML(R"HTML(
+    <div style="width: 100px;">
+      <div style="height: 10px;"></div>
+      <div style="height: 10px;"></div>
+      <div id="target" style="height: 10px;"></div>
+    </div>
+  )HTML");
+
+  base::HistogramTester histogram_tester;
+  UpdateAllLifecyclePhasesForTest();
+  histogram_tester.ExpectTotalCount("Blink.Layout.LayoutResultCache.HitRate",
+                                    0);
+
+  GetElementById("target")->setAttribute(html_names::kStyleAttr,
+                                         AtomicString("height: 20px;"));
+  UpdateAllLifecyclePhasesForTest();
+  // The two unchanged siblings hit the cache, their ancestors and the target
+  // itself don't.
+  histogram_tester.ExpectTotalCount("Blink.Layout.LayoutResultCache.HitRate",
+                                    1);
+  int64_t hit_rate =
+      histogram_tester.GetTotalSum("Blink.Layout.LayoutResultCache.HitRate");
+  EXPECT_GT(hit_rate, 0);
+  EXPECT_LT(hit_rate, 100);
+  EXPECT_EQ(0u, GetLayoutView().LayoutCacheLookupsForTesting(
+                    LayoutResultCacheSlot::kLayout));
+}
+
 }  // namespace
 }  // namespace blink
@@ -0,0 +1,67 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/dom/text.h"
+#include "third_party/blink/renderer/core/layout/layout_text.h"
+#include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+class LayoutTextPerfTest : public RenderingTest {
+ public:
+  // Returns about `size` characters of chat-log-like text: short numbered
+  // lines of words.
+  static String MakeText(wtf_size_t size);
+
+  // Measures the main-thread time to lay out `text` after inserting it into
+  // the element with id "log".
+  void RunPerfTest(const String& text);
+};
+
+String LayoutTextPerfTest::MakeText(wtf_size_t size) {
+  StringBuilder builder;
+  builder.ReserveCapacity(size);
+  for (unsigned i = 0; builder.length() < size; ++i) {
+    builder.AppendNumber(i);
+    builder.Append(": lorem ipsum dolor sit amet, consectetur elit\n");
+  }
+  return builder.ToString();
+}
+
+void LayoutTextPerfTest::RunPerfTest(const String& text) {
+  Element* log = GetElementById("log");
+  log->appendChild(GetDocument().createTextNode(text));
+
+  // Style and layout tree building happen outside of the timed section, so
+  // that it only covers layout itself, which includes shaping the new text.
+  GetDocument().UpdateStyleAndLayoutTree();
+  base::TimeTicks start = base::TimeTicks::Now();
+  UpdateAllLifecyclePhasesForTest();
+  LOG(ERROR) << "  Time to lay out " << text.length()
+             << " characters of inserted text: "
+             << (base::TimeTicks::Now() - start).InMilliseconds() << "ms";
+
+  EXPECT_TRUE(To<LayoutText>(log->firstChild()->GetLayoutObject())
+                  ->HasInlineFragments());
+}
+
+TEST_F(LayoutTextPerfTest, InsertLargeText) {
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      #log {
+        width: 600px;
+        white-space: pre-wrap;
+        font-family: sans-serif;
+      }
+    </style>
+    <div id="log"></div>
+  )HTML");
+
+  RunPerfTest(MakeText(1024 * 1024));
+}
+
+}  // namespace blink
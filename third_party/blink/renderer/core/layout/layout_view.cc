@@ -23,6 +23,7 @@
 
 #include <inttypes.h>
 
+#include "base/metrics/histogram_functions.h"
 #include "base/time/time.h"
 #include "build/build_config.h"
 #include "third_party/blink/public/common/features.h"
@@ -866,6 +867,25 @@ void LayoutView::LayoutRoot() {
 
   BlockNode(this).Layout(builder.ToConstraintSpace());
   initial_containing_block_resize_handled_list_ = nullptr;
+
+  RecordLayoutCacheHitRates();
+}
+
+void LayoutView::RecordLayoutCacheHitRates() {
+  NOT_DESTROYED();
+  for (size_t slot = 0; slot < layout_cache_counts_.size(); ++slot) {
+    LayoutCacheCounts& counts = layout_cache_counts_[slot];
+    if (!counts.lookups) {
+      continue;
+    }
+    base::UmaHistogramPercentage(
+        static_cast<LayoutResultCacheSlot>(slot) ==
+                LayoutResultCacheSlot::kLayout
+            ? "Blink.Layout.LayoutResultCache.HitRate"
+            : "Blink.Layout.MeasureResultCache.HitRate",
+        static_cast<int>(uint64_t{100} * counts.hits / counts.lookups));
+    counts = LayoutCacheCounts();
+  }
 }
 
 void LayoutView::UpdateAfterLayout() {
@@ -22,6 +22,8 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_LAYOUT_VIEW_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_LAYOUT_VIEW_H_
 
+#include <array>
+
 #include "base/check_op.h"
 #include "base/dcheck_is_on.h"
 #include "third_party/blink/public/mojom/scroll/scrollbar_mode.mojom-blink.h"
@@ -43,6 +45,7 @@ class HitTestResult;
 class LayoutText;
 class LayoutViewTransitionRoot;
 class LocalFrameView;
+enum class LayoutResultCacheSlot;
 
 struct VariableLengthTransformResult {
   wtf_size_t original_length;
@@ -92,6 +95,26 @@ class CORE_EXPORT LayoutView : public LayoutNGBlockFlow {
 
   void ClearHitTestCache();
 
+  // Counts a layout result cache lookup in BlockNode::Layout(). The hit rates
+  // for each cache slot are reported, and the counts reset, after each
+  // LayoutRoot().
+  void CountLayoutCacheLookup(LayoutResultCacheSlot slot, bool is_hit) {
+    NOT_DESTROYED();
+    LayoutCacheCounts& counts = layout_cache_counts_[static_cast<size_t>(slot)];
+    ++counts.lookups;
+    if (is_hit) {
+      ++counts.hits;
+    }
+  }
+  unsigned LayoutCacheLookupsForTesting(LayoutResultCacheSlot slot) const {
+    NOT_DESTROYED();
+    return layout_cache_counts_[static_cast<size_t>(slot)].lookups;
+  }
+  unsigned LayoutCacheHitsForTesting(LayoutResultCacheSlot slot) const {
+    NOT_DESTROYED();
+    return layout_cache_counts_[static_cast<size_t>(slot)].hits;
+  }
+
   const char* GetName() const override {
     NOT_DESTROYED();
     return "LayoutView";
@@ -353,6 +376,7 @@ class CORE_EXPORT LayoutView : public LayoutNGBlockFlow {
 
  private:
   void StyleDidChange(StyleDifference, const ComputedStyle* old_style) override;
+  void RecordLayoutCacheHitRates();
   int ViewLogicalWidthForBoxSizing() const {
     NOT_DESTROYED();
     return ViewLogicalWidth(kIncludeScrollbars);
@@ -409,6 +433,13 @@ class CORE_EXPORT LayoutView : public LayoutNGBlockFlow {
   unsigned hit_test_cache_hits_;
   Member<HitTestCache> hit_test_cache_;
 
+  struct LayoutCacheCounts {
+    unsigned lookups = 0;
+    unsigned hits = 0;
+  };
+  // Indexed by LayoutResultCacheSlot.
+  std::array<LayoutCacheCounts, 2> layout_cache_counts_;
+
   // FrameViewAutoSizeInfo controls scrollbar appearance manually rather than
   // relying on layout. These members are used to override the ScrollbarModes
   // calculated from style. kScrollbarAuto disables the override.
@@ -139,6 +139,11 @@ class CORE_EXPORT ImageResource final
   Member<MultipartImageResourceParser> multipart_parser_;
   base::TimeTicks last_flush_time_;
 
+  // Main-thread time spent in ImageResourceContent::UpdateImage(), i.e.
+  // handing the received bytes to the image, which sniffs the headers and
+  // size as they arrive. Recorded to UMA when loading finishes.
+  base::TimeDelta update_image_time_;
+
   MultipartParsingState multipart_parsing_state_ =
       MultipartParsingState::kWaitingForFirstPart;
 
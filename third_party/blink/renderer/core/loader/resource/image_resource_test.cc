@@ -518,6 +518,26 @@ TEST_F(ImageResourceTest, UpdateBitmapImages) {
   EXPECT_TRUE(IsA<BitmapImage>(image_resource->GetContent()->GetImage()));
 }
 
+TEST_F(ImageResourceTest, RecordsUpdateImageTimeOnFinish) {
+  base::HistogramTester histogram_tester;
+  ImageResource* image_resource = ImageResource::CreateForTest(NullURL());
+  image_resource->NotifyStartLoad();
+
+  ResourceResponse resource_response(NullURL());
+  resource_response.SetMimeType(AtomicString("image/jpeg"));
+  resource_response.SetExpectedContentLength(sizeof(kJpegImage));
+  image_resource->ResponseReceived(resource_response);
+  image_resource->AppendData(reinterpret_cast<const char*>(kJpegImage),
+                             sizeof(kJpegImage));
+  histogram_tester.ExpectTotalCount(
+      "Blink.ImageResource.MainThreadUpdateImageTime", 0);
+
+  image_resource->FinishForTest();
+  EXPECT_FALSE(image_resource->ErrorOccurred());
+  histogram_tester.ExpectTotalCount(
+      "Blink.ImageResource.MainThreadUpdateImageTime", 1);
+}
+
 TEST_F(ImageResourceTest, SVGImage) {
   KURL url("http://127.0.0.1:8000/foo");
   ImageResource* image_resource = ImageResource::CreateForTest(url);
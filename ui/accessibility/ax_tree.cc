@@ -1115,6 +1115,11 @@ bool AXTree::Unserialize(const AXTreeUpdate& update) {
   SCOPED_UMA_HISTOGRAM_TIMER_MICROS(
       "Accessibility.Performance.Tree.Unserialize2");
 
+  // When the whole tree is being (re)created, size the id map up front so
+  // that large documents don't rehash it repeatedly while nodes are added.
+  if (update_state.root_will_be_created)
+    id_map_.reserve(update.nodes.size());
+
   // Notify observers of subtrees and nodes that are about to be destroyed or
   // reparented, this must be done before applying any updates to the tree.
   for (auto&& pair : update_state.node_id_to_pending_data) {
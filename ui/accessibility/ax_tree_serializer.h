@@ -9,10 +9,11 @@
 #include <stdint.h>
 
 #include <ctime>
-#include <map>
 #include <memory>
 #include <ostream>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "base/debug/crash_logging.h"
@@ -241,7 +242,7 @@ class AXTreeSerializer {
   raw_ptr<ClientTreeNode, DanglingUntriaged> client_root_ = nullptr;
 
   // A map from IDs to nodes in the client tree.
-  std::map<AXNodeID, ClientTreeNode*> client_id_map_;
+  std::unordered_map<AXNodeID, ClientTreeNode*> client_id_map_;
 
   // The maximum number of nodes to serialize in a given call to
   // SerializeChanges, or 0 if there's no maximum.
@@ -631,7 +632,7 @@ AXTreeSerializer<AXSourceNode,
                  AXTreeUpdateType,
                  AXTreeDataType,
                  AXNodeDataType>::ClientTreeNodeById(AXNodeID id) {
-  std::map<AXNodeID, ClientTreeNode*>::iterator iter = client_id_map_.find(id);
+  auto iter = client_id_map_.find(id);
   if (iter != client_id_map_.end())
     return iter->second;
   return nullptr;
@@ -976,14 +977,15 @@ bool AXTreeSerializer<AXSourceNode,
   // If we've hit the maximum number of serialized nodes, pretend
   // this node has no children but keep going so that we get
   // consistent results.
-  std::set<AXNodeID> new_ignored_ids;
-  std::set<AXNodeID> new_child_ids;
+  std::unordered_set<AXNodeID> new_ignored_ids;
+  std::unordered_set<AXNodeID> new_child_ids;
   size_t num_children = 0;
   if (should_terminate_early) {
     incomplete_node_ids_.push_back(id);
   } else {
     tree_->CacheChildrenIfNeeded(node);
     num_children = tree_->GetChildCount(node);
+    new_child_ids.reserve(num_children);
   }
   for (size_t i = 0; i < num_children; ++i) {
     AXSourceNode child = tree_->ChildAt(node, i);
@@ -1027,16 +1029,17 @@ bool AXTreeSerializer<AXSourceNode,
   // first in a separate pass so that nodes that are reparented
   // don't end up children of two different parents in the middle
   // of an update, which can lead to a double-free.
-  std::map<AXNodeID, ClientTreeNode*> client_child_id_map;
+  std::unordered_set<AXNodeID> reused_child_ids;
   std::vector<ClientTreeNode*> old_children;
   old_children.swap(client_node->children);
+  reused_child_ids.reserve(old_children.size());
   for (size_t i = 0; i < old_children.size(); ++i) {
     ClientTreeNode* old_child = old_children[i];
     int old_child_id = old_child->id;
     if (new_child_ids.find(old_child_id) == new_child_ids.end()) {
       DeleteClientSubtree(old_child);
     } else {
-      client_child_id_map[old_child_id] = old_child;
+      reused_child_ids.insert(old_child_id);
     }
   }
 
@@ -1089,7 +1092,7 @@ bool AXTreeSerializer<AXSourceNode,
     new_child_ids.erase(child_id);
     actual_serialized_node_child_ids.push_back(child_id);
     ClientTreeNode* reused_child = nullptr;
-    if (client_child_id_map.find(child_id) != client_child_id_map.end())
+    if (reused_child_ids.find(child_id) != reused_child_ids.end())
       reused_child = ClientTreeNodeById(child_id);
     if (reused_child) {
       client_node->children.push_back(reused_child);
@@ -10,6 +10,7 @@
 
 #include "base/check_op.h"
 #include "base/functional/bind.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/observer_list.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/trace_event/trace_event.h"
@@ -775,6 +776,17 @@ void WindowEventDispatcher::OnWindowInitialized(Window* window) {
 ////////////////////////////////////////////////////////////////////////////////
 // WindowEventDispatcher, private:
 
+void WindowEventDispatcher::HoldMoveEvent(
+    std::unique_ptr<ui::LocatedEvent> event) {
+  if (held_move_event_) {
+    ++held_move_event_coalesced_count_;
+  } else {
+    held_move_event_coalesced_count_ = 0;
+    first_held_move_time_ = event->time_stamp();
+  }
+  held_move_event_ = std::move(event);
+}
+
 ui::EventDispatchDetails WindowEventDispatcher::DispatchHeldEvents() {
   if (!held_repostable_event_ && !held_move_event_) {
     if (did_dispatch_held_move_event_callback_)
@@ -811,6 +823,10 @@ ui::EventDispatchDetails WindowEventDispatcher::DispatchHeldEvents() {
     // so drop the held mouse event.
     if (event->IsTouchEvent() ||
         (event->IsMouseEvent() && !synthesize_mouse_move_)) {
+      base::UmaHistogramCounts100("Event.Aura.HeldMoveEvents.CoalescedCount",
+                                  held_move_event_coalesced_count_);
+      base::UmaHistogramTimes("Event.Aura.HeldMoveEvents.HoldDuration",
+                              ui::EventTimeForNow() - first_held_move_time_);
       dispatching_held_event_ = event.get();
       dispatch_details = OnEventFromSource(event.get());
     }
@@ -929,8 +945,7 @@ DispatchDetails WindowEventDispatcher::PreDispatchMouseEvent(
 
   if (IsEventCandidateForHold(*event) && !dispatching_held_event_) {
     if (move_hold_count_) {
-      held_move_event_ =
-          std::make_unique<ui::MouseEvent>(*event, target, window());
+      HoldMoveEvent(std::make_unique<ui::MouseEvent>(*event, target, window()));
       event->SetHandled();
       return DispatchDetails();
     } else {
@@ -1036,8 +1051,7 @@ DispatchDetails WindowEventDispatcher::PreDispatchTouchEvent(
     ui::TouchEvent* event) {
   if (event->type() == ui::ET_TOUCH_MOVED && move_hold_count_ &&
       !dispatching_held_event_) {
-    held_move_event_ =
-        std::make_unique<ui::TouchEvent>(*event, target, window());
+    HoldMoveEvent(std::make_unique<ui::TouchEvent>(*event, target, window()));
     event->SetHandled();
     return DispatchDetails();
   }
@@ -14,6 +14,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/scoped_multi_source_observation.h"
+#include "base/time/time.h"
 #include "cc/metrics/events_metrics_manager.h"
 #include "ui/aura/aura_export.h"
 #include "ui/aura/client/capture_delegate.h"
@@ -258,6 +259,9 @@ class AURA_EXPORT WindowEventDispatcher : public ui::EventProcessor,
   // Overridden from EnvObserver:
   void OnWindowInitialized(Window* window) override;
 
+  // Replaces |held_move_event_| with |event|, counting the replaced moves.
+  void HoldMoveEvent(std::unique_ptr<ui::LocatedEvent> event);
+
   // We hold and aggregate mouse drags and touch moves as a way of throttling
   // resizes when HoldMouseMoves() is called. The following methods are used to
   // dispatch held and newly incoming mouse and touch events, typically when an
@@ -312,6 +316,10 @@ class AURA_EXPORT WindowEventDispatcher : public ui::EventProcessor,
   int move_hold_count_ = 0;
   // The location of |held_move_event_| is in |window_|'s coordinate.
   std::unique_ptr<ui::LocatedEvent> held_move_event_;
+  // Number of earlier moves |held_move_event_| replaced, and the time stamp of
+  // the first of them. Reported when the held move is dispatched.
+  int held_move_event_coalesced_count_ = 0;
+  base::TimeTicks first_held_move_time_;
 
   // Allowing for reposting of events. Used when exiting context menus.
   std::unique_ptr<ui::LocatedEvent> held_repostable_event_;
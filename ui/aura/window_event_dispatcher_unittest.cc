@@ -884,6 +884,30 @@ TEST_F(WindowEventDispatcherTest, MouseMovesHeld) {
   root_window()->RemovePreTargetHandler(&recorder);
 }
 
+TEST_F(WindowEventDispatcherTest, HeldMouseMovesRecordCoalescedCount) {
+  base::HistogramTester histogram_tester;
+  test::TestWindowDelegate delegate;
+  std::unique_ptr<aura::Window> window(CreateTestWindowWithDelegate(
+      &delegate, 1, gfx::Rect(0, 0, 100, 100), root_window()));
+
+  host()->dispatcher()->HoldPointerMoves();
+  for (int i = 0; i < 3; ++i) {
+    ui::MouseEvent mouse_dragged_event(
+        ui::ET_MOUSE_DRAGGED, gfx::Point(i, i), gfx::Point(i, i),
+        ui::EventTimeForNow(), 0, 0);
+    DispatchEventUsingWindowDispatcher(&mouse_dragged_event);
+  }
+  histogram_tester.ExpectTotalCount("Event.Aura.HeldMoveEvents.CoalescedCount",
+                                    0);
+
+  host()->dispatcher()->ReleasePointerMoves();
+  RunAllPendingInMessageLoop();
+  histogram_tester.ExpectUniqueSample(
+      "Event.Aura.HeldMoveEvents.CoalescedCount", 2, 1);
+  histogram_tester.ExpectTotalCount("Event.Aura.HeldMoveEvents.HoldDuration",
+                                    1);
+}
+
 TEST_F(WindowEventDispatcherTest, TouchMovesHeld) {
   EventFilterRecorder recorder;
   root_window()->AddPreTargetHandler(&recorder);
@@ -14,6 +14,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/time/time.h"
+#include "base/trace_event/trace_event.h"
 #include "cc/animation/animation.h"
 #include "ui/compositor/callback_layer_animation_observer.h"
 #include "ui/compositor/compositor.h"
@@ -66,8 +67,12 @@ class AnimationThroughputReporter::AnimationTracker
   void OnAnimatorDetachedFromTimeline() override {
     // Gives up tracking when detached from the timeline.
     first_animation_group_id_.reset();
-    if (throughput_tracker_)
+    if (throughput_tracker_) {
       throughput_tracker_.reset();
+      TRACE_EVENT_NESTABLE_ASYNC_END1("ui", "AnimationThroughputReporter",
+                                      TRACE_ID_LOCAL(this), "result",
+                                      "detached");
+    }
 
     // OnAnimationEnded would not happen after detached from the timeline.
     // So do the clean up here.
@@ -119,6 +124,12 @@ class AnimationThroughputReporter::AnimationTracker
         AnimationThroughputReporter::GetCompositor(animator_);
     throughput_tracker_ = compositor->RequestNewThroughputTracker();
     throughput_tracker_->Start(report_callback_);
+
+    // Spans the tracked frames in traces, so that the frames dropped during
+    // the span can be attributed to the animated layer.
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN1(
+        "ui", "AnimationThroughputReporter", TRACE_ID_LOCAL(this), "layer",
+        AnimationThroughputReporter::GetLayerName(animator_));
   }
 
   // Invoked when all animation sequences finish.
@@ -129,6 +140,9 @@ class AnimationThroughputReporter::AnimationTracker
         throughput_tracker_->Cancel();
       else
         throughput_tracker_->Stop();
+      TRACE_EVENT_NESTABLE_ASYNC_END1(
+          "ui", "AnimationThroughputReporter", TRACE_ID_LOCAL(this), "result",
+          started_animations_aborted_ ? "aborted" : "finished");
 
       // `OnAnimationEnded` could be called multiple times when scheduling
       // animations. Destroy the tracker so that it is not stopped/canceled
@@ -191,6 +205,12 @@ Compositor* AnimationThroughputReporter::GetCompositor(
   return animator->delegate()->GetLayer()->GetCompositor();
 }
 
+// static
+const std::string& AnimationThroughputReporter::GetLayerName(
+    LayerAnimator* animator) {
+  return animator->delegate()->GetLayer()->name();
+}
+
 // static
 bool AnimationThroughputReporter::IsAnimatorAttachedToTimeline(
     LayerAnimator* animator) {
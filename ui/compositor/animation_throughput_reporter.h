@@ -6,6 +6,7 @@
 #define UI_COMPOSITOR_ANIMATION_THROUGHPUT_REPORTER_H_
 
 #include <memory>
+#include <string>
 
 #include "base/functional/callback_forward.h"
 #include "base/memory/scoped_refptr.h"
@@ -54,6 +55,9 @@ class COMPOSITOR_EXPORT AnimationThroughputReporter {
   // Listed here to access LayerAnimator's protected delegate().
   static Compositor* GetCompositor(LayerAnimator* animator);
 
+  // Returns the name of the layer animated by |animator|, for traces.
+  static const std::string& GetLayerName(LayerAnimator* animator);
+
   // Whether |animator_| is attached to a timeline.
   // List here to access LayerAnimation's private |anmation_| member.
   static bool IsAnimatorAttachedToTimeline(LayerAnimator* animator);
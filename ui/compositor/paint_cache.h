@@ -17,6 +17,11 @@ class PaintRecorder;
 
 // A class that holds the output of a PaintRecorder to be reused when the
 // object that created the PaintRecorder has not been changed/invalidated.
+//
+// The recording is reused or replaced as a whole. Callers that paint a tree,
+// like views::View, keep one PaintCache per node for the node's own painting
+// only, so an invalidation re-records just the nodes it intersects and the
+// rest of the tree is appended from their caches.
 class COMPOSITOR_EXPORT PaintCache {
  public:
   PaintCache();
@@ -171,7 +171,11 @@ bool EncodeSkPixmap(const SkPixmap& src,
                     std::vector<unsigned char>* output,
                     int zlib_level,
                     bool disable_filters) {
-  if (discard_transparency) {
+  // If every pixel is already opaque, discarding transparency doesn't change
+  // any pixel values, so skip the full-size unpremultiplied copy below.
+  const bool is_opaque = src.info().alphaType() == kOpaque_SkAlphaType ||
+                         src.computeIsOpaque();
+  if (discard_transparency && !is_opaque) {
     SkImageInfo opaque_info = src.info().makeAlphaType(kOpaque_SkAlphaType);
     SkBitmap copy;
     if (!copy.tryAllocPixels(opaque_info)) {
@@ -193,7 +197,7 @@ bool EncodeSkPixmap(const SkPixmap& src,
 
   // If the image's pixels are all opaque, encode the PNG as opaque, regardless
   // of the pixmap's alphaType.
-  if (src.info().alphaType() != kOpaque_SkAlphaType && src.computeIsOpaque()) {
+  if (src.info().alphaType() != kOpaque_SkAlphaType && is_opaque) {
     SkPixmap opaque_pixmap{src.info().makeAlphaType(kOpaque_SkAlphaType),
                            src.addr(), src.rowBytes()};
     return EncodeSkPixmap(opaque_pixmap, comments, output, zlib_level,
@@ -762,6 +762,30 @@ TEST(PNGCodec, EncoderSavesImagesWithAllOpaquePixelsAsOpaque) {
   EXPECT_EQ(bitmap.info().alphaType(), kOpaque_SkAlphaType);
 }
 
+TEST(PNGCodec, EncoderDiscardTransparencyOfOpaqueImageMatchesOpaqueEncode) {
+  const int w = 20, h = 20;
+
+  // Create an RGBA image with all opaque pixels.
+  std::vector<unsigned char> original;
+  MakeRGBAImage(w, h, /*use_transparency=*/false, &original);
+
+  std::vector<unsigned char> kept_png_data;
+  ASSERT_TRUE(PNGCodec::Encode(&original.front(), PNGCodec::FORMAT_RGBA,
+                               gfx::Size(w, h), w * 4,
+                               /*discard_transparency=*/false,
+                               std::vector<PNGCodec::Comment>{},
+                               &kept_png_data));
+  std::vector<unsigned char> discarded_png_data;
+  ASSERT_TRUE(PNGCodec::Encode(&original.front(), PNGCodec::FORMAT_RGBA,
+                               gfx::Size(w, h), w * 4,
+                               /*discard_transparency=*/true,
+                               std::vector<PNGCodec::Comment>{},
+                               &discarded_png_data));
+
+  // There is no transparency to discard, so both encodings are identical.
+  EXPECT_EQ(kept_png_data, discarded_png_data);
+}
+
 // Test that corrupted data decompression causes failures.
 TEST(PNGCodec, DecodeCorrupted) {
   int w = 20, h = 20;
@@ -20,9 +20,6 @@ namespace gfx {
 bool WebpCodec::Encode(const SkPixmap& input,
                        int quality,
                        std::vector<unsigned char>* output) {
-  output->clear();
-  VectorWStream dst(output);
-
   SkWebpEncoder::Options options;
   options.fQuality = quality;
   bool use_lossless_webp = quality >= 100 && base::FeatureList::IsEnabled(
@@ -30,6 +27,16 @@ bool WebpCodec::Encode(const SkPixmap& input,
   options.fCompression = use_lossless_webp
                              ? SkWebpEncoder::Compression::kLossless
                              : SkWebpEncoder::Compression::kLossy;
+  return Encode(input, options, output);
+}
+
+bool WebpCodec::Encode(const SkPixmap& input,
+                       const SkWebpEncoder::Options& options,
+                       std::vector<unsigned char>* output) {
+  // clear() keeps the vector's capacity, so callers encoding many images in a
+  // row can pass the same |output| to avoid reallocating it each time.
+  output->clear();
+  VectorWStream dst(output);
   return SkWebpEncoder::Encode(&dst, input, options);
 }
 
@@ -61,6 +68,7 @@ std::optional<std::vector<uint8_t>> WebpCodec::EncodeAnimated(
     const std::vector<Frame>& frames,
     const SkWebpEncoder::Options& options) {
   std::vector<SkEncoder::Frame> pixmap_frames;
+  pixmap_frames.reserve(frames.size());
   for (const auto& frame : frames) {
     SkEncoder::Frame pixmap_frame;
     if (!frame.bitmap.peekPixels(&pixmap_frame.pixmap)) {
@@ -48,6 +48,16 @@ class CODEC_EXPORT WebpCodec {
                      int quality,
                      std::vector<unsigned char>* output);
 
+  // Encodes the given raw 'input' pixmap using the supplied encoder 'options'.
+  // This allows callers to pick the compression mode and, for lossless
+  // encoding, to trade encode speed against size through 'options.fQuality'
+  // (which then acts as the effort level). 'output' is cleared but keeps its
+  // capacity, so it can be reused across encodes. Returns true on success; on
+  // failure the contents of 'output' are undefined.
+  static bool Encode(const SkPixmap& input,
+                     const SkWebpEncoder::Options& options,
+                     std::vector<unsigned char>* output);
+
   // Encodes (lossy) the 'input' bitmap. The encoded WebP data will be written
   // into the supplied vector and true will be returned on success. On failure
   // (false), the contents of the output buffer are undefined.
@@ -335,23 +335,6 @@ class ColorTransformPerChannelTransferFn : public ColorTransformStep {
   explicit ColorTransformPerChannelTransferFn(bool extended)
       : extended_(extended) {}
 
-  void Transform(ColorTransform::TriStim* colors,
-                 size_t num,
-                 const ColorTransform::RuntimeOptions& options) const override {
-    for (size_t i = 0; i < num; i++) {
-      ColorTransform::TriStim& c = colors[i];
-      if (extended_) {
-        c.set_x(copysign(Evaluate(abs(c.x())), c.x()));
-        c.set_y(copysign(Evaluate(abs(c.y())), c.y()));
-        c.set_z(copysign(Evaluate(abs(c.z())), c.z()));
-      } else {
-        c.set_x(Evaluate(c.x()));
-        c.set_y(Evaluate(c.y()));
-        c.set_z(Evaluate(c.z()));
-      }
-    }
-  }
-
   void AppendSkShaderSource(std::stringstream* src) const override {
     if (extended_) {
       *src << "{  half v = abs(color.r);" << endl;
@@ -380,12 +363,55 @@ class ColorTransformPerChannelTransferFn : public ColorTransformStep {
   virtual void AppendTransferShaderSource(std::stringstream* src,
                                           bool is_glsl) const = 0;
 
+ protected:
+  // Applies |evaluate| to every channel of |colors|.
+  template <typename Evaluator>
+  void TransformPerChannel(ColorTransform::TriStim* colors,
+                           size_t num,
+                           Evaluator evaluate) const {
+    if (extended_) {
+      for (size_t i = 0; i < num; i++) {
+        ColorTransform::TriStim& c = colors[i];
+        c.set_x(copysign(evaluate(abs(c.x())), c.x()));
+        c.set_y(copysign(evaluate(abs(c.y())), c.y()));
+        c.set_z(copysign(evaluate(abs(c.z())), c.z()));
+      }
+    } else {
+      for (size_t i = 0; i < num; i++) {
+        ColorTransform::TriStim& c = colors[i];
+        c.set_x(evaluate(c.x()));
+        c.set_y(evaluate(c.y()));
+        c.set_z(evaluate(c.z()));
+      }
+    }
+  }
+
  private:
   // True if the transfer function is extended to be defined for all real
   // values by point symmetry.
   bool extended_ = false;
 };
 
+// Base of the concrete transfer functions. It transforms pixels with a
+// non-virtual call to |Derived|'s Evaluate(), which the compiler can inline
+// into the per-pixel loop, instead of making three virtual calls per pixel.
+template <typename Derived>
+class ColorTransformPerChannelTransferFnImpl
+    : public ColorTransformPerChannelTransferFn {
+ public:
+  explicit ColorTransformPerChannelTransferFnImpl(bool extended)
+      : ColorTransformPerChannelTransferFn(extended) {}
+
+  void Transform(ColorTransform::TriStim* colors,
+                 size_t num,
+                 const ColorTransform::RuntimeOptions& options) const override {
+    const Derived* derived = static_cast<const Derived*>(this);
+    TransformPerChannel(colors, num, [derived](float v) {
+      return derived->Derived::Evaluate(v);
+    });
+  }
+};
+
 // This class represents the piecewise-HDR function using three new parameters,
 // P, Q, and R. The function is defined as:
 //            0         : x < 0
@@ -396,7 +422,9 @@ class ColorTransformPerChannelTransferFn : public ColorTransformStep {
 //     T(x) = C*x/P+F          : x < P*D
 //            (A*x/P+B)**G + E : x < P
 //            Q*x+R            : else
-class ColorTransformPiecewiseHDR : public ColorTransformPerChannelTransferFn {
+class ColorTransformPiecewiseHDR
+    : public ColorTransformPerChannelTransferFnImpl<
+          ColorTransformPiecewiseHDR> {
  public:
   static void GetParams(const gfx::ColorSpace color_space,
                         skcms_TransferFunction* fn,
@@ -452,7 +480,7 @@ class ColorTransformPiecewiseHDR : public ColorTransformPerChannelTransferFn {
                              float p,
                              float q,
                              float r)
-      : ColorTransformPerChannelTransferFn(false),
+      : ColorTransformPerChannelTransferFnImpl(false),
         fn_(fn),
         p_(p),
         q_(q),
@@ -496,11 +524,13 @@ class ColorTransformPiecewiseHDR : public ColorTransformPerChannelTransferFn {
   const float r_;
 };
 
-class ColorTransformSkTransferFn : public ColorTransformPerChannelTransferFn {
+class ColorTransformSkTransferFn
+    : public ColorTransformPerChannelTransferFnImpl<
+          ColorTransformSkTransferFn> {
  public:
   explicit ColorTransformSkTransferFn(const skcms_TransferFunction& fn,
                                       bool extended)
-      : ColorTransformPerChannelTransferFn(extended), fn_(fn) {}
+      : ColorTransformPerChannelTransferFnImpl(extended), fn_(fn) {}
   // ColorTransformStep implementation.
   ColorTransformSkTransferFn* GetSkTransferFn() override { return this; }
   bool Join(ColorTransformStep* next_untyped) override {
@@ -565,10 +595,11 @@ class ColorTransformSkTransferFn : public ColorTransformPerChannelTransferFn {
 };
 
 // Applies the HLG OETF formulation that maps [0, 12] to [0, 1].
-class ColorTransformHLG_OETF : public ColorTransformPerChannelTransferFn {
+class ColorTransformHLG_OETF
+    : public ColorTransformPerChannelTransferFnImpl<ColorTransformHLG_OETF> {
  public:
   explicit ColorTransformHLG_OETF()
-      : ColorTransformPerChannelTransferFn(false) {}
+      : ColorTransformPerChannelTransferFnImpl(false) {}
 
   // ColorTransformPerChannelTransferFn implementation:
   float Evaluate(float v) const override {
@@ -596,10 +627,12 @@ class ColorTransformHLG_OETF : public ColorTransformPerChannelTransferFn {
   }
 };
 
-class ColorTransformPQFromLinear : public ColorTransformPerChannelTransferFn {
+class ColorTransformPQFromLinear
+    : public ColorTransformPerChannelTransferFnImpl<
+          ColorTransformPQFromLinear> {
  public:
   explicit ColorTransformPQFromLinear()
-      : ColorTransformPerChannelTransferFn(false) {}
+      : ColorTransformPerChannelTransferFnImpl(false) {}
 
   // ColorTransformPerChannelTransferFn implementation:
   float Evaluate(float v) const override {
@@ -628,10 +661,11 @@ class ColorTransformPQFromLinear : public ColorTransformPerChannelTransferFn {
 };
 
 // Applies the HLG inverse OETF formulation that maps [0, 1] to [0, 1].
-class ColorTransformHLG_InvOETF : public ColorTransformPerChannelTransferFn {
+class ColorTransformHLG_InvOETF
+    : public ColorTransformPerChannelTransferFnImpl<ColorTransformHLG_InvOETF> {
  public:
   explicit ColorTransformHLG_InvOETF()
-      : ColorTransformPerChannelTransferFn(false) {}
+      : ColorTransformPerChannelTransferFnImpl(false) {}
 
   // ColorTransformPerChannelTransferFn implementation:
   float Evaluate(float v) const override {
@@ -664,10 +698,11 @@ class ColorTransformHLG_InvOETF : public ColorTransformPerChannelTransferFn {
   }
 };
 
-class ColorTransformPQToLinear : public ColorTransformPerChannelTransferFn {
+class ColorTransformPQToLinear
+    : public ColorTransformPerChannelTransferFnImpl<ColorTransformPQToLinear> {
  public:
   explicit ColorTransformPQToLinear()
-      : ColorTransformPerChannelTransferFn(false) {}
+      : ColorTransformPerChannelTransferFnImpl(false) {}
 
   // ColorTransformPerChannelTransferFn implementation:
   float Evaluate(float v) const override {
@@ -705,11 +740,12 @@ class ColorTransformPQToLinear : public ColorTransformPerChannelTransferFn {
   }
 };
 
-class ColorTransformFromLinear : public ColorTransformPerChannelTransferFn {
+class ColorTransformFromLinear
+    : public ColorTransformPerChannelTransferFnImpl<ColorTransformFromLinear> {
  public:
   // ColorTransformStep implementation.
   explicit ColorTransformFromLinear(ColorSpace::TransferID transfer)
-      : ColorTransformPerChannelTransferFn(false), transfer_(transfer) {}
+      : ColorTransformPerChannelTransferFnImpl(false), transfer_(transfer) {}
   ColorTransformFromLinear* GetFromLinear() override { return this; }
   bool IsNull() override { return transfer_ == ColorSpace::TransferID::LINEAR; }
 
@@ -764,10 +800,11 @@ class ColorTransformFromLinear : public ColorTransformPerChannelTransferFn {
   ColorSpace::TransferID transfer_;
 };
 
-class ColorTransformToLinear : public ColorTransformPerChannelTransferFn {
+class ColorTransformToLinear
+    : public ColorTransformPerChannelTransferFnImpl<ColorTransformToLinear> {
  public:
   explicit ColorTransformToLinear(ColorSpace::TransferID transfer)
-      : ColorTransformPerChannelTransferFn(false), transfer_(transfer) {}
+      : ColorTransformPerChannelTransferFnImpl(false), transfer_(transfer) {}
   // ColorTransformStep implementation:
   bool Join(ColorTransformStep* next_untyped) override {
     ColorTransformFromLinear* next = next_untyped->GetFromLinear();
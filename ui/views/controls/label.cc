@@ -697,7 +697,16 @@ int Label::GetHeightForWidth(int w) const {
   if (!GetVisible() && collapse_when_hidden_)
     return 0;
 
-  w -= GetInsets().width();
+  const gfx::Insets insets = GetInsets();
+  w -= insets.width();
+
+  // Layout managers often ask for the same width more than once per pass, and
+  // in between other size queries reset |full_text_|'s display rect, which
+  // would make it re-shape the text for every call. Insets are applied outside
+  // the cache since border changes don't call PreferredSizeChanged().
+  if (cached_height_for_width_ && cached_height_for_width_->first == w)
+    return cached_height_for_width_->second + insets.height();
+
   int height = 0;
   int base_line_height = GetLineHeight();
   if (!GetMultiLine() || GetText().empty() || w < 0) {
@@ -722,7 +731,8 @@ int Label::GetHeightForWidth(int w) const {
                  : string_height;
   }
   height -= gfx::ShadowValue::GetMargin(full_text_->shadows()).height();
-  return height + GetInsets().height();
+  cached_height_for_width_ = std::make_pair(w, height);
+  return height + insets.height();
 }
 
 View* Label::GetTooltipHandlerForPoint(const gfx::Point& point) {
@@ -1036,6 +1046,11 @@ void Label::OnDeviceScaleFactorChanged(float old_device_scale_factor,
   PreferredSizeChanged();
 }
 
+void Label::PreferredSizeChanged() {
+  cached_height_for_width_.reset();
+  View::PreferredSizeChanged();
+}
+
 void Label::VisibilityChanged(View* starting_from, bool is_visible) {
   if (!is_visible)
     ClearDisplayText();
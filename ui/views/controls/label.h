@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "base/gtest_prod_util.h"
@@ -352,6 +353,7 @@ class VIEWS_EXPORT Label : public View,
 
   // View:
   void OnBoundsChanged(const gfx::Rect& previous_bounds) override;
+  void PreferredSizeChanged() override;
   void VisibilityChanged(View* starting_from, bool is_visible) override;
   void OnPaint(gfx::Canvas* canvas) override;
   void OnDeviceScaleFactorChanged(float old_device_scale_factor,
@@ -482,6 +484,11 @@ class VIEWS_EXPORT Label : public View,
   // An un-elided and single-line RenderText object used for preferred sizing.
   std::unique_ptr<gfx::RenderText> full_text_;
 
+  // The last (width, height) pair computed by GetHeightForWidth(), excluding
+  // insets. Cleared by PreferredSizeChanged(), which every change to the text
+  // or its styling triggers.
+  mutable std::optional<std::pair<int, int>> cached_height_for_width_;
+
   // The RenderText instance used for drawing.
   mutable std::unique_ptr<gfx::RenderText> display_text_;
 
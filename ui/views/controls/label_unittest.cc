@@ -600,6 +600,24 @@ TEST_F(LabelTest, MultiLineGetHeightForWidth) {
   EXPECT_EQ(line_height * 10, label()->GetHeightForWidth(0));
 }
 
+TEST_F(LabelTest, GetHeightForWidthTracksChangesAtSameWidth) {
+  label()->SetMultiLine(true);
+  label()->SetText(u"This is an example.");
+  const int width = label()->GetPreferredSize({}).width();
+  const int line_height = label()->GetLineHeight();
+  EXPECT_EQ(line_height, label()->GetHeightForWidth(width));
+
+  // Changing the text must not return the height computed for the old text.
+  label()->SetText(u"This is an example. This is an example.");
+  EXPECT_GT(label()->GetHeightForWidth(width), line_height);
+
+  // Insets are applied on top of the text height.
+  label()->SetText(u"This is an example.");
+  const int height = label()->GetHeightForWidth(width);
+  label()->SetBorder(CreateEmptyBorder(gfx::Insets::TLBR(5, 0, 7, 0)));
+  EXPECT_EQ(height + 12, label()->GetHeightForWidth(width));
+}
+
 TEST_F(LabelTest, TooltipProperty) {
   label()->SetText(u"My cool string.");
 
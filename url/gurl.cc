@@ -176,42 +176,54 @@ bool GURL::operator>(const GURL& other) const {
 
 // Note: code duplicated below (it's inconvenient to use a template here).
 GURL GURL::Resolve(std::string_view relative) const {
-  // Not allowed for invalid URLs.
-  if (!is_valid_)
-    return GURL();
+  return Resolver(*this).Resolve(relative);
+}
 
-  GURL result;
-  url::StdStringCanonOutput output(&result.spec_);
-  if (!url::ResolveRelative(spec_.data(), static_cast<int>(spec_.length()),
-                            parsed_, relative.data(),
-                            static_cast<int>(relative.length()),
-                            nullptr, &output, &result.parsed_)) {
-    // Error resolving, return an empty URL.
-    return GURL();
+GURL GURL::Resolve(std::u16string_view relative) const {
+  return Resolver(*this).Resolve(relative);
+}
+
+GURL::Resolver::Resolver(const GURL& base) : base_(base) {
+  if (base.is_valid_) {
+    base_properties_ = url::ComputeRelativeURLBase(
+        base.spec_.data(), static_cast<int>(base.spec_.length()), base.parsed_);
   }
+}
 
-  output.Complete();
-  result.is_valid_ = true;
-  if (result.SchemeIsFileSystem()) {
-    result.inner_url_ =
-        std::make_unique<GURL>(result.spec_.data(), result.parsed_.Length(),
-                               *result.parsed_.inner_parsed(), true);
+GURL::Resolver::~Resolver() = default;
+
+GURL GURL::Resolver::Resolve(std::string_view relative) const {
+  return ResolveImpl(relative);
+}
+
+GURL GURL::Resolver::Resolve(std::u16string_view relative) const {
+  return ResolveImpl(relative);
+}
+
+std::vector<GURL> GURL::Resolver::ResolveAll(
+    base::span<const std::string_view> relatives) const {
+  std::vector<GURL> results;
+  results.reserve(relatives.size());
+  for (std::string_view relative : relatives) {
+    results.push_back(ResolveImpl(relative));
   }
-  return result;
+  return results;
 }
 
-// Note: code duplicated above (it's inconvenient to use a template here).
-GURL GURL::Resolve(std::u16string_view relative) const {
+template <typename CharT>
+GURL GURL::Resolver::ResolveImpl(
+    std::basic_string_view<CharT> relative) const {
   // Not allowed for invalid URLs.
-  if (!is_valid_)
+  if (!base_->is_valid_)
     return GURL();
 
   GURL result;
   url::StdStringCanonOutput output(&result.spec_);
-  if (!url::ResolveRelative(spec_.data(), static_cast<int>(spec_.length()),
-                            parsed_, relative.data(),
-                            static_cast<int>(relative.length()),
-                            nullptr, &output, &result.parsed_)) {
+  if (!url::ResolveRelative(
+          base_->spec_.data(), static_cast<int>(base_->spec_.length()),
+          base_->parsed_, base_properties_, relative.data(),
+          static_cast<int>(relative.length()), nullptr, &output,
+          &result.parsed_)) {
     // Error resolving, return an empty URL.
     return GURL();
   }
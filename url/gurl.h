@@ -11,15 +11,19 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "base/debug/alias.h"
 #include "base/debug/crash_logging.h"
+#include "base/memory/raw_ref.h"
 #include "base/trace_event/base_tracing_forward.h"
 #include "url/third_party/mozilla/url_parse.h"
 #include "url/url_canon.h"
 #include "url/url_canon_stdstring.h"
 #include "url/url_constants.h"
+#include "url/url_util.h"
 
 // Represents a URL. GURL is Google's URL parsing library.
 //
@@ -159,6 +163,32 @@ class COMPONENT_EXPORT(URL) GURL {
   GURL Resolve(std::string_view relative) const;
   GURL Resolve(std::u16string_view relative) const;
 
+  // Resolves URLs against a fixed base like Resolve(), but derives what
+  // resolving needs from the base only once. Use it instead of calling
+  // Resolve() on the same GURL in a loop, e.g. for all the URLs in a document.
+  // `base` must outlive the Resolver.
+  class COMPONENT_EXPORT(URL) Resolver {
+   public:
+    explicit Resolver(const GURL& base);
+    Resolver(const Resolver&) = delete;
+    Resolver& operator=(const Resolver&) = delete;
+    ~Resolver();
+
+    GURL Resolve(std::string_view relative) const;
+    GURL Resolve(std::u16string_view relative) const;
+
+    // Resolves each of `relatives`, in order.
+    std::vector<GURL> ResolveAll(
+        base::span<const std::string_view> relatives) const;
+
+   private:
+    template <typename CharT>
+    GURL ResolveImpl(std::basic_string_view<CharT> relative) const;
+
+    const raw_ref<const GURL> base_;
+    url::RelativeURLBase base_properties_;
+  };
+
   // Creates a new GURL by replacing the current URL's components with the
   // supplied versions. See the Replacements class in url_canon.h for more.
   //
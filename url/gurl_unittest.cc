@@ -6,6 +6,8 @@
 
 #include <stddef.h>
 
+#include <vector>
+
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/test/scoped_feature_list.h"
@@ -372,6 +374,41 @@ TEST(GURLTest, Resolve) {
   }
 }
 
+TEST(GURLTest, Resolver) {
+  GURL base("http://www.google.com/blah/bloo?c#d");
+  GURL::Resolver resolver(base);
+  constexpr std::string_view kRelatives[] = {
+      "foo.html", "/bar", "../../../hello/./world.html?a#b", "#com",
+      "Https:images.google.com", "http://images.\tgoogle.\ncom/\rfoo.html"};
+
+  // The resolver gives the same results as resolving against the base one URL
+  // at a time.
+  std::vector<GURL> resolved = resolver.ResolveAll(kRelatives);
+  ASSERT_EQ(std::size(kRelatives), resolved.size());
+  for (size_t i = 0; i < std::size(kRelatives); i++) {
+    GURL expected = base.Resolve(kRelatives[i]);
+    EXPECT_TRUE(resolved[i].is_valid()) << i;
+    EXPECT_EQ(expected, resolved[i]) << i;
+    EXPECT_EQ(expected, resolver.Resolve(kRelatives[i])) << i;
+    EXPECT_EQ(expected, resolver.Resolve(base::UTF8ToUTF16(kRelatives[i])))
+        << i;
+  }
+
+  GURL filesystem_base("filesystem:http://www.google.com/type/");
+  GURL::Resolver filesystem_resolver(filesystem_base);
+  GURL filesystem_url = filesystem_resolver.Resolve("../foo.html");
+  EXPECT_EQ("filesystem:http://www.google.com/type/foo.html",
+            filesystem_url.spec());
+  ASSERT_TRUE(filesystem_url.inner_url());
+  EXPECT_EQ("http://www.google.com/type/", filesystem_url.inner_url()->spec());
+
+  // Resolving against an invalid base gives the empty URL.
+  GURL invalid_base("http:");
+  GURL::Resolver invalid_resolver(invalid_base);
+  EXPECT_TRUE(invalid_resolver.Resolve("foo.html").is_empty());
+  EXPECT_TRUE(invalid_resolver.ResolveAll(kRelatives)[0].is_empty());
+}
+
 class GURLTypedTest : public ::testing::TestWithParam<bool> {
  public:
   GURLTypedTest()
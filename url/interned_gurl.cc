@@ -0,0 +1,75 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "url/interned_gurl.h"
+
+#include <utility>
+
+#include "base/no_destructor.h"
+
+namespace url {
+
+InternedGURL::InternedGURL() = default;
+
+InternedGURL::InternedGURL(const InternedGURL&) = default;
+
+InternedGURL& InternedGURL::operator=(const InternedGURL&) = default;
+
+InternedGURL::InternedGURL(InternedGURL&&) = default;
+
+InternedGURL& InternedGURL::operator=(InternedGURL&&) = default;
+
+InternedGURL::~InternedGURL() = default;
+
+InternedGURL::InternedGURL(scoped_refptr<const SharedGURL> url)
+    : url_(std::move(url)) {}
+
+const GURL& InternedGURL::get() const {
+  if (url_) {
+    return url_->data;
+  }
+  static const base::NoDestructor<GURL> empty_gurl;
+  return *empty_gurl;
+}
+
+GURLInternTable::GURLInternTable() = default;
+
+GURLInternTable::~GURLInternTable() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+}
+
+InternedGURL GURLInternTable::Intern(const GURL& url) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (url.is_empty()) {
+    return InternedGURL();
+  }
+
+  auto it = urls_.find(std::string_view(url.possibly_invalid_spec()));
+  if (it != urls_.end()) {
+    return InternedGURL(it->second);
+  }
+
+  auto shared_url = base::MakeRefCounted<InternedGURL::SharedGURL>(url);
+  urls_.emplace(std::string_view(shared_url->data.possibly_invalid_spec()),
+                shared_url);
+  return InternedGURL(std::move(shared_url));
+}
+
+void GURLInternTable::Purge() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  for (auto it = urls_.begin(); it != urls_.end();) {
+    if (it->second->HasOneRef()) {
+      urls_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+size_t GURLInternTable::size() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return urls_.size();
+}
+
+}  // namespace url
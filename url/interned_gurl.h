@@ -0,0 +1,99 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef URL_INTERNED_GURL_H_
+#define URL_INTERNED_GURL_H_
+
+#include <stddef.h>
+
+#include <string_view>
+
+#include "base/component_export.h"
+#include "base/containers/flat_hash_map.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/sequence_checker.h"
+#include "url/gurl.h"
+
+namespace url {
+
+// A reference to an immutable GURL that is shared with every other
+// InternedGURL made from an equal URL by the same GURLInternTable. Copying one
+// doesn't copy the spec, and two InternedGURLs from the same table are equal
+// iff they point to the same GURL.
+//
+// This is meant for structures that keep many copies of the same URLs for a
+// long time, e.g. history or session entries, where the duplicate specs add up.
+// Don't use it for short-lived URLs: interning costs a hash lookup.
+//
+// InternedGURLs can be used and destroyed on any sequence.
+class COMPONENT_EXPORT(URL) InternedGURL {
+ public:
+  // Refers to the empty GURL.
+  InternedGURL();
+  InternedGURL(const InternedGURL&);
+  InternedGURL& operator=(const InternedGURL&);
+  InternedGURL(InternedGURL&&);
+  InternedGURL& operator=(InternedGURL&&);
+  ~InternedGURL();
+
+  const GURL& get() const;
+  const GURL& operator*() const { return get(); }
+  const GURL* operator->() const { return &get(); }
+
+  // Only meaningful for InternedGURLs from the same GURLInternTable. Compare
+  // the GURLs themselves otherwise.
+  friend bool operator==(const InternedGURL& a, const InternedGURL& b) {
+    return a.url_ == b.url_;
+  }
+  friend bool operator!=(const InternedGURL& a, const InternedGURL& b) {
+    return !(a == b);
+  }
+
+ private:
+  friend class GURLInternTable;
+
+  using SharedGURL = base::RefCountedData<GURL>;
+
+  explicit InternedGURL(scoped_refptr<const SharedGURL> url);
+
+  // Null for the empty GURL.
+  scoped_refptr<const SharedGURL> url_;
+};
+
+// Hands out InternedGURLs, so that equal URLs share one GURL. The table keeps
+// the URLs it has handed out until Purge() finds them unused, so owners should
+// call Purge() from time to time, e.g. after removing many entries.
+//
+// A table is used on one sequence. It is meant to be owned per profile or per
+// service rather than shared globally.
+class COMPONENT_EXPORT(URL) GURLInternTable {
+ public:
+  GURLInternTable();
+  GURLInternTable(const GURLInternTable&) = delete;
+  GURLInternTable& operator=(const GURLInternTable&) = delete;
+  ~GURLInternTable();
+
+  // Returns the InternedGURL for `url`, creating it if none of the URLs in the
+  // table is equal to `url`.
+  InternedGURL Intern(const GURL& url);
+
+  // Drops the URLs that aren't referred to by any InternedGURL anymore.
+  void Purge();
+
+  size_t size() const;
+
+ private:
+  SEQUENCE_CHECKER(sequence_checker_);
+
+  // Keyed by the spec of the value's GURL, which doesn't move while the value
+  // is alive.
+  base::FlatHashMap<std::string_view,
+                    scoped_refptr<const InternedGURL::SharedGURL>>
+      urls_ GUARDED_BY_CONTEXT(sequence_checker_);
+};
+
+}  // namespace url
+
+#endif  // URL_INTERNED_GURL_H_
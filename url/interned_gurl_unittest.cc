@@ -0,0 +1,69 @@
+// Copyright 2024 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "url/interned_gurl.h"
+
+#include <optional>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace url {
+
+TEST(InternedGURLTest, Default) {
+  InternedGURL url;
+  EXPECT_TRUE(url->is_empty());
+  EXPECT_EQ(GURL(), *url);
+  EXPECT_EQ(InternedGURL(), url);
+}
+
+TEST(InternedGURLTest, EqualURLsShareOneGURL) {
+  GURLInternTable table;
+  InternedGURL a = table.Intern(GURL("https://www.example.com/a"));
+  InternedGURL a2 = table.Intern(GURL("HTTPS://www.EXAMPLE.com/a"));
+  InternedGURL b = table.Intern(GURL("https://www.example.com/b"));
+
+  EXPECT_EQ("https://www.example.com/a", a->spec());
+  EXPECT_EQ(a, a2);
+  EXPECT_EQ(&*a, &*a2);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(2u, table.size());
+
+  // The empty URL isn't stored.
+  EXPECT_EQ(InternedGURL(), table.Intern(GURL()));
+  EXPECT_EQ(2u, table.size());
+
+  // Invalid URLs are interned by their spec too.
+  InternedGURL invalid = table.Intern(GURL("http:"));
+  EXPECT_FALSE(invalid->is_valid());
+  EXPECT_EQ(invalid, table.Intern(GURL("http:")));
+  EXPECT_EQ(3u, table.size());
+}
+
+TEST(InternedGURLTest, PurgeDropsUnusedURLs) {
+  GURLInternTable table;
+  InternedGURL kept = table.Intern(GURL("https://www.example.com/kept"));
+  std::optional<InternedGURL> dropped =
+      table.Intern(GURL("https://www.example.com/dropped"));
+  InternedGURL copy = *dropped;
+  EXPECT_EQ(2u, table.size());
+
+  // A copy still refers to the URL.
+  dropped.reset();
+  table.Purge();
+  EXPECT_EQ(2u, table.size());
+
+  copy = InternedGURL();
+  table.Purge();
+  EXPECT_EQ(1u, table.size());
+  EXPECT_EQ(kept, table.Intern(GURL("https://www.example.com/kept")));
+
+  // Interning the purged URL again gives a new GURL.
+  InternedGURL recreated =
+      table.Intern(GURL("https://www.example.com/dropped"));
+  EXPECT_EQ("https://www.example.com/dropped", recreated->spec());
+  EXPECT_EQ(2u, table.size());
+}
+
+}  // namespace url
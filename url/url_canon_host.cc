@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <type_traits>
+
 #include "base/check.h"
 #include "base/cpu_reduction_experiment.h"
 #include "url/url_canon.h"
@@ -180,6 +182,15 @@ bool IsForbiddenHostCodePoint(uint8_t ch) {
   return ch <= 0x7F && (kHostCharacterTable[ch] & kForbiddenHost);
 }
 
+// Returns true if DoSimpleHost() copies `ch` to the output unchanged, i.e. it
+// is an ASCII character that is valid in a host and already in canonical
+// (lower) case.
+template <typename CHAR>
+bool IsCanonicalHostChar(CHAR ch) {
+  auto uch = static_cast<std::make_unsigned_t<CHAR>>(ch);
+  return uch < 0x80 && kHostCharLookup[uch] == uch;
+}
+
 // RFC1034 maximum FQDN length.
 constexpr size_t kMaxHostLength = 253;
 
@@ -244,6 +255,21 @@ bool DoSimpleHost(const INCHAR* host,
 
   bool success = true;
   for (size_t i = 0; i < host_len; ++i) {
+    if constexpr (std::is_same_v<INCHAR, OUTCHAR>) {
+      // Most hosts are already canonical, so copy runs of characters that
+      // don't change in bulk instead of looking each one up and pushing it to
+      // the output separately.
+      size_t run_end = i;
+      while (run_end < host_len && IsCanonicalHostChar(host[run_end])) {
+        ++run_end;
+      }
+      if (run_end > i) {
+        output->Append(&host[i], run_end - i);
+        i = run_end - 1;
+        continue;
+      }
+    }
+
     unsigned int source = host[i];
     if (source == '%') {
       // Unescape first, if possible.
@@ -270,6 +270,17 @@ bool DoPartialPathInternal(const CHAR* spec,
           // This character should be escaped.
           AppendEscapedChar(out_ch, output);
         }
+      } else if constexpr (sizeof(CHAR) == 1) {
+        // Nothing special about this character. Most of a path usually isn't
+        // either, so append the whole run of such characters at once.
+        size_t run_end = i + 1;
+        while (run_end < end &&
+               kPathCharLookup[static_cast<unsigned char>(spec[run_end])] ==
+                   PASS) {
+          ++run_end;
+        }
+        output->Append(&spec[i], run_end - i);
+        i = run_end - 1;
       } else {
         // Nothing special about this character, just append it.
         output->push_back(out_ch);
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <string_view>
+#include <vector>
 
 #include "base/test/perf_time_logger.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -123,6 +124,62 @@ TEST(URLParse, TypicalURLParseCanonStdString) {
   canon_timer.Done();
 }
 
+// Hosts and paths typical of browsing history: mostly already canonical, with
+// some upper case hosts, escapes and dot segments.
+constexpr std::string_view kTypicalHosts[] = {
+    "www.google.com",
+    "mail.google.com",
+    "en.wikipedia.org",
+    "WWW.Example.COM",
+    "cdn-123.static.example-content.net",
+    "192.168.0.1",
+    "xn--bcher-kva.example",
+    "docs.chromium.org",
+};
+
+constexpr std::string_view kTypicalPaths[] = {
+    "/",
+    "/search",
+    "/wiki/Uniform_Resource_Locator",
+    "/mail/u/0/",
+    "/Stephen-King-Thrillers-Horror-People/dp/0766012336/ref=sr_1_2/",
+    "/1-800-MY-APPLE/WebObjects/AppleStore.woa/wa/RSLID",
+    "/assets/js/vendor.min.js",
+    "/docs/a%20b/../c/./index.html",
+};
+
+TEST(URLParse, TypicalHostCanon) {
+  url::RawCanonOutput<1024> output;
+  url::Component out_host;
+
+  base::PerfTimeLogger canon_timer("Typical_Host_Canon_AMillion");
+  for (int i = 0; i < 125000; i++) {  // divide by 8 so we get 1M
+    for (std::string_view host : kTypicalHosts) {
+      output.set_length(0);
+      url::CanonicalizeHost(host.data(),
+                            url::Component(0, static_cast<int>(host.size())),
+                            &output, &out_host);
+    }
+  }
+  canon_timer.Done();
+}
+
+TEST(URLParse, TypicalPathCanon) {
+  url::RawCanonOutput<1024> output;
+  url::Component out_path;
+
+  base::PerfTimeLogger canon_timer("Typical_Path_Canon_AMillion");
+  for (int i = 0; i < 125000; i++) {  // divide by 8 so we get 1M
+    for (std::string_view path : kTypicalPaths) {
+      output.set_length(0);
+      url::CanonicalizePath(path.data(),
+                            url::Component(0, static_cast<int>(path.size())),
+                            &output, &out_path);
+    }
+  }
+  canon_timer.Done();
+}
+
 TEST(URLParse, GURL) {
   base::PerfTimeLogger gurl_timer("Typical_GURL_AMillion");
   for (int i = 0; i < 333333; i++) {  // divide by 3 so we get 1M
@@ -133,4 +190,41 @@ TEST(URLParse, GURL) {
   gurl_timer.Done();
 }
 
+// Relative URLs as found in a typical document, all resolved against the same
+// base.
+constexpr std::string_view kTypicalBase =
+    "https://www.example.com/news/2024/06/article.html?ref=home";
+
+constexpr std::string_view kTypicalRelatives[] = {
+    "/static/css/main.css",
+    "/static/js/vendor.min.js",
+    "images/header.png",
+    "../../../about/",
+    "?page=2",
+    "#comments",
+    "//cdn.example.net/fonts/Roboto-Regular.woff2",
+    "https://www.example.org/partner/landing.html",
+};
+
+TEST(URLParse, TypicalGURLResolve) {
+  GURL base(kTypicalBase);
+  base::PerfTimeLogger resolve_timer("Typical_GURL_Resolve_AMillion");
+  for (int i = 0; i < 125000; i++) {  // divide by 8 so we get 1M
+    for (std::string_view relative : kTypicalRelatives) {
+      GURL resolved = base.Resolve(relative);
+    }
+  }
+  resolve_timer.Done();
+}
+
+TEST(URLParse, TypicalGURLResolver) {
+  GURL base(kTypicalBase);
+  GURL::Resolver resolver(base);
+  base::PerfTimeLogger resolve_timer("Typical_GURL_Resolver_AMillion");
+  for (int i = 0; i < 125000; i++) {  // divide by 8 so we get 1M
+    std::vector<GURL> resolved = resolver.ResolveAll(kTypicalRelatives);
+  }
+  resolve_timer.Done();
+}
+
 }  // namespace
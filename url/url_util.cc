@@ -310,10 +310,40 @@ bool DoCanonicalize(const CHAR* spec,
   return success;
 }
 
+RelativeURLBase DoComputeRelativeURLBase(const char* base_spec,
+                                         int base_spec_len,
+                                         const Parsed& base_parsed) {
+  RelativeURLBase base;
+  if (base_spec && base_parsed.scheme.is_nonempty()) {
+    int after_scheme = base_parsed.scheme.end() + 1;  // Skip past the colon.
+    int num_slashes = CountConsecutiveSlashes(base_spec, after_scheme,
+                                              base_spec_len);
+    base.is_authority_based = num_slashes > 1;
+    base.is_hierarchical = num_slashes > 0;
+  }
+
+  if (url::IsUsingStandardCompliantNonSpecialSchemeURLParsing()) {
+    base.is_hierarchical_by_scheme =
+        base_parsed.scheme.is_nonempty() && !base_parsed.has_opaque_path;
+  } else {
+    SchemeType unused_scheme_type = SCHEME_WITH_HOST_PORT_AND_USER_INFORMATION;
+    base.is_hierarchical_by_scheme =
+        base_parsed.scheme.is_nonempty() &&
+        DoIsStandard(base_spec, base_parsed.scheme, &unused_scheme_type);
+  }
+  base.is_hierarchical |= base.is_hierarchical_by_scheme;
+
+  base.is_file =
+      base_parsed.scheme.is_nonempty() &&
+      DoCompareSchemeComponent(base_spec, base_parsed.scheme, kFileScheme);
+  return base;
+}
+
 template<typename CHAR>
 bool DoResolveRelative(const char* base_spec,
                        int base_spec_len,
                        const Parsed& base_parsed,
+                       const RelativeURLBase& base,
                        const CHAR* in_relative,
                        int in_relative_length,
                        CharsetConverter* charset_converter,
@@ -327,34 +357,11 @@ bool DoResolveRelative(const char* base_spec,
       in_relative, in_relative_length, &whitespace_buffer, &relative_length,
       &output_parsed->potentially_dangling_markup);
 
-  bool base_is_authority_based = false;
-  bool base_is_hierarchical = false;
-  if (base_spec &&
-      base_parsed.scheme.is_nonempty()) {
-    int after_scheme = base_parsed.scheme.end() + 1;  // Skip past the colon.
-    int num_slashes = CountConsecutiveSlashes(base_spec, after_scheme,
-                                              base_spec_len);
-    base_is_authority_based = num_slashes > 1;
-    base_is_hierarchical = num_slashes > 0;
-  }
-
-  bool is_hierarchical_base;
-
-  if (url::IsUsingStandardCompliantNonSpecialSchemeURLParsing()) {
-    is_hierarchical_base =
-        base_parsed.scheme.is_nonempty() && !base_parsed.has_opaque_path;
-  } else {
-    SchemeType unused_scheme_type = SCHEME_WITH_HOST_PORT_AND_USER_INFORMATION;
-    is_hierarchical_base =
-        base_parsed.scheme.is_nonempty() &&
-        DoIsStandard(base_spec, base_parsed.scheme, &unused_scheme_type);
-  }
-
   bool is_relative;
   Component relative_component;
   if (!IsRelativeURL(base_spec, base_parsed, relative, relative_length,
-                     (base_is_hierarchical || is_hierarchical_base),
-                     &is_relative, &relative_component)) {
+                     base.is_hierarchical, &is_relative,
+                     &relative_component)) {
     // Error resolving.
     return false;
   }
@@ -365,7 +372,8 @@ bool DoResolveRelative(const char* base_spec,
   // Pretend for a moment that |base_spec| is a standard URL. Normally
   // non-standard URLs are treated as PathURLs, but if the base has an
   // authority we would like to preserve it.
-  if (is_relative && base_is_authority_based && !is_hierarchical_base) {
+  if (is_relative && base.is_authority_based &&
+      !base.is_hierarchical_by_scheme) {
     Parsed base_parsed_authority;
     ParseStandardURL(base_spec, base_spec_len, &base_parsed_authority);
     if (base_parsed_authority.host.is_nonempty()) {
@@ -384,11 +392,9 @@ bool DoResolveRelative(const char* base_spec,
     }
   } else if (is_relative) {
     // Relative, resolve and canonicalize.
-    bool file_base_scheme = base_parsed.scheme.is_nonempty() &&
-        DoCompareSchemeComponent(base_spec, base_parsed.scheme, kFileScheme);
-    return ResolveRelativeURL(base_spec, base_parsed, file_base_scheme,
-                              relative, relative_component, charset_converter,
-                              output, output_parsed);
+    return ResolveRelativeURL(base_spec, base_parsed, base.is_file, relative,
+                              relative_component, charset_converter, output,
+                              output_parsed);
   }
 
   // Not relative, canonicalize the input.
@@ -820,22 +826,58 @@ bool ResolveRelative(const char* base_spec,
                      CharsetConverter* charset_converter,
                      CanonOutput* output,
                      Parsed* output_parsed) {
-  return DoResolveRelative(base_spec, base_spec_len, base_parsed,
-                           relative, relative_length,
-                           charset_converter, output, output_parsed);
+  return DoResolveRelative(
+      base_spec, base_spec_len, base_parsed,
+      DoComputeRelativeURLBase(base_spec, base_spec_len, base_parsed),
+      relative, relative_length, charset_converter, output, output_parsed);
+}
+
+bool ResolveRelative(const char* base_spec,
+                     int base_spec_len,
+                     const Parsed& base_parsed,
+                     const char16_t* relative,
+                     int relative_length,
+                     CharsetConverter* charset_converter,
+                     CanonOutput* output,
+                     Parsed* output_parsed) {
+  return DoResolveRelative(
+      base_spec, base_spec_len, base_parsed,
+      DoComputeRelativeURLBase(base_spec, base_spec_len, base_parsed),
+      relative, relative_length, charset_converter, output, output_parsed);
+}
+
+RelativeURLBase ComputeRelativeURLBase(const char* base_spec,
+                                       int base_spec_len,
+                                       const Parsed& base_parsed) {
+  return DoComputeRelativeURLBase(base_spec, base_spec_len, base_parsed);
+}
+
+bool ResolveRelative(const char* base_spec,
+                     int base_spec_len,
+                     const Parsed& base_parsed,
+                     const RelativeURLBase& base,
+                     const char* relative,
+                     int relative_length,
+                     CharsetConverter* charset_converter,
+                     CanonOutput* output,
+                     Parsed* output_parsed) {
+  return DoResolveRelative(base_spec, base_spec_len, base_parsed, base,
+                           relative, relative_length, charset_converter, output,
+                           output_parsed);
 }
 
 bool ResolveRelative(const char* base_spec,
                      int base_spec_len,
                      const Parsed& base_parsed,
+                     const RelativeURLBase& base,
                      const char16_t* relative,
                      int relative_length,
                      CharsetConverter* charset_converter,
                      CanonOutput* output,
                      Parsed* output_parsed) {
-  return DoResolveRelative(base_spec, base_spec_len, base_parsed,
-                           relative, relative_length,
-                           charset_converter, output, output_parsed);
+  return DoResolveRelative(base_spec, base_spec_len, base_parsed, base,
+                           relative, relative_length, charset_converter, output,
+                           output_parsed);
 }
 
 bool ReplaceComponents(const char* spec,
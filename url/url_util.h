@@ -268,6 +268,50 @@ bool ResolveRelative(const char* base_spec,
                      CanonOutput* output,
                      Parsed* output_parsed);
 
+// The properties of a base URL that ResolveRelative() derives from it on every
+// call. When resolving many URLs against the same base, compute them once with
+// ComputeRelativeURLBase() and pass them to the ResolveRelative() overloads
+// below instead.
+struct RelativeURLBase {
+  // The base has a "//" after its scheme.
+  bool is_authority_based = false;
+  // The base has a "/" after its scheme, or is hierarchical by its scheme.
+  bool is_hierarchical = false;
+  // The base is hierarchical by its scheme: it is a standard URL, or a
+  // non-special URL without an opaque path.
+  bool is_hierarchical_by_scheme = false;
+  // The base is a file: URL.
+  bool is_file = false;
+};
+
+COMPONENT_EXPORT(URL)
+RelativeURLBase ComputeRelativeURLBase(const char* base_spec,
+                                       int base_spec_len,
+                                       const Parsed& base_parsed);
+
+// Same as above, but with the base properties already computed by
+// ComputeRelativeURLBase() for `base_spec` and `base_parsed`.
+COMPONENT_EXPORT(URL)
+bool ResolveRelative(const char* base_spec,
+                     int base_spec_len,
+                     const Parsed& base_parsed,
+                     const RelativeURLBase& base,
+                     const char* relative,
+                     int relative_length,
+                     CharsetConverter* charset_converter,
+                     CanonOutput* output,
+                     Parsed* output_parsed);
+COMPONENT_EXPORT(URL)
+bool ResolveRelative(const char* base_spec,
+                     int base_spec_len,
+                     const Parsed& base_parsed,
+                     const RelativeURLBase& base,
+                     const char16_t* relative,
+                     int relative_length,
+                     CharsetConverter* charset_converter,
+                     CanonOutput* output,
+                     Parsed* output_parsed);
+
 // Replaces components in the given VALID input URL. The new canonical URL info
 // is written to output and out_parsed.
 //